@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include "AnimatorState.h"
+#include "../Animavision/VirtualFileSystem.h"
 
 
 void core::AnimatorController::Save(const std::string& filePath, AnimatorController& controller)
@@ -15,10 +16,14 @@ void core::AnimatorController::Save(const std::string& filePath, AnimatorControl
 
 core::AnimatorController core::AnimatorController::Load(const std::string& filePath)
 {
-	std::ifstream is(filePath);
-	cereal::JSONInputArchive archive(is);
-
 	AnimatorController controller;
+
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(filePath, data))
+		return controller;
+
+	MemoryStream is(data);
+	cereal::JSONInputArchive archive(is);
 	archive(controller);
 
 
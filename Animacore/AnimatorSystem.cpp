@@ -4,7 +4,9 @@
 #include "Scene.h"
 #include "CoreComponents.h"
 #include "RenderComponents.h"
+#include "AssetResolver.h"
 #include "CoreSystemEvents.h"
+#include "FramePacket.h"
 
 #include "AnimatorState.h"
 
@@ -12,6 +14,7 @@
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/AnimationHelper.h"
+#include "../Animavision/VirtualFileSystem.h"
 
 #include "MetaCtxs.h"
 
@@ -99,12 +102,18 @@ bool core::AnimatorSystem::processTransition(core::Animator& animator, core::Ani
 	return false;
 }
 
+void core::AnimatorSystem::Extract(Scene& scene, Renderer& renderer, FramePacket& packet)
+{
+	(*this)(scene, renderer, packet.tick);
+}
+
 void core::AnimatorSystem::operator()(Scene& scene, Renderer& renderer, float tick)
 {
 	if(!scene.IsPlaying())
 		return;
 
 	auto&& registry = scene.GetRegistry();
+	auto events = scene.GetEventBus();
 	auto view = registry->view<Animator>();
 
 	auto meta = entt::resolve<global::CallBackFuncDummy>(global::callbackEventMetaCtx);
@@ -247,8 +256,10 @@ void core::AnimatorSystem::operator()(Scene& scene, Renderer& renderer, float ti
 						(*animator._currentNodeClips)[i].first->position = (translation * (1.0f - blendFactor) + nextTranslation * blendFactor);
 						(*animator._currentNodeClips)[i].first->rotation = (blendRotation);
 						(*animator._currentNodeClips)[i].first->scale = (scale * (1.0f - blendFactor) + nextScale * blendFactor);
-						registry->patch<LocalTransform>(entity);
 					}
+
+					// 본마다 patch 콜백을 부르지 않고 애니메이터당 한 번만 알림 (동기화 지점에서 일괄 처리)
+					events->Push<OnUpdateLocalTransform>(entity, registry);
 				}
 			}
 			else
@@ -289,8 +300,9 @@ void core::AnimatorSystem::operator()(Scene& scene, Renderer& renderer, float ti
 				(*animator._currentNodeClips)[i].first->position = translation;
 				(*animator._currentNodeClips)[i].first->rotation = rotation;
 				(*animator._currentNodeClips)[i].first->scale = scale;
-				registry->patch<LocalTransform>(entity);
 			}
+
+			events->Push<OnUpdateLocalTransform>(entity, registry);
 		}
 	}
 }
@@ -324,7 +336,8 @@ void core::AnimatorSystem::initEntity(core::Entity entity, Scene& scene, Rendere
 
 	auto& animator = entity.Get<Animator>();
 
-	AnimatorController* controller = controllerManager.GetController(animator.animatorFileName);
+	// 지연 로딩이라 씬 의존성 목록에 없던 컨트롤러는 여기서 읽음
+	AnimatorController* controller = animator.animatorFileName.empty() ? nullptr : controllerManager.GetController(animator.animatorFileName, &renderer);
 
 	if (controller)
 	{
@@ -365,8 +378,7 @@ void core::AnimatorSystem::initEntity(core::Entity entity, Scene& scene, Rendere
 
 	for (auto& meshRenderer : animator._meshRenderers)
 	{
-		if (!meshRenderer->mesh)
-			meshRenderer->mesh = renderer.GetMesh(meshRenderer->meshString);
+		AssetResolver::ResolveMesh(renderer, *meshRenderer);
 
 		if (meshRenderer->isSkinned && meshRenderer->mesh)
 		{
@@ -446,21 +458,12 @@ void core::AnimatorSystem::initEntity(core::Entity entity, Scene& scene, Rendere
 
 void core::ControllerManager::LoadControllersFromDrive(const std::string& path, Renderer* renderer)
 {
-	std::filesystem::path controllerPath = path;
-
-	if (!std::filesystem::exists(controllerPath))
+	// 팩 + 디스크
+	for (const auto& file : VirtualFileSystem::List(path))
 	{
-		return;
-	}
-
-	for (const auto& entry : std::filesystem::recursive_directory_iterator(controllerPath))
-	{
-		if (entry.is_regular_file())
+		if (std::filesystem::path(file).extension() == ".controller")
 		{
-			if (entry.path().extension() == ".controller")
-			{
-				LoadController(entry.path().string(), renderer);
-			}
+			LoadController(file, renderer);
 		}
 	}
 
@@ -482,12 +485,7 @@ core::AnimatorController* core::ControllerManager::LoadController(const std::str
 	// 없으면 로드하자.
 	std::filesystem::path controllerPath = pathStr;
 
-	if (!std::filesystem::exists(controllerPath))
-	{
-		return nullptr;
-	}
-
-	if (controllerPath.extension() != ".controller")
+	if (controllerPath.extension() != ".controller" || !VirtualFileSystem::Exists(controllerPath))
 	{
 		return nullptr;
 	}
@@ -504,6 +502,9 @@ core::AnimatorController* core::ControllerManager::LoadController(const std::str
 		{
 			continue;
 		}
+
+		// 지연 로딩 중이면 클립이 들어있는 fbx 를 읽음 (전부 읽어 둔 경우는 바로 true)
+		renderer->LoadAsset(AssetType::AnimationClip, state.motionName);
 		state.motion = renderer->GetAnimationClip(state.motionName);
 	}
 
@@ -26,7 +26,7 @@ namespace core
 		std::unordered_map<std::string, AnimatorController> _controllers;
 	};
 
-	class AnimatorSystem : public ISystem, public IRenderSystem
+	class AnimatorSystem : public ISystem, public IRenderSystem, public IFramePacketSystem
 	{
 	public:
 		AnimatorSystem(Scene& scene);
@@ -35,6 +35,10 @@ namespace core
 
 		void operator()(Scene& scene, Renderer& renderer, float tick) override;
 
+		// 포즈 계산은 메인 스레드에서 끝나고 본 행렬은 RenderSystem 이 bonePalettes 로 복사하므로 제출할 것이 없음
+		void Extract(Scene& scene, Renderer& renderer, FramePacket& packet) override;
+		void Submit(const FramePacket& packet, Renderer& renderer) override {}
+
 		inline static ControllerManager controllerManager;
 	private:
 		void createEntity(const OnCreateEntity& event);
@@ -0,0 +1,227 @@
+﻿#include "pch.h"
+#include "AssetLoader.h"
+
+#include "SceneManifest.h"
+#include "AnimatorSystem.h"
+#include "Profiler.h"
+
+#include "../Animavision/Renderer.h"
+
+#include <chrono>
+
+namespace
+{
+	// PreRenderSystem, PostRenderSystem 등이 직접 이름으로 찾는 에셋
+	constexpr const char* ENGINE_MESHES[] = { "Cube", "Sphere" };
+	constexpr const char* ENGINE_MATERIALS[] = { "./Resources/Materials/DefaultSky.material" };
+}
+
+core::AssetLoader& core::AssetLoader::Get()
+{
+	static AssetLoader loader;
+	return loader;
+}
+
+void core::AssetLoader::LoadEngineAssets(Renderer& renderer)
+{
+	PROFILE_FUNCTION();
+
+	for (const char* name : ENGINE_MESHES)
+		loadAsset(renderer, AssetType::Mesh, name);
+
+	for (const char* name : ENGINE_MATERIALS)
+		loadAsset(renderer, AssetType::Material, name);
+}
+
+uint32_t core::AssetLoader::Load(const SceneManifest& manifest, Renderer& renderer)
+{
+	PROFILE_FUNCTION();
+
+	uint32_t count = 0;
+
+	auto load = [&](AssetType type, const std::vector<std::string>& names)
+		{
+			for (const auto& name : names)
+				count += loadAsset(renderer, type, name);
+		};
+
+	load(AssetType::Mesh, manifest.meshes);
+	load(AssetType::Material, manifest.materials);
+	load(AssetType::UITexture, manifest.uiTextures);
+	load(AssetType::ParticleTexture, manifest.particleTextures);
+
+	for (const auto& path : manifest.controllers)
+		count += loadController(renderer, path);
+
+	return count;
+}
+
+void core::AssetLoader::Prefetch(const SceneManifest& manifest)
+{
+	std::lock_guard lock(_mutex);
+
+	auto enqueueAll = [this](AssetType type, const std::vector<std::string>& names)
+		{
+			for (const auto& name : names)
+				enqueue(type, name);
+		};
+
+	enqueueAll(AssetType::Mesh, manifest.meshes);
+	enqueueAll(AssetType::Material, manifest.materials);
+	enqueueAll(AssetType::UITexture, manifest.uiTextures);
+	enqueueAll(AssetType::ParticleTexture, manifest.particleTextures);
+
+	for (const auto& path : manifest.controllers)
+		enqueueController(path);
+}
+
+void core::AssetLoader::Request(AssetType type, const std::string& name)
+{
+	if (name.empty())
+		return;
+
+	std::lock_guard lock(_mutex);
+	enqueue(type, name);
+}
+
+void core::AssetLoader::RequestController(const std::string& path)
+{
+	if (path.empty())
+		return;
+
+	std::lock_guard lock(_mutex);
+	enqueueController(path);
+}
+
+bool core::AssetLoader::Pump(Renderer& renderer, float budgetMs)
+{
+	if (IsIdle())
+		return true;
+
+	PROFILE_FUNCTION();
+
+	const auto start = std::chrono::steady_clock::now();
+
+	while (true)
+	{
+		std::pair<AssetType, std::string> asset;
+		std::string controller;
+		bool isController = false;
+
+		{
+			std::lock_guard lock(_mutex);
+
+			if (!_queue.empty())
+			{
+				asset = std::move(_queue.front());
+				_queue.pop_front();
+			}
+			else if (!_controllerQueue.empty())
+			{
+				controller = std::move(_controllerQueue.front());
+				_controllerQueue.pop_front();
+				isController = true;
+			}
+			else
+			{
+				_queuedCount = 0;
+				_doneCount = 0;
+				return true;
+			}
+		}
+
+		if (isController)
+			loadController(renderer, controller);
+		else
+			loadAsset(renderer, asset.first, asset.second);
+
+		{
+			std::lock_guard lock(_mutex);
+			++_doneCount;
+		}
+
+		const float elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (elapsed >= budgetMs)
+			return IsIdle();
+	}
+}
+
+bool core::AssetLoader::IsIdle() const
+{
+	std::lock_guard lock(_mutex);
+	return _queue.empty() && _controllerQueue.empty();
+}
+
+float core::AssetLoader::GetProgress() const
+{
+	std::lock_guard lock(_mutex);
+
+	if (_queuedCount == 0)
+		return 1.0f;
+
+	return static_cast<float>(_doneCount) / static_cast<float>(_queuedCount);
+}
+
+bool core::AssetLoader::enqueue(AssetType type, const std::string& name)
+{
+	if (name.empty() || !_requested[static_cast<size_t>(type)].insert(name).second)
+		return false;
+
+	_queue.emplace_back(type, name);
+	++_queuedCount;
+
+	return true;
+}
+
+bool core::AssetLoader::enqueueController(const std::string& path)
+{
+	if (path.empty() || !_requestedControllers.insert(path).second)
+		return false;
+
+	_controllerQueue.push_back(path);
+	++_queuedCount;
+
+	return true;
+}
+
+bool core::AssetLoader::loadAsset(Renderer& renderer, AssetType type, const std::string& name)
+{
+	if (name.empty())
+		return false;
+
+	{
+		// 큐에 남아 있는 같은 요청은 처리할 때 이미 있는 것으로 끝남
+		std::lock_guard lock(_mutex);
+		_requested[static_cast<size_t>(type)].insert(name);
+	}
+
+	const bool isLoaded = renderer.LoadAsset(type, name);
+
+	if (isLoaded)
+		_loadedCount.fetch_add(1, std::memory_order_relaxed);
+	else
+		_missingCount.fetch_add(1, std::memory_order_relaxed);
+
+	return isLoaded;
+}
+
+bool core::AssetLoader::loadController(Renderer& renderer, const std::string& path)
+{
+	if (path.empty())
+		return false;
+
+	{
+		std::lock_guard lock(_mutex);
+		_requestedControllers.insert(path);
+	}
+
+	// 상태의 모션 클립도 LoadController 에서 LoadAsset 으로 읽음
+	const bool isLoaded = AnimatorSystem::controllerManager.GetController(path, &renderer) != nullptr;
+
+	if (isLoaded)
+		_loadedCount.fetch_add(1, std::memory_order_relaxed);
+	else
+		_missingCount.fetch_add(1, std::memory_order_relaxed);
+
+	return isLoaded;
+}
@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include <deque>
+#include <atomic>
+
+#include "../Animavision/AssetHandle.h"
+
+class Renderer;
+
+namespace core
+{
+	struct SceneManifest;
+
+	/// \brief
+	/// \n 씬이 참조하는 에셋만 읽는 로더 (에셋 디렉터리는 Renderer::IndexAssetsFromDrive 로 색인만 해 둠)
+	///	\n Load : 바로 전부 읽음 (첫 씬), Prefetch / Request : 큐에 넣고 Pump 에서 시간 예산만큼 읽음
+	///	\n 렌더러 라이브러리에 쓰므로 Load, Pump 는 메인 스레드에서 렌더 스레드와 씬 로더 워커가 쉬는 동안만 호출
+	///	\n Request 는 아무 스레드에서나 호출 가능 (AssetResolver 가 찾지 못한 이름을 요청), 한 번 요청한 이름은 다시 넣지 않음
+	class AssetLoader
+	{
+	public:
+		static AssetLoader& Get();
+
+		AssetLoader(const AssetLoader&) = delete;
+		AssetLoader& operator=(const AssetLoader&) = delete;
+
+		// 렌더 시스템이 씬과 관계없이 이름으로 찾는 에셋
+		void LoadEngineAssets(Renderer& renderer);
+
+		// 읽은(이미 있던 것 포함) 에셋 수
+		uint32_t Load(const SceneManifest& manifest, Renderer& renderer);
+
+		void Prefetch(const SceneManifest& manifest);
+		void Request(AssetType type, const std::string& name);
+		void RequestController(const std::string& path);
+
+		// budgetMs 동안 큐를 처리 (적어도 하나), 큐가 비었으면 true
+		bool Pump(Renderer& renderer, float budgetMs);
+
+		bool IsIdle() const;
+
+		// 큐가 비어 있던 때부터 넣은 것 중 처리한 비율 (0 ~ 1)
+		float GetProgress() const;
+
+		uint32_t GetLoadedCount() const { return _loadedCount.load(std::memory_order_relaxed); }
+		uint32_t GetMissingCount() const { return _missingCount.load(std::memory_order_relaxed); }
+
+	private:
+		static constexpr size_t TYPE_COUNT = static_cast<size_t>(AssetType::ParticleTexture) + 1;
+
+		AssetLoader() = default;
+
+		// 큐에 넣었으면 true (_mutex 잠근 상태)
+		bool enqueue(AssetType type, const std::string& name);
+		bool enqueueController(const std::string& path);
+
+		bool loadAsset(Renderer& renderer, AssetType type, const std::string& name);
+		bool loadController(Renderer& renderer, const std::string& path);
+
+		mutable std::mutex _mutex;
+		std::deque<std::pair<AssetType, std::string>> _queue;
+		std::deque<std::string> _controllerQueue;			// 클립을 읽어야 하므로 에셋 다음에 처리
+
+		std::array<robin_hood::unordered_set<std::string>, TYPE_COUNT> _requested;
+		robin_hood::unordered_set<std::string> _requestedControllers;
+
+		uint32_t _queuedCount = 0;
+		uint32_t _doneCount = 0;
+
+		std::atomic<uint32_t> _loadedCount = 0;
+		std::atomic<uint32_t> _missingCount = 0;
+	};
+}
@@ -0,0 +1,136 @@
+﻿#include "pch.h"
+#include "AssetResolver.h"
+
+#include "AssetLoader.h"
+#include "RenderComponents.h"
+
+#include "../Animavision/Renderer.h"
+
+namespace
+{
+	// asset 이 name 의 최신 에셋이면 해시 없이 바로 끝남
+	// 아직 읽지 않은 에셋은 AssetLoader 에 요청 (다음 Pump 에서 읽히면 generation 이 바뀌어 다시 가져옴)
+	template <typename T>
+	bool resolve(AssetRegistry<T>& registry, AssetType type, const std::string& name, AssetHandle& handle, std::shared_ptr<T>& asset)
+	{
+		if (asset != nullptr && registry.IsCurrent(handle))
+			return true;
+
+		// 이름이 그대로면 같은 자리에서 다시 가져오고, 바뀌었을 때만 해시
+		if (registry.GetName(handle) != name)
+			handle = registry.Intern(name);
+		else
+			handle = registry.Refresh(handle);
+
+		asset = registry.Get(handle);
+
+		if (asset == nullptr)
+			core::AssetLoader::Get().Request(type, name);
+
+		return asset != nullptr;
+	}
+}
+
+bool core::AssetResolver::ResolveMesh(Renderer& renderer, MeshRenderer& meshRenderer)
+{
+	auto* registry = renderer.GetMeshRegistry();
+	if (registry == nullptr)
+	{
+		if (meshRenderer.mesh == nullptr)
+			meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
+
+		return meshRenderer.mesh != nullptr;
+	}
+
+	return resolve(*registry, AssetType::Mesh, meshRenderer.meshString, meshRenderer.meshHandle, meshRenderer.mesh);
+}
+
+bool core::AssetResolver::ResolveMaterials(Renderer& renderer, MeshRenderer& meshRenderer)
+{
+	auto& materials = meshRenderer.materials;
+	auto& handles = meshRenderer.materialHandles;
+	const auto& names = meshRenderer.materialStrings;
+
+	auto* registry = renderer.GetMaterialRegistry();
+	if (registry == nullptr)
+	{
+		if (materials.empty())
+		{
+			for (auto&& materialString : names)
+				materials.push_back(renderer.GetMaterial(materialString));
+		}
+
+		return !materials.empty();
+	}
+
+	// 비워졌거나 개수가 다르면 이름이 바뀐 것 : 전부 다시 해시
+	if (materials.size() != names.size() || handles.size() != names.size())
+	{
+		materials.clear();
+		handles.clear();
+		materials.reserve(names.size());
+		handles.reserve(names.size());
+
+		for (auto&& materialString : names)
+		{
+			handles.push_back(registry->Intern(materialString));
+			materials.push_back(registry->Get(handles.back()));
+
+			if (materials.back() == nullptr)
+				AssetLoader::Get().Request(AssetType::Material, materialString);
+		}
+
+		return !materials.empty();
+	}
+
+	for (size_t i = 0; i < materials.size(); ++i)
+	{
+		if (registry->IsCurrent(handles[i]))
+			continue;
+
+		// 다시 로드된 머티리얼
+		std::shared_ptr<Material> material;
+		resolve(*registry, AssetType::Material, names[i], handles[i], material);
+		materials[i] = std::move(material);
+	}
+
+	return !materials.empty();
+}
+
+bool core::AssetResolver::ResolveMaterial(Renderer& renderer, Decal& decal)
+{
+	auto* registry = renderer.GetMaterialRegistry();
+	if (registry == nullptr)
+	{
+		if (decal.material == nullptr && !decal.materialString.empty())
+			decal.material = renderer.GetMaterial(decal.materialString);
+
+		return decal.material != nullptr;
+	}
+
+	return resolve(*registry, AssetType::Material, decal.materialString, decal.materialHandle, decal.material);
+}
+
+bool core::AssetResolver::ResolveUITexture(Renderer& renderer, UICommon& common)
+{
+	auto* registry = renderer.GetUITextureRegistry();
+	if (registry == nullptr)
+	{
+		auto texture = renderer.GetUITexture(common.textureString);
+		if (texture == common.texture)
+			return false;
+
+		common.texture = std::move(texture);
+		return true;
+	}
+
+	// UI 는 이름만 바꾸는 코드가 많아 이름도 비교 (해시 없이 문자열 비교만)
+	if (common.texture != nullptr && registry->IsCurrent(common.textureHandle) && registry->GetName(common.textureHandle) == common.textureString)
+		return false;
+
+	auto previous = common.texture;
+	common.texture = nullptr;
+	resolve(*registry, AssetType::UITexture, common.textureString, common.textureHandle, common.texture);
+
+	return common.texture != previous;
+}
@@ -0,0 +1,29 @@
+﻿#pragma once
+
+class Renderer;
+
+namespace core
+{
+	struct MeshRenderer;
+	struct UICommon;
+	struct Decal;
+
+	/// \brief
+	/// \n 컴포넌트의 에셋 이름을 렌더러 레지스트리 핸들(AssetHandle) 로 바꿔 포인터를 채움
+	///	\n 이름은 바뀌었을 때만 해시하고 평소에는 핸들 generation 비교만 하므로 매 프레임 불러도 됨
+	///	\n 같은 이름의 에셋이 다시 로드되면 generation 이 바뀌어 새 포인터로 교체
+	///	\n 이름을 바꾼 쪽은 지금처럼 mesh / materials / material 을 비우면 다음 호출에서 새 이름으로 찾음 (UI 텍스처는 이름만 바꿔도 됨)
+	struct AssetResolver
+	{
+		// mesh 가 준비되면 true
+		static bool ResolveMesh(Renderer& renderer, MeshRenderer& meshRenderer);
+
+		// materials 가 materialStrings 와 같은 개수로 채워지면 true (찾지 못한 머티리얼은 nullptr)
+		static bool ResolveMaterials(Renderer& renderer, MeshRenderer& meshRenderer);
+
+		static bool ResolveMaterial(Renderer& renderer, Decal& decal);
+
+		// textureString 이 바뀌었거나 텍스처가 다시 로드됐으면 texture 를 바꾸고 true
+		static bool ResolveUITexture(Renderer& renderer, UICommon& common);
+	};
+}
@@ -0,0 +1,745 @@
+﻿#include "pch.h"
+#include "BenchmarkRunner.h"
+
+#include "Scene.h"
+#include "InputSystem.h"
+#include "AnimatorSystem.h"
+#include "FrameAllocator.h"
+#include "CoreComponents.h"
+#include "CoreSystemEvents.h"
+#include "PathFindingSystem.h"
+#include "JobSystem.h"
+
+#include "../Animavision/Renderer.h"
+#include "../Animavision/NullRenderer.h"
+
+#include <chrono>
+#include <random>
+#include <numeric>
+#include <fstream>
+
+namespace
+{
+	constexpr uint32_t HEADLESS_WIDTH = 1920;
+	constexpr uint32_t HEADLESS_HEIGHT = 1080;
+
+	// 군중 측정 : 기본 규모, 추가 에이전트를 흩뿌릴 범위, 목적지를 다시 지정하는 주기
+	constexpr std::array<uint32_t, 3> DEFAULT_CROWD_AGENTS = { 64, 256, 1024 };
+	constexpr float CROWD_SPREAD = 8.f;
+	constexpr uint32_t CROWD_RETARGET_FRAMES = 120;
+
+	constexpr uint32_t DEFAULT_ITERATION_ENTITIES = 100000;
+
+	struct Percentiles
+	{
+		float mean = 0.f;
+		float p50 = 0.f;
+		float p90 = 0.f;
+		float p99 = 0.f;
+		float max = 0.f;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(mean), CEREAL_NVP(p50), CEREAL_NVP(p90), CEREAL_NVP(p99), CEREAL_NVP(max));
+		}
+	};
+
+	struct SystemReport
+	{
+		std::string name;
+		std::string phase;
+		Percentiles milliseconds;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(name), CEREAL_NVP(phase), CEREAL_NVP(milliseconds));
+		}
+	};
+
+	struct AllocationReport
+	{
+		bool tracked = false;
+		uint64_t total = 0;
+		uint64_t bytes = 0;
+		Percentiles perFrame;
+		Percentiles frameArenaBytes;	// 프레임 아레나 사용량 (힙 할당 대신 쓴 임시 메모리)
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(tracked), CEREAL_NVP(total), CEREAL_NVP(bytes), CEREAL_NVP(perFrame), CEREAL_NVP(frameArenaBytes));
+		}
+	};
+
+	// 렌더 단계 시간과 NullRenderer 기록 통계 (프레임당)
+	struct RenderReport
+	{
+		Percentiles milliseconds;
+		Percentiles commands;
+		Percentiles draws;
+		Percentiles dispatches;
+		Percentiles stateChanges;
+		Percentiles redundantStateChanges;
+		Percentiles renderTargetChanges;
+		Percentiles shaderChanges;
+		Percentiles constantWrites;
+		Percentiles constantBytes;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(milliseconds), CEREAL_NVP(commands), CEREAL_NVP(draws), CEREAL_NVP(dispatches),
+				CEREAL_NVP(stateChanges), CEREAL_NVP(redundantStateChanges), CEREAL_NVP(renderTargetChanges),
+				CEREAL_NVP(shaderChanges), CEREAL_NVP(constantWrites), CEREAL_NVP(constantBytes));
+		}
+	};
+
+	struct RenderSamples
+	{
+		std::vector<float> milliseconds;
+		std::vector<float> commands;
+		std::vector<float> draws;
+		std::vector<float> dispatches;
+		std::vector<float> stateChanges;
+		std::vector<float> redundantStateChanges;
+		std::vector<float> renderTargetChanges;
+		std::vector<float> shaderChanges;
+		std::vector<float> constantWrites;
+		std::vector<float> constantBytes;
+
+		void Add(float elapsed, const NullRenderer& renderer)
+		{
+			const RenderStats& stats = renderer.GetStats();
+
+			milliseconds.push_back(elapsed);
+			commands.push_back(static_cast<float>(renderer.GetCommands().size()));
+			draws.push_back(static_cast<float>(stats.draws));
+			dispatches.push_back(static_cast<float>(stats.dispatches));
+			stateChanges.push_back(static_cast<float>(stats.stateChanges));
+			redundantStateChanges.push_back(static_cast<float>(stats.redundantStateChanges));
+			renderTargetChanges.push_back(static_cast<float>(stats.renderTargetChanges));
+			shaderChanges.push_back(static_cast<float>(stats.shaderChanges));
+			constantWrites.push_back(static_cast<float>(stats.constantWrites));
+			constantBytes.push_back(static_cast<float>(stats.constantBytes));
+		}
+	};
+
+	// EventBus 타입별 전달 통계 (프레임당)
+	struct EventReport
+	{
+		std::string name;
+		Percentiles count;
+		Percentiles batches;
+		Percentiles milliseconds;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(name), CEREAL_NVP(count), CEREAL_NVP(batches), CEREAL_NVP(milliseconds));
+		}
+	};
+
+	struct EventSamples
+	{
+		std::vector<float> count;
+		std::vector<float> batches;
+		std::vector<float> milliseconds;
+	};
+
+	struct EntityReport
+	{
+		uint32_t start = 0;
+		uint32_t end = 0;
+		uint32_t min = UINT32_MAX;
+		uint32_t max = 0;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(start), CEREAL_NVP(end), CEREAL_NVP(min), CEREAL_NVP(max));
+		}
+	};
+
+	Percentiles makePercentiles(std::vector<float> samples)
+	{
+		Percentiles result;
+
+		if (samples.empty())
+			return result;
+
+		std::ranges::sort(samples);
+
+		// 최근접 순위 (nearest-rank)
+		auto at = [&samples](float quantile)
+			{
+				const size_t rank = static_cast<size_t>(std::ceil(quantile * static_cast<float>(samples.size())));
+				return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+			};
+
+		result.mean = std::accumulate(samples.begin(), samples.end(), 0.f) / static_cast<float>(samples.size());
+		result.p50 = at(0.5f);
+		result.p90 = at(0.9f);
+		result.p99 = at(0.99f);
+		result.max = samples.back();
+
+		return result;
+	}
+
+	const char* phaseName(core::SystemType phase)
+	{
+		switch (phase)
+		{
+		case core::SystemType::PreUpdate:
+			return "PreUpdate";
+		case core::SystemType::Update:
+			return "Update";
+		case core::SystemType::FixedUpdate:
+			return "FixedUpdate";
+		case core::SystemType::PreRender:
+			return "PreRender";
+		case core::SystemType::Render:
+			return "Render";
+		case core::SystemType::PostRender:
+			return "PostRender";
+		default:
+			return "None";
+		}
+	}
+
+	uint32_t countEntities(entt::registry& registry)
+	{
+		uint32_t count = 0;
+
+		for ([[maybe_unused]] auto entity : registry.view<entt::entity>())
+			++count;
+
+		return count;
+	}
+}
+
+// 군중 규모 하나의 측정 결과 (에이전트 배치, 목적지 요청은 프레임당 예산으로 나뉘어 처리됨)
+struct core::BenchmarkRunner::CrowdReport
+{
+	uint32_t agents = 0;
+	Percentiles frameMilliseconds;
+	Percentiles pathFindingMilliseconds;
+
+	template <class Archive>
+	void serialize(Archive& archive)
+	{
+		archive(CEREAL_NVP(agents), CEREAL_NVP(frameMilliseconds), CEREAL_NVP(pathFindingMilliseconds));
+	}
+};
+
+// 병렬 순회 처리량 (같은 작업을 직렬, 병렬로 번갈아 실행한 프레임별 시간)
+struct core::BenchmarkRunner::IterationReport
+{
+	uint32_t entities = 0;
+	uint32_t workers = 0;
+	Percentiles serialMilliseconds;
+	Percentiles parallelMilliseconds;
+	float speedup = 0.f;				// 직렬 평균 / 병렬 평균
+
+	template <class Archive>
+	void serialize(Archive& archive)
+	{
+		archive(CEREAL_NVP(entities), CEREAL_NVP(workers), CEREAL_NVP(serialMilliseconds), CEREAL_NVP(parallelMilliseconds), CEREAL_NVP(speedup));
+	}
+};
+
+core::BenchmarkRunner::BenchmarkRunner(BenchmarkSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+core::BenchmarkRunner::~BenchmarkRunner() = default;
+
+bool core::BenchmarkRunner::Run()
+{
+	using namespace std::chrono;
+
+	if (!std::filesystem::exists(_settings.scenePath))
+	{
+		_errors.push_back(std::format("Scene file not found : {}", _settings.scenePath.string()));
+		return false;
+	}
+
+	_renderer = Renderer::Create(nullptr, HEADLESS_WIDTH, HEADLESS_HEIGHT, Renderer::API::NONE);
+	auto* nullRenderer = static_cast<NullRenderer*>(_renderer.get());
+	loadResources();
+
+	auto& recorder = InputSystem::recorder;
+
+	if (!_settings.replayPath.empty())
+	{
+		if (!recorder.StartReplay(_settings.replayPath))
+		{
+			_errors.push_back(std::format("Failed to open input recording : {}", _settings.replayPath.string()));
+			return false;
+		}
+
+		// 기록 길이만큼 실행
+		const uint32_t total = static_cast<uint32_t>(recorder.GetFrameCount());
+		_settings.seed = recorder.GetSeed();
+		_settings.warmupFrames = (std::min)(_settings.warmupFrames, total);
+		_settings.frames = total - _settings.warmupFrames;
+	}
+
+	startScene(_settings.scenePath);
+
+	const bool isLoaded = _errors.empty();
+
+	for (uint32_t i = 0; i < _settings.warmupFrames; ++i)
+	{
+		const float tick = recorder.GetNextTick(_settings.tick);
+
+		_scene->Update(tick);
+		_scene->ProcessEvent();
+
+		if (_settings.render)
+		{
+			nullRenderer->ResetRecording();
+			_scene->Render(tick, _renderer.get());
+		}
+
+		switchScene();
+	}
+
+	std::vector<SystemType> phases = { SystemType::PreUpdate, SystemType::Update, SystemType::FixedUpdate };
+	if (_settings.render)
+		phases.insert(phases.end(), { SystemType::PreRender, SystemType::Render, SystemType::PostRender });
+
+	RenderSamples renderSamples;
+
+	std::vector<float> frameSamples;
+	std::vector<float> allocationSamples;
+	std::vector<float> arenaSamples;
+	std::map<std::pair<SystemType, std::string>, std::vector<float>> systemSamples;
+	std::map<std::string, EventSamples> eventSamples;
+	frameSamples.reserve(_settings.frames);
+	allocationSamples.reserve(_settings.frames);
+
+	EntityReport entities;
+	entities.start = countEntities(*_scene->GetRegistry());
+
+	AllocationCounter::count.store(0, std::memory_order_relaxed);
+	AllocationCounter::bytes.store(0, std::memory_order_relaxed);
+
+	for (uint32_t i = 0; i < _settings.frames; ++i)
+	{
+		const uint64_t allocationsBefore = AllocationCounter::count.load(std::memory_order_relaxed);
+
+		// 측정 구간의 할당만 집계 (결과 기록용 할당 제외)
+		AllocationCounter::isTracking.store(true, std::memory_order_relaxed);
+		const float tick = recorder.GetNextTick(_settings.tick);
+		const auto start = steady_clock::now();
+
+		_scene->Update(tick);
+		_scene->ProcessEvent();
+
+		duration<float, std::milli> renderElapsed{};
+		if (_settings.render)
+		{
+			// 로그는 프레임마다 비우고 용량은 재사용
+			nullRenderer->ResetRecording();
+			const auto renderStart = steady_clock::now();
+			_scene->Render(tick, _renderer.get());
+			renderElapsed = steady_clock::now() - renderStart;
+		}
+
+		const duration<float, std::milli> elapsed = steady_clock::now() - start;
+		AllocationCounter::isTracking.store(false, std::memory_order_relaxed);
+
+		if (_settings.render)
+			renderSamples.Add(renderElapsed.count(), *nullRenderer);
+
+		frameSamples.push_back(elapsed.count());
+		allocationSamples.push_back(static_cast<float>(AllocationCounter::count.load(std::memory_order_relaxed) - allocationsBefore));
+		arenaSamples.push_back(static_cast<float>(FrameArena::GetLastFrameBytes()));
+
+		for (SystemType phase : phases)
+		{
+			for (const auto& timing : _scene->GetScheduler().GetTimings(phase))
+			{
+				if (timing.name)
+					systemSamples[{ phase, timing.name }].push_back(timing.milliseconds);
+			}
+		}
+
+		// Scene::Update 시작 시 초기화되므로 이번 프레임의 Update, ProcessEvent 에서 전달된 이벤트
+		for (const auto& stats : _scene->GetEventBus()->GetStats())
+		{
+			auto& samples = eventSamples[stats.name];
+			samples.count.push_back(static_cast<float>(stats.count));
+			samples.batches.push_back(static_cast<float>(stats.batches));
+			samples.milliseconds.push_back(stats.milliseconds);
+		}
+
+		const uint32_t entityCount = countEntities(*_scene->GetRegistry());
+		entities.min = (std::min)(entities.min, entityCount);
+		entities.max = (std::max)(entities.max, entityCount);
+
+		switchScene();
+	}
+
+	entities.end = countEntities(*_scene->GetRegistry());
+	if (_settings.frames == 0)
+		entities.min = entities.start;
+
+	_scene->Finish(_renderer.get());
+	_scene.reset();
+	recorder.Stop();
+
+	// 군중 규모별 측정 (규모마다 씬을 새로 시작)
+	std::vector<CrowdReport> crowds;
+	for (const uint32_t agentCount : _settings.crowdAgents)
+		crowds.push_back(runCrowd(agentCount));
+
+	IterationReport iteration;
+	if (_settings.iterationEntities > 0)
+		iteration = runIteration(_settings.iterationEntities);
+
+	// 결과 기록
+	std::vector<SystemReport> systems;
+	for (auto& [key, samples] : systemSamples)
+		systems.push_back({ key.second, phaseName(key.first), makePercentiles(std::move(samples)) });
+
+	// 평균 시간이 긴 순서
+	std::ranges::sort(systems, std::greater{}, [](const SystemReport& report) { return report.milliseconds.mean; });
+
+	std::vector<EventReport> events;
+	for (auto& [name, samples] : eventSamples)
+	{
+		events.push_back({ name,
+			makePercentiles(std::move(samples.count)),
+			makePercentiles(std::move(samples.batches)),
+			makePercentiles(std::move(samples.milliseconds)) });
+	}
+
+	RenderReport render;
+	render.milliseconds = makePercentiles(std::move(renderSamples.milliseconds));
+	render.commands = makePercentiles(std::move(renderSamples.commands));
+	render.draws = makePercentiles(std::move(renderSamples.draws));
+	render.dispatches = makePercentiles(std::move(renderSamples.dispatches));
+	render.stateChanges = makePercentiles(std::move(renderSamples.stateChanges));
+	render.redundantStateChanges = makePercentiles(std::move(renderSamples.redundantStateChanges));
+	render.renderTargetChanges = makePercentiles(std::move(renderSamples.renderTargetChanges));
+	render.shaderChanges = makePercentiles(std::move(renderSamples.shaderChanges));
+	render.constantWrites = makePercentiles(std::move(renderSamples.constantWrites));
+	render.constantBytes = makePercentiles(std::move(renderSamples.constantBytes));
+
+	AllocationReport allocations;
+	allocations.tracked = AllocationCounter::isHooked;
+	allocations.total = AllocationCounter::count.load(std::memory_order_relaxed);
+	allocations.bytes = AllocationCounter::bytes.load(std::memory_order_relaxed);
+	allocations.perFrame = makePercentiles(std::move(allocationSamples));
+	allocations.frameArenaBytes = makePercentiles(std::move(arenaSamples));
+
+	std::ofstream file(_settings.outputPath);
+	if (!file.is_open())
+		return false;
+
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(
+			cereal::make_nvp("scene", _settings.scenePath.generic_string()),
+			cereal::make_nvp("frames", _settings.frames),
+			cereal::make_nvp("warmupFrames", _settings.warmupFrames),
+			cereal::make_nvp("tick", _settings.tick),
+			cereal::make_nvp("seed", _settings.seed),
+			cereal::make_nvp("parallel", _settings.parallel),
+			cereal::make_nvp("render", _settings.render),
+			cereal::make_nvp("deferredEvents", _settings.deferredEvents),
+			cereal::make_nvp("replay", _settings.replayPath.generic_string()),
+			cereal::make_nvp("frameMilliseconds", makePercentiles(std::move(frameSamples))),
+			cereal::make_nvp("systems", systems),
+			cereal::make_nvp("events", events),
+			cereal::make_nvp("renderStats", render),
+			cereal::make_nvp("allocations", allocations),
+			cereal::make_nvp("entities", entities),
+			cereal::make_nvp("crowd", crowds),
+			cereal::make_nvp("iteration", iteration),
+			cereal::make_nvp("errors", _errors)
+		);
+	}
+
+	return isLoaded && file.good();
+}
+
+bool core::BenchmarkRunner::ParseArguments(const std::vector<std::string>& args, BenchmarkSettings& settings)
+{
+	bool isBenchmark = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size();
+
+		if (arg == "--benchmark" && hasValue)
+		{
+			settings.scenePath = args[++i];
+			isBenchmark = true;
+		}
+		else if (arg == "--frames" && hasValue)
+			settings.frames = static_cast<uint32_t>(std::stoul(args[++i]));
+		else if (arg == "--warmup" && hasValue)
+			settings.warmupFrames = static_cast<uint32_t>(std::stoul(args[++i]));
+		else if (arg == "--tick" && hasValue)
+			settings.tick = std::stof(args[++i]);
+		else if (arg == "--seed" && hasValue)
+			settings.seed = static_cast<uint32_t>(std::stoul(args[++i]));
+		else if (arg == "--out" && hasValue)
+			settings.outputPath = args[++i];
+		else if (arg == "--serial")
+			settings.parallel = false;
+		else if (arg == "--render")
+			settings.render = true;
+		else if (arg == "--immediate-events")
+			settings.deferredEvents = false;
+		else if (arg == "--replay" && hasValue)
+			settings.replayPath = args[++i];
+		else if (arg == "--crowd")
+		{
+			// 쉼표로 구분한 개수 목록이 없으면 기본 규모
+			if (hasValue && !args[i + 1].empty() && std::isdigit(static_cast<unsigned char>(args[i + 1].front())))
+			{
+				for (const auto part : std::views::split(args[++i], ','))
+					settings.crowdAgents.push_back(static_cast<uint32_t>(std::stoul(std::string(part.begin(), part.end()))));
+			}
+			else
+			{
+				settings.crowdAgents.assign(DEFAULT_CROWD_AGENTS.begin(), DEFAULT_CROWD_AGENTS.end());
+			}
+		}
+		else if (arg == "--iteration")
+		{
+			if (hasValue && !args[i + 1].empty() && std::isdigit(static_cast<unsigned char>(args[i + 1].front())))
+				settings.iterationEntities = static_cast<uint32_t>(std::stoul(args[++i]));
+			else
+				settings.iterationEntities = DEFAULT_ITERATION_ENTITIES;
+		}
+	}
+
+	return isBenchmark;
+}
+
+void core::BenchmarkRunner::loadResources()
+{
+	_renderer->LoadMeshesFromDrive("./Resources/Models");
+	_renderer->LoadMaterialsFromDrive("./Resources");
+	_renderer->LoadShadersFromDrive("./Shaders");
+	_renderer->LoadAnimationClipsFromDrive("./Resources/Animations");
+	_renderer->LoadUITexturesFromDrive("./Resources/UI");
+	_renderer->LoadParticleTexturesFromDrive("./Resources/Particles");
+	_renderer->LoadFontsFromDrive("./Resources/Fonts");
+
+	AnimatorSystem::controllerManager.LoadControllersFromDrive("./Resources", _renderer.get());
+}
+
+void core::BenchmarkRunner::startScene(const std::filesystem::path& path)
+{
+	_scene = std::make_shared<Scene>();
+	_scene->GetDispatcher()->sink<OnThrow>().connect<&BenchmarkRunner::onThrow>(this);
+	_scene->GetDispatcher()->sink<OnChangeScene>().connect<&BenchmarkRunner::changeScene>(this);
+	_scene->LoadScene(path);
+
+	auto& config = _scene->GetRegistry()->ctx().get<Configuration>();
+	config.width = HEADLESS_WIDTH;
+	config.height = HEADLESS_HEIGHT;
+
+	_scene->GetGenerator()->seed(_settings.seed);
+	_scene->GetScheduler().SetParallel(_settings.parallel);
+	_scene->GetEventBus()->SetDeferred(_settings.deferredEvents);
+	_scene->Start(_renderer.get());
+}
+
+core::BenchmarkRunner::CrowdReport core::BenchmarkRunner::runCrowd(uint32_t agentCount)
+{
+	using namespace std::chrono;
+
+	CrowdReport report;
+	report.agents = agentCount;
+
+	startScene(_settings.scenePath);
+	auto& registry = *_scene->GetRegistry();
+
+	// 씬에 배치된 에이전트 위치를 네비메쉬 위의 기준점으로 사용
+	std::vector<Vector3> anchors;
+	for (auto&& [entity, agent, world] : registry.view<Agent, WorldTransform>().each())
+		anchors.push_back(world.position);
+
+	if (anchors.empty())
+	{
+		_errors.push_back(std::format("Crowd benchmark needs a scene with agents on a nav mesh : {}", _settings.scenePath.string()));
+		_scene->Finish(_renderer.get());
+		_scene.reset();
+		return report;
+	}
+
+	auto& generator = *_scene->GetGenerator();
+	std::uniform_int_distribution<size_t> pickAnchor(0, anchors.size() - 1);
+	std::uniform_real_distribution<float> jitter(-CROWD_SPREAD, CROWD_SPREAD);
+
+	auto randomPoint = [&]
+		{
+			Vector3 point = anchors[pickAnchor(generator)];
+			point.x += jitter(generator);
+			point.z += jitter(generator);
+			return point;
+		};
+
+	std::vector<entt::entity> crowd;
+	crowd.reserve(agentCount);
+
+	for (uint32_t i = 0; i < agentCount; ++i)
+	{
+		Entity entity = _scene->CreateEntity();
+		const Vector3 position = randomPoint();
+		entity.Get<LocalTransform>().position = position;
+		entity.Get<WorldTransform>().position = position;
+		entity.Emplace<Agent>().destination = position;
+		crowd.push_back(entity);
+	}
+
+	std::vector<float> frameSamples;
+	std::vector<float> pathFindingSamples;
+	frameSamples.reserve(_settings.frames);
+	pathFindingSamples.reserve(_settings.frames);
+
+	for (uint32_t i = 0; i < _settings.warmupFrames + _settings.frames; ++i)
+	{
+		// 배치가 끝난 에이전트만 경로를 요청하므로 주기마다 모두 다시 지정 (군중이 계속 움직이도록)
+		if (i % CROWD_RETARGET_FRAMES == 0)
+		{
+			for (auto entity : crowd)
+			{
+				if (registry.all_of<Agent>(entity))
+					registry.patch<Agent>(entity, [&randomPoint](Agent& agent) { agent.destination = randomPoint(); });
+			}
+		}
+
+		const auto start = steady_clock::now();
+
+		_scene->Update(_settings.tick);
+		_scene->ProcessEvent();
+
+		const duration<float, std::milli> elapsed = steady_clock::now() - start;
+
+		if (i < _settings.warmupFrames)
+			continue;
+
+		frameSamples.push_back(elapsed.count());
+
+		for (const auto& timing : _scene->GetScheduler().GetTimings(SystemType::Update))
+		{
+			if (timing.name && std::string_view(timing.name) == SystemTraits<PathFindingSystem>::name)
+				pathFindingSamples.push_back(timing.milliseconds);
+		}
+	}
+
+	_scene->Finish(_renderer.get());
+	_scene.reset();
+
+	report.frameMilliseconds = makePercentiles(std::move(frameSamples));
+	report.pathFindingMilliseconds = makePercentiles(std::move(pathFindingSamples));
+
+	return report;
+}
+
+core::BenchmarkRunner::IterationReport core::BenchmarkRunner::runIteration(uint32_t entityCount)
+{
+	using namespace std::chrono;
+
+	IterationReport report;
+	report.entities = entityCount;
+
+	auto& jobSystem = GetJobSystem();
+	report.workers = jobSystem.GetWorkerCount();
+
+	entt::registry registry;
+	std::mt19937 generator(_settings.seed);
+	std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+
+	for (uint32_t i = 0; i < entityCount; ++i)
+	{
+		const entt::entity entity = registry.create();
+
+		auto& local = registry.emplace<LocalTransform>(entity);
+		local.position = { distribution(generator), distribution(generator), distribution(generator) };
+		local.rotation = Quaternion::CreateFromYawPitchRoll(distribution(generator), 0.f, 0.f);
+
+		registry.emplace<WorldTransform>(entity);
+	}
+
+	// 부모가 없는 엔티티의 TransformSystem::updateTransform 과 같은 계산
+	auto update = [](entt::entity, LocalTransform& local, WorldTransform& world)
+		{
+			local.matrix = Matrix::CreateScale(local.scale) *
+				Matrix::CreateFromQuaternion(local.rotation) *
+				Matrix::CreateTranslation(local.position);
+
+			world.matrix = local.matrix;
+			world.scale = local.scale;
+			world.rotation = local.rotation;
+			world.position = local.position;
+		};
+
+	auto view = registry.view<LocalTransform, WorldTransform>();
+
+	std::vector<float> serialSamples;
+	std::vector<float> parallelSamples;
+	serialSamples.reserve(_settings.frames);
+	parallelSamples.reserve(_settings.frames);
+
+	for (uint32_t i = 0; i < _settings.warmupFrames + _settings.frames; ++i)
+	{
+		auto start = steady_clock::now();
+
+		for (auto&& [entity, local, world] : view.each())
+			update(entity, local, world);
+
+		const duration<float, std::milli> serialElapsed = steady_clock::now() - start;
+
+		start = steady_clock::now();
+		jobSystem.ParallelForEach(view, update);
+		const duration<float, std::milli> parallelElapsed = steady_clock::now() - start;
+
+		if (i < _settings.warmupFrames)
+			continue;
+
+		serialSamples.push_back(serialElapsed.count());
+		parallelSamples.push_back(parallelElapsed.count());
+	}
+
+	report.serialMilliseconds = makePercentiles(std::move(serialSamples));
+	report.parallelMilliseconds = makePercentiles(std::move(parallelSamples));
+
+	if (report.parallelMilliseconds.mean > 0.f)
+		report.speedup = report.serialMilliseconds.mean / report.parallelMilliseconds.mean;
+
+	return report;
+}
+
+void core::BenchmarkRunner::switchScene()
+{
+	// 입력 재생 중, 기록에서 씬이 교체된 프레임에만 교체 (런처와 같은 프레임 경계)
+	if (_nextScenePath.empty() || !InputSystem::recorder.IsSceneSwitchFrame())
+		return;
+
+	_scene->Finish(_renderer.get());
+	startScene(_nextScenePath);
+	_nextScenePath.clear();
+}
+
+void core::BenchmarkRunner::onThrow(const OnThrow& event)
+{
+	if (event.exceptionType == OnThrow::Error)
+		_errors.push_back(event.message);
+}
+
+void core::BenchmarkRunner::changeScene(const OnChangeScene& event)
+{
+	_nextScenePath = event.path;
+}
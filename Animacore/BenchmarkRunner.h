@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include <atomic>
+
+class Renderer;
+
+namespace core
+{
+	class Scene;
+	struct OnThrow;
+	struct OnChangeScene;
+
+	/// \brief
+	/// \n 할당 횟수 집계 (전역 operator new 를 교체한 실행 파일이 Record 를 호출)
+	///	\n 교체하지 않은 실행 파일에서는 isHooked 가 false 이고 값이 0 으로 남음
+	struct AllocationCounter
+	{
+		static void Record(size_t size)
+		{
+			if (isTracking.load(std::memory_order_relaxed))
+			{
+				count.fetch_add(1, std::memory_order_relaxed);
+				bytes.fetch_add(size, std::memory_order_relaxed);
+			}
+		}
+
+		inline static bool isHooked = false;
+		inline static std::atomic<bool> isTracking = false;
+		inline static std::atomic<uint64_t> count = 0;
+		inline static std::atomic<uint64_t> bytes = 0;
+	};
+
+	struct BenchmarkSettings
+	{
+		std::filesystem::path scenePath;
+		std::filesystem::path outputPath = "./benchmark.json";
+		uint32_t frames = 600;
+		uint32_t warmupFrames = 60;			// 측정 전 실행 (초기 할당, 캐시 워밍업 제외)
+		float tick = 1.f / 60.f;
+		uint32_t seed = 0;					// Scene 난수 생성기 시드
+		bool parallel = true;				// false 면 시스템을 등록 순서대로 직렬 실행
+		bool render = false;				// 렌더 단계도 실행하고 NullRenderer 기록 통계를 남김
+		bool deferredEvents = true;			// false 면 EventBus 가 Push 즉시 전달 (trigger 와 같은 동작, 비교용)
+		std::filesystem::path replayPath;	// 입력 재생 (기록의 시드, tick, 길이를 사용하고 기록된 프레임에서 씬 교체)
+		std::vector<uint32_t> crowdAgents;	// 씬의 에이전트 주변에 이만큼 에이전트를 추가하여 규모별로 따로 측정
+		uint32_t iterationEntities = 0;		// 0 이 아니면 이만큼의 엔티티를 직렬/JobSystem 병렬로 순회하여 비교
+	};
+
+	/// \brief
+	/// \n 창과 GPU 없이 씬을 고정 tick 으로 갱신하고 결과를 JSON 으로 기록하는 헤드리스 실행기
+	///	\n 렌더러는 NullRenderer (Renderer::API::NONE), 렌더 단계는 --render 일 때만 실행
+	///	\n 메타 데이터(RegisterCoreMetaData, 게임 메타)는 호출하는 쪽에서 미리 등록해야 함
+	class BenchmarkRunner
+	{
+	public:
+		explicit BenchmarkRunner(BenchmarkSettings settings);
+		~BenchmarkRunner();
+
+		// 리소스, 씬 로드 후 측정하고 결과 저장 (씬 로드, 저장 실패 시 false)
+		bool Run();
+
+		// "--benchmark <scene> [--frames N] [--warmup N] [--tick S] [--seed N] [--serial] [--render] [--immediate-events] [--replay path]
+		//  [--crowd [N,N,...]] [--iteration [N]] [--out path]"
+		// --crowd 에 개수를 생략하면 64, 256, 1024, --iteration 은 100000
+		// --benchmark 가 없으면 false
+		static bool ParseArguments(const std::vector<std::string>& args, BenchmarkSettings& settings);
+
+	private:
+		struct CrowdReport;
+		struct IterationReport;
+
+		void loadResources();
+		void startScene(const std::filesystem::path& path);
+		void switchScene();
+
+		// 씬을 새로 시작하고 에이전트를 추가한 뒤 측정 (목적지는 주기적으로 다시 지정)
+		CrowdReport runCrowd(uint32_t agentCount);
+
+		// 씬과 별개의 레지스트리에서 트랜스폼 갱신을 직렬 each() 와 ParallelForEach 로 번갈아 측정
+		IterationReport runIteration(uint32_t entityCount);
+
+		void onThrow(const OnThrow& event);
+		void changeScene(const OnChangeScene& event);
+
+		BenchmarkSettings _settings;
+		std::unique_ptr<Renderer> _renderer;
+		std::shared_ptr<Scene> _scene;
+		std::filesystem::path _nextScenePath;
+		std::vector<std::string> _errors;
+	};
+}
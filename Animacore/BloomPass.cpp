@@ -4,6 +4,8 @@
 #include "Scene.h"
 #include "RenderComponents.h"
 #include "CoreComponents.h"
+#include "Profiler.h"
+#include "FramePacket.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -66,9 +68,9 @@ void core::BloomPass::Init(Scene& scene, Renderer& renderer, uint32_t width, uin
 	}
 }
 
-void core::BloomPass::Run(Scene& scene, Renderer& renderer, float tick, RenderResources& renderResource)
+void core::BloomPass::Run(const FramePacket& packet, Renderer& renderer, RenderResources& renderResource)
 {
-	entt::registry& registry = *scene.GetRegistry();
+	PROFILE_FUNCTION();
 
 	auto align = [](int value, int aligment)
 		{
@@ -78,19 +80,16 @@ void core::BloomPass::Run(Scene& scene, Renderer& renderer, float tick, RenderRe
 	unsigned short width = std::max<unsigned short>(1, static_cast<unsigned short>(_width) / 2);
 	unsigned short height = std::max<unsigned short>(1, static_cast<unsigned short>(_height) / 2);
 
-	BloomParams params = {};
-	bool useBloom = false;
+	//      
+	if (packet.postProcessVolumes.empty())
+		return;
 
-	for (auto&& [entity, volume] : registry.view<core::PostProcessingVolume>().each())
-	{
-		params.threshold = volume.bloomThreshold;
-		params.scatter = volume.bloomScatter;
-		params.useScatter = volume.useBloomScatter;
-		useBloom = true;
-	}
+	const auto& volume = packet.postProcessVolumes.back();
 
-	if (!useBloom)
-		return;
+	BloomParams params = {};
+	params.threshold = volume.bloomThreshold;
+	params.scatter = volume.bloomScatter;
+	params.useScatter = volume.useBloomScatter;
 
 	//  κ 
 	{
@@ -8,12 +8,13 @@ namespace core
 {
 	class Scene;
 	struct RenderResources;
+	struct FramePacket;
 
 	class BloomPass
 	{
 	public:
 		void Init(Scene& scene, Renderer& renderer, uint32_t width, uint32_t height);
-		void Run(Scene& scene, Renderer& renderer, float tick, RenderResources& renderResource);
+		void Run(const FramePacket& packet, Renderer& renderer, RenderResources& renderResource);
 		void Finish();
 
 		std::shared_ptr<Texture> GetBloomTexture() const { return _extractBrightTextures[_downSampleUAVIndex]; }
@@ -96,6 +96,34 @@ namespace core
 	};
 
 
+	/*------------------------------
+		NavMeshObstacle
+	------------------------------*/
+	// NavMesh 를 동적으로 깎아내는 장애물 (옮겨지는 가구, 열리는 문 등)
+	struct NavMeshObstacle
+	{
+		enum class Shape
+		{
+			Cylinder,
+			Box,
+		};
+
+		Shape shape = Shape::Box;
+		Vector3 center;						// 로컬 중심 오프셋
+		Vector3 size = Vector3::One;		// Box 크기
+		float radius = 0.5f;				// Cylinder 반지름
+		float height = 2.0f;				// Cylinder 높이
+		float moveThreshold = 0.1f;			// 이 거리 이상 움직여야 NavMesh 갱신
+
+	private:
+		unsigned int _obstacleRef = 0;
+		Vector3 _position;
+		float _yaw = 0.f;
+
+		friend class PathFindingSystem;
+	};
+
+
 	/*------------------------------
 		Sound
 	------------------------------*/
@@ -178,6 +206,14 @@ namespace core
 		bool enableVSync = false;
 	};
 
+	// 비동기 씬 로딩 진행 상황 (로딩 중에만 현재 씬에 기록됨, 로딩 화면 표시용)
+	struct SceneLoadProgress
+	{
+		std::string path;
+		float progress = 0.0f;	// 0 ~ 1
+		bool isLoading = false;
+	};
+
 	struct BGM
 	{
 		core::Sound sound;
@@ -22,6 +22,8 @@ namespace core
 		bool enableImGui = false;
 		WNDPROC proc = nullptr;
 		uint32_t windowStyle = WS_OVERLAPPEDWINDOW;
+		bool pipelineFrames = false;	// 업데이트와 렌더 제출을 한 프레임 겹쳐 실행 (가능한 씬만)
+		float fixedTick = 0.f;			// 0 보다 크면 타이머 대신 고정 tick 으로 갱신 (입력 기록, 재생용)
 	};
 
 	class CoreProcess
@@ -414,6 +414,19 @@ namespace cereal
 		);
 	}
 
+	template <class Archive>
+	void serialize(Archive& archive, core::NavMeshObstacle& data)
+	{
+		archive(
+			MAKE_NVP(shape),
+			MAKE_NVP(center),
+			MAKE_NVP(size),
+			MAKE_NVP(radius),
+			MAKE_NVP(height),
+			MAKE_NVP(moveThreshold)
+		);
+	}
+
 	template <class Archive>
 	void serialize(Archive& archive, core::NavMeshConfigs& data)
 	{
@@ -443,7 +456,9 @@ namespace cereal
 			MAKE_NVP(partitionType),
 			MAKE_NVP(navMeshBMin),
 			MAKE_NVP(navMeshBMax),
-			MAKE_NVP(tileSize)
+			MAKE_NVP(tileSize),
+			MAKE_NVP(maxAgents),
+			MAKE_NVP(maxPathRequestsPerFrame)
 		);
 	}
 
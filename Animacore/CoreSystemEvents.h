@@ -173,7 +173,7 @@ namespace core
 	/*------------------------------
 		트랜스폼 변경
 	------------------------------*/
-	// TransformSystem, PhysicsSystem 에서 내부적으로 사용됨
+	// PhysicsScene 에서 바디마다 EventBus 로 Push, TransformSystem 에서 일괄 처리
 	struct OnUpdateTransform
 	{
 		entt::entity entity;
@@ -185,6 +185,32 @@ namespace core
 		}
 	};
 
+	/*------------------------------
+		로컬 트랜스폼 변경
+	------------------------------*/
+	// EventBus 로 전달 (AnimatorSystem 에서 애니메이터마다 한 번, TransformSystem 에서 처리)
+	struct OnUpdateLocalTransform
+	{
+		entt::entity entity;
+		entt::registry* registry;
+
+		OnUpdateLocalTransform(entt::entity entity, entt::registry* registry)
+			: entity(entity), registry(registry)
+		{
+		}
+	};
+
+	/*------------------------------
+		트랜스폼 일괄 변경
+	------------------------------*/
+	// WorldTransform 을 직접 수정한 여러 엔티티를 한번에 알림 (patch 콜백을 엔티티마다 부르지 않기 위함)
+	// PathFindingSystem 에서 사용, TransformSystem, PhysicsSystem 에서 처리
+	struct OnUpdateTransforms
+	{
+		const std::vector<entt::entity>& entities;
+		entt::registry* registry;
+	};
+
 	/*------------------------------
 		리지드바디 업데이트
 	------------------------------*/
@@ -3,8 +3,12 @@
 
 #include "Scene.h"
 #include "RenderComponents.h"
+#include "AssetResolver.h"
 #include "CoreComponents.h"
+#include "Profiler.h"
+#include "FramePacket.h"
 #include "LightStructure.h"
+#include "MeshLod.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -116,68 +120,32 @@ void core::DeferredShadePass::Init(Scene& scene, Renderer& renderer, uint32_t wi
 
 }
 
-void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick, RenderResources& renderResources)
+void core::DeferredShadePass::Extract(Scene& scene, Renderer& renderer, FramePacket& packet)
 {
-	auto& registry = *scene.GetRegistry();
-
-	auto& deferredTextures = renderResources.deferredTextures;
+	PROFILE_FUNCTION();
 
-	Matrix view = renderResources.viewMatrix;
-	Matrix proj = renderResources.projectionMatrix;
-	Matrix viewProj = renderResources.viewProjectionMatrix;
+	auto& registry = *scene.GetRegistry();
+	auto& renderResources = registry.ctx().get<core::RenderResources>();
 
 	if (!renderResources.mainCamera)
 		return;
 
+	const auto& camera = packet.camera;
 	auto& mainCamera = *renderResources.mainCamera;
-	auto& cameraTransform = *renderResources.cameraTransform;
 
-	/// ⿡ Į ڵ ߰
+	for (auto&& [entity, transform, decal] : registry.view<core::WorldTransform, core::Decal>().each())
 	{
-		auto viewInveres = view.Invert();
-		renderer.ClearTexture(_decalOutputAlbedo.get(), _decalOutputAlbedo->GetClearValue());
-		renderer.ClearTexture(_decalOutputORM.get(), _decalOutputORM->GetClearValue());
-
-		for (auto&& [entity, transform, decal] : registry.view<core::WorldTransform, core::Decal>().each())
-		{
-			if (decal.material == nullptr)
-			{
-				if (!decal.materialString.empty())
-				{
-					decal.material = renderer.GetMaterial(decal.materialString);
-				}
-				continue;
-			}
-
-			decal.material->SetTexture("gNormalTexture", deferredTextures[DeferredSlot::Normal]);
-			decal.material->SetTexture("gDepthTexture", deferredTextures[DeferredSlot::PositionW]);
-			decal.material->SetUAVTexture("OutputTexture", _decalOutputAlbedo);
-			decal.material->SetUAVTexture("OrmOutputTexture", _decalOutputORM);
-
-			auto& world = transform.matrix;
-			auto worldInverse = world.Invert();
-			auto WVP = world * view * proj;
-
-			decal.material->m_Shader->MapConstantBuffer(renderer.GetContext());
-			decal.material->m_Shader->SetMatrix("gWVP", WVP);
-			decal.material->m_Shader->SetMatrix("gWorldInv", worldInverse);
-			decal.material->m_Shader->SetMatrix("gViewInv", viewInveres);
-			decal.material->m_Shader->SetFloat("fTargetWidth", static_cast<float>(renderResources.width));
-			decal.material->m_Shader->SetFloat("fTargetHeight", static_cast<float>(renderResources.height));
-			decal.material->m_Shader->SetFloat("gFadeFactor", decal.fadeFactor);
-			decal.material->m_Shader->SetFloat3("gDecalDirection", transform.matrix.Up());
-			decal.material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+		if (!AssetResolver::ResolveMaterial(renderer, decal))
+			continue;
 
-			//renderer.Submit(*_cubeMesh, *decal.material, 0, PrimitiveTopology::TRIANGLELIST, 1);
-			renderer.DispatchCompute(*decal.material, renderResources.width / 16, renderResources.height / 16, 1);
-		}
+		packet.decals.push_back({ decal.material.get(), transform.matrix, decal.fadeFactor });
 	}
 
-
-	std::vector<core::DirectionalLightStructure> directionalLights;
-	std::vector<core::PointLightStructure> pointLights;
-	std::vector<core::PointLightStructure> nonShadowPointLights;
-	std::vector<core::SpotLightStructure> spotLights;
+	// SetStruct  ̴ 迭 ũ⸸ŭ ϹǷ  ־ ׸ŭ 뷮 
+	auto& directionalLights = packet.directionalLights;
+	auto& pointLights = packet.pointLights;
+	auto& nonShadowPointLights = packet.nonShadowPointLights;
+	auto& spotLights = packet.spotLights;
 
 	directionalLights.reserve(1);
 	pointLights.reserve(MAX_LIGHT_COUNT);
@@ -196,7 +164,7 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 		light.direction.Normalize();
 
 		float cascadeEnds[4] = { 0.0f, };
-		core::CalculateCascadeMatrices(view, proj, mainCamera.fieldOfView, mainCamera.aspectRatio, light.direction, mainCamera.nearClip, mainCamera.farClip, 4, light.lightViewProjection, cascadeEnds, directionalLight.cascadeEnds);
+		core::CalculateCascadeMatrices(camera.view, camera.proj, mainCamera.fieldOfView, mainCamera.aspectRatio, light.direction, mainCamera.nearClip, mainCamera.farClip, 4, light.lightViewProjection, cascadeEnds, directionalLight.cascadeEnds);
 
 		light.cascadedEndClip = Vector4{ cascadeEnds[0], cascadeEnds[1], cascadeEnds[2], cascadeEnds[3] };
 
@@ -342,6 +310,99 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 		spotLights.emplace_back(light);
 	}
 
+	// ׸ڸ    帮 ޽õ  
+	auto isShadowLight = [](const auto& light) { return light.isOn && light.useShadow; };
+	if (std::ranges::none_of(directionalLights, isShadowLight) && std::ranges::none_of(pointLights, isShadowLight) && std::ranges::none_of(spotLights, isShadowLight))
+		return;
+
+	for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
+	{
+		if (!meshRenderer.isOn || !meshRenderer.receiveShadow)
+			continue;
+
+		if (!AssetResolver::ResolveMesh(renderer, meshRenderer))
+			continue;
+
+		FramePacket::ShadowCaster caster;
+		caster.mesh = meshRenderer.mesh.get();
+		caster.world = transform.matrix;
+		caster.worldInvTranspose = transform.matrix.Invert().Transpose();
+		caster.position = transform.position;
+		caster.lod = meshRenderer.lod;
+		caster.subMeshCount = meshRenderer.mesh->subMeshCount;
+		caster.firstAlpha = static_cast<uint32_t>(packet.shadowAlphas.size());
+		caster.isCulling = meshRenderer.isCulling;
+
+		// ⼺ ׸ڸ ޽ Ƽ   ߶
+		for (uint32_t i = 0; i < caster.subMeshCount; i++)
+		{
+			std::shared_ptr<Texture> alpha;
+
+			if (meshRenderer.materials.size() > i && meshRenderer.materials[i] != nullptr)
+			{
+				auto iter = meshRenderer.materials[i]->GetTextures().find(G_ALPHA);
+
+				if (iter != meshRenderer.materials[i]->GetTextures().end())
+					alpha = iter->second.Texture;
+			}
+
+			packet.shadowAlphas.push_back(std::move(alpha));
+		}
+
+		packet.shadowCasters.push_back(caster);
+	}
+}
+
+void core::DeferredShadePass::Run(const FramePacket& packet, Renderer& renderer, RenderResources& renderResources)
+{
+	PROFILE_FUNCTION();
+
+	auto& deferredTextures = renderResources.deferredTextures;
+
+	const auto& camera = packet.camera;
+	const Matrix& view = camera.view;
+	const Matrix& proj = camera.proj;
+	const Matrix& viewProj = camera.viewProj;
+
+	if (!camera.hasMainCamera)
+		return;
+
+	/// ⿡ Į ڵ ߰
+	{
+		auto viewInveres = view.Invert();
+		renderer.ClearTexture(_decalOutputAlbedo.get(), _decalOutputAlbedo->GetClearValue());
+		renderer.ClearTexture(_decalOutputORM.get(), _decalOutputORM->GetClearValue());
+
+		for (const auto& decal : packet.decals)
+		{
+			decal.material->SetTexture("gNormalTexture", deferredTextures[DeferredSlot::Normal]);
+			decal.material->SetTexture("gDepthTexture", deferredTextures[DeferredSlot::PositionW]);
+			decal.material->SetUAVTexture("OutputTexture", _decalOutputAlbedo);
+			decal.material->SetUAVTexture("OrmOutputTexture", _decalOutputORM);
+
+			auto& world = decal.world;
+			auto worldInverse = world.Invert();
+			auto WVP = world * view * proj;
+
+			decal.material->m_Shader->MapConstantBuffer(renderer.GetContext());
+			decal.material->m_Shader->SetMatrix("gWVP", WVP);
+			decal.material->m_Shader->SetMatrix("gWorldInv", worldInverse);
+			decal.material->m_Shader->SetMatrix("gViewInv", viewInveres);
+			decal.material->m_Shader->SetFloat("fTargetWidth", static_cast<float>(renderResources.width));
+			decal.material->m_Shader->SetFloat("fTargetHeight", static_cast<float>(renderResources.height));
+			decal.material->m_Shader->SetFloat("gFadeFactor", decal.fadeFactor);
+			decal.material->m_Shader->SetFloat3("gDecalDirection", world.Up());
+			decal.material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+
+			//renderer.Submit(*_cubeMesh, *decal.material, 0, PrimitiveTopology::TRIANGLELIST, 1);
+			renderer.DispatchCompute(*decal.material, renderResources.width / 16, renderResources.height / 16, 1);
+		}
+	}
+
+	const auto& directionalLights = packet.directionalLights;
+	const auto& pointLights = packet.pointLights;
+	const auto& nonShadowPointLights = packet.nonShadowPointLights;
+	const auto& spotLights = packet.spotLights;
 
 	PerObject perObject;
 	{
@@ -353,58 +414,41 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 			if (!directionalLights[dLightIndex].isOn || !directionalLights[dLightIndex].useShadow)
 				continue;
 
-			for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
+			for (const auto& caster : packet.shadowCasters)
 			{
-				float distance = (transform.position - cameraTransform.position).Length();
+				float distance = (caster.position - camera.position).Length();
 
-				if (!meshRenderer.isOn || !meshRenderer.receiveShadow || distance >= 100.0f)
+				if (distance >= 100.0f)
 					continue;
 
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
-					continue;
-				}
-
-				if (!meshRenderer.isCulling)
+				if (!caster.isCulling)
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::SHADOW_CULL_NONE, DepthStencilState::DEPTH_ENABLED);
 				else
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::SHADOW, DepthStencilState::DEPTH_ENABLED);
 
-				auto world = transform.matrix;
-				auto worldInvTranspose = world.Invert().Transpose();
-
 				perObject.gProj = proj;
 				perObject.gView = view;
 				perObject.gViewProj = viewProj;
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
+				perObject.gWorld = caster.world;
+				perObject.gWorldInvTranspose = caster.worldInvTranspose;
 				perObject.gTexTransform = Matrix::Identity;
 
-				for (uint32_t i = 0; i < meshRenderer.mesh->subMeshCount; i++)
+				for (uint32_t i = 0; i < caster.subMeshCount; i++)
 				{
 					_dDepthMaterial->m_Shader->MapConstantBuffer(renderer.GetContext());
 					_dDepthMaterial->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
 					_dDepthMaterial->m_Shader->SetStruct(DIRECTIONAL_LIGHTS, directionalLights.data());
 					_dDepthMaterial->m_Shader->SetInt(USE_ALPHA_MAP, false);
 
-					if (meshRenderer.materials.size() > i)
+					if (const auto& alpha = packet.shadowAlphas[caster.firstAlpha + i])
 					{
-						if (meshRenderer.materials[i] != nullptr)
-						{
-							auto iter = meshRenderer.materials[i]->GetTextures().find(G_ALPHA);
-
-							if (iter != meshRenderer.materials[i]->GetTextures().end())
-							{
-								_dDepthMaterial->m_Shader->SetInt(USE_ALPHA_MAP, true);
-								_dDepthMaterial->SetTexture(G_ALPHA, iter->second.Texture);
-							}
-						}
+						_dDepthMaterial->m_Shader->SetInt(USE_ALPHA_MAP, true);
+						_dDepthMaterial->SetTexture(G_ALPHA, alpha);
 					}
 
 					_dDepthMaterial->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-					renderer.Submit(*meshRenderer.mesh, *_dDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1);
+					renderer.Submit(*caster.mesh, *_dDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1, caster.lod + MeshLod::SHADOW_BIAS);
 				}
 			}
 		}
@@ -423,37 +467,22 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 			if (!pointLights[pLightIndex].isOn || !pointLights[pLightIndex].useShadow)
 				continue;
 
-			for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
+			for (const auto& caster : packet.shadowCasters)
 			{
-				if (!meshRenderer.isOn || !meshRenderer.receiveShadow)
-					continue;
-
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
-					continue;
-				}
-
-				auto meshPosition = transform.position;
-				auto lightPosition = pointLights[pLightIndex].position;
-
-				auto distance = Vector3::Distance(meshPosition, lightPosition);
+				auto distance = Vector3::Distance(caster.position, pointLights[pLightIndex].position);
 				if (distance > pointLights[pLightIndex].range)
 					continue;
 
-				if (!meshRenderer.isCulling)
+				if (!caster.isCulling)
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::PSHADOW_CULL_NONE, DepthStencilState::DEPTH_ENABLED);
 				else
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::PSHADOW, DepthStencilState::DEPTH_ENABLED);
 
-				auto world = transform.matrix;
-				auto worldInvTranspose = world.Invert().Transpose();
-
 				perObject.gProj = proj;
 				perObject.gView = view;
 				perObject.gViewProj = viewProj;
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
+				perObject.gWorld = caster.world;
+				perObject.gWorldInvTranspose = caster.worldInvTranspose;
 				perObject.gTexTransform = Matrix::Identity;
 
 				_pDepthMaterial->m_Shader->MapConstantBuffer(renderer.GetContext());
@@ -462,8 +491,8 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 				_pDepthMaterial->m_Shader->SetInt(NUM_POINT_LIGHTS, static_cast<int>(pointLights.size()));
 				_pDepthMaterial->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-				for (uint32_t i = 0; i < meshRenderer.mesh->subMeshCount; i++)
-					renderer.Submit(*meshRenderer.mesh, *_pDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1);
+				for (uint32_t i = 0; i < caster.subMeshCount; i++)
+					renderer.Submit(*caster.mesh, *_pDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1, caster.lod + MeshLod::SHADOW_BIAS);
 			}
 		}
 
@@ -476,37 +505,22 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 			if (!spotLights[sLightIndex].isOn || !spotLights[sLightIndex].useShadow)
 				continue;
 
-			for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
+			for (const auto& caster : packet.shadowCasters)
 			{
-				if (!meshRenderer.isOn || !meshRenderer.receiveShadow)
-					continue;
-
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
-					continue;
-				}
-
-				auto meshPosition = transform.position;
-				auto lightPosition = spotLights[sLightIndex].position;
-
-				auto distance = Vector3::Distance(meshPosition, lightPosition);
+				auto distance = Vector3::Distance(caster.position, spotLights[sLightIndex].position);
 				if (distance > spotLights[sLightIndex].range)
 					continue;
 
-				if (!meshRenderer.isCulling)
+				if (!caster.isCulling)
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::SHADOW_CULL_NONE, DepthStencilState::DEPTH_ENABLED);
 				else
 					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::SHADOW, DepthStencilState::DEPTH_ENABLED);
 
-				auto world = transform.matrix;
-				auto worldInvTranspose = world.Invert().Transpose();
-
 				perObject.gProj = proj;
 				perObject.gView = view;
 				perObject.gViewProj = viewProj;
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
+				perObject.gWorld = caster.world;
+				perObject.gWorldInvTranspose = caster.worldInvTranspose;
 				perObject.gTexTransform = Matrix::Identity;
 
 				_sDepthMaterial->m_Shader->MapConstantBuffer(renderer.GetContext());
@@ -515,8 +529,8 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 				_sDepthMaterial->m_Shader->SetInt("numSpotLights", static_cast<int>(spotLights.size()));
 				_sDepthMaterial->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-				for (uint32_t i = 0; i < meshRenderer.mesh->subMeshCount; i++)
-					renderer.Submit(*meshRenderer.mesh, *_sDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1);
+				for (uint32_t i = 0; i < caster.subMeshCount; i++)
+					renderer.Submit(*caster.mesh, *_sDepthMaterial, i, PrimitiveTopology::TRIANGLELIST, 1, caster.lod + MeshLod::SHADOW_BIAS);
 			}
 		}
 	}
@@ -540,7 +554,7 @@ void core::DeferredShadePass::Run(Scene& scene, Renderer& renderer, float tick,
 		_deferredMaterial->m_Shader->SetMatrix("gWorldInvTranspose", worldInvTranspose);
 		_deferredMaterial->m_Shader->SetMatrix("gView", view);
 		_deferredMaterial->m_Shader->SetMatrix("gViewProj", viewProj);
-		_deferredMaterial->m_Shader->SetFloat3("gEyePosW", cameraTransform.position);
+		_deferredMaterial->m_Shader->SetFloat3("gEyePosW", camera.position);
 		_deferredMaterial->m_Shader->SetMatrix("gTexTransform", Matrix::Identity);
 
 		//_deferredMaterial->SetTexture("̸", ؽ);
@@ -9,12 +9,18 @@ namespace core
 {
 	class Scene;
 	struct RenderResources;
+	struct FramePacket;
 
 	class DeferredShadePass
 	{
 	public:
 		void Init(Scene& scene, Renderer& renderer, uint32_t width, uint32_t height);
-		void Run(Scene& scene, Renderer& renderer, float tick, RenderResources& renderResource);
+
+		//   : Į, , ׸ڸ 帮 ޽ø Ŷ (Ʈ Ʈ ü Ʈ )
+		void Extract(Scene& scene, Renderer& renderer, FramePacket& packet);
+
+		//   : Į, ׸ , ۵ ̵
+		void Run(const FramePacket& packet, Renderer& renderer, RenderResources& renderResource);
 		void Finish();
 
 	private:
@@ -0,0 +1,46 @@
+﻿#include "pch.h"
+#include "EventBus.h"
+
+void core::EventBus::Flush()
+{
+	// 리스너가 다른 타입(또는 같은 타입)을 Push 하면 다음 패스에서 전달
+	for (int pass = 0; pass < MAX_FLUSH_PASSES; ++pass)
+	{
+		size_t delivered = 0;
+
+		for (auto queue : _order)
+			delivered += queue->Deliver();
+
+		if (delivered == 0)
+			return;
+	}
+
+	// 남은 이벤트는 다음 동기화 지점에서 전달
+}
+
+void core::EventBus::Clear()
+{
+	for (auto queue : _order)
+		queue->Clear();
+}
+
+std::vector<core::EventStats> core::EventBus::GetStats() const
+{
+	std::vector<EventStats> stats;
+	stats.reserve(_order.size());
+
+	for (auto queue : _order)
+		stats.push_back(queue->stats);
+
+	return stats;
+}
+
+void core::EventBus::ResetStats()
+{
+	for (auto queue : _order)
+	{
+		queue->stats.count = 0;
+		queue->stats.batches = 0;
+		queue->stats.milliseconds = 0.f;
+	}
+}
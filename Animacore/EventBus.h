@@ -0,0 +1,216 @@
+﻿#pragma once
+
+#include <span>
+#include <chrono>
+
+#include "Profiler.h"
+
+namespace core
+{
+	struct EventStats
+	{
+		const char* name = nullptr;		// 이벤트 타입 이름 (Profiler::Intern)
+		uint32_t count = 0;				// 전달한 이벤트 수
+		uint32_t batches = 0;			// 리스너 호출 횟수 (동기화 지점마다 한 번, 즉시 모드는 이벤트마다)
+		float milliseconds = 0.f;		// 리스너 실행 시간
+	};
+
+	/// \brief
+	/// \n 자주 발생하는 이벤트용 타입별 큐
+	///	\n Push 는 타입별 연속 배열에 추가만 하고, 동기화 지점(Scene::Update 단계 사이, ProcessEvent)의 Flush 에서
+	///	\n 리스너에 std::span 으로 한 번에 전달 (entt::dispatcher::trigger 처럼 이벤트마다 콜백을 타지 않음)
+	///	\n 즉시 모드에서는 Push 가 바로 리스너를 호출 (trigger 와 같은 동작, 비교용)
+	///	\n 리스너 연결은 메인 스레드에서 (시스템 생성자)
+	///	\n Push 는 스레드 안전하지 않으므로 한 타입은 한 시스템에서만 Push (현재 OnUpdateTransform 은 PhysicsSystem, OnUpdateLocalTransform 은 AnimatorSystem)
+	class EventBus
+	{
+	public:
+		template <typename Event>
+		using Signal = entt::sigh<void(std::span<const Event>)>;
+
+		// 동기화 지점에서 리스너가 만든 이벤트를 다시 전달하는 최대 횟수 (순환 방지)
+		static constexpr int MAX_FLUSH_PASSES = 8;
+
+		EventBus() = default;
+		~EventBus() = default;
+
+		EventBus(const EventBus&) = delete;
+		EventBus& operator=(const EventBus&) = delete;
+
+		template <typename Event>
+		entt::sink<Signal<Event>> Sink();
+
+		template <typename Event, typename... Args>
+		void Push(Args&&... args);
+
+		template <typename Type>
+		void Disconnect(Type* instance);
+
+		// 쌓인 이벤트를 타입별로 전달 (리스너가 Push 한 이벤트도 같은 Flush 에서 전달)
+		void Flush();
+
+		// 한 타입만 바로 전달 (다음 시스템이 결과를 봐야 해서 단계가 끝날 때까지 미룰 수 없는 경우)
+		template <typename Event>
+		void Flush();
+
+		// 전달하지 않고 버림 (씬 종료)
+		void Clear();
+
+		void SetDeferred(bool deferred) { _isDeferred = deferred; }
+		bool IsDeferred() const { return _isDeferred; }
+
+		// 마지막 ResetStats 이후 타입별 전달 통계 (Scene::Update 시작 시 초기화 = 한 프레임)
+		std::vector<EventStats> GetStats() const;
+		void ResetStats();
+
+	private:
+		struct QueueBase
+		{
+			virtual ~QueueBase() = default;
+
+			// 쌓인 이벤트 전달, 전달한 개수 반환
+			virtual size_t Deliver() = 0;
+			virtual void Disconnect(const void* instance) = 0;
+			virtual void Clear() = 0;
+
+			EventStats stats;
+		};
+
+		template <typename Event>
+		struct Queue : QueueBase
+		{
+			size_t Deliver() override;
+			void Publish(std::span<const Event> batch);
+			void Disconnect(const void* instance) override { entt::sink{ signal }.disconnect(instance); }
+			void Clear() override { events.clear(); }
+
+			std::vector<Event> events;
+			std::vector<Event> delivering;		// 전달 중 리스너가 같은 타입을 Push 해도 안전하도록 교체해서 사용
+			Signal<Event> signal;
+		};
+
+		template <typename Event>
+		Queue<Event>* findQueue();
+
+		template <typename Event>
+		Queue<Event>& assureQueue();
+
+		// entt::type_index 순번으로 바로 찾음 (연결된 적 없는 타입은 nullptr)
+		std::vector<std::unique_ptr<QueueBase>> _queues;
+		std::vector<QueueBase*> _order;		// 연결 순서 = 전달 순서
+		bool _isDeferred = true;
+	};
+
+	template <typename Event>
+	size_t EventBus::Queue<Event>::Deliver()
+	{
+		if (events.empty())
+			return 0;
+
+		delivering.swap(events);
+		Publish(delivering);
+
+		const size_t count = delivering.size();
+
+		// 용량은 유지해 다음 프레임부터 재할당 없음
+		delivering.clear();
+
+		return count;
+	}
+
+	template <typename Event>
+	void EventBus::Queue<Event>::Publish(std::span<const Event> batch)
+	{
+		PROFILE_SCOPE(stats.name);
+
+		const auto start = std::chrono::steady_clock::now();
+		signal.publish(batch);
+		const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		stats.count += static_cast<uint32_t>(batch.size());
+		stats.batches += 1;
+		stats.milliseconds += elapsed.count();
+	}
+
+	template <typename Event>
+	entt::sink<EventBus::Signal<Event>> EventBus::Sink()
+	{
+		return entt::sink{ assureQueue<Event>().signal };
+	}
+
+	template <typename Event, typename... Args>
+	void EventBus::Push(Args&&... args)
+	{
+		// 리스너가 없는 타입은 버림 (Push 중에는 큐를 만들지 않아 다른 타입의 동시 Push 와 경합 없음)
+		auto queue = findQueue<Event>();
+
+		if (!queue)
+			return;
+
+		if (_isDeferred)
+		{
+			if constexpr (std::is_aggregate_v<Event>)
+				queue->events.push_back(Event{ std::forward<Args>(args)... });
+			else
+				queue->events.emplace_back(std::forward<Args>(args)...);
+		}
+		else
+		{
+			const Event event{ std::forward<Args>(args)... };
+			queue->Publish(std::span<const Event>(&event, 1));
+		}
+	}
+
+	template <typename Event>
+	void EventBus::Flush()
+	{
+		auto queue = findQueue<Event>();
+
+		if (!queue)
+			return;
+
+		// 리스너가 같은 타입을 Push 하면 이어서 전달
+		for (int pass = 0; pass < MAX_FLUSH_PASSES; ++pass)
+		{
+			if (queue->Deliver() == 0)
+				return;
+		}
+	}
+
+	template <typename Type>
+	void EventBus::Disconnect(Type* instance)
+	{
+		for (auto queue : _order)
+			queue->Disconnect(instance);
+	}
+
+	template <typename Event>
+	EventBus::Queue<Event>* EventBus::findQueue()
+	{
+		const auto index = entt::type_index<Event>::value();
+
+		if (index >= _queues.size())
+			return nullptr;
+
+		return static_cast<Queue<Event>*>(_queues[index].get());
+	}
+
+	template <typename Event>
+	EventBus::Queue<Event>& EventBus::assureQueue()
+	{
+		const auto index = entt::type_index<Event>::value();
+
+		if (index >= _queues.size())
+			_queues.resize(index + 1);
+
+		if (!_queues[index])
+		{
+			auto queue = std::make_unique<Queue<Event>>();
+			queue->stats.name = Profiler::Get().Intern(entt::type_name<Event>::value());
+			_order.push_back(queue.get());
+			_queues[index] = std::move(queue);
+		}
+
+		return static_cast<Queue<Event>&>(*_queues[index]);
+	}
+}
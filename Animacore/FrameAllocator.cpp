@@ -0,0 +1,115 @@
+﻿#include "pch.h"
+#include "FrameAllocator.h"
+
+namespace
+{
+	std::mutex arenaMutex;
+	std::vector<core::FrameArena*> arenas;
+
+	// 스레드가 끝나면 목록에서 제거
+	struct ThreadArena
+	{
+		ThreadArena()
+		{
+			std::lock_guard lock(arenaMutex);
+			arenas.push_back(&arena);
+		}
+
+		~ThreadArena()
+		{
+			std::lock_guard lock(arenaMutex);
+			std::erase(arenas, &arena);
+		}
+
+		core::FrameArena arena;
+	};
+}
+
+core::FrameArena& core::FrameArena::Get()
+{
+	thread_local ThreadArena threadArena;
+	return threadArena.arena;
+}
+
+void core::FrameArena::ResetAll()
+{
+	std::lock_guard lock(arenaMutex);
+
+	size_t bytes = 0;
+
+	for (FrameArena* arena : arenas)
+	{
+		if (arena->_isSelfReset.load(std::memory_order_relaxed))
+			continue;
+
+		bytes += arena->_peak;
+		arena->Reset();
+	}
+
+	s_lastFrameBytes.store(bytes, std::memory_order_relaxed);
+}
+
+void* core::FrameArena::Allocate(size_t size, size_t alignment)
+{
+	while (_blockIndex < _blocks.size())
+	{
+		Block& block = _blocks[_blockIndex];
+
+		const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+		const size_t aligned = ((base + _offset + alignment - 1) & ~(alignment - 1)) - base;
+
+		if (aligned + size <= block.size)
+		{
+			_used += aligned + size - _offset;
+			_peak = (std::max)(_peak, _used);
+			_offset = aligned + size;
+
+			return block.data.get() + aligned;
+		}
+
+		// 남은 블록으로 넘어감 (이전 블록의 남은 공간은 버림)
+		++_blockIndex;
+		_offset = 0;
+	}
+
+	// 블록 추가 (정렬 여유분 포함)
+	const size_t blockSize = (std::max)(BLOCK_SIZE, size + alignment);
+	_blocks.push_back({ std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize });
+	_blockIndex = _blocks.size() - 1;
+	_offset = 0;
+
+	return Allocate(size, alignment);
+}
+
+void core::FrameArena::Deallocate(void* ptr, size_t size)
+{
+	if (_blockIndex >= _blocks.size())
+		return;
+
+	// 마지막 할당이면 되돌림 (vector 증가처럼 바로 다시 할당하는 경우)
+	std::byte* top = _blocks[_blockIndex].data.get() + _offset;
+	if (static_cast<std::byte*>(ptr) + size == top)
+	{
+		_offset -= size;
+		_used -= size;
+	}
+}
+
+void core::FrameArena::Reset()
+{
+	// 여러 블록을 썼으면 전체 크기의 블록 하나로 합침
+	if (_blocks.size() > 1)
+	{
+		size_t total = 0;
+		for (const Block& block : _blocks)
+			total += block.size;
+
+		_blocks.clear();
+		_blocks.push_back({ std::make_unique_for_overwrite<std::byte[]>(total), total });
+	}
+
+	_blockIndex = 0;
+	_offset = 0;
+	_used = 0;
+	_peak = 0;
+}
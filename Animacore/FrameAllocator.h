@@ -0,0 +1,101 @@
+﻿#pragma once
+
+#include <deque>
+
+namespace core
+{
+	/// \brief
+	/// \n 프레임 동안만 쓰는 임시 메모리용 선형(bump) 아레나, 스레드마다 하나
+	///	\n 해제는 마지막 할당만 되돌리고 나머지는 프레임 경계(Scene::ProcessEvent)에서 한 번에 초기화
+	///	\n 블록이 모자라면 새 블록을 붙이고, 초기화할 때 하나로 합쳐 다음 프레임부터는 힙 할당이 없음
+	///	\n 프레임을 넘겨 보관하는 컨테이너에는 사용 금지
+	class FrameArena
+	{
+	public:
+		static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+		FrameArena() = default;
+		~FrameArena() = default;
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		// 현재 스레드의 아레나
+		static FrameArena& Get();
+
+		// 프레임 경계에서 스레드 아레나 모두 초기화 (SelfReset 아레나 제외)
+		// 호출 시점에 아레나를 쓰는 작업이 실행 중이면 안 됨 (업데이트 단계 작업은 모두 끝난 뒤)
+		static void ResetAll();
+
+		// 직전 ResetAll 에서 초기화된 아레나 사용량 합
+		static size_t GetLastFrameBytes() { return s_lastFrameBytes.load(std::memory_order_relaxed); }
+
+		// 메인 프레임과 따로 도는 스레드(렌더 스레드)는 스스로 Reset 하도록 ResetAll 에서 제외
+		void SetSelfReset(bool selfReset) { _isSelfReset.store(selfReset, std::memory_order_relaxed); }
+
+		void* Allocate(size_t size, size_t alignment);
+		void Deallocate(void* ptr, size_t size);
+		void Reset();
+
+		size_t GetUsed() const { return _used; }
+
+	private:
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> data;
+			size_t size = 0;
+		};
+
+		std::vector<Block> _blocks;
+		size_t _blockIndex = 0;
+		size_t _offset = 0;
+		size_t _used = 0;
+		size_t _peak = 0;
+
+		std::atomic<bool> _isSelfReset = false;
+
+		inline static std::atomic<size_t> s_lastFrameBytes = 0;
+	};
+
+	/// \brief
+	/// \n FrameArena 를 쓰는 STL 할당자 (생성한 스레드의 아레나)
+	template <typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocator() noexcept : _arena(&FrameArena::Get()) {}
+
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U>& other) noexcept : _arena(other._arena) {}
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(_arena->Allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* ptr, size_t count) noexcept
+		{
+			_arena->Deallocate(ptr, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const FrameAllocator<U>& other) const noexcept { return _arena == other._arena; }
+
+	private:
+		FrameArena* _arena = nullptr;
+
+		template <typename U>
+		friend class FrameAllocator;
+	};
+
+	template <typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+	template <typename T>
+	using FrameDeque = std::deque<T, FrameAllocator<T>>;
+
+	template <typename Key, typename Value, typename Compare = std::less<Key>>
+	using FrameMap = std::map<Key, Value, Compare, FrameAllocator<std::pair<const Key, Value>>>;
+}
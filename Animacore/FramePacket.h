@@ -0,0 +1,238 @@
+﻿#pragma once
+
+#include "LightStructure.h"
+#include "ParticleStructures.h"
+
+class Mesh;
+class Material;
+class Texture;
+struct Font;
+
+namespace core
+{
+	class IFramePacketSystem;
+
+	/// \brief
+	/// \n 업데이트가 끝난 시점의 렌더 데이터 스냅샷
+	///	\n 메인 스레드가 Extract 로 채우고, 렌더 스레드는 레지스트리 대신 이 패킷만 읽어 제출함
+	///	\n Mesh, Material, Font 는 Renderer 가 소유하므로 포인터만 보관
+	///	\n 텍스처는 머티리얼에 shared_ptr 로 넘기고 컴포넌트가 먼저 지워질 수 있으므로 shared_ptr 로 보관
+	struct FramePacket
+	{
+		struct Camera
+		{
+			Matrix view = Matrix::Identity;
+			Matrix proj = Matrix::Identity;
+			Matrix viewProj = Matrix::Identity;
+			Matrix world = Matrix::Identity;
+			Vector3 position = Vector3::Zero;
+			bool hasMainCamera = false;
+		};
+
+		// 컬링을 통과한 메시 하나 (서브메시 드로우는 draws[firstDraw, firstDraw + drawCount))
+		struct MeshInstance
+		{
+			Mesh* mesh = nullptr;
+			Matrix world;
+			Matrix worldInvTranspose;
+			float emissiveFactor = 1.0f;
+			bool isCulling = true;
+			bool canReceivingDecal = true;
+
+			uint32_t firstDraw = 0;
+			uint32_t drawCount = 0;
+		};
+
+		struct SubMeshDraw
+		{
+			Material* material = nullptr;
+			uint32_t subMeshIndex = 0;
+			uint32_t lod = 0;
+
+			// 스키닝 메시만 사용 : bonePalettes[paletteOffset, paletteOffset + paletteCount)
+			uint32_t paletteOffset = 0;
+			uint32_t paletteCount = 0;
+			bool isSkinned = false;
+			bool isAnimated = false;	// 본 행렬에 월드가 포함되어 gWorld 를 단위 행렬로 덮어씀
+		};
+
+		struct Decal
+		{
+			Material* material = nullptr;
+			Matrix world;
+			float fadeFactor = 1.0f;
+		};
+
+		// 그림자를 드리우는 메시 (서브메시별 알파 텍스처는 shadowAlphas[firstAlpha, firstAlpha + subMeshCount), 없으면 nullptr)
+		struct ShadowCaster
+		{
+			Mesh* mesh = nullptr;
+			Matrix world;
+			Matrix worldInvTranspose;
+			Vector3 position = Vector3::Zero;
+			uint32_t lod = 0;
+			uint32_t subMeshCount = 0;
+			uint32_t firstAlpha = 0;
+			bool isCulling = true;
+		};
+
+		// 외곽선을 그릴 메시 (엔티티 값을 피킹 색으로 사용)
+		struct OutlineMesh
+		{
+			Mesh* mesh = nullptr;
+			Matrix world;
+			int entity = 0;
+			uint32_t subMeshCount = 0;
+		};
+
+		// 이번 프레임에 시뮬레이션할 파티클 (GPU 버퍼는 복사한 ParticleObject 가 붙잡아 둠)
+		struct ParticleEmitter
+		{
+			ParticleObject object;
+			std::shared_ptr<Texture> baseColorTexture;
+			std::shared_ptr<Texture> emissiveTexture;
+			int renderMode = 0;
+			bool isTwoSide = false;
+			bool isReset = false;	// 데드 리스트, 파티클 버퍼를 다시 초기화
+		};
+
+		// UI 사각형 하나 (2D 는 world 가 NDC 행렬)
+		struct UIQuad
+		{
+			std::shared_ptr<Texture> texture;
+			Matrix world;
+			float layerDepth = 0.0f;
+			Color color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float maskProgress = 1.0f;
+			int maskMode = 0;
+		};
+
+		// 3D 텍스트는 텍스처에 그린 뒤 world 사각형으로 붙이고, 2D 텍스트는 position 이 화면 좌표
+		struct Text
+		{
+			Font* font = nullptr;
+			std::string text;
+			Matrix world;
+			Vector2 position = Vector2::Zero;
+			Vector2 size = Vector2::Zero;
+			Vector2 scale = Vector2::One;
+			Color color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float fontSize = 32.0f;
+			float leftPadding = 0.0f;
+			int textAlign = 0;
+			int textBoxAlign = 0;
+			bool useUnderline = false;
+			bool useStrikeThrough = false;
+		};
+
+		struct ComboBox
+		{
+			Text text;
+			std::vector<std::string> items;
+			uint32_t curIndex = 0;
+			bool isOpen = false;
+		};
+
+		struct PostProcessVolume
+		{
+			Color bloomTint = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float bloomIntensity = 1.0f;
+			float bloomThreshold = 1.0f;
+			float bloomScatter = 0.5f;
+			int bloomCurve = 0;
+			bool useBloom = false;
+			bool useBloomScatter = false;
+
+			Color fogColor = { 0.7f, 0.7f, 0.7f, 1.0f };
+			float fogDensity = 0.01f;
+			float fogStart = 10.0f;
+			float fogRange = 300.0f;
+			bool useFog = false;
+
+			float exposure = 1.0f;
+			float contrast = 0.0f;
+			float saturation = 0.0f;
+			bool useExposure = false;
+		};
+
+		uint64_t frameIndex = 0;
+		float tick = 0.0f;
+		bool isPlaying = false;
+
+		Camera camera;
+		std::vector<MeshInstance> meshes;
+		std::vector<SubMeshDraw> draws;
+		std::vector<Matrix> bonePalettes;
+
+		// 포워드 (draws 를 디퍼드 메시와 같이 사용)
+		std::vector<MeshInstance> transparentMeshes;
+		std::vector<MeshInstance> waterMeshes;
+
+		// 조명 (셰이더 배열 크기만큼 복사하므로 Extract 에서 용량을 예약해 둠)
+		std::vector<DirectionalLightStructure> directionalLights;
+		std::vector<PointLightStructure> pointLights;
+		std::vector<PointLightStructure> nonShadowPointLights;
+		std::vector<SpotLightStructure> spotLights;
+
+		std::vector<Decal> decals;
+		std::vector<ShadowCaster> shadowCasters;
+		std::vector<std::shared_ptr<Texture>> shadowAlphas;
+		std::vector<OutlineMesh> outlineMeshes;
+		std::vector<ParticleEmitter> particles;
+
+		Material* skyMaterial = nullptr;
+		Mesh* skyMesh = nullptr;
+
+		// UI, 텍스트 (그리는 순서대로)
+		std::vector<Text> worldTexts;
+		std::vector<UIQuad> worldUIs;
+		std::vector<UIQuad> canvasUIs;
+		std::vector<UIQuad> screenUIs;	// 레이어 깊이가 큰 것부터
+		std::vector<Text> screenTexts;
+		std::vector<ComboBox> comboBoxes;
+
+		std::vector<PostProcessVolume> postProcessVolumes;
+
+		// 제출 순서대로 (PreRender -> Render -> PostRender), 패킷이 시스템 수명을 붙잡아 둠
+		std::vector<std::shared_ptr<IFramePacketSystem>> submitters;
+
+		// 용량은 유지하여 매 프레임 재할당을 피함
+		void Clear()
+		{
+			tick = 0.0f;
+			isPlaying = false;
+			camera = {};
+			meshes.clear();
+			draws.clear();
+			bonePalettes.clear();
+
+			transparentMeshes.clear();
+			waterMeshes.clear();
+
+			directionalLights.clear();
+			pointLights.clear();
+			nonShadowPointLights.clear();
+			spotLights.clear();
+
+			decals.clear();
+			shadowCasters.clear();
+			shadowAlphas.clear();
+			outlineMeshes.clear();
+			particles.clear();
+
+			skyMaterial = nullptr;
+			skyMesh = nullptr;
+
+			worldTexts.clear();
+			worldUIs.clear();
+			canvasUIs.clear();
+			screenUIs.clear();
+			screenTexts.clear();
+			comboBoxes.clear();
+
+			postProcessVolumes.clear();
+
+			submitters.clear();
+		}
+	};
+}
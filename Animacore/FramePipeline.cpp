@@ -0,0 +1,87 @@
+﻿#include "pch.h"
+#include "FramePipeline.h"
+
+#include "Profiler.h"
+#include "FrameAllocator.h"
+
+core::FramePipeline::FramePipeline(SubmitFunc submit)
+	: _submit(std::move(submit))
+{
+	_thread = std::jthread([this](std::stop_token token) { renderLoop(token); });
+}
+
+core::FramePipeline::~FramePipeline()
+{
+	Flush();
+
+	_thread.request_stop();
+	_condition.notify_all();
+}
+
+void core::FramePipeline::Flush()
+{
+	std::unique_lock lock(_mutex);
+	_condition.wait(lock, [this] { return _pending == nullptr; });
+}
+
+core::FramePacket& core::FramePipeline::GetExtractPacket()
+{
+	// Extract 는 에셋을 찾거나 텍스처를 만들며 Renderer 를 사용하므로 이전 제출이 끝난 뒤에 채움
+	Flush();
+
+	// 렌더 스레드는 항상 반대쪽 패킷만 읽음
+	auto& packet = _packets[_extractIndex];
+	packet.Clear();
+
+	return packet;
+}
+
+void core::FramePipeline::Kick()
+{
+	auto& packet = _packets[_extractIndex];
+	packet.frameIndex = _frameIndex++;
+
+	{
+		std::unique_lock lock(_mutex);
+		_condition.wait(lock, [this] { return _pending == nullptr; });
+		_pending = &packet;
+	}
+	_condition.notify_all();
+
+	_extractIndex ^= 1;
+}
+
+void core::FramePipeline::renderLoop(std::stop_token token)
+{
+	PROFILE_THREAD("Render");
+
+	// 메인 스레드의 ProcessEvent 와 겹쳐 제출하므로 패킷 단위로 직접 초기화
+	FrameArena& arena = FrameArena::Get();
+	arena.SetSelfReset(true);
+
+	while (true)
+	{
+		const FramePacket* packet = nullptr;
+		{
+			std::unique_lock lock(_mutex);
+			if (!_condition.wait(lock, token, [this] { return _pending != nullptr; }))
+				return;
+
+			packet = _pending;
+		}
+
+		{
+			PROFILE_SCOPE("FramePipeline::Submit");
+			_submit(*packet);
+		}
+
+		arena.Reset();
+
+		// 제출이 끝난 패킷은 다음 Extract 에서 재사용
+		{
+			std::lock_guard lock(_mutex);
+			_pending = nullptr;
+		}
+		_condition.notify_all();
+	}
+}
@@ -0,0 +1,51 @@
+﻿#pragma once
+
+#include <thread>
+#include <condition_variable>
+
+#include "FramePacket.h"
+
+namespace core
+{
+	/// \brief
+	/// \n 시뮬레이션과 렌더 제출을 한 프레임 겹쳐 실행 (업데이트 N+1 과 렌더 N 이 동시에 진행)
+	///	\n 패킷 두 개를 번갈아 사용하여 렌더 스레드가 읽는 패킷과 메인 스레드가 채우는 패킷을 분리함
+	///	\n Renderer(즉시 컨텍스트) 는 한 번에 한 스레드만 사용하므로, 메인 스레드가 Renderer 나
+	///	\n 렌더 자원을 건드리기 전(이벤트 처리, 씬 교체, 해상도 변경)에는 반드시 Flush 해야 함
+	class FramePipeline
+	{
+	public:
+		using SubmitFunc = std::function<void(const FramePacket&)>;
+
+		explicit FramePipeline(SubmitFunc submit);
+		~FramePipeline();
+
+		FramePipeline(const FramePipeline&) = delete;
+		FramePipeline& operator=(const FramePipeline&) = delete;
+
+		// 렌더 스레드가 제출 중인 패킷을 끝낼 때까지 대기
+		void Flush();
+
+		// 이번 프레임에 채울 패킷 (비워진 상태로 반환)
+		FramePacket& GetExtractPacket();
+
+		// 채운 패킷을 렌더 스레드로 넘기고 버퍼 교체 (이전 패킷이 끝나지 않았으면 대기)
+		void Kick();
+
+	private:
+		void renderLoop(std::stop_token token);
+
+		SubmitFunc _submit;
+
+		std::array<FramePacket, 2> _packets;
+		uint32_t _extractIndex = 0;
+		uint64_t _frameIndex = 0;
+
+		std::mutex _mutex;
+		std::condition_variable_any _condition;
+		const FramePacket* _pending = nullptr;	// 렌더 스레드가 처리 중이거나 처리할 패킷
+
+		// 다른 멤버가 모두 생성된 뒤 시작하고, 가장 먼저 정리되도록 마지막에 선언
+		std::jthread _thread;
+	};
+}
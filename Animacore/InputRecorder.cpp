@@ -0,0 +1,221 @@
+﻿#include "pch.h"
+#include "InputRecorder.h"
+
+namespace
+{
+	template <typename T>
+	void write(std::ostream& stream, const T& value)
+	{
+		stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	bool read(std::istream& stream, T& value)
+	{
+		return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+}
+
+bool core::InputRecorder::StartRecording(const std::filesystem::path& path, uint32_t seed)
+{
+	Stop();
+
+	_stream.open(path, std::ios::binary | std::ios::trunc);
+	if (!_stream.is_open())
+		return false;
+
+	_stream.write(MAGIC, sizeof(MAGIC));
+	write(_stream, VERSION);
+	write(_stream, seed);
+
+	_mode = Mode::Record;
+	_seed = seed;
+	_recordedCount = 0;
+	_previous = {};
+
+	return true;
+}
+
+bool core::InputRecorder::StartReplay(const std::filesystem::path& path)
+{
+	Stop();
+
+	std::ifstream stream(path, std::ios::binary);
+	if (!stream.is_open())
+		return false;
+
+	char magic[sizeof(MAGIC)] = {};
+	uint32_t version = 0;
+	uint32_t seed = 0;
+
+	if (!stream.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), MAGIC)
+		|| !read(stream, version) || version != VERSION
+		|| !read(stream, seed))
+		return false;
+
+	_previous = {};
+
+	Frame frame;
+	while (readFrame(stream, frame))
+		_frames.push_back(frame);
+
+	_mode = Mode::Replay;
+	_seed = seed;
+	_frameIndex = 0;
+
+	return true;
+}
+
+void core::InputRecorder::Stop()
+{
+	if (_mode == Mode::Record)
+	{
+		if (_hasPending)
+			writeFrame(_pending);
+
+		_stream.close();
+	}
+
+	_mode = Mode::None;
+	_hasPending = false;
+	_frames.clear();
+	_frameIndex = 0;
+}
+
+float core::InputRecorder::GetNextTick(float fallback) const
+{
+	if (_mode != Mode::Replay || _frameIndex >= _frames.size())
+		return fallback;
+
+	return _frames[_frameIndex].tick;
+}
+
+void core::InputRecorder::Record(const Frame& frame)
+{
+	if (_mode != Mode::Record)
+		return;
+
+	if (_hasPending)
+		writeFrame(_pending);
+
+	_pending = frame;
+	_pending.isSceneSwitch = false;
+	_hasPending = true;
+	++_recordedCount;
+}
+
+const core::InputRecorder::Frame* core::InputRecorder::Next()
+{
+	if (_mode != Mode::Replay || _frameIndex >= _frames.size())
+		return nullptr;
+
+	return &_frames[_frameIndex++];
+}
+
+void core::InputRecorder::MarkSceneSwitch()
+{
+	if (_mode == Mode::Record && _hasPending)
+		_pending.isSceneSwitch = true;
+}
+
+bool core::InputRecorder::IsSceneSwitchFrame() const
+{
+	if (_mode != Mode::Replay || _frameIndex == 0)
+		return false;
+
+	return _frames[_frameIndex - 1].isSceneSwitch;
+}
+
+void core::InputRecorder::writeFrame(const Frame& frame)
+{
+	// 프레임마다 flags + tick, 나머지는 이전 프레임과 달라진 것만
+	const std::bitset<256> changed = frame.pushed ^ _previous.pushed;
+	const bool isMouseChanged = frame.mousePosition != _previous.mousePosition || frame.mouseDeltaPosition != _previous.mouseDeltaPosition;
+
+	uint8_t flags = 0;
+	if (frame.isFocused)
+		flags |= Focused;
+	if (frame.isSceneSwitch)
+		flags |= SceneSwitch;
+	if (changed.any())
+		flags |= Keys;
+	if (isMouseChanged)
+		flags |= Mouse;
+	if (frame.mouseWheel != 0)
+		flags |= Wheel;
+
+	write(_stream, flags);
+	write(_stream, frame.tick);
+
+	if (flags & Keys)
+	{
+		write(_stream, static_cast<uint16_t>(changed.count()));
+
+		for (uint32_t key = 0; key < changed.size(); ++key)
+		{
+			if (changed[key])
+				write(_stream, static_cast<uint8_t>(key));
+		}
+	}
+
+	if (flags & Mouse)
+	{
+		write(_stream, frame.mousePosition);
+		write(_stream, frame.mouseDeltaPosition);
+	}
+
+	if (flags & Wheel)
+		write(_stream, static_cast<int32_t>(frame.mouseWheel));
+
+	_previous = frame;
+}
+
+bool core::InputRecorder::readFrame(std::istream& stream, Frame& frame)
+{
+	uint8_t flags = 0;
+
+	if (!read(stream, flags) || !read(stream, frame.tick))
+		return false;
+
+	frame.isFocused = flags & Focused;
+	frame.isSceneSwitch = flags & SceneSwitch;
+	frame.pushed = _previous.pushed;
+	frame.mousePosition = _previous.mousePosition;
+	frame.mouseDeltaPosition = _previous.mouseDeltaPosition;
+	frame.mouseWheel = 0;
+
+	if (flags & Keys)
+	{
+		uint16_t count = 0;
+		if (!read(stream, count))
+			return false;
+
+		for (uint16_t i = 0; i < count; ++i)
+		{
+			uint8_t key = 0;
+			if (!read(stream, key))
+				return false;
+
+			frame.pushed.flip(key);
+		}
+	}
+
+	if (flags & Mouse)
+	{
+		if (!read(stream, frame.mousePosition) || !read(stream, frame.mouseDeltaPosition))
+			return false;
+	}
+
+	if (flags & Wheel)
+	{
+		int32_t wheel = 0;
+		if (!read(stream, wheel))
+			return false;
+
+		frame.mouseWheel = wheel;
+	}
+
+	_previous = frame;
+
+	return true;
+}
@@ -0,0 +1,102 @@
+﻿#pragma once
+
+#include <bitset>
+#include <fstream>
+
+namespace core
+{
+	/// \brief
+	/// \n 프레임별 입력 상태와 tick 을 바이너리로 기록하고 그대로 재생 (재현 가능한 성능 측정용)
+	///	\n 기록 : InputSystem 이 Win32 에서 읽은 상태를 매 프레임 Record
+	///	\n 재생 : InputSystem 이 Win32 대신 Next 로 꺼낸 상태를 사용, 실행하는 쪽은 GetNextTick 으로 tick 을 맞춤
+	///	\n 씬 교체는 교체가 일어난 프레임에 표시해 두고 재생할 때 같은 프레임에서 교체
+	class InputRecorder
+	{
+	public:
+		enum class Mode
+		{
+			None,
+			Record,
+			Replay,
+		};
+
+		struct Frame
+		{
+			float tick = 0.f;
+			bool isFocused = false;
+			bool isSceneSwitch = false;		// 이 프레임이 끝날 때 씬이 교체됨
+
+			std::bitset<256> pushed;
+			Vector2 mousePosition;
+			Vector2 mouseDeltaPosition;
+			int mouseWheel = 0;
+		};
+
+		InputRecorder() = default;
+		~InputRecorder() { Stop(); }
+
+		InputRecorder(const InputRecorder&) = delete;
+		InputRecorder& operator=(const InputRecorder&) = delete;
+
+		// 파일을 열 수 없거나 형식이 다르면 false
+		bool StartRecording(const std::filesystem::path& path, uint32_t seed);
+		bool StartReplay(const std::filesystem::path& path);
+		void Stop();
+
+		Mode GetMode() const { return _mode; }
+		bool IsRecording() const { return _mode == Mode::Record; }
+		bool IsReplaying() const { return _mode == Mode::Replay; }
+
+		// 기록에 사용한 Scene 난수 시드 (재생 시 씬마다 같은 시드로 초기화)
+		uint32_t GetSeed() const { return _seed; }
+
+		// 재생 : 전체 프레임 수, 기록 : 지금까지 기록한 프레임 수
+		size_t GetFrameCount() const { return _mode == Mode::Replay ? _frames.size() : _recordedCount; }
+		size_t GetFrameIndex() const { return _frameIndex; }
+		bool IsFinished() const { return _mode == Mode::Replay && _frameIndex >= _frames.size(); }
+
+		// 재생 중이면 다음 프레임의 기록된 tick, 아니면 fallback
+		float GetNextTick(float fallback) const;
+
+		void Record(const Frame& frame);
+		// 재생할 다음 프레임 (끝났으면 nullptr)
+		const Frame* Next();
+
+		// 기록 : 마지막으로 기록한 프레임에 씬 교체 표시
+		void MarkSceneSwitch();
+		// 재생 : 마지막으로 꺼낸 프레임에서 씬이 교체되었는지
+		bool IsSceneSwitchFrame() const;
+
+	private:
+		static constexpr char MAGIC[4] = { 'A', 'I', 'N', 'P' };
+		static constexpr uint32_t VERSION = 1;
+
+		enum Flag : uint8_t
+		{
+			Focused = 1 << 0,
+			SceneSwitch = 1 << 1,
+			Keys = 1 << 2,			// 이전 프레임과 달라진 키 목록
+			Mouse = 1 << 3,			// 위치, 이동량
+			Wheel = 1 << 4,
+		};
+
+		void writeFrame(const Frame& frame);
+		bool readFrame(std::istream& stream, Frame& frame);
+
+		Mode _mode = Mode::None;
+		uint32_t _seed = 0;
+
+		// 기록 (마지막 프레임은 씬 교체 표시를 위해 다음 Record, Stop 까지 보류)
+		std::ofstream _stream;
+		Frame _pending;
+		bool _hasPending = false;
+		size_t _recordedCount = 0;
+
+		// 재생
+		std::vector<Frame> _frames;
+		size_t _frameIndex = 0;
+
+		// 변화량 부호화 기준 (이전 프레임)
+		Frame _previous;
+	};
+}
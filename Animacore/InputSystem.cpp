@@ -20,29 +20,18 @@ void core::InputSystem::PreUpdate(Scene& scene, float tick)
 	auto& input = scene.GetRegistry()->ctx().get<Input>();
 	auto keySize = input.keyStates.size();
 
-	if (const auto hWnd = GetFocus())
+	if (recorder.IsReplaying())
+	{
+		replay(input);
+		return;
+	}
+
+	const auto hWnd = GetFocus();
+
+	if (hWnd)
 	{
 		for (auto key = 0; key < keySize; ++key)
-		{
-			const bool isPushed = isKeyPressed(key);
-
-			if (isPushed)
-			{
-				if (input._prevPushed[key])
-					input.keyStates[key] = Input::State::Hold;
-				else
-					input.keyStates[key] = Input::State::Down;
-			}
-			else
-			{
-				if (input._prevPushed[key])
-					input.keyStates[key] = Input::State::Up;
-				else
-					input.keyStates[key] = Input::State::None;
-			}
-
-			input._prevPushed[key] = isPushed;
-		}
+			updateKey(input, key, isKeyPressed(key));
 
 		POINT pt;
 		GetCursorPos(&pt);
@@ -128,6 +117,21 @@ void core::InputSystem::PreUpdate(Scene& scene, float tick)
 		input.mouseDeltaRotation = Vector2::Zero;
 		input.mouseWheel = 0;
 	}
+
+	if (recorder.IsRecording())
+	{
+		InputRecorder::Frame frame;
+		frame.tick = tick;
+		frame.isFocused = hWnd != nullptr;
+		frame.mousePosition = input.mousePosition;
+		frame.mouseDeltaPosition = input.mouseDeltaPosition;
+		frame.mouseWheel = input.mouseWheel;
+
+		for (auto key = 0; key < keySize; ++key)
+			frame.pushed[key] = input._prevPushed[key];
+
+		recorder.Record(frame);
+	}
 }
 
 bool core::InputSystem::isKeyPressed(int keyCode)
@@ -138,6 +142,47 @@ bool core::InputSystem::isKeyPressed(int keyCode)
 	return false;
 }
 
+void core::InputSystem::updateKey(Input& input, int key, bool isPushed)
+{
+	if (isPushed)
+	{
+		if (input._prevPushed[key])
+			input.keyStates[key] = Input::State::Hold;
+		else
+			input.keyStates[key] = Input::State::Down;
+	}
+	else
+	{
+		if (input._prevPushed[key])
+			input.keyStates[key] = Input::State::Up;
+		else
+			input.keyStates[key] = Input::State::None;
+	}
+
+	input._prevPushed[key] = isPushed;
+}
+
+void core::InputSystem::replay(Input& input)
+{
+	// 기록이 끝나면 포커스를 잃은 것과 같이 처리
+	static const InputRecorder::Frame released;
+
+	const InputRecorder::Frame* frame = recorder.Next();
+	if (!frame)
+		frame = &released;
+
+	for (auto key = 0; key < input.keyStates.size(); ++key)
+		updateKey(input, key, frame->pushed[key]);
+
+	input.mousePosition = frame->mousePosition;
+	input.mouseDeltaPosition = frame->mouseDeltaPosition;
+	input._prevMousePosition = frame->mousePosition;
+
+	input.mouseDeltaRotation.x = input.mouseDeltaPosition.x / _windowWidth * 2.0f * DirectX::XM_PI;
+	input.mouseDeltaRotation.y = input.mouseDeltaPosition.y / _windowHeight * 2.0f * DirectX::XM_PI;
+	input.mouseWheel = frame->mouseWheel;
+}
+
 void core::InputSystem::startSystem(const OnStartSystem& event)
 {
 	// Input 컴포넌트 삽입
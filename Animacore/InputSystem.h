@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "SystemTraits.h"
 #include "SystemInterface.h"
+#include "InputRecorder.h"
 
 
 namespace global
@@ -31,8 +32,15 @@ namespace core
 		// 인풋은 업데이트 맨 처음 도는게 필요하다.
 		void PreUpdate(Scene& scene, float tick) override;
 
+		// 씬이 바뀌어도 이어서 기록, 재생
+		inline static InputRecorder recorder;
+
 	private:
 		bool isKeyPressed(int keyCode);
+		static void updateKey(Input& input, int key, bool isPushed);
+
+		// 기록된 프레임으로 Input 갱신 (Win32 대신)
+		void replay(Input& input);
 
 		// events
 		void startSystem(const OnStartSystem& event);
@@ -48,4 +56,5 @@ namespace core
 	};
 }
 DEFINE_SYSTEM_TRAITS(core::InputSystem)
+DEFINE_SYSTEM_WRITES(core::InputSystem, core::access::Context<core::Input>, core::access::MainThread)
 
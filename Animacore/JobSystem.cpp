@@ -0,0 +1,237 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+#include "Profiler.h"
+
+namespace
+{
+	// 현재 스레드가 속한 풀과 워커 인덱스
+	thread_local const core::JobSystem* t_owner = nullptr;
+	thread_local int t_workerIndex = -1;
+}
+
+core::JobSystem::JobSystem(uint32_t workerCount)
+{
+	if (workerCount == 0)
+		workerCount = (std::max)(std::thread::hardware_concurrency(), 2u) - 1;
+
+	for (uint32_t i = 0; i <= workerCount; ++i)
+		_queues.push_back(std::make_unique<WorkQueue>());
+
+	_workers.reserve(workerCount);
+
+	for (uint32_t i = 0; i < workerCount; ++i)
+		_workers.emplace_back([this, i](std::stop_token stopToken) { work(stopToken, i); });
+}
+
+core::JobSystem::~JobSystem()
+{
+	for (auto& worker : _workers)
+		worker.request_stop();
+
+	_workers.clear();
+}
+
+void core::JobSystem::Run(JobCounter& counter, Job job)
+{
+	counter._count.fetch_add(1, std::memory_order_relaxed);
+	push({ std::move(job), &counter });
+}
+
+void core::JobSystem::Run(Job job)
+{
+	push({ std::move(job), nullptr });
+}
+
+void core::JobSystem::Then(JobCounter& dependency, JobCounter& counter, Job job)
+{
+	counter._count.fetch_add(1, std::memory_order_relaxed);
+
+	{
+		std::lock_guard lock(dependency._continuationMutex);
+
+		if (!dependency.IsDone())
+		{
+			dependency._continuations.push_back({ std::move(job), &counter });
+			return;
+		}
+	}
+
+	// 이미 끝났으면 바로 실행
+	push({ std::move(job), &counter });
+}
+
+void core::JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func)
+{
+	if (count == 0)
+		return;
+
+	// 워커당 4 조각 정도로 나누어 먼저 끝난 워커가 나머지를 훔쳐갈 수 있게 함
+	if (grainSize == 0)
+		grainSize = (std::max<size_t>)(1, count / ((GetWorkerCount() + 1) * 4));
+
+	if (count <= grainSize || GetWorkerCount() == 0)
+	{
+		func(0, count);
+		return;
+	}
+
+	JobCounter counter;
+
+	// 첫 조각은 현재 스레드에서 처리
+	for (size_t begin = grainSize; begin < count; begin += grainSize)
+	{
+		const size_t end = (std::min)(begin + grainSize, count);
+		Run(counter, [&func, begin, end] { func(begin, end); });
+	}
+
+	func(0, grainSize);
+	Wait(counter);
+}
+
+void core::JobSystem::push(Task task)
+{
+	// 워커가 만든 작업은 자기 큐에 (캐시 지역성), 그 외는 공유 큐에
+	const int workerIndex = GetCurrentWorkerIndex();
+	auto& queue = *_queues[workerIndex >= 0 ? workerIndex : _queues.size() - 1];
+
+	{
+		std::lock_guard lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+	}
+
+	_pendingTasks.fetch_add(1, std::memory_order_release);
+
+	{
+		std::lock_guard lock(_sleepMutex);
+	}
+	_sleepCondition.notify_one();
+}
+
+void core::JobSystem::finish(JobCounter& counter)
+{
+	std::vector<JobCounter::Continuation> continuations;
+
+	{
+		// 후속 작업 등록과 경합하지 않도록 잠근 상태에서 감소
+		std::lock_guard lock(counter._continuationMutex);
+
+		if (counter._count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			return;
+
+		continuations.swap(counter._continuations);
+	}
+
+	for (auto& continuation : continuations)
+		push({ std::move(continuation.job), continuation.counter });
+}
+
+void core::JobSystem::Wait(JobCounter& counter)
+{
+	while (!counter.IsDone())
+	{
+		if (!TryRunOne())
+			std::this_thread::yield();
+	}
+
+	// 마지막 작업의 finish 가 counter 를 놓을 때까지 대기 (호출자가 counter 를 바로 해제할 수 있도록)
+	std::lock_guard lock(counter._continuationMutex);
+}
+
+bool core::JobSystem::TryRunOne()
+{
+	Task task;
+
+	if (!findTask(task))
+		return false;
+
+	execute(task);
+	return true;
+}
+
+int core::JobSystem::GetCurrentWorkerIndex() const
+{
+	return t_owner == this ? t_workerIndex : -1;
+}
+
+bool core::JobSystem::pop(size_t queueIndex, Task& task)
+{
+	auto& queue = *_queues[queueIndex];
+	std::lock_guard lock(queue.mutex);
+
+	if (queue.tasks.empty())
+		return false;
+
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+bool core::JobSystem::steal(size_t queueIndex, Task& task)
+{
+	auto& queue = *_queues[queueIndex];
+	std::lock_guard lock(queue.mutex);
+
+	if (queue.tasks.empty())
+		return false;
+
+	task = std::move(queue.tasks.front());
+	queue.tasks.pop_front();
+	return true;
+}
+
+bool core::JobSystem::findTask(Task& task)
+{
+	const size_t queueCount = _queues.size();
+	const size_t sharedIndex = queueCount - 1;
+	const int workerIndex = GetCurrentWorkerIndex();
+
+	// 자기 큐 (가장 최근 작업) -> 공유 큐 -> 다른 워커 큐 (가장 오래된 작업)
+	bool found = (workerIndex >= 0 && pop(workerIndex, task)) || steal(sharedIndex, task);
+
+	const size_t start = workerIndex >= 0 ? workerIndex + 1 : 0;
+
+	for (size_t i = 0; !found && i < sharedIndex; ++i)
+	{
+		const size_t victim = (start + i) % sharedIndex;
+
+		if (static_cast<int>(victim) != workerIndex)
+			found = steal(victim, task);
+	}
+
+	if (found)
+		_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+
+	return found;
+}
+
+void core::JobSystem::execute(Task& task)
+{
+	task.job();
+
+	if (task.counter)
+		finish(*task.counter);
+}
+
+void core::JobSystem::work(std::stop_token stopToken, uint32_t index)
+{
+	t_owner = this;
+	t_workerIndex = static_cast<int>(index);
+
+	PROFILE_THREAD(std::format("Job Worker {}", index));
+
+	while (!stopToken.stop_requested())
+	{
+		if (TryRunOne())
+			continue;
+
+		std::unique_lock lock(_sleepMutex);
+		_sleepCondition.wait(lock, stopToken, [this] { return _pendingTasks.load(std::memory_order_acquire) > 0; });
+	}
+}
+
+core::JobSystem& core::GetJobSystem()
+{
+	static JobSystem jobSystem;
+	return jobSystem;
+}
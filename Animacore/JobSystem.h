@@ -0,0 +1,151 @@
+﻿#pragma once
+
+#include <thread>
+#include <condition_variable>
+
+namespace core
+{
+	// fork-join 대기용 카운터 (Run 할 때 증가, 작업이 끝나면 감소)
+	// 0 이 되면 Then 으로 등록한 후속 작업이 실행됨
+	class JobCounter
+	{
+	public:
+		bool IsDone() const { return _count.load(std::memory_order_acquire) == 0; }
+
+	private:
+		struct Continuation
+		{
+			std::function<void()> job;
+			JobCounter* counter = nullptr;
+		};
+
+		std::atomic<uint32_t> _count = 0;
+		std::mutex _continuationMutex;
+		std::vector<Continuation> _continuations;
+
+		friend class JobSystem;
+	};
+
+	/// \brief
+	/// \n 엔진 공용 작업 스레드 풀 (work-stealing)
+	///	\n 워커마다 자기 큐를 가지고 뒤에서 꺼내며, 비면 다른 워커 큐의 앞에서 훔쳐옴
+	///	\n 워커가 아닌 스레드(메인 스레드)가 넣은 작업은 공유 큐로 들어감
+	///	\n Wait 하는 스레드도 작업을 대신 처리하므로 작업 안에서 다시 fork-join 해도 멈추지 않음
+	class JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+
+		// workerCount 가 0 이면 (하드웨어 스레드 수 - 1), 메인 스레드도 Wait 중에 작업을 처리함
+		explicit JobSystem(uint32_t workerCount = 0);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		uint32_t GetWorkerCount() const { return static_cast<uint32_t>(_workers.size()); }
+
+		// 작업 추가 (counter 는 작업이 끝날 때까지 유효해야 함)
+		void Run(JobCounter& counter, Job job);
+
+		// 완료를 기다리지 않는 작업 (PhysX 태스크 등)
+		void Run(Job job);
+
+		// dependency 의 작업이 모두 끝나면 job 실행 (counter 는 등록 시점부터 증가)
+		void Then(JobCounter& dependency, JobCounter& counter, Job job);
+
+		// [0, count) 를 grainSize 단위로 나누어 병렬 처리하고 끝날 때까지 대기, func(begin, end)
+		// grainSize 가 0 이면 워커 수에 맞춰 결정
+		void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& func);
+
+		// view/group 의 엔티티를 나누어 병렬 처리, func(entity, components&...) (each() 와 같은 인자)
+		// 병렬 실행 중에는 컴포넌트 추가/삭제 등 registry 구조 변경 금지
+		template <typename ViewOrGroup, typename Func>
+		void ParallelForEach(const ViewOrGroup& view, Func&& func, size_t grainSize = 0);
+
+		// counter 의 작업이 모두 끝날 때까지 다른 작업을 처리하며 대기
+		void Wait(JobCounter& counter);
+
+		// 대기 중인 작업 하나를 현재 스레드에서 처리 (없으면 false)
+		bool TryRunOne();
+
+		// 현재 스레드의 워커 인덱스 (워커가 아니면 -1)
+		int GetCurrentWorkerIndex() const;
+
+	private:
+		struct Task
+		{
+			Job job;
+			JobCounter* counter = nullptr;
+		};
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		void push(Task task);
+		void finish(JobCounter& counter);
+
+		bool pop(size_t queueIndex, Task& task);
+		bool steal(size_t queueIndex, Task& task);
+		bool findTask(Task& task);
+		void execute(Task& task);
+		void work(std::stop_token stopToken, uint32_t index);
+
+		// [0, workerCount) 는 워커 전용, 마지막은 외부 스레드 공유 큐
+		std::vector<std::unique_ptr<WorkQueue>> _queues;
+		std::vector<std::jthread> _workers;
+
+		// 잠든 워커를 깨우기 위한 대기 작업 수
+		std::atomic<uint32_t> _pendingTasks = 0;
+		std::mutex _sleepMutex;
+		std::condition_variable_any _sleepCondition;
+	};
+
+	// 엔진 공용 인스턴스 (처음 사용할 때 생성)
+	JobSystem& GetJobSystem();
+
+	template <typename ViewOrGroup, typename Func>
+	void JobSystem::ParallelForEach(const ViewOrGroup& view, Func&& func, size_t grainSize)
+	{
+		auto invoke = [&func](entt::entity entity, auto&& components)
+			{
+				std::apply([&](auto&... args) { func(entity, args...); }, components);
+			};
+
+		if constexpr (std::is_pointer_v<decltype(view.handle())>)
+		{
+			// view : 가장 작은 풀을 기준으로 나누고 나머지 조건은 contains 로 확인
+			const auto* handle = view.handle();
+			if (!handle)
+				return;
+
+			const entt::entity* entities = handle->data();
+
+			ParallelFor(handle->size(), grainSize, [&](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						if (view.contains(entities[i]))
+							invoke(entities[i], view.get(entities[i]));
+					}
+				});
+		}
+		else
+		{
+			// group : 엔티티가 연속으로 모여 있음
+			auto first = view.begin();
+
+			ParallelFor(view.size(), grainSize, [&](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						const entt::entity entity = first[static_cast<std::ptrdiff_t>(i)];
+						invoke(entity, view.get(entity));
+					}
+				});
+		}
+	}
+}
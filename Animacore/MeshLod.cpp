@@ -0,0 +1,39 @@
+﻿#include "pch.h"
+#include "MeshLod.h"
+
+#include "../Animavision/Mesh.h"
+
+float core::MeshLod::ScreenSize(const DirectX::BoundingSphere& sphere, const Vector3& eye, const Matrix& proj)
+{
+	// 직교 : _22 = 2 / 높이, 원근 : _22 = cot(fov / 2)
+	if (proj._44 != 0.0f)
+		return sphere.Radius * proj._22;
+
+	const float distance = Vector3::Distance(sphere.Center, eye);
+
+	if (distance <= sphere.Radius)
+		return FLT_MAX;
+
+	return sphere.Radius * proj._22 / distance;
+}
+
+uint32_t core::MeshLod::Select(const Mesh& mesh, float screenSize, float screenHeight, uint32_t current)
+{
+	const uint32_t count = mesh.GetLodCount();
+
+	if (count <= 1)
+		return 0;
+
+	// 반지름 1 이 화면에서 차지하는 픽셀
+	const float pixels = screenSize * 0.5f * screenHeight;
+
+	uint32_t lod = (std::min)(current, count - 1);
+
+	while (lod + 1 < count && mesh.lodErrors[lod + 1] * pixels <= ERROR_PIXELS * (1.0f - HYSTERESIS))
+		++lod;
+
+	while (lod > 0 && mesh.lodErrors[lod] * pixels > ERROR_PIXELS * (1.0f + HYSTERESIS))
+		--lod;
+
+	return lod;
+}
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+class Mesh;
+
+namespace core
+{
+	/// \brief
+	/// \n 임포트 시 만든 LOD 체인(Mesh::lodErrors, SubMeshDescriptor::lods) 에서 화면 크기로 단계를 고름
+	///	\n 단계별 단순화 오차(바운딩 반지름 대비) 를 화면 픽셀로 투영해 허용치 이하인 가장 거친 단계를 선택
+	///	\n 경계에서 단계가 매 프레임 바뀌지 않도록 거칠게는 허용치보다 충분히 작을 때, 세밀하게는 충분히 클 때만 이동
+	struct MeshLod
+	{
+		static constexpr float ERROR_PIXELS = 1.0f;		// 허용 화면 오차 (픽셀)
+		static constexpr float HYSTERESIS = 0.25f;		// 단계를 옮기는 여유 비율
+		static constexpr uint32_t SHADOW_BIAS = 1;		// 그림자 패스는 메인 뷰보다 이만큼 거친 단계 (넘으면 가장 거친 단계)
+
+		// 월드 바운딩 구 지름의 화면 높이 대비 비율 (카메라가 구 안에 있으면 FLT_MAX)
+		static float ScreenSize(const DirectX::BoundingSphere& sphere, const Vector3& eye, const Matrix& proj);
+
+		// current 는 이전 프레임에 고른 단계 (MeshRenderer::lod)
+		static uint32_t Select(const Mesh& mesh, float screenSize, float screenHeight, uint32_t current);
+	};
+}
@@ -332,7 +332,9 @@ namespace core
 				SET_MEMBER(NavMeshSettings::partitionType, "Parition Type")
 				SET_MEMBER(NavMeshSettings::navMeshBMin, "NavMesh Box Min")
 				SET_MEMBER(NavMeshSettings::navMeshBMax, "NavMesh Box Max")
-				SET_MEMBER(NavMeshSettings::tileSize, "Tile Size");
+				SET_MEMBER(NavMeshSettings::tileSize, "Tile Size")
+				SET_MEMBER(NavMeshSettings::maxAgents, "Max Agents")
+				SET_MEMBER(NavMeshSettings::maxPathRequestsPerFrame, "Path Requests Per Frame");
 
 			REGISTER_COMPONENT_META(Agent)
 				SET_DEFAULT_FUNC(Agent)
@@ -344,6 +346,15 @@ namespace core
 				SET_MEMBER(Agent::destination, "Destination")
 				SET_MEMBER(Agent::isStopped, "Is Stopped");
 
+			REGISTER_COMPONENT_META(NavMeshObstacle)
+				SET_DEFAULT_FUNC(NavMeshObstacle)
+				SET_MEMBER(NavMeshObstacle::shape, "Shape")
+				SET_MEMBER(NavMeshObstacle::center, "Center")
+				SET_MEMBER(NavMeshObstacle::size, "Size")
+				SET_MEMBER(NavMeshObstacle::radius, "Radius")
+				SET_MEMBER(NavMeshObstacle::height, "Height")
+				SET_MEMBER(NavMeshObstacle::moveThreshold, "Move Threshold");
+
 			REGISTER_COMPONENT_META(ParticleSystem)
 				SET_DEFAULT_FUNC(ParticleSystem)
 				SET_MEMBER(ParticleSystem::mainData, "Main Data")
@@ -628,6 +639,11 @@ namespace core
 					SET_VALUE(CapsuleCollider::Axis::Y, "Y")
 					SET_VALUE(CapsuleCollider::Axis::Z, "Z");
 
+				REGISTER_CUSTOM_ENUM_META(NavMeshObstacle::Shape)
+					SET_NAME(NavMeshObstacle::Shape)
+					SET_VALUE(NavMeshObstacle::Shape::Cylinder, "Cylinder")
+					SET_VALUE(NavMeshObstacle::Shape::Box, "Box");
+
 				REGISTER_CUSTOM_ENUM_META(Rigidbody::Interpolation)
 					SET_NAME(Rigidbody::Interpolation)
 					SET_VALUE(Rigidbody::Interpolation::None, "None")
@@ -2,6 +2,7 @@
 
 class dtNavMesh;
 class dtNavMeshQuery;
+class dtTileCache;
 
 namespace core
 {
@@ -9,6 +10,7 @@ namespace core
 	{
 		dtNavMesh* navMesh = nullptr;			// Detour 네비게이션 메쉬 포인터
 		dtNavMeshQuery* navMeshQuery = nullptr;	// 경로 탐색용 쿼리 객체
+		dtTileCache* tileCache = nullptr;		// 동적 장애물용 타일 캐시 (장애물이 없는 씬은 nullptr)
 	};
 
 	struct NavMeshSettings
@@ -104,6 +106,16 @@ namespace core
 		// 타일의 크기에 따라 탐색 성능과 메모리 사용량이 영향을 받습니다.
 		float tileSize = 32.f;
 
+		// 최대 에이전트 수
+		// Crowd 가 처음 확보하는 에이전트 수입니다.
+		// 실행 중 부족해지면 두 배씩 늘어나므로 씬에서 예상되는 수를 지정하면 재할당을 피할 수 있습니다.
+		int maxAgents = 64;
+
+		// 프레임당 경로 요청 수
+		// 에이전트 배치 및 목적지 변경 시의 탐색(findNearestPoly) 을 프레임당 이 수만큼만 처리합니다.
+		// 나머지 요청은 다음 프레임으로 미뤄집니다.
+		int maxPathRequestsPerFrame = 32;
+
 		
 		std::string objMesh;
 
@@ -4,10 +4,180 @@
 #include "Scene.h"
 #include "NavConfigs.h"
 #include "CoreSystemEvents.h"
+#include "JobSystem.h"
 
+#include <atomic>
 #include <fstream>
+#include <recastnavigation/DetourAlloc.h>
+#include <recastnavigation/DetourCommon.h>
 #include <recastnavigation/DetourNavMesh.h>
 #include <recastnavigation/DetourNavMeshBuilder.h>
+#include <recastnavigation/DetourTileCache.h>
+#include <recastnavigation/DetourTileCacheBuilder.h>
+
+namespace
+{
+	// 타일 캐시 파일 (.nav) 포맷
+	constexpr uint32_t NAV_CACHE_MAGIC = 'M' << 24 | 'C' << 16 | 'N' << 8 | 'V';
+	constexpr uint32_t NAV_CACHE_VERSION = 2;
+
+	// 생성 방식 (같은 경로라도 방식이 다르면 캐시를 재사용하지 않음)
+	constexpr uint64_t NAV_SEED_TILED = 'T' << 24 | 'I' << 16 | 'L' << 8 | 'E';
+	constexpr uint64_t NAV_SEED_LAYERS = 'L' << 24 | 'A' << 16 | 'Y' << 8 | 'R';
+
+	// 타일당 예상 레이어 수 및 동시 장애물 수
+	constexpr int EXPECTED_LAYERS_PER_TILE = 4;
+	constexpr int MAX_LAYERS_PER_TILE = 32;
+	constexpr int MAX_OBSTACLES = 256;
+
+	struct NavCacheHeader
+	{
+		uint32_t magic = NAV_CACHE_MAGIC;
+		uint32_t version = NAV_CACHE_VERSION;
+		uint64_t settingsHash = 0;
+		uint64_t geometryHash = 0;
+		int tileCount = 0;
+	};
+
+	struct NavCacheTileHeader
+	{
+		int x = 0;
+		int y = 0;
+		uint64_t hash = 0;
+		int dataSize = 0;
+	};
+
+	// FNV-1a
+	uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull)
+	{
+		const auto* bytes = static_cast<const unsigned char*>(data);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	template <typename T>
+	uint64_t HashValue(const T& value, uint64_t hash = 14695981039346656037ull)
+	{
+		return HashBytes(&value, sizeof(T), hash);
+	}
+
+	// 레이어 압축 (PackBits 방식의 RLE)
+	// 높이/영역/연결 정보는 같은 값이 길게 반복되므로 단순 RLE 로도 충분히 줄어듦
+	class RleCompressor : public dtTileCacheCompressor
+	{
+	public:
+		int maxCompressedSize(const int bufferSize) override
+		{
+			return bufferSize + (bufferSize + 127) / 128;
+		}
+
+		dtStatus compress(const unsigned char* buffer, const int bufferSize,
+			unsigned char* compressed, const int maxCompressedSize, int* compressedSize) override
+		{
+			int in = 0;
+			int out = 0;
+
+			while (in < bufferSize)
+			{
+				// 반복 구간 (3 ~ 128)
+				int run = 1;
+				while (in + run < bufferSize && run < 128 && buffer[in + run] == buffer[in])
+					++run;
+
+				if (run >= 3)
+				{
+					if (out + 2 > maxCompressedSize)
+						return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+
+					compressed[out++] = static_cast<unsigned char>(257 - run);
+					compressed[out++] = buffer[in];
+					in += run;
+					continue;
+				}
+
+				// 리터럴 구간 (1 ~ 128)
+				const int literalStart = in;
+				while (in < bufferSize && in - literalStart < 128)
+				{
+					if (in + 2 < bufferSize && buffer[in] == buffer[in + 1] && buffer[in] == buffer[in + 2])
+						break;
+					++in;
+				}
+
+				const int length = in - literalStart;
+				if (out + 1 + length > maxCompressedSize)
+					return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+
+				compressed[out++] = static_cast<unsigned char>(length - 1);
+				memcpy(compressed + out, buffer + literalStart, length);
+				out += length;
+			}
+
+			*compressedSize = out;
+			return DT_SUCCESS;
+		}
+
+		dtStatus decompress(const unsigned char* compressed, const int compressedSize,
+			unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+		{
+			int in = 0;
+			int out = 0;
+
+			while (in < compressedSize)
+			{
+				const int header = compressed[in++];
+
+				if (header < 128)
+				{
+					const int length = header + 1;
+					if (in + length > compressedSize || out + length > maxBufferSize)
+						return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+
+					memcpy(buffer + out, compressed + in, length);
+					in += length;
+					out += length;
+				}
+				else
+				{
+					const int length = 257 - header;
+					if (in >= compressedSize || out + length > maxBufferSize)
+						return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+
+					memset(buffer + out, compressed[in++], length);
+					out += length;
+				}
+			}
+
+			*bufferSize = out;
+			return DT_SUCCESS;
+		}
+	};
+
+	// 타일 캐시가 생성한 폴리곤에 플래그 부여
+	class WalkableMeshProcess : public dtTileCacheMeshProcess
+	{
+	public:
+		void process(dtNavMeshCreateParams* params, unsigned char* polyAreas, unsigned short* polyFlags) override
+		{
+			for (int i = 0; i < params->polyCount; ++i)
+			{
+				if (polyAreas[i] == DT_TILECACHE_WALKABLE_AREA)
+					polyFlags[i] = 1;
+			}
+		}
+	};
+
+	// 상태가 없으므로 모든 타일 캐시가 공유
+	RleCompressor g_tileCompressor;
+	WalkableMeshProcess g_tileMeshProcess;
+	dtTileCacheAlloc g_tileAllocator;
+}
 
 core::NavMeshBuilder::NavMeshBuilder(Scene* scene)
 	: _scene(scene)
@@ -167,16 +337,18 @@ bool core::NavMeshBuilder::BuildNavMesh(const NavMeshSettings& settings, NavMesh
 	}
 
 	_navMesh = dtAllocNavMesh();
-	if (!_navMesh || !_navMesh->init(navData, navDataSize, DT_TILE_FREE_DATA)) {
+	if (!_navMesh || dtStatusFailed(_navMesh->init(navData, navDataSize, DT_TILE_FREE_DATA))) {
 		dtFree(navData);
 		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize Detour navmesh.");
+		releaseDetour();
 		cleanup();
 		return false;
 	}
 
 	_navMeshQuery = dtAllocNavMeshQuery();
-	if (!_navMeshQuery->init(_navMesh, 2048)) {
+	if (!_navMeshQuery || dtStatusFailed(_navMeshQuery->init(_navMesh, 2048))) {
 		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize Detour navmesh query.");
+		releaseDetour();
 		cleanup();
 		return false;
 	}
@@ -188,6 +360,589 @@ bool core::NavMeshBuilder::BuildNavMesh(const NavMeshSettings& settings, NavMesh
 	return true;
 }
 
+bool core::NavMeshBuilder::BuildTiledNavMesh(const NavMeshSettings& settings, NavMeshData& data, const std::filesystem::path& cachePath)
+{
+	if (_vertices.empty() || _indices.empty()) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nNo mesh data available for NavMesh building.");
+		return false;
+	}
+
+	TileGrid grid;
+	prepareTileGrid(settings, NAV_SEED_TILED, grid);
+
+	// Detour 타일 레퍼런스 비트 분배
+	const int tileBits = rcMin(static_cast<int>(dtIlog2(dtNextPow2(grid.width * grid.height))), 14);
+	const int polyBits = 22 - tileBits;
+
+	dtNavMeshParams params;
+	memset(&params, 0, sizeof(params));
+	rcVcopy(params.orig, grid.bMin);
+	params.tileWidth = grid.tileWorldSize;
+	params.tileHeight = grid.tileWorldSize;
+	params.maxTiles = 1 << tileBits;
+	params.maxPolys = 1 << polyBits;
+
+	auto tiles = buildTiles(grid, cachePath,
+		[this, &settings](rcContext& context, const rcConfig& config, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out)
+		{
+			return buildTileMesh(context, config, settings, triangles, tile, out);
+		});
+
+	_navMesh = dtAllocNavMesh();
+	if (!_navMesh || dtStatusFailed(_navMesh->init(&params))) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize tiled Detour navmesh.");
+		for (auto& tile : tiles)
+			dtFree(tile.data);
+		releaseDetour();
+		cleanup();
+		return false;
+	}
+
+	for (auto& tile : tiles)
+	{
+		if (tile.data && dtStatusFailed(_navMesh->addTile(tile.data, tile.dataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+			dtFree(tile.data);
+	}
+
+	_navMeshQuery = dtAllocNavMeshQuery();
+	if (!_navMeshQuery || dtStatusFailed(_navMeshQuery->init(_navMesh, 2048))) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize Detour navmesh query.");
+		releaseDetour();
+		cleanup();
+		return false;
+	}
+
+	data.navMesh = _navMesh;
+	data.navMeshQuery = _navMeshQuery;
+
+	return true;
+}
+
+bool core::NavMeshBuilder::BuildTileCache(const NavMeshSettings& settings, NavMeshData& data, const std::filesystem::path& cachePath)
+{
+	if (_vertices.empty() || _indices.empty()) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nNo mesh data available for NavMesh building.");
+		return false;
+	}
+
+	TileGrid grid;
+	prepareTileGrid(settings, NAV_SEED_LAYERS, grid);
+
+	// 타일 캐시 설정
+	dtTileCacheParams cacheParams;
+	memset(&cacheParams, 0, sizeof(cacheParams));
+	rcVcopy(cacheParams.orig, grid.bMin);
+	cacheParams.cs = grid.config.cs;
+	cacheParams.ch = grid.config.ch;
+	cacheParams.width = grid.config.tileSize;
+	cacheParams.height = grid.config.tileSize;
+	cacheParams.walkableHeight = settings.agentHeight;
+	cacheParams.walkableRadius = settings.agentRadius;
+	cacheParams.walkableClimb = settings.agentMaxClimb;
+	cacheParams.maxSimplificationError = grid.config.maxSimplificationError;
+	cacheParams.maxTiles = grid.width * grid.height * EXPECTED_LAYERS_PER_TILE;
+	cacheParams.maxObstacles = MAX_OBSTACLES;
+
+	// Detour 타일 레퍼런스 비트 분배 (레이어 수 포함)
+	const int tileBits = rcMin(static_cast<int>(dtIlog2(dtNextPow2(grid.width * grid.height * EXPECTED_LAYERS_PER_TILE))), 14);
+	const int polyBits = 22 - tileBits;
+
+	dtNavMeshParams params;
+	memset(&params, 0, sizeof(params));
+	rcVcopy(params.orig, grid.bMin);
+	params.tileWidth = grid.tileWorldSize;
+	params.tileHeight = grid.tileWorldSize;
+	params.maxTiles = 1 << tileBits;
+	params.maxPolys = 1 << polyBits;
+
+	auto tiles = buildTiles(grid, cachePath,
+		[this](rcContext& context, const rcConfig& config, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out)
+		{
+			return buildTileLayers(context, config, triangles, tile, out);
+		});
+
+	dtTileCache* tileCache = dtAllocTileCache();
+	if (!tileCache || dtStatusFailed(tileCache->init(&cacheParams, &g_tileAllocator, &g_tileCompressor, &g_tileMeshProcess))) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize tile cache.");
+		dtFreeTileCache(tileCache);
+		for (auto& tile : tiles)
+			dtFree(tile.data);
+		return false;
+	}
+
+	_navMesh = dtAllocNavMesh();
+	if (!_navMesh || dtStatusFailed(_navMesh->init(&params))) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize tiled Detour navmesh.");
+		dtFreeTileCache(tileCache);
+		for (auto& tile : tiles)
+			dtFree(tile.data);
+		releaseDetour();
+		cleanup();
+		return false;
+	}
+
+	// 압축 레이어 등록 후 타일별로 네비게이션 메쉬 생성
+	for (auto& tile : tiles)
+	{
+		if (tile.data && dtStatusFailed(tileCache->addTile(tile.data, tile.dataSize, DT_COMPRESSEDTILE_FREE_DATA, nullptr)))
+			dtFree(tile.data);
+	}
+
+	for (int y = 0; y < grid.height; ++y)
+	{
+		for (int x = 0; x < grid.width; ++x)
+			tileCache->buildNavMeshTilesAt(x, y, _navMesh);
+	}
+
+	_navMeshQuery = dtAllocNavMeshQuery();
+	if (!_navMeshQuery || dtStatusFailed(_navMeshQuery->init(_navMesh, 2048))) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to initialize Detour navmesh query.");
+		dtFreeTileCache(tileCache);
+		releaseDetour();
+		cleanup();
+		return false;
+	}
+
+	data.navMesh = _navMesh;
+	data.navMeshQuery = _navMeshQuery;
+	data.tileCache = tileCache;
+
+	return true;
+}
+
+void core::NavMeshBuilder::prepareTileGrid(const NavMeshSettings& settings, uint64_t seed, TileGrid& grid) const
+{
+	// 타일 공통 설정
+	rcConfig& config = grid.config;
+	memset(&config, 0, sizeof(config));
+	config.cs = settings.cellSize;
+	config.ch = settings.cellHeight;
+	config.walkableSlopeAngle = settings.agentMaxSlope;
+	config.walkableHeight = static_cast<int>(ceilf(settings.agentHeight / config.ch));
+	config.walkableClimb = static_cast<int>(floorf(settings.agentMaxClimb / config.ch));
+	config.walkableRadius = static_cast<int>(ceilf(settings.agentRadius / config.cs));
+	config.maxEdgeLen = static_cast<int>(settings.edgeMaxLen / config.cs);
+	config.maxSimplificationError = settings.edgeMaxError;
+	config.minRegionArea = static_cast<int>(rcSqr(settings.regionMinSize));
+	config.mergeRegionArea = static_cast<int>(rcSqr(settings.regionMergeSize));
+	config.maxVertsPerPoly = static_cast<int>(settings.vertsPerPoly);
+	config.detailSampleDist = settings.detailSampleDist < 0.9f ? 0 : config.cs * settings.detailSampleDist;
+	config.detailSampleMaxError = config.ch * settings.detailSampleMaxError;
+	config.tileSize = (std::max)(static_cast<int>(settings.tileSize), 8);
+	config.borderSize = config.walkableRadius + 3;
+	config.width = config.tileSize + config.borderSize * 2;
+	config.height = config.tileSize + config.borderSize * 2;
+
+	// 영역이 지정되어 있으면 지정 영역을 사용 (타일 격자가 지오메트리 변경에 흔들리지 않음)
+	if (settings.navMeshBMin != settings.navMeshBMax)
+	{
+		rcVcopy(grid.bMin, &settings.navMeshBMin.x);
+		rcVcopy(grid.bMax, &settings.navMeshBMax.x);
+	}
+	else
+	{
+		rcVcopy(grid.bMin, _bMin);
+		rcVcopy(grid.bMax, _bMax);
+	}
+
+	int gridWidth = 0;
+	int gridHeight = 0;
+	rcCalcGridSize(grid.bMin, grid.bMax, config.cs, &gridWidth, &gridHeight);
+
+	grid.tileWorldSize = config.tileSize * config.cs;
+	grid.width = (gridWidth + config.tileSize - 1) / config.tileSize;
+	grid.height = (gridHeight + config.tileSize - 1) / config.tileSize;
+
+	// 설정 해시 (격자 원점/크기 포함)
+	grid.settingsHash = HashValue(seed, HashValue(NAV_CACHE_VERSION));
+	for (float value : { settings.cellSize, settings.cellHeight, settings.agentHeight, settings.agentRadius,
+		settings.agentMaxClimb, settings.agentMaxSlope, settings.regionMinSize, settings.regionMergeSize,
+		settings.edgeMaxLen, settings.edgeMaxError, settings.vertsPerPoly, settings.detailSampleDist,
+		settings.detailSampleMaxError, settings.tileSize, grid.bMin[0], grid.bMin[1], grid.bMin[2], grid.bMax[1] })
+	{
+		grid.settingsHash = HashValue(value, grid.settingsHash);
+	}
+	grid.settingsHash = HashValue(settings.partitionType, grid.settingsHash);
+	grid.settingsHash = HashValue(grid.width, HashValue(grid.height, grid.settingsHash));
+
+	// 삼각형을 (경계 포함) 겹치는 타일에 분배
+	const float borderWorldSize = config.borderSize * config.cs;
+	const int triangleCount = static_cast<int>(_indices.size() / 3);
+	grid.triangles.assign(static_cast<size_t>(grid.width) * grid.height, {});
+
+	for (int t = 0; t < triangleCount; ++t)
+	{
+		float triMin[3];
+		float triMax[3];
+		rcVcopy(triMin, &_vertices[_indices[t * 3] * 3]);
+		rcVcopy(triMax, triMin);
+
+		for (int k = 1; k < 3; ++k)
+		{
+			const float* v = &_vertices[_indices[t * 3 + k] * 3];
+			rcVmin(triMin, v);
+			rcVmax(triMax, v);
+		}
+
+		const int minX = rcClamp(static_cast<int>(floorf((triMin[0] - grid.bMin[0] - borderWorldSize) / grid.tileWorldSize)), 0, grid.width - 1);
+		const int maxX = rcClamp(static_cast<int>(floorf((triMax[0] - grid.bMin[0] + borderWorldSize) / grid.tileWorldSize)), 0, grid.width - 1);
+		const int minY = rcClamp(static_cast<int>(floorf((triMin[2] - grid.bMin[2] - borderWorldSize) / grid.tileWorldSize)), 0, grid.height - 1);
+		const int maxY = rcClamp(static_cast<int>(floorf((triMax[2] - grid.bMin[2] + borderWorldSize) / grid.tileWorldSize)), 0, grid.height - 1);
+
+		for (int y = minY; y <= maxY; ++y)
+			for (int x = minX; x <= maxX; ++x)
+				grid.triangles[y * grid.width + x].push_back(t);
+	}
+
+	// 타일별 지오메트리 해시
+	grid.hashes.assign(grid.triangles.size(), 0);
+	for (int y = 0; y < grid.height; ++y)
+	{
+		for (int x = 0; x < grid.width; ++x)
+		{
+			uint64_t hash = HashValue(x, HashValue(y, grid.settingsHash));
+
+			for (int t : grid.triangles[y * grid.width + x])
+			{
+				for (int k = 0; k < 3; ++k)
+					hash = HashBytes(&_vertices[_indices[t * 3 + k] * 3], sizeof(float) * 3, hash);
+			}
+
+			grid.hashes[y * grid.width + x] = hash;
+		}
+	}
+}
+
+std::vector<core::NavMeshBuilder::TileData> core::NavMeshBuilder::buildTiles(const TileGrid& grid, const std::filesystem::path& cachePath, const TileBuildFunc& build)
+{
+	std::vector<TileData> tiles;
+
+	// 캐시와 비교하여 해시가 같은 타일은 재사용
+	std::vector<TileData> cachedTiles;
+	if (!cachePath.empty())
+		loadTileCache(cachePath, grid.settingsHash, cachedTiles);
+
+	std::vector<bool> reused(grid.triangles.size(), false);
+	bool cacheChanged = cachedTiles.empty();
+
+	for (auto& cached : cachedTiles)
+	{
+		const bool inGrid = cached.x >= 0 && cached.x < grid.width && cached.y >= 0 && cached.y < grid.height;
+
+		if (inGrid && grid.hashes[cached.y * grid.width + cached.x] == cached.hash)
+		{
+			reused[cached.y * grid.width + cached.x] = true;
+			tiles.push_back(cached);
+		}
+		else
+		{
+			dtFree(cached.data);
+			cacheChanged = true;
+		}
+	}
+
+	std::vector<size_t> dirtyTiles;
+	for (size_t i = 0; i < grid.triangles.size(); ++i)
+	{
+		if (!reused[i] && !grid.triangles[i].empty())
+			dirtyTiles.push_back(i);
+	}
+
+	// 변경된 타일을 병렬로 생성
+	std::vector<std::vector<TileData>> results(dirtyTiles.size());
+	std::atomic<int> failedTiles = 0;
+
+	auto buildRange = [&](size_t begin, size_t end)
+		{
+			// rcContext 는 스레드간 공유 불가
+			rcContext context(false);
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				const size_t index = dirtyTiles[i];
+				const int x = static_cast<int>(index % grid.width);
+				const int y = static_cast<int>(index / grid.width);
+
+				rcConfig config = grid.config;
+				config.bmin[0] = grid.bMin[0] + x * grid.tileWorldSize;
+				config.bmin[1] = grid.bMin[1];
+				config.bmin[2] = grid.bMin[2] + y * grid.tileWorldSize;
+				config.bmax[0] = grid.bMin[0] + (x + 1) * grid.tileWorldSize;
+				config.bmax[1] = grid.bMax[1];
+				config.bmax[2] = grid.bMin[2] + (y + 1) * grid.tileWorldSize;
+
+				// 경계 영역만큼 확장 (인접 타일과의 연결을 위해)
+				config.bmin[0] -= config.borderSize * config.cs;
+				config.bmin[2] -= config.borderSize * config.cs;
+				config.bmax[0] += config.borderSize * config.cs;
+				config.bmax[2] += config.borderSize * config.cs;
+
+				TileData tile = { x, y, grid.hashes[index], nullptr, 0 };
+
+				if (!build(context, config, grid.triangles[index], tile, results[i]))
+				{
+					for (auto& result : results[i])
+						dtFree(result.data);
+					results[i].clear();
+					++failedTiles;
+					continue;
+				}
+
+				// 빈 타일도 해시를 기록하여 다음 로드 시 재생성하지 않음
+				if (results[i].empty())
+					results[i].push_back(tile);
+			}
+		};
+
+	// 공용 작업 스레드에서 타일 단위로 분배 (메인 스레드도 참여)
+	GetJobSystem().ParallelFor(dirtyTiles.size(), 1, buildRange);
+
+	for (auto& result : results)
+		tiles.insert(tiles.end(), result.begin(), result.end());
+
+	if (failedTiles > 0)
+		LOG_WARN(*_scene, "NavMeshBuilder\n{} tile(s) failed to build.", failedTiles.load());
+
+	// 타일 데이터는 이후 navMesh/tileCache 로 소유권이 넘어가지만 저장은 지금 수행
+	if (!cachePath.empty() && (cacheChanged || !dirtyTiles.empty()))
+		saveTileCache(cachePath, grid.settingsHash, HashBytes(grid.hashes.data(), grid.hashes.size() * sizeof(uint64_t)), tiles);
+
+	LOG_INFO(*_scene, "NavMeshBuilder\nTiled NavMesh ready ({} tiles, {} rebuilt)", grid.triangles.size(), dirtyTiles.size());
+
+	return tiles;
+}
+
+core::NavMeshBuilder::CompactHeightfieldPtr core::NavMeshBuilder::rasterizeTile(rcContext& context, const rcConfig& config, const std::vector<int>& triangles) const
+{
+	CompactHeightfieldPtr compactHeightfield(nullptr, &rcFreeCompactHeightfield);
+
+	// 높이 필드 생성
+	std::unique_ptr<rcHeightfield, void(*)(rcHeightfield*)> heightfield(rcAllocHeightfield(), &rcFreeHeightField);
+	if (!heightfield || !rcCreateHeightfield(&context, *heightfield, config.width, config.height, config.bmin, config.bmax, config.cs, config.ch))
+		return compactHeightfield;
+
+	// 타일에 걸친 삼각형만 래스터화
+	std::vector<int> tileIndices;
+	tileIndices.reserve(triangles.size() * 3);
+	for (int t : triangles)
+		tileIndices.insert(tileIndices.end(), { _indices[t * 3], _indices[t * 3 + 1], _indices[t * 3 + 2] });
+
+	const int vertexCount = static_cast<int>(_vertices.size() / 3);
+	const int triangleCount = static_cast<int>(triangles.size());
+
+	std::vector<unsigned char> triAreas(triangleCount, RC_WALKABLE_AREA);
+	rcMarkWalkableTriangles(&context, config.walkableSlopeAngle, _vertices.data(), vertexCount, tileIndices.data(), triangleCount, triAreas.data());
+	if (!rcRasterizeTriangles(&context, _vertices.data(), vertexCount, tileIndices.data(), triAreas.data(), triangleCount, *heightfield, config.walkableClimb))
+		return compactHeightfield;
+
+	rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
+	rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
+	rcFilterWalkableLowHeightSpans(&context, config.walkableHeight, *heightfield);
+
+	// Compact Heightfield 생성 및 침식
+	compactHeightfield.reset(rcAllocCompactHeightfield());
+	if (!compactHeightfield || !rcBuildCompactHeightfield(&context, config.walkableHeight, config.walkableClimb, *heightfield, *compactHeightfield)
+		|| !rcErodeWalkableArea(&context, config.walkableRadius, *compactHeightfield))
+	{
+		compactHeightfield.reset();
+	}
+
+	return compactHeightfield;
+}
+
+bool core::NavMeshBuilder::buildTileMesh(rcContext& context, const rcConfig& config, const NavMeshSettings& settings, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out) const
+{
+	auto compactHeightfield = rasterizeTile(context, config, triangles);
+	if (!compactHeightfield)
+		return false;
+
+	// 네비게이션 메쉬 생성 방식 (WATERSHED)
+	if (!rcBuildDistanceField(&context, *compactHeightfield))
+		return false;
+
+	if (!rcBuildRegions(&context, *compactHeightfield, config.borderSize, config.minRegionArea, config.mergeRegionArea))
+		return false;
+
+	// 윤곽선, Poly Mesh, Detail Mesh 생성
+	std::unique_ptr<rcContourSet, void(*)(rcContourSet*)> contourSet(rcAllocContourSet(), &rcFreeContourSet);
+	if (!contourSet || !rcBuildContours(&context, *compactHeightfield, config.maxSimplificationError, config.maxEdgeLen, *contourSet))
+		return false;
+
+	// 걸을 수 있는 영역이 없는 빈 타일
+	if (contourSet->nconts == 0)
+		return true;
+
+	std::unique_ptr<rcPolyMesh, void(*)(rcPolyMesh*)> polyMesh(rcAllocPolyMesh(), &rcFreePolyMesh);
+	if (!polyMesh || !rcBuildPolyMesh(&context, *contourSet, config.maxVertsPerPoly, *polyMesh))
+		return false;
+
+	std::unique_ptr<rcPolyMeshDetail, void(*)(rcPolyMeshDetail*)> polyMeshDetail(rcAllocPolyMeshDetail(), &rcFreePolyMeshDetail);
+	if (!polyMeshDetail || !rcBuildPolyMeshDetail(&context, *polyMesh, *compactHeightfield, config.detailSampleDist, config.detailSampleMaxError, *polyMeshDetail))
+		return false;
+
+	if (polyMesh->npolys == 0)
+		return true;
+
+	// PolyFlags 설정
+	for (int i = 0; i < polyMesh->npolys; ++i)
+	{
+		if (polyMesh->areas[i] == RC_WALKABLE_AREA)
+			polyMesh->flags[i] = 1;
+	}
+
+	// Detour 타일 데이터 생성
+	dtNavMeshCreateParams params = {};
+	params.verts = polyMesh->verts;
+	params.vertCount = polyMesh->nverts;
+	params.polys = polyMesh->polys;
+	params.polyAreas = polyMesh->areas;
+	params.polyFlags = polyMesh->flags;
+	params.polyCount = polyMesh->npolys;
+	params.nvp = polyMesh->nvp;
+	params.detailMeshes = polyMeshDetail->meshes;
+	params.detailVerts = polyMeshDetail->verts;
+	params.detailVertsCount = polyMeshDetail->nverts;
+	params.detailTris = polyMeshDetail->tris;
+	params.detailTriCount = polyMeshDetail->ntris;
+	params.walkableHeight = settings.agentHeight;
+	params.walkableRadius = settings.agentRadius;
+	params.walkableClimb = settings.agentMaxClimb;
+	params.tileX = tile.x;
+	params.tileY = tile.y;
+	params.tileLayer = 0;
+	rcVcopy(params.bmin, polyMesh->bmin);
+	rcVcopy(params.bmax, polyMesh->bmax);
+	params.cs = config.cs;
+	params.ch = config.ch;
+	params.buildBvTree = true;
+
+	if (!dtCreateNavMeshData(&params, &tile.data, &tile.dataSize))
+		return false;
+
+	out.push_back(tile);
+	return true;
+}
+
+bool core::NavMeshBuilder::buildTileLayers(rcContext& context, const rcConfig& config, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out) const
+{
+	auto compactHeightfield = rasterizeTile(context, config, triangles);
+	if (!compactHeightfield)
+		return false;
+
+	// 높이 필드를 겹치지 않는 레이어로 분할
+	std::unique_ptr<rcHeightfieldLayerSet, void(*)(rcHeightfieldLayerSet*)> layerSet(rcAllocHeightfieldLayerSet(), &rcFreeHeightfieldLayerSet);
+	if (!layerSet || !rcBuildHeightfieldLayers(&context, *compactHeightfield, config.borderSize, config.walkableHeight, *layerSet))
+		return false;
+
+	const int layerCount = rcMin(layerSet->nlayers, MAX_LAYERS_PER_TILE);
+
+	for (int i = 0; i < layerCount; ++i)
+	{
+		const rcHeightfieldLayer& layer = layerSet->layers[i];
+
+		// 레이어 압축
+		dtTileCacheLayerHeader header = {};
+		header.magic = DT_TILECACHE_MAGIC;
+		header.version = DT_TILECACHE_VERSION;
+		header.tx = tile.x;
+		header.ty = tile.y;
+		header.tlayer = i;
+		dtVcopy(header.bmin, layer.bmin);
+		dtVcopy(header.bmax, layer.bmax);
+		header.width = static_cast<unsigned char>(layer.width);
+		header.height = static_cast<unsigned char>(layer.height);
+		header.minx = static_cast<unsigned char>(layer.minx);
+		header.maxx = static_cast<unsigned char>(layer.maxx);
+		header.miny = static_cast<unsigned char>(layer.miny);
+		header.maxy = static_cast<unsigned char>(layer.maxy);
+		header.hmin = static_cast<unsigned short>(layer.hmin);
+		header.hmax = static_cast<unsigned short>(layer.hmax);
+
+		TileData layerTile = tile;
+		if (dtStatusFailed(dtBuildTileCacheLayer(&g_tileCompressor, &header, layer.heights, layer.areas, layer.cons, &layerTile.data, &layerTile.dataSize)))
+			return false;
+
+		out.push_back(layerTile);
+	}
+
+	return true;
+}
+
+bool core::NavMeshBuilder::loadTileCache(const std::filesystem::path& path, uint64_t settingsHash, std::vector<TileData>& tiles)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	// 헤더 검사 (버전/설정/격자가 다르면 전체 재생성)
+	NavCacheHeader header;
+	file.read(reinterpret_cast<char*>(&header), sizeof(NavCacheHeader));
+
+	if (!file || header.magic != NAV_CACHE_MAGIC || header.version != NAV_CACHE_VERSION || header.settingsHash != settingsHash)
+	{
+		LOG_INFO(*_scene, "NavMeshBuilder\nNavMesh cache is out of date {}", path.string());
+		return false;
+	}
+
+	tiles.reserve(header.tileCount);
+
+	for (int i = 0; i < header.tileCount; ++i)
+	{
+		NavCacheTileHeader tileHeader;
+		file.read(reinterpret_cast<char*>(&tileHeader), sizeof(NavCacheTileHeader));
+
+		if (!file || tileHeader.dataSize < 0)
+			break;
+
+		TileData tile = { tileHeader.x, tileHeader.y, tileHeader.hash, nullptr, tileHeader.dataSize };
+
+		if (tile.dataSize > 0)
+		{
+			tile.data = static_cast<unsigned char*>(dtAlloc(tile.dataSize, DT_ALLOC_PERM));
+			file.read(reinterpret_cast<char*>(tile.data), tile.dataSize);
+
+			if (!file)
+			{
+				dtFree(tile.data);
+				break;
+			}
+		}
+
+		tiles.push_back(tile);
+	}
+
+	return true;
+}
+
+void core::NavMeshBuilder::saveTileCache(const std::filesystem::path& path, uint64_t settingsHash, uint64_t geometryHash, const std::vector<TileData>& tiles)
+{
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) {
+		LOG_ERROR(*_scene, "NavMeshBuilder\nFailed to open file for saving navmesh {}", path.string().c_str());
+		return;
+	}
+
+	NavCacheHeader header;
+	header.settingsHash = settingsHash;
+	header.geometryHash = geometryHash;
+	header.tileCount = static_cast<int>(tiles.size());
+	file.write(reinterpret_cast<const char*>(&header), sizeof(NavCacheHeader));
+
+	for (const auto& tile : tiles)
+	{
+		NavCacheTileHeader tileHeader = { tile.x, tile.y, tile.hash, tile.data ? tile.dataSize : 0 };
+		file.write(reinterpret_cast<const char*>(&tileHeader), sizeof(NavCacheTileHeader));
+
+		if (tileHeader.dataSize > 0)
+			file.write(reinterpret_cast<const char*>(tile.data), tileHeader.dataSize);
+	}
+
+	LOG_INFO(*_scene, "NavMeshBuilder\nNavMesh saved to {}", path.string().c_str());
+}
+
 void core::NavMeshBuilder::SaveNavMesh(std::filesystem::path path)
 {
 	if (!_navMesh) return;
@@ -277,7 +1032,7 @@ void core::NavMeshBuilder::LoadNavMesh(std::filesystem::path path, NavMeshData&
 	LOG_INFO(*_scene, "NavMeshBuilder\nNavMesh loaded from {}", path.string().c_str());
 }
 
-void core::NavMeshBuilder::InputWorld(const std::vector<float>& vertices, const std::vector<int>& indices)
+void core::NavMeshBuilder::InputWorld(std::vector<float> vertices, std::vector<int> indices)
 {
 	// 전달받은 vertices와 indices를 내부 변수로 저장
 	_vertices = std::move(vertices);
@@ -390,6 +1145,15 @@ void core::NavMeshBuilder::cleanup()
 	}
 }
 
+void core::NavMeshBuilder::releaseDetour()
+{
+	// 성공하면 NavMeshData 가 소유하므로 cleanup 에서는 해제하지 않음
+	dtFreeNavMeshQuery(_navMeshQuery);
+	_navMeshQuery = nullptr;
+	dtFreeNavMesh(_navMesh);
+	_navMesh = nullptr;
+}
+
 void core::NavMeshBuilder::calcMinMax()
 {
 	// bmin 및 bmax를 초기화
@@ -19,6 +19,14 @@ namespace core
         // 네비게이션 메쉬를 설정값과 데이터를 기반으로 생성하는 함수
         bool BuildNavMesh(const NavMeshSettings& settings, NavMeshData& data);
 
+        // 타일 단위 네비게이션 메쉬를 병렬로 생성하는 함수
+        // cachePath 가 주어지면 지오메트리/설정 해시로 캐시를 검사하여 변경된 타일만 재생성
+        bool BuildTiledNavMesh(const NavMeshSettings& settings, NavMeshData& data, const std::filesystem::path& cachePath = {});
+
+        // 동적 장애물용 타일 캐시(압축 레이어)와 네비게이션 메쉬를 생성하는 함수
+        // 압축 레이어는 BuildTiledNavMesh 와 같은 방식으로 캐시됨
+        bool BuildTileCache(const NavMeshSettings& settings, NavMeshData& data, const std::filesystem::path& cachePath = {});
+
         // 네비게이션 메쉬를 파일에 저장하는 함수
         void SaveNavMesh(std::filesystem::path path);
 
@@ -26,15 +34,58 @@ namespace core
         void LoadNavMesh(std::filesystem::path path, NavMeshData& data);
 
         // 네비게이션 메쉬의 버텍스, 인덱스 정보를 직접 제공하는 함수
-        void InputWorld(const std::vector<float>& vertices, const std::vector<int>& indices);
+        void InputWorld(std::vector<float> vertices, std::vector<int> indices);
 
         // 파일에서 네비게이션 메쉬를 불러오는 함수
         void InputMesh(std::filesystem::path path);
 
     private:
+        // 타일 단위 생성 결과 (타일 캐시 모드에서는 레이어마다 하나)
+        struct TileData
+        {
+            int x = 0;
+            int y = 0;
+            uint64_t hash = 0;                  // 타일에 걸친 지오메트리 + 설정 해시
+            unsigned char* data = nullptr;      // dtAlloc 으로 할당된 타일 데이터 (navMesh/tileCache 로 소유권 이전)
+            int dataSize = 0;                   // 0 이면 걸을 수 있는 영역이 없는 타일
+        };
+
+        // 타일 격자 및 타일별 삼각형 분배 정보
+        struct TileGrid
+        {
+            rcConfig config;                                // 타일 공통 설정 (bmin/bmax 제외)
+            float bMin[3];
+            float bMax[3];
+            float tileWorldSize = 0.f;
+            int width = 0;
+            int height = 0;
+            uint64_t settingsHash = 0;
+            std::vector<std::vector<int>> triangles;        // 타일별 (경계 포함) 겹치는 삼각형
+            std::vector<uint64_t> hashes;                   // 타일별 해시
+        };
+
+        using TileBuildFunc = std::function<bool(rcContext&, const rcConfig&, const std::vector<int>&, TileData, std::vector<TileData>&)>;
+        using CompactHeightfieldPtr = std::unique_ptr<rcCompactHeightfield, void(*)(rcCompactHeightfield*)>;
+
+        // 타일 격자 구성 (seed 로 생성 방식을 구분하여 캐시를 분리)
+        void prepareTileGrid(const NavMeshSettings& settings, uint64_t seed, TileGrid& grid) const;
+
+        // 캐시에서 재사용할 수 없는 타일만 병렬로 생성하고 캐시를 갱신
+        std::vector<TileData> buildTiles(const TileGrid& grid, const std::filesystem::path& cachePath, const TileBuildFunc& build);
+
+        // 타일 생성 단계 (워커 스레드에서 호출, 로그 출력 금지)
+        CompactHeightfieldPtr rasterizeTile(rcContext& context, const rcConfig& config, const std::vector<int>& triangles) const;
+        bool buildTileMesh(rcContext& context, const rcConfig& config, const NavMeshSettings& settings, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out) const;
+        bool buildTileLayers(rcContext& context, const rcConfig& config, const std::vector<int>& triangles, TileData tile, std::vector<TileData>& out) const;
+
+        // 타일 캐시 입출력
+        bool loadTileCache(const std::filesystem::path& path, uint64_t settingsHash, std::vector<TileData>& tiles);
+        void saveTileCache(const std::filesystem::path& path, uint64_t settingsHash, uint64_t geometryHash, const std::vector<TileData>& tiles);
+
         // 초기화 및 정리 함수
         void initialize();                // 데이터 구조 초기화
         void cleanup();                   // 리소스 정리
+        void releaseDetour();             // 실패 시 NavMeshData 로 넘기지 못한 navmesh, query 해제
         void calcMinMax();                // min max 할당
 
         Scene* _scene = nullptr;
@@ -3,7 +3,10 @@
 
 #include "Scene.h"
 #include "RenderComponents.h"
+#include "AssetResolver.h"
 #include "CoreComponents.h"
+#include "Profiler.h"
+#include "FramePacket.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -36,84 +39,104 @@ void core::OITPass::initOITResources(Scene& scene, Renderer& renderer, uint32_t
 	_oitCombineMaterial->SetTexture("gAccum", _accumulationTexture);
 }
 
-void core::OITPass::oitPass(core::Scene& scene, Renderer& renderer, const Matrix& view, const Matrix& proj, const Matrix& viewProj, const Vector3& camPos)
+void core::OITPass::extractTransparents(core::Scene& scene, Renderer& renderer, FramePacket& packet)
 {
 	auto& registry = *scene.GetRegistry();
-	PerObject perObject;
-	RenderResources& renderResources = registry.ctx().get<core::RenderResources>();
 
+	for (auto&& [entity, transform, meshRenderer, renderAttributes] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
 	{
-		Texture* textures[] = { _revealageTexture.get(), _accumulationTexture.get() };
-		renderer.SetRenderTargets(2, textures, renderResources.depthTexture.get(), false);
-		renderer.ClearTexture(_revealageTexture.get(), _revealageTexture->GetClearValue());
-		renderer.ClearTexture(_accumulationTexture.get(), _accumulationTexture->GetClearValue());
-		renderer.ApplyRenderState(BlendState::TRANSPARENT_BLEND, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
+		if (!meshRenderer.isOn)
+			continue;
 
-		for (auto&& [entity, transform, meshRenderer, renderAttributes] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
-		{
-			if (!meshRenderer.isOn)
-				continue;
+		if (!(renderAttributes.flags & core::RenderAttributes::Flag::IsTransparent)
+			|| renderAttributes.flags & core::RenderAttributes::Flag::IsWater)
+			continue;
 
-			if (!(renderAttributes.flags & core::RenderAttributes::Flag::IsTransparent) 
-				|| renderAttributes.flags & core::RenderAttributes::Flag::IsWater)
-				continue;
+		if (!AssetResolver::ResolveMesh(renderer, meshRenderer))
+			continue;
+
+		if (!AssetResolver::ResolveMaterials(renderer, meshRenderer))
+			continue;
 
-			if (meshRenderer.mesh == nullptr)
+		FramePacket::MeshInstance instance;
+		instance.mesh = meshRenderer.mesh.get();
+		instance.world = transform.matrix;
+		instance.worldInvTranspose = transform.matrix.Invert().Transpose();
+		instance.canReceivingDecal = meshRenderer.canReceivingDecal;
+		instance.firstDraw = static_cast<uint32_t>(packet.draws.size());
+
+		for (uint32_t i = 0; i < (uint32_t)meshRenderer.materials.size(); ++i)
+		{
+			auto& material = meshRenderer.materials[i];
+			if (material == nullptr)
 			{
-				meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
 				continue;
 			}
-
-			if (meshRenderer.materials.size() <= 0)
+			if (i >= meshRenderer.mesh->subMeshCount)
 			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-				}
+				OutputDebugStringA(std::to_string(uint32_t(entity)).c_str());
+				OutputDebugStringA("Submesh index out of range\n");
 				continue;
 			}
 
-			auto& world = transform.matrix;
-			auto worldInvTranspose = world.Invert().Transpose();
+			FramePacket::SubMeshDraw draw;
+			draw.material = material.get();
+			draw.subMeshIndex = i;
+			packet.draws.push_back(draw);
+		}
+
+		instance.drawCount = static_cast<uint32_t>(packet.draws.size()) - instance.firstDraw;
+		packet.transparentMeshes.push_back(instance);
+	}
+}
+
+void core::OITPass::oitPass(const FramePacket& packet, Renderer& renderer, const RenderResources& renderResources)
+{
+	PROFILE_FUNCTION();
 
-			for (uint32_t i = 0; i < (uint32_t)meshRenderer.materials.size(); ++i)
+	const auto& camera = packet.camera;
+	PerObject perObject;
+
+	{
+		Texture* textures[] = { _revealageTexture.get(), _accumulationTexture.get() };
+		renderer.SetRenderTargets(2, textures, renderResources.depthTexture.get(), false);
+		renderer.ClearTexture(_revealageTexture.get(), _revealageTexture->GetClearValue());
+		renderer.ClearTexture(_accumulationTexture.get(), _accumulationTexture->GetClearValue());
+		renderer.ApplyRenderState(BlendState::TRANSPARENT_BLEND, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
+
+		for (const auto& instance : packet.transparentMeshes)
+		{
+			for (uint32_t d = instance.firstDraw; d < instance.firstDraw + instance.drawCount; ++d)
 			{
-				auto material = meshRenderer.materials[i];
-				if (material == nullptr)
-				{
-					continue;
-				}
-				if (i >= meshRenderer.mesh->subMeshCount)
-				{
-					OutputDebugStringA(std::to_string(uint32_t(entity)).c_str());
-					OutputDebugStringA("Submesh index out of range\n");
-					continue;
-				}
-
-				perObject.gProj = proj;
-				perObject.gView = view;
-				perObject.gViewProj = viewProj;
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
+				const auto& draw = packet.draws[d];
+				auto material = draw.material;
+
+				perObject.gProj = camera.proj;
+				perObject.gView = camera.view;
+				perObject.gViewProj = camera.viewProj;
+				perObject.gWorld = instance.world;
+				perObject.gWorldInvTranspose = instance.worldInvTranspose;
 				perObject.gTexTransform = Matrix::Identity;
 
 				material->m_Shader->MapConstantBuffer(renderer.GetContext());
 				material->m_Shader->SetConstant("cbPerObject", &perObject, sizeof(PerObject));
-				material->m_Shader->SetFloat3("gEyePosW", camPos);
-				material->m_Shader->SetInt("gRecieveDecal", meshRenderer.canReceivingDecal);
+				material->m_Shader->SetFloat3("gEyePosW", camera.position);
+				material->m_Shader->SetInt("gRecieveDecal", instance.canReceivingDecal);
 				material->m_Shader->SetInt("gReflect", false);
 				material->m_Shader->SetInt("gRefract", false);
 
 				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
+				renderer.Submit(*instance.mesh, *material, draw.subMeshIndex, PrimitiveTopology::TRIANGLELIST, 1);
 			}
 		}
 	}
 }
 
-void core::OITPass::oitCompositePass(core::Scene& scene, Renderer& renderer, const Matrix& view, const Matrix& proj, const Matrix& viewProj, std::shared_ptr<Mesh> quadMesh, std::shared_ptr<Texture> renderTargetTexture)
+void core::OITPass::oitCompositePass(const FramePacket& packet, Renderer& renderer, std::shared_ptr<Mesh> quadMesh, std::shared_ptr<Texture> renderTargetTexture)
 {
+	PROFILE_FUNCTION();
+
 	Texture* textures[] = { renderTargetTexture.get() };
 	renderer.SetRenderTargets(1, textures, nullptr, false);
 	renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
@@ -124,8 +147,8 @@ void core::OITPass::oitCompositePass(core::Scene& scene, Renderer& renderer, con
 	_oitCombineMaterial->m_Shader->MapConstantBuffer(renderer.GetContext());
 	_oitCombineMaterial->m_Shader->SetMatrix("gWorld", world);
 	_oitCombineMaterial->m_Shader->SetMatrix("gWorldInvTranspose", worldInvTranspose);
-	_oitCombineMaterial->m_Shader->SetMatrix("gView", view);
-	_oitCombineMaterial->m_Shader->SetMatrix("gViewProj", viewProj);
+	_oitCombineMaterial->m_Shader->SetMatrix("gView", packet.camera.view);
+	_oitCombineMaterial->m_Shader->SetMatrix("gViewProj", packet.camera.viewProj);
 	_oitCombineMaterial->m_Shader->SetMatrix("gTexTransform", Matrix::Identity);
 	_oitCombineMaterial->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
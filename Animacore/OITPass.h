@@ -6,12 +6,19 @@ class Texture;
 
 namespace core
 {
+	struct RenderResources;
+	struct FramePacket;
+
 	class OITPass
 	{
 	public:
 		void initOITResources(Scene& scene, Renderer& renderer, uint32_t width, uint32_t height);
-		void oitPass(core::Scene& scene, Renderer& renderer, const Matrix& view, const Matrix& proj, const Matrix& viewProj, const Vector3& camPos);
-		void oitCompositePass(core::Scene& scene, Renderer& renderer, const Matrix& view, const Matrix& proj, const Matrix& viewProj, std::shared_ptr<Mesh> quadMesh, std::shared_ptr<Texture> renderTargetTexture);
+
+		//   :  ޽ ( )  packet.transparentMeshes 
+		void extractTransparents(core::Scene& scene, Renderer& renderer, FramePacket& packet);
+
+		void oitPass(const FramePacket& packet, Renderer& renderer, const RenderResources& renderResources);
+		void oitCompositePass(const FramePacket& packet, Renderer& renderer, std::shared_ptr<Mesh> quadMesh, std::shared_ptr<Texture> renderTargetTexture);
 		void finishOITResources();
 
 	private:
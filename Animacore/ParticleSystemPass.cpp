@@ -4,6 +4,9 @@
 #include "Scene.h"
 #include "RenderComponents.h"
 #include "CoreComponents.h"
+#include "Profiler.h"
+#include "AssetLoader.h"
+#include "FramePacket.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -34,6 +37,8 @@ void core::ParticleSystemPass::startParticlePass(Scene& scene, Renderer& rendere
 
 void core::ParticleSystemPass::initParticles(Scene& scene, Renderer& renderer, float tick)
 {
+	PROFILE_FUNCTION();
+
 	auto&& registry = scene.GetRegistry();
 
 	for (auto&& [entity, transform, particleSystem] : registry->view<core::WorldTransform, core::ParticleSystem>().each())
@@ -117,9 +122,11 @@ void core::ParticleSystemPass::initParticles(Scene& scene, Renderer& renderer, f
 		particle.SetFrameTime(tick);
 }
 
-void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer, float tick, Matrix view, Matrix proj, std::shared_ptr<Texture> renderTargetTexture, std::shared_ptr<Texture> depthStencilTexture)
+void core::ParticleSystemPass::extractParticles(Scene& scene, Renderer& renderer, FramePacket& packet)
 {
-	auto align = [](int value, int alignment) { return (value + alignment - 1) / alignment * alignment; };
+	PROFILE_FUNCTION();
+
+	initParticles(scene, renderer, packet.tick);
 
 	for (auto& [entity, particle] : _particleObjectMap)
 	{
@@ -134,16 +141,10 @@ void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer,
 			continue;
 		}
 
-		if (particleSystem.instanceData.isReset || particle.isFirstTime)
+		//  ʱȭ  忡, ð  ⼭ ǵ
+		const bool isReset = particleSystem.instanceData.isReset || particle.isFirstTime;
+		if (isReset)
 		{
-			particle.deadListBufferTexture->SetInitialCount(0);
-			_initDeadlistMaterial->SetUAVTexture("gDeadListToAddTo", particle.deadListBufferTexture);
-			renderer.DispatchCompute(*_initDeadlistMaterial, align(particle.mainData.maxParticleCount, 256) / 256, 1, 1);
-
-			particle.particleBufferTexture->SetInitialCount(-1);
-			_initParticleMaterial->SetUAVTexture("gParticleBuffer", particle.particleBufferTexture);
-			renderer.DispatchCompute(*_initParticleMaterial, align(particle.mainData.maxParticleCount, 256) / 256, 1, 1);
-
 			particle.Reset();
 			particleSystem.instanceData.isReset = false;
 			particle.isFirstTime = false;
@@ -154,6 +155,54 @@ void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer,
 		if (particleSystem.textureSheetAnimationData.isUsed)
 			particle.UpdateTextureSheetAnimation(particleSystem);
 
+		//    ؽó AssetLoader  ûϰ  ӿ ٽ ã
+		if (!particleSystem.baseColorTexture)
+		{
+			particleSystem.baseColorTexture = renderer.GetParticleTexture(particleSystem.renderData.baseColorTextureString.c_str());
+			if (!particleSystem.baseColorTexture)
+				AssetLoader::Get().Request(AssetType::ParticleTexture, particleSystem.renderData.baseColorTextureString);
+		}
+
+		if (!particleSystem.emissiveTexture)
+		{
+			particleSystem.emissiveTexture = renderer.GetParticleTexture(particleSystem.renderData.emissiveTextureString.c_str());
+			if (!particleSystem.emissiveTexture)
+				AssetLoader::Get().Request(AssetType::ParticleTexture, particleSystem.renderData.emissiveTextureString);
+		}
+
+		FramePacket::ParticleEmitter emitter;
+		emitter.object = particle;
+		emitter.baseColorTexture = particleSystem.baseColorTexture;
+		emitter.emissiveTexture = particleSystem.emissiveTexture;
+		emitter.renderMode = static_cast<int>(particleSystem.renderData.renderModeType);
+		emitter.isTwoSide = particleSystem.renderData.isTwoSide;
+		emitter.isReset = isReset;
+
+		packet.particles.push_back(std::move(emitter));
+	}
+}
+
+void core::ParticleSystemPass::renderParticles(const FramePacket& packet, Renderer& renderer, std::shared_ptr<Texture> renderTargetTexture, std::shared_ptr<Texture> depthStencilTexture)
+{
+	PROFILE_FUNCTION();
+
+	auto align = [](int value, int alignment) { return (value + alignment - 1) / alignment * alignment; };
+
+	for (const auto& emitter : packet.particles)
+	{
+		const ParticleObject& particle = emitter.object;
+
+		if (emitter.isReset)
+		{
+			particle.deadListBufferTexture->SetInitialCount(0);
+			_initDeadlistMaterial->SetUAVTexture("gDeadListToAddTo", particle.deadListBufferTexture);
+			renderer.DispatchCompute(*_initDeadlistMaterial, align(particle.mainData.maxParticleCount, 256) / 256, 1, 1);
+
+			particle.particleBufferTexture->SetInitialCount(-1);
+			_initParticleMaterial->SetUAVTexture("gParticleBuffer", particle.particleBufferTexture);
+			renderer.DispatchCompute(*_initParticleMaterial, align(particle.mainData.maxParticleCount, 256) / 256, 1, 1);
+		}
+
 		particle.particleBufferTexture->SetInitialCount(-1);
 		_emitParticleMaterial->SetUAVTexture("gParticleBuffer", particle.particleBufferTexture);
 		particle.deadListBufferTexture->SetInitialCount(-1);
@@ -202,9 +251,11 @@ void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer,
 		Texture* textures[] = { renderTargetTexture.get() };
 		renderer.SetRenderTargets(1, textures, nullptr, false);
 
-		if (particleSystem.renderData.isTwoSide)
+		const auto renderMode = static_cast<ParticleSystem::RenderModule::RenderMode>(emitter.renderMode);
+
+		if (emitter.isTwoSide)
 		{
-			switch (particleSystem.renderData.renderModeType)
+			switch (renderMode)
 			{
 			case ParticleSystem::RenderModule::RenderMode::Additive:
 				renderer.ApplyRenderState(BlendState::ADDITIVE_BLEND, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
@@ -225,7 +276,7 @@ void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer,
 		}
 		else
 		{
-			switch (particleSystem.renderData.renderModeType)
+			switch (renderMode)
 			{
 			case ParticleSystem::RenderModule::RenderMode::Additive:
 				renderer.ApplyRenderState(BlendState::ADDITIVE_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
@@ -248,22 +299,16 @@ void core::ParticleSystemPass::renderParticles(Scene& scene, Renderer& renderer,
 		_renderParticleMaterial->SetTexture("gParticleBuffer", particle.particleBufferTexture);
 		_renderParticleMaterial->SetTexture("gIndexBuffer", particle.aliveListBufferTexture);
 
-		if (!particleSystem.baseColorTexture)
-			particleSystem.baseColorTexture = renderer.GetParticleTexture(particleSystem.renderData.baseColorTextureString.c_str());
-
-		if (!particleSystem.emissiveTexture)
-			particleSystem.emissiveTexture = renderer.GetParticleTexture(particleSystem.renderData.emissiveTextureString.c_str());
-
-		_renderParticleMaterial->SetTexture("gAlbedoTexture", particleSystem.baseColorTexture);
-		_renderParticleMaterial->SetTexture("gEmissiveTexture", particleSystem.emissiveTexture);
+		_renderParticleMaterial->SetTexture("gAlbedoTexture", emitter.baseColorTexture);
+		_renderParticleMaterial->SetTexture("gEmissiveTexture", emitter.emissiveTexture);
 		_renderParticleMaterial->SetTexture("gDepthTexture", depthStencilTexture);
 
 		auto renderShader = _renderParticleMaterial->GetShader();
 
 		renderShader->MapConstantBuffer(renderer.GetContext());
 		renderShader->SetStruct("gParticleRender", &particle.renderData);
-		renderShader->SetMatrix("gView", view);
-		renderShader->SetMatrix("gProj", proj);
+		renderShader->SetMatrix("gView", packet.camera.view);
+		renderShader->SetMatrix("gProj", packet.camera.proj);
 		renderShader->UnmapConstantBuffer(renderer.GetContext());
 
 		renderer.SubmitInstancedIndirect(*_renderParticleMaterial, _indirectDrawTexture.get(), 0, PrimitiveTopology::POINTLIST);
@@ -9,14 +9,20 @@ class Texture;
 namespace core
 {
 	struct OnParticleTransformUpdate;
+	struct FramePacket;
 
 	class ParticleSystemPass
 	{
 	public:
 		void startParticlePass(Scene& scene, Renderer& renderer);
 		void initParticles(Scene& scene, Renderer& renderer, float tick);
+
+		//   :  , , ؽó û óϰ  ƼŬ packet.particles  
+		void extractParticles(Scene& scene, Renderer& renderer, FramePacket& packet);
 		void removeParticle(entt::registry& registry, entt::entity entity);
-		void renderParticles(Scene& scene, Renderer& renderer, float tick, Matrix view, Matrix proj, 
+
+		//   : Ŷ ƼŬ ùķ̼ϰ ׸
+		void renderParticles(const FramePacket& packet, Renderer& renderer,
 			std::shared_ptr<Texture> renderTargetTexture, std::shared_ptr<Texture> depthStencilTexture);
 		void finishParticlePass(Scene& scene);
 
@@ -3,15 +3,26 @@
 
 #include "Scene.h"
 #include "CoreComponents.h"
+#include "CoreSystemEvents.h"
 
 #include <recastnavigation/DetourCrowd.h>
+#include <recastnavigation/DetourNavMesh.h>
+#include <recastnavigation/DetourNavMeshQuery.h>
+#include <recastnavigation/DetourTileCache.h>
+
+#include <chrono>
 
 #include "NavConfigs.h"
 #include "NavMeshBuilder.h"
 #include "PhysicsScene.h"
 
-constexpr int MAX_AGENTS = 64;
 constexpr float MAX_AGENT_RADIUS = 5.0f;
+constexpr const char* NAV_MESH_CACHE_DIRECTORY = "./Resources/NavMeshes";
+constexpr const char* NAV_MESH_EXTENSION = ".nav";
+
+// 장애물로 인한 타일 재생성에 프레임당 사용할 시간
+constexpr std::chrono::microseconds OBSTACLE_UPDATE_BUDGET{ 1000 };
+constexpr float OBSTACLE_ROTATION_THRESHOLD = DirectX::XMConvertToRadians(5.f);
 
 core::PathFindingSystem::PathFindingSystem(Scene& scene)
 	: ISystem(scene)
@@ -31,23 +42,64 @@ void core::PathFindingSystem::operator()(Scene& scene, float tick)
 	if (!scene.IsPlaying())
 		return;
 
-	if (_crowd)
-		_crowd->update(tick, nullptr);
+	if (!_crowd)
+		return;
 
 	auto& registry = *scene.GetRegistry();
-	auto view = registry.view<Agent, WorldTransform>();
-	dtCrowdAgent* agents[MAX_AGENTS];
-	auto cnt = _crowd->getActiveAgents(agents, MAX_AGENTS);
+
+	if (_navMeshData.tileCache)
+		updateObstacles(registry, tick);
+
+	applyPathResults(registry);
+	processPathRequests(registry);
+
+	_crowd->update(tick, nullptr);
+
+	writeBackAgents(registry);
+}
+
+void core::PathFindingSystem::writeBackAgents(entt::registry& registry)
+{
+	auto cnt = _crowd->getActiveAgents(_activeAgents.data(), static_cast<int>(_activeAgents.size()));
+
+	// 위치만 직접 기록하고 patch 콜백 대신 한번에 알림
+	auto view = registry.view<WorldTransform>();
+	_movedEntities.clear();
 
 	for (int i = 0; i < cnt; ++i)
 	{
-		auto entity = getEntityFromUserData(agents[i]->params.userData);
+		auto entity = getEntityFromUserData(_activeAgents[i]->params.userData);
+
+		if (!view.contains(entity))
+			continue;
+
 		auto& world = view.get<WorldTransform>(entity);
-		world.position.x = agents[i]->npos[0];
-		world.position.y = agents[i]->npos[1];
-		world.position.z = agents[i]->npos[2];
-		registry.patch<WorldTransform>(entity);
+		const Vector3 position = { _activeAgents[i]->npos[0], _activeAgents[i]->npos[1], _activeAgents[i]->npos[2] };
+
+		if (world.position == position)
+			continue;
+
+		world.position = position;
+		_movedEntities.push_back(entity);
 	}
+
+	if (!_movedEntities.empty())
+		_dispatcher->trigger<OnUpdateTransforms>({ _movedEntities, &registry });
+}
+
+dtCrowdAgentParams core::PathFindingSystem::makeAgentParams(const Agent& agent, entt::entity entity)
+{
+	dtCrowdAgentParams params = {};
+	params.radius = agent.radius;
+	params.height = agent.height;
+	params.maxSpeed = agent.speed;
+	params.maxAcceleration = agent.acceleration;
+	params.collisionQueryRange = agent.collisionQueryRange;
+	params.pathOptimizationRange = params.radius * 30.0f;
+	params.updateFlags = DT_CROWD_ANTICIPATE_TURNS | DT_CROWD_OPTIMIZE_VIS | DT_CROWD_OBSTACLE_AVOIDANCE;
+	params.userData = reinterpret_cast<void*>(entity);
+
+	return params;
 }
 
 int core::PathFindingSystem::placeAgentOnMesh(Agent& agent, const Vector3& startPos, entt::entity entity)
@@ -61,23 +113,46 @@ int core::PathFindingSystem::placeAgentOnMesh(Agent& agent, const Vector3& start
 		return -1;
 
 	// 에이전트 추가
-	dtCrowdAgentParams params = {};
-	params.radius = agent.radius;
-	params.height = agent.height;
-	params.maxSpeed = agent.speed;
-	params.maxAcceleration = agent.acceleration;
-	params.collisionQueryRange = agent.collisionQueryRange;
-	params.pathOptimizationRange = params.radius * 30.0f;
-	params.updateFlags = DT_CROWD_ANTICIPATE_TURNS | DT_CROWD_OPTIMIZE_VIS | DT_CROWD_OBSTACLE_AVOIDANCE;
-	params.userData = reinterpret_cast<void*>(entity);
+	dtCrowdAgentParams params = makeAgentParams(agent, entity);
+	int index = addCrowdAgent(closestPos, params);
+
+	// 수용량이 부족하면 확장 후 재시도
+	if (index < 0 && growCrowd())
+		index = addCrowdAgent(closestPos, params);
 
-	return _crowd->addAgent(&closestPos.x, &params);
+	return index;
+}
+
+int core::PathFindingSystem::addCrowdAgent(const Vector3& position, const dtCrowdAgentParams& params)
+{
+	// 정지된 에이전트는 active 가 꺼져 있어 addAgent 가 그 슬롯을 빈 슬롯으로 재사용하므로 추가하는 동안만 켜 둠
+	_stoppedSlots.clear();
+
+	for (const auto& data : _agentData | std::views::values)
+	{
+		if (data.index < 0)
+			continue;
+
+		if (dtCrowdAgent* crowdAgent = _crowd->getEditableAgent(data.index); !crowdAgent->active)
+		{
+			crowdAgent->active = true;
+			_stoppedSlots.push_back(data.index);
+		}
+	}
+
+	const int index = _crowd->addAgent(&position.x, &params);
+
+	for (const int slot : _stoppedSlots)
+		_crowd->getEditableAgent(slot)->active = false;
+
+	return index;
 }
 
 bool core::PathFindingSystem::initCrowd(int maxAgents, float maxAgentRadius)
 {
 	// Crowd 객체 생성 및 초기화
-	_crowd = dtAllocCrowd();  // dtCrowd 할당
+	if (!_crowd)
+		_crowd = dtAllocCrowd();  // dtCrowd 할당
 
 	if (!_crowd)
 		return false;
@@ -86,14 +161,128 @@ bool core::PathFindingSystem::initCrowd(int maxAgents, float maxAgentRadius)
 	if (!_crowd->init(maxAgents, maxAgentRadius, _navMeshData.navMesh))
 		return false;
 
+	_crowdCapacity = maxAgents;
+	_activeAgents.resize(maxAgents);
+
 	// 필터 설정 (필요 시 사용자 정의 필터 사용)
-	dtQueryFilter filter;
 	_crowd->getEditableFilter(0)->setIncludeFlags(0xffff);  // 모든 폴리곤 포함
 	_crowd->getEditableFilter(0)->setExcludeFlags(0);       // 제외할 폴리곤 없음
 
 	return true;
 }
 
+bool core::PathFindingSystem::growCrowd()
+{
+	// 현재 에이전트 상태 보관 (정지되어 active 가 꺼진 에이전트 포함)
+	struct AgentSnapshot
+	{
+		entt::entity entity;
+		dtCrowdAgentParams params;
+		Vector3 position;
+		Vector3 velocity;
+		Vector3 desiredVelocity;
+		float desiredSpeed;
+		bool isActive;
+		bool isPartial;
+
+		unsigned char targetState;
+		dtPolyRef targetRef;
+		Vector3 targetPos;
+		std::vector<dtPolyRef> corridor;
+	};
+
+	std::vector<AgentSnapshot> snapshots;
+	snapshots.reserve(_agentData.size());
+
+	for (auto& [entity, data] : _agentData)
+	{
+		const dtCrowdAgent* crowdAgent = data.index >= 0 ? _crowd->getAgent(data.index) : nullptr;
+
+		if (!crowdAgent)
+			continue;
+
+		AgentSnapshot& snapshot = snapshots.emplace_back();
+		snapshot.entity = entity;
+		snapshot.params = crowdAgent->params;
+		snapshot.position = { crowdAgent->npos[0], crowdAgent->npos[1], crowdAgent->npos[2] };
+		snapshot.velocity = { crowdAgent->vel[0], crowdAgent->vel[1], crowdAgent->vel[2] };
+		snapshot.desiredVelocity = { crowdAgent->dvel[0], crowdAgent->dvel[1], crowdAgent->dvel[2] };
+		snapshot.desiredSpeed = crowdAgent->desiredSpeed;
+		snapshot.isActive = crowdAgent->active;
+		snapshot.isPartial = crowdAgent->partial;
+		snapshot.targetState = crowdAgent->targetState;
+		snapshot.targetRef = crowdAgent->targetRef;
+		snapshot.targetPos = { crowdAgent->targetPos[0], crowdAgent->targetPos[1], crowdAgent->targetPos[2] };
+		snapshot.corridor.assign(crowdAgent->corridor.getPath(), crowdAgent->corridor.getPath() + crowdAgent->corridor.getPathCount());
+	}
+
+	// 두 배로 재초기화 (init 내부에서 기존 데이터 정리)
+	if (!initCrowd(_crowdCapacity * 2, MAX_AGENT_RADIUS))
+		return false;
+
+	for (auto& data : _agentData | std::views::values)
+		data.index = -1;
+
+	// 모두 active 상태로 추가해야 정지된 에이전트의 슬롯이 재사용되지 않음
+	for (const auto& snapshot : snapshots)
+	{
+		const int index = _crowd->addAgent(&snapshot.position.x, &snapshot.params);
+		_agentData[snapshot.entity].index = index;
+
+		if (index < 0)
+			continue;
+
+		// 속도와 경로(corridor)를 이어받아 확장 시점에 멈추거나 경로를 다시 찾지 않도록 함
+		dtCrowdAgent* crowdAgent = _crowd->getEditableAgent(index);
+		std::copy_n(&snapshot.velocity.x, 3, crowdAgent->vel);
+		std::copy_n(&snapshot.velocity.x, 3, crowdAgent->nvel);
+		std::copy_n(&snapshot.desiredVelocity.x, 3, crowdAgent->dvel);
+		crowdAgent->desiredSpeed = snapshot.desiredSpeed;
+
+		switch (snapshot.targetState)
+		{
+		case DT_CROWDAGENT_TARGET_VALID:
+			if (!snapshot.corridor.empty())
+			{
+				crowdAgent->corridor.setCorridor(&snapshot.targetPos.x, snapshot.corridor.data(), static_cast<int>(snapshot.corridor.size()));
+				crowdAgent->partial = snapshot.isPartial;
+				crowdAgent->targetState = DT_CROWDAGENT_TARGET_VALID;
+				crowdAgent->targetRef = snapshot.targetRef;
+				std::copy_n(&snapshot.targetPos.x, 3, crowdAgent->targetPos);
+				crowdAgent->targetReplan = false;
+			}
+			else
+			{
+				_crowd->requestMoveTarget(index, snapshot.targetRef, &snapshot.targetPos.x);
+			}
+			break;
+
+		// 경로 요청 중이던 에이전트는 새 crowd 의 경로 큐에 다시 요청
+		case DT_CROWDAGENT_TARGET_REQUESTING:
+		case DT_CROWDAGENT_TARGET_WAITING_FOR_QUEUE:
+		case DT_CROWDAGENT_TARGET_WAITING_FOR_PATH:
+			_crowd->requestMoveTarget(index, snapshot.targetRef, &snapshot.targetPos.x);
+			break;
+
+		// 속도 목표는 targetPos 에 속도가 들어 있음
+		case DT_CROWDAGENT_TARGET_VELOCITY:
+			_crowd->requestMoveVelocity(index, &snapshot.targetPos.x);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	for (const auto& snapshot : snapshots)
+	{
+		if (const int index = _agentData[snapshot.entity].index; index >= 0 && !snapshot.isActive)
+			_crowd->getEditableAgent(index)->active = false;
+	}
+
+	return true;
+}
+
 void core::PathFindingSystem::updateAgentParam(entt::registry& registry, entt::entity entity)
 {
 	if (!_crowd || !_agentData.contains(entity))
@@ -108,6 +297,7 @@ void core::PathFindingSystem::updateAgentParam(entt::registry& registry, entt::e
 		auto& agentData = _agentData[entity];
 
 		// 정지 상태가 변경된 경우에만 처리
+		// (정지 중에는 회피 대상에서도 빠지고, 다시 움직이면 기존 경로를 이어감, 슬롯 재사용은 addCrowdAgent 에서 막음)
 		if (agent->isStopped != agentData.isStopped)
 		{
 			agentData.isStopped = agent->isStopped;
@@ -121,25 +311,21 @@ void core::PathFindingSystem::updateAgentParam(entt::registry& registry, entt::e
 			return;
 		}
 
-		// 목적지 변경 확인 및 업데이트
+		// 목적지 변경 확인 및 업데이트 (다음 프레임부터 예산 내에서 처리)
 		if (agent->destination != agentData.destination)
 		{
-			updateDestination(*agent, entity);
 			agentData.destination = agent->destination;
+
+			if (!agentData.isRequested)
+			{
+				agentData.isRequested = true;
+				_pathRequests.push_back(entity);
+			}
 			return;
 		}
 
 		// 에이전트의 파라미터 업데이트
-		dtCrowdAgentParams params = {};
-		params.radius = agent->radius;
-		params.height = agent->height;
-		params.maxSpeed = agent->speed;
-		params.maxAcceleration = agent->acceleration;
-		params.collisionQueryRange = agent->collisionQueryRange;
-		params.pathOptimizationRange = params.radius * 30.0f;
-		params.updateFlags = DT_CROWD_ANTICIPATE_TURNS | DT_CROWD_OPTIMIZE_VIS | DT_CROWD_OBSTACLE_AVOIDANCE;
-		params.userData = reinterpret_cast<void*>(entity);
-
+		dtCrowdAgentParams params = makeAgentParams(*agent, entity);
 		_crowd->updateAgentParameters(_agentData[entity].index, &params);
 	}
 }
@@ -160,50 +346,333 @@ void core::PathFindingSystem::updateDestination(core::Agent& agent, entt::entity
 		_crowd->requestMoveTarget(_agentData[entity].index, agent._polyRef, &nearestPt.x);
 }
 
+void core::PathFindingSystem::processPathRequests(entt::registry& registry)
+{
+	int budget = _pathRequestBudget;
+
+	// 배치 대기 에이전트 (런타임 생성 포함)
+	while (budget > 0 && !_placeRequests.empty())
+	{
+		const entt::entity entity = _placeRequests.front();
+		_placeRequests.pop_front();
+
+		if (!registry.all_of<Agent, WorldTransform>(entity) || _agentData.contains(entity))
+			continue;
+
+		auto& agent = registry.get<Agent>(entity);
+		const int index = placeAgentOnMesh(agent, registry.get<WorldTransform>(entity).position, entity);
+		--budget;
+
+		if (index < 0)
+		{
+			LOG_ERROR_D(*_dispatcher, "{} : Failed to add agent to the crowd.", entity);
+			continue;
+		}
+
+		_agentData[entity] = { index, agent.destination, agent.isStopped };
+	}
+
+	// 목적지 요청 (가장 가까운 폴리곤 탐색은 워커 스레드에서 진행)
+	const bool async = _pathQueryService && _pathQueryService->IsAttached();
+	_queryBatch.clear();
+	_queryOwners.clear();
+
+	while (budget > 0 && !_pathRequests.empty())
+	{
+		const entt::entity entity = _pathRequests.front();
+		_pathRequests.pop_front();
+
+		auto it = _agentData.find(entity);
+		if (it == _agentData.end() || !registry.all_of<Agent>(entity))
+			continue;
+
+		if (it->second.index < 0)
+		{
+			it->second.isRequested = false;
+			continue;
+		}
+
+		--budget;
+
+		if (!async)
+		{
+			it->second.isRequested = false;
+			updateDestination(registry.get<Agent>(entity), entity);
+			continue;
+		}
+
+		const float* extents = _crowd->getQueryExtents();
+
+		PathQueryRequest& request = _queryBatch.emplace_back();
+		request.type = PathQueryType::NearestPoly;
+		request.start = it->second.destination;
+		request.end = it->second.destination;
+		request.extents = { extents[0], extents[1], extents[2] };
+		request.owner = entity;
+		request.channel = entt::type_hash<PathFindingSystem>::value();
+		_queryOwners.push_back(entity);
+	}
+
+	if (_queryBatch.empty())
+		return;
+
+	_pathQueryService->Request(_queryBatch, &_queryHandles);
+
+	for (size_t i = 0; i < _queryOwners.size(); ++i)
+		_agentData[_queryOwners[i]].query = _queryHandles[i];
+}
+
+void core::PathFindingSystem::applyPathResults(entt::registry& registry)
+{
+	if (!_pathQueryService || !_pathQueryService->Poll(entt::type_hash<PathFindingSystem>::value(), _queryResults))
+		return;
+
+	for (const auto& result : _queryResults)
+	{
+		auto it = _agentData.find(result.owner);
+
+		// 삭제되었거나 새 요청으로 대체된 결과
+		if (it == _agentData.end() || it->second.query != result.handle)
+			continue;
+
+		auto& agentData = it->second;
+		agentData.query = INVALID_PATH_QUERY;
+		agentData.isRequested = false;
+
+		if (agentData.index < 0)
+			continue;
+
+		// 쿼리 도중 목적지가 바뀌었으면 다시 요청
+		if (result.requestedEnd != agentData.destination)
+		{
+			agentData.isRequested = true;
+			_pathRequests.push_back(result.owner);
+			continue;
+		}
+
+		if (!result.succeeded)
+			continue;
+
+		if (auto* agent = registry.try_get<Agent>(result.owner))
+			agent->_polyRef = static_cast<dtPolyRef>(result.polyRef);
+
+		_crowd->requestMoveTarget(agentData.index, static_cast<dtPolyRef>(result.polyRef), &result.point.x);
+	}
+}
+
+void core::PathFindingSystem::constructAgent(entt::registry& registry, entt::entity entity)
+{
+	_placeRequests.push_back(entity);
+}
+
+void core::PathFindingSystem::destroyAgent(entt::registry& registry, entt::entity entity)
+{
+	auto it = _agentData.find(entity);
+	if (it == _agentData.end())
+		return;
+
+	if (_crowd && it->second.index >= 0)
+		_crowd->removeAgent(it->second.index);
+
+	_agentData.erase(it);
+}
+
+
+void core::PathFindingSystem::updateObstacles(entt::registry& registry, float tick)
+{
+	auto* tileCache = _navMeshData.tileCache;
+
+	// 이번 프레임에 추가/삭제 요청이 있었는지 (요청은 update 에서 처리됨)
+	bool hasRequests = false;
+
+	// 요청 큐는 프레임당 크기가 제한되어 있으므로 가득 차면 다음 프레임에 재시도
+	while (!_pendingObstacleRemovals.empty())
+	{
+		if (dtStatusFailed(tileCache->removeObstacle(_pendingObstacleRemovals.back())))
+			break;
+		_pendingObstacleRemovals.pop_back();
+		hasRequests = true;
+	}
+
+	// 기준 이상 이동/회전한 장애물만 다시 등록
+	for (auto&& [entity, obstacle, world] : registry.view<NavMeshObstacle, WorldTransform>().each())
+	{
+		// -pi, pi 경계를 넘는 회전도 실제 각도 차이로 비교
+		const float yaw = world.rotation.ToEuler().y;
+		const bool moved = Vector3::DistanceSquared(obstacle._position, world.position) > obstacle.moveThreshold * obstacle.moveThreshold
+			|| std::abs(std::remainder(yaw - obstacle._yaw, DirectX::XM_2PI)) > OBSTACLE_ROTATION_THRESHOLD;
+
+		if (obstacle._obstacleRef && !moved)
+			continue;
+
+		if (obstacle._obstacleRef)
+		{
+			if (dtStatusFailed(tileCache->removeObstacle(obstacle._obstacleRef)))
+				break;
+			obstacle._obstacleRef = 0;
+			hasRequests = true;
+		}
+
+		if (!addObstacle(obstacle, world))
+			break;
+		hasRequests = true;
+	}
+
+	// 새 요청도 없고 재생성할 타일도 남지 않았으면 워커를 막지 않음
+	if (!hasRequests && _isTileCacheUpToDate)
+		return;
+
+	// 변경된 타일 재생성은 프레임당 시간 예산 내에서 한 타일씩 진행
+	const auto start = std::chrono::steady_clock::now();
+	bool upToDate = false;
+
+	// 타일 교체 중에는 워커의 경로 탐색을 막음
+	auto navMeshLock = _pathQueryService ? _pathQueryService->LockForWrite() : std::unique_lock<std::shared_mutex>{};
+
+	do
+	{
+		tileCache->update(tick, _navMeshData.navMesh, &upToDate);
+	} while (!upToDate && std::chrono::steady_clock::now() - start < OBSTACLE_UPDATE_BUDGET);
+
+	_isTileCacheUpToDate = upToDate;
+}
+
+unsigned int core::PathFindingSystem::addObstacle(NavMeshObstacle& obstacle, const WorldTransform& world)
+{
+	auto* tileCache = _navMeshData.tileCache;
+
+	const Vector3 center = world.position + Vector3::Transform(obstacle.center * world.scale, world.rotation);
+	const float yaw = world.rotation.ToEuler().y;
+	dtStatus status;
+
+	if (obstacle.shape == NavMeshObstacle::Shape::Box)
+	{
+		// 박스는 Y 축 회전만 반영
+		const Vector3 halfExtents = obstacle.size * world.scale * 0.5f;
+		status = tileCache->addBoxObstacle(&center.x, &halfExtents.x, yaw, &obstacle._obstacleRef);
+	}
+	else
+	{
+		// 실린더는 바닥 중심을 기준으로 등록
+		const float radius = obstacle.radius * (std::max)(world.scale.x, world.scale.z);
+		const float height = obstacle.height * world.scale.y;
+		const Vector3 bottom = center - Vector3(0.f, height * 0.5f, 0.f);
+		status = tileCache->addObstacle(&bottom.x, radius, height, &obstacle._obstacleRef);
+	}
+
+	if (dtStatusFailed(status))
+	{
+		obstacle._obstacleRef = 0;
+		return 0;
+	}
+
+	obstacle._position = world.position;
+	obstacle._yaw = yaw;
+
+	return obstacle._obstacleRef;
+}
+
+void core::PathFindingSystem::constructObstacle(entt::registry& registry, entt::entity entity)
+{
+	// 타일 캐시는 시작 시점에 장애물이 있는 씬에서만 만들어지므로, 그 외에는 네비메쉬에 반영되지 않음
+	if (_navMeshData.navMesh && !_navMeshData.tileCache)
+		LOG_WARN_D(*_dispatcher, "{} : NavMeshObstacle is ignored because the scene had no obstacles at start (no tile cache was built)", entity);
+}
+
+void core::PathFindingSystem::destroyObstacle(entt::registry& registry, entt::entity entity)
+{
+	if (!_navMeshData.tileCache)
+		return;
+
+	auto& obstacle = registry.get<NavMeshObstacle>(entity);
+
+	if (obstacle._obstacleRef)
+		_pendingObstacleRemovals.push_back(obstacle._obstacleRef);
+}
 
 void core::PathFindingSystem::startSystem(const OnStartSystem& event)
 {
 	event.scene->GetRegistry()->on_update<Agent>().connect<&PathFindingSystem::updateAgentParam>(this);
+	event.scene->GetRegistry()->on_construct<Agent>().connect<&PathFindingSystem::constructAgent>(this);
+	event.scene->GetRegistry()->on_destroy<Agent>().connect<&PathFindingSystem::destroyAgent>(this);
+	event.scene->GetRegistry()->on_construct<NavMeshObstacle>().connect<&PathFindingSystem::constructObstacle>(this);
+	event.scene->GetRegistry()->on_destroy<NavMeshObstacle>().connect<&PathFindingSystem::destroyObstacle>(this);
 	auto settingView = event.scene->GetRegistry()->view<NavMeshSettings>();
 
 	NavMeshBuilder builder(event.scene);
 
+	int maxAgents = NavMeshSettings{}.maxAgents;
+	_pathRequestBudget = NavMeshSettings{}.maxPathRequestsPerFrame;
+
 	for (auto&& [entity, settings] : settingView.each())
 	{
+		maxAgents = (std::max)(settings.maxAgents, 1);
+		_pathRequestBudget = (std::max)(settings.maxPathRequestsPerFrame, 1);
+
 		auto psScene = event.scene->GetPhysicsScene();
 		std::vector<float> vertices;
 		std::vector<int> indices;
 		psScene->GetStaticPoly(vertices, indices);
-		builder.InputWorld(vertices, indices);
-		builder.BuildNavMesh(settings, _navMeshData);
+		builder.InputWorld(std::move(vertices), std::move(indices));
+
+		// 정적 지오메트리/설정이 캐시와 같으면 빌드 없이 로드, 변경된 타일만 재생성
+		std::filesystem::path cachePath = settings.navMesh.empty()
+			? std::filesystem::path(NAV_MESH_CACHE_DIRECTORY) / (event.scene->GetName() + NAV_MESH_EXTENSION)
+			: std::filesystem::path(settings.navMesh);
+
+		// 장애물이 있는 씬은 타일 캐시(압축 레이어)로 생성하여 부분 재생성 지원
+		if (event.scene->GetRegistry()->view<NavMeshObstacle>().empty())
+			builder.BuildTiledNavMesh(settings, _navMeshData, cachePath);
+		else
+			builder.BuildTileCache(settings, _navMeshData, cachePath);
 		break;
 	}
 
-	if (!initCrowd(MAX_AGENTS, MAX_AGENT_RADIUS))
-	{
-		LOG_ERROR(*event.scene, "PathFindingSystem\nFailed to Initialize Crowd");
-		return;
-	}
+	// 게임플레이 시스템의 경로/근접 쿼리용
+	_pathQueryService = event.scene->GetPathQueryService();
+
+	if (_navMeshData.navMesh && !_pathQueryService->Attach(_navMeshData.navMesh))
+		LOG_WARN(*event.scene, "PathFindingSystem\nFailed to start path query workers");
 
 	auto registry = event.scene->GetRegistry();
 	auto view = registry->view<Agent, WorldTransform>();
 
-	for (auto&& [entity, agent, world] : view.each())
+	// 씬에 배치된 에이전트 수만큼은 처음부터 확보
+	if (!initCrowd((std::max)(maxAgents, static_cast<int>(view.size_hint())), MAX_AGENT_RADIUS))
 	{
-		auto index = placeAgentOnMesh(agent, world.position, entity);
-
-		if (index >= 0)
-			_agentData[entity] = { index, agent.destination, agent.isStopped };
-		else
-			LOG_ERROR(*event.scene, "{} : Failed to add agent to the crowd.", entity);
+		LOG_ERROR(*event.scene, "PathFindingSystem\nFailed to Initialize Crowd");
+		return;
 	}
+
+	// 배치와 첫 경로 요청은 프레임당 예산에 맞춰 나누어 처리
+	for (auto entity : view)
+		_placeRequests.push_back(entity);
 }
 
 void core::PathFindingSystem::finishSystem(const OnFinishSystem& event)
 {
 	event.scene->GetRegistry()->on_update<Agent>().disconnect(this);
+	event.scene->GetRegistry()->on_construct<Agent>().disconnect(this);
+	event.scene->GetRegistry()->on_destroy<Agent>().disconnect(this);
+	event.scene->GetRegistry()->on_construct<NavMeshObstacle>().disconnect(this);
+	event.scene->GetRegistry()->on_destroy<NavMeshObstacle>().disconnect(this);
 	_agentData.clear();
+	_placeRequests.clear();
+	_pathRequests.clear();
+	_crowdCapacity = 0;
+	_pendingObstacleRemovals.clear();
+	_isTileCacheUpToDate = true;
+
+	// 워커가 네비메쉬를 참조하므로 해제 전에 먼저 정지
+	if (_pathQueryService)
+		_pathQueryService->Detach();
+	_pathQueryService = nullptr;
+
 	dtFreeCrowd(_crowd);
+	_crowd = nullptr;
+	dtFreeTileCache(_navMeshData.tileCache);
+	dtFreeNavMeshQuery(_navMeshData.navMeshQuery);
+	dtFreeNavMesh(_navMeshData.navMesh);
 	_navMeshData = NavMeshData{};
 }
 
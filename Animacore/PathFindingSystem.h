@@ -2,8 +2,11 @@
 #include "SystemInterface.h"
 #include "SystemTraits.h"
 #include "NavConfigs.h"
+#include "PathQueryService.h"
 
 class dtCrowd;
+struct dtCrowdAgent;
+struct dtCrowdAgentParams;
 
 namespace core
 {
@@ -11,14 +14,21 @@ namespace core
 	struct OnStartSystem;
 	struct NavMeshData;
 	struct Agent;
+	struct NavMeshObstacle;
+	struct WorldTransform;
+	struct LocalTransform;
+	struct Relationship;
+	struct NavMeshSettings;
 
 	class PathFindingSystem : public ISystem, public IUpdateSystem
 	{
 		struct AgentData
 		{
-			int index = -1;			// crowd 인덱스
-			Vector3 destination;	// 목적지
-			bool isStopped;			// 정지 여부
+			int index = -1;				// crowd 인덱스
+			Vector3 destination;		// 목적지
+			bool isStopped;				// 정지 여부
+			bool isRequested = false;	// 경로 요청 대기 중 여부
+			PathQueryHandle query = INVALID_PATH_QUERY;	// 진행 중인 목적지 쿼리
 		};
 
 	public:
@@ -30,6 +40,10 @@ namespace core
 	private:
 		// 초기화
 		bool initCrowd(int maxAgents, float maxAgentRadius);
+		// 수용량 확장 (기존 에이전트의 속도, 경로, 정지 상태 유지)
+		bool growCrowd();
+		// 정지된 에이전트의 슬롯을 재사용하지 않고 추가
+		int addCrowdAgent(const Vector3& position, const dtCrowdAgentParams& params);
 
 		// 에이전트 생성
 		int placeAgentOnMesh(Agent& agent, const Vector3& startPos, entt::entity entity);
@@ -37,6 +51,24 @@ namespace core
 		void updateAgentParam(entt::registry& registry, entt::entity entity);
 		// 목적지 업데이트
 		void updateDestination(core::Agent& agent, entt::entity entity);
+		// 배치 대기 및 경로 요청을 프레임당 예산만큼 처리 (목적지 탐색은 PathQueryService 로 비동기 처리)
+		void processPathRequests(entt::registry& registry);
+		// 완료된 목적지 쿼리를 crowd 에 반영
+		void applyPathResults(entt::registry& registry);
+		// crowd 위치를 WorldTransform 에 일괄 반영
+		void writeBackAgents(entt::registry& registry);
+
+		// 런타임 중 에이전트 추가/삭제
+		void constructAgent(entt::registry& registry, entt::entity entity);
+		void destroyAgent(entt::registry& registry, entt::entity entity);
+
+		static dtCrowdAgentParams makeAgentParams(const Agent& agent, entt::entity entity);
+
+		// 동적 장애물 등록/갱신 (타일 캐시 사용 시)
+		void updateObstacles(entt::registry& registry, float tick);
+		unsigned int addObstacle(NavMeshObstacle& obstacle, const WorldTransform& world);
+		void constructObstacle(entt::registry& registry, entt::entity entity);
+		void destroyObstacle(entt::registry& registry, entt::entity entity);
 
 		// 이벤트
 		void startSystem(const OnStartSystem& event);
@@ -48,8 +80,33 @@ namespace core
 
 		NavMeshData _navMeshData;
 		dtCrowd* _crowd = nullptr;
+		std::shared_ptr<PathQueryService> _pathQueryService;
 
 		std::map<entt::entity, AgentData> _agentData;
+
+		// crowd 수용량 및 프레임당 경로 요청 수 (NavMeshSettings)
+		int _crowdCapacity = 0;
+		int _pathRequestBudget = 0;
+
+		// 배치 대기 / 목적지 변경 요청 큐 (findNearestPoly 비용 분산)
+		std::deque<entt::entity> _placeRequests;
+		std::deque<entt::entity> _pathRequests;
+
+		// 매 프레임 재사용하는 버퍼
+		std::vector<dtCrowdAgent*> _activeAgents;
+		std::vector<int> _stoppedSlots;
+		std::vector<entt::entity> _movedEntities;
+		std::vector<PathQueryRequest> _queryBatch;
+		std::vector<entt::entity> _queryOwners;
+		std::vector<PathQueryHandle> _queryHandles;
+		std::vector<PathQueryResult> _queryResults;
+
+		// 요청 큐가 가득 차 다음 프레임으로 미뤄진 장애물 삭제
+		std::vector<unsigned int> _pendingObstacleRemovals;
+		// 마지막 tileCache->update 에서 재생성할 타일이 남지 않았는지
+		bool _isTileCacheUpToDate = true;
 	};
 }
 DEFINE_SYSTEM_TRAITS(core::PathFindingSystem)
+DEFINE_SYSTEM_READS(core::PathFindingSystem, core::NavMeshSettings, core::Relationship)
+DEFINE_SYSTEM_WRITES(core::PathFindingSystem, core::Agent, core::NavMeshObstacle, core::WorldTransform, core::LocalTransform, core::access::Physics, core::access::Dispatcher)
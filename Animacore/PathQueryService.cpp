@@ -0,0 +1,377 @@
+﻿#include "pch.h"
+#include "PathQueryService.h"
+
+#include <recastnavigation/DetourNavMesh.h>
+#include <recastnavigation/DetourNavMeshQuery.h>
+
+namespace
+{
+	// 워커 쿼리당 탐색 노드 수 및 결과 버퍼 크기
+	constexpr int MAX_SEARCH_NODES = 2048;
+	constexpr int MAX_PATH_POLYS = 256;
+	constexpr int MAX_STRAIGHT_PATH = 256;
+
+	// 슬라이스당 A* 반복 횟수 (슬라이스 사이에 쓰기 잠금을 양보)
+	constexpr int ITERATIONS_PER_SLICE = 64;
+
+	constexpr uint32_t MAX_DEFAULT_WORKERS = 4;
+}
+
+core::PathQueryService::PathQueryService(uint32_t workerCount)
+{
+	// 공용 워커를 게임 로직, 물리와 나눠 쓰므로 일부만 사용
+	_workerCount = workerCount > 0
+		? workerCount
+		: std::clamp(GetJobSystem().GetWorkerCount() / 4, 1u, MAX_DEFAULT_WORKERS);
+}
+
+core::PathQueryService::~PathQueryService()
+{
+	Detach();
+}
+
+bool core::PathQueryService::Attach(dtNavMesh* navMesh)
+{
+	Detach();
+
+	if (!navMesh)
+		return false;
+
+	// 작업마다 독립적인 쿼리 객체 (dtNavMeshQuery 는 스레드 안전하지 않음)
+	for (uint32_t i = 0; i < _workerCount; ++i)
+	{
+		dtNavMeshQuery* query = dtAllocNavMeshQuery();
+
+		if (!query || dtStatusFailed(query->init(navMesh, MAX_SEARCH_NODES)))
+		{
+			dtFreeNavMeshQuery(query);
+			Detach();
+			return false;
+		}
+
+		_queries.push_back(query);
+	}
+
+	_navMesh = navMesh;
+
+	std::lock_guard lock(_jobMutex);
+	_freeQueries = _queries;
+
+	return true;
+}
+
+void core::PathQueryService::Detach()
+{
+	// 진행 중인 슬라이스가 끝나면 종료 (대기하는 동안 이 스레드도 다른 작업을 처리)
+	_isStopping.store(true, std::memory_order_relaxed);
+	GetJobSystem().Wait(_drains);
+	_isStopping.store(false, std::memory_order_relaxed);
+
+	for (auto* query : _queries)
+		dtFreeNavMeshQuery(query);
+
+	_queries.clear();
+	_navMesh = nullptr;
+
+	{
+		std::lock_guard lock(_jobMutex);
+		_freeQueries.clear();
+		_jobs.clear();
+		_running.clear();
+		_cancelled.clear();
+	}
+
+	std::lock_guard lock(_resultMutex);
+	_results.clear();
+}
+
+core::PathQueryHandle core::PathQueryService::Request(const PathQueryRequest& request)
+{
+	if (!_navMesh)
+		return INVALID_PATH_QUERY;
+
+	PathQueryHandle handle;
+
+	{
+		std::lock_guard lock(_jobMutex);
+
+		if (++_nextHandle == INVALID_PATH_QUERY)
+			++_nextHandle;
+
+		handle = _nextHandle;
+		_jobs.push_back({ handle, request });
+		startDrains();
+	}
+
+	return handle;
+}
+
+void core::PathQueryService::Request(std::span<const PathQueryRequest> requests, std::vector<PathQueryHandle>* outHandles)
+{
+	if (outHandles)
+		outHandles->clear();
+
+	if (requests.empty())
+		return;
+
+	if (!_navMesh)
+	{
+		if (outHandles)
+			outHandles->assign(requests.size(), INVALID_PATH_QUERY);
+		return;
+	}
+
+	{
+		std::lock_guard lock(_jobMutex);
+
+		for (const auto& request : requests)
+		{
+			if (++_nextHandle == INVALID_PATH_QUERY)
+				++_nextHandle;
+
+			_jobs.push_back({ _nextHandle, request });
+
+			if (outHandles)
+				outHandles->push_back(_nextHandle);
+		}
+
+		startDrains();
+	}
+}
+
+void core::PathQueryService::Cancel(PathQueryHandle handle)
+{
+	if (handle == INVALID_PATH_QUERY)
+		return;
+
+	std::lock_guard lock(_jobMutex);
+
+	// 대기 중이면 바로 제거
+	if (auto it = std::ranges::find(_jobs, handle, &Job::handle); it != _jobs.end())
+	{
+		_jobs.erase(it);
+		return;
+	}
+
+	// 진행 중이면 완료 시점에 버림
+	if (_running.contains(handle))
+	{
+		_cancelled.insert(handle);
+		return;
+	}
+
+	// 완료되어 Poll 을 기다리는 결과는 바로 제거, 이미 전달되었거나 모르는 핸들은 무시
+	std::lock_guard resultLock(_resultMutex);
+
+	for (auto& results : _results | std::views::values)
+	{
+		if (std::erase_if(results, [handle](const PathQueryResult& result) { return result.handle == handle; }) > 0)
+			return;
+	}
+}
+
+size_t core::PathQueryService::Poll(entt::id_type channel, std::vector<PathQueryResult>& outResults)
+{
+	outResults.clear();
+
+	{
+		std::lock_guard lock(_resultMutex);
+
+		auto it = _results.find(channel);
+		if (it == _results.end() || it->second.empty())
+			return 0;
+
+		outResults.swap(it->second);
+	}
+
+	return outResults.size();
+}
+
+void core::PathQueryService::startDrains()
+{
+	auto& jobSystem = GetJobSystem();
+	size_t pending = _jobs.size();
+
+	while (pending > 0 && !_freeQueries.empty())
+	{
+		dtNavMeshQuery* query = _freeQueries.back();
+		_freeQueries.pop_back();
+		--pending;
+
+		jobSystem.Run(_drains, [this, query] { drain(query); });
+	}
+}
+
+void core::PathQueryService::drain(dtNavMeshQuery* query)
+{
+	auto& jobSystem = GetJobSystem();
+	Job job;
+
+	{
+		std::lock_guard lock(_jobMutex);
+
+		if (_isStopping.load(std::memory_order_relaxed) || _jobs.empty())
+		{
+			_freeQueries.push_back(query);
+			return;
+		}
+
+		// 메인 스레드가 Wait 중에 집어 들었으면 프레임이 경로 탐색을 기다리지 않도록 워커에게 돌려줌
+		if (jobSystem.GetCurrentWorkerIndex() < 0 && jobSystem.GetWorkerCount() > 0)
+		{
+			jobSystem.Run(_drains, [this, query] { drain(query); });
+			return;
+		}
+
+		job = std::move(_jobs.front());
+		_jobs.pop_front();
+		_running.insert(job.handle);
+	}
+
+	PathQueryResult result;
+	execute(query, job, result);
+
+	if (!_isStopping.load(std::memory_order_relaxed))
+		complete(std::move(result));
+
+	// 남은 요청은 새 작업으로 이어서 처리 (없으면 다음 작업이 쿼리 객체를 반납)
+	jobSystem.Run(_drains, [this, query] { drain(query); });
+}
+
+void core::PathQueryService::execute(dtNavMeshQuery* query, const Job& job, PathQueryResult& result)
+{
+	const auto& request = job.request;
+
+	result.handle = job.handle;
+	result.type = request.type;
+	result.owner = request.owner;
+	result.channel = request.channel;
+	result.requestedEnd = request.end;
+
+	// 모든 폴리곤 포함 (PathFindingSystem crowd 필터와 동일)
+	dtQueryFilter filter;
+	filter.setIncludeFlags(0xffff);
+	filter.setExcludeFlags(0);
+
+	if (request.type == PathQueryType::FindPath || request.type == PathQueryType::StraightPath)
+	{
+		result.succeeded = findPath(query, filter, job, result);
+		return;
+	}
+
+	std::shared_lock lock(_navMeshMutex);
+
+	dtPolyRef startRef = 0;
+	Vector3 startPoint;
+	dtStatus status = query->findNearestPoly(&request.start.x, &request.extents.x, &filter, &startRef, &startPoint.x);
+
+	if (dtStatusFailed(status) || !startRef)
+		return;
+
+	if (request.type == PathQueryType::NearestPoly)
+	{
+		result.polyRef = startRef;
+		result.point = startPoint;
+		result.succeeded = true;
+		return;
+	}
+
+	// Raycast
+	float t = 0.f;
+	dtPolyRef polys[MAX_PATH_POLYS];
+	int polyCount = 0;
+	status = query->raycast(startRef, &startPoint.x, &request.end.x, &filter, &t, &result.normal.x, polys, &polyCount, MAX_PATH_POLYS);
+
+	if (dtStatusFailed(status))
+		return;
+
+	// t 가 FLT_MAX 이면 끝점까지 막힘 없음
+	result.hit = t <= 1.f;
+	result.point = result.hit ? Vector3::Lerp(startPoint, request.end, t) : request.end;
+	result.polyRef = polyCount > 0 ? polys[polyCount - 1] : startRef;
+	result.corridor.assign(polys, polys + polyCount);
+	result.succeeded = true;
+}
+
+bool core::PathQueryService::findPath(dtNavMeshQuery* query, const dtQueryFilter& filter, const Job& job, PathQueryResult& result)
+{
+	const auto& request = job.request;
+
+	std::shared_lock lock(_navMeshMutex);
+
+	dtPolyRef startRef = 0;
+	dtPolyRef endRef = 0;
+	Vector3 startPoint;
+	Vector3 endPoint;
+
+	if (dtStatusFailed(query->findNearestPoly(&request.start.x, &request.extents.x, &filter, &startRef, &startPoint.x)) || !startRef)
+		return false;
+
+	if (dtStatusFailed(query->findNearestPoly(&request.end.x, &request.extents.x, &filter, &endRef, &endPoint.x)) || !endRef)
+		return false;
+
+	// 슬라이스 사이에 잠금을 풀어 타일 갱신이 오래 기다리지 않도록 함
+	// (탐색 중 사라진 폴리곤은 Detour 가 실패로 처리)
+	dtStatus status = query->initSlicedFindPath(startRef, endRef, &startPoint.x, &endPoint.x, &filter);
+
+	while (dtStatusInProgress(status))
+	{
+		lock.unlock();
+
+		if (_isStopping.load(std::memory_order_relaxed))
+			return false;
+
+		lock.lock();
+		status = query->updateSlicedFindPath(ITERATIONS_PER_SLICE, nullptr);
+	}
+
+	if (dtStatusFailed(status))
+		return false;
+
+	dtPolyRef polys[MAX_PATH_POLYS];
+	int polyCount = 0;
+	status = query->finalizeSlicedFindPath(polys, &polyCount, MAX_PATH_POLYS);
+
+	if (dtStatusFailed(status) || polyCount == 0)
+		return false;
+
+	result.partial = dtStatusDetail(status, DT_PARTIAL_RESULT) || polys[polyCount - 1] != endRef;
+	result.polyRef = polys[polyCount - 1];
+	result.corridor.assign(polys, polys + polyCount);
+
+	if (request.type != PathQueryType::StraightPath)
+		return true;
+
+	// 부분 경로는 마지막 폴리곤 위의 가장 가까운 지점까지
+	Vector3 target = endPoint;
+
+	if (result.partial)
+		query->closestPointOnPoly(polys[polyCount - 1], &endPoint.x, &target.x, nullptr);
+
+	float straightPath[MAX_STRAIGHT_PATH * 3];
+	int straightCount = 0;
+	status = query->findStraightPath(&startPoint.x, &target.x, polys, polyCount, straightPath, nullptr, nullptr, &straightCount, MAX_STRAIGHT_PATH);
+
+	if (dtStatusFailed(status))
+		return false;
+
+	result.points.reserve(straightCount);
+
+	for (int i = 0; i < straightCount; ++i)
+		result.points.emplace_back(straightPath[i * 3], straightPath[i * 3 + 1], straightPath[i * 3 + 2]);
+
+	return true;
+}
+
+void core::PathQueryService::complete(PathQueryResult&& result)
+{
+	// 결과를 넣을 때까지 _jobMutex 를 잡아 Cancel 이 진행 중도 완료도 아닌 틈을 보지 않도록 함 (_jobMutex -> _resultMutex 순서)
+	std::lock_guard lock(_jobMutex);
+	_running.erase(result.handle);
+
+	if (_cancelled.erase(result.handle) > 0)
+		return;
+
+	std::lock_guard resultLock(_resultMutex);
+	_results[result.channel].push_back(std::move(result));
+}
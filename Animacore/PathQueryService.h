@@ -0,0 +1,130 @@
+﻿#pragma once
+
+#include <span>
+
+#include "JobSystem.h"
+
+class dtNavMesh;
+class dtNavMeshQuery;
+class dtQueryFilter;
+
+namespace core
+{
+	enum class PathQueryType
+	{
+		NearestPoly,	// 가장 가까운 폴리곤과 지점
+		FindPath,		// 폴리곤 경로 (corridor)
+		StraightPath,	// 폴리곤 경로 + 꺾이는 지점 목록
+		Raycast,		// 네비메쉬 표면을 따라 직선 이동 가능 여부
+	};
+
+	using PathQueryHandle = uint32_t;
+	constexpr PathQueryHandle INVALID_PATH_QUERY = 0;
+
+	struct PathQueryRequest
+	{
+		PathQueryType type = PathQueryType::NearestPoly;
+		Vector3 start;							// NearestPoly 는 start 만 사용
+		Vector3 end;
+		Vector3 extents = { 2.f, 4.f, 2.f };	// 폴리곤 탐색 범위
+		entt::entity owner = entt::null;		// 결과를 적용할 엔티티
+		entt::id_type channel = 0;				// 결과를 받아갈 시스템 (보통 entt::type_hash<System>::value())
+	};
+
+	struct PathQueryResult
+	{
+		PathQueryHandle handle = INVALID_PATH_QUERY;
+		PathQueryType type = PathQueryType::NearestPoly;
+		entt::entity owner = entt::null;
+		entt::id_type channel = 0;
+		bool succeeded = false;
+		bool partial = false;					// 목적지에 도달하지 못한 부분 경로
+
+		uint64_t polyRef = 0;					// NearestPoly : 찾은 폴리곤
+		Vector3 point;							// NearestPoly : 가장 가까운 지점, Raycast : 충돌 지점 (충돌이 없으면 end)
+		Vector3 normal;							// Raycast : 충돌한 벽의 법선
+		bool hit = false;						// Raycast : 충돌 여부
+
+		Vector3 requestedEnd;					// 요청 당시 목적지 (결과가 아직 유효한지 판단)
+		std::vector<uint64_t> corridor;			// FindPath, StraightPath : 폴리곤 경로
+		std::vector<Vector3> points;			// StraightPath : 경로 지점
+	};
+
+	/// \brief
+	/// \n 네비메쉬 경로/근접 쿼리를 공용 JobSystem 워커에서 처리하는 서비스 (씬마다 개별적으로 존재함)
+	///	\n 동시에 처리하는 작업마다 dtNavMeshQuery 를 하나씩 빌려 공유 dtNavMesh 를 읽기 전용으로 탐색
+	///	\n 작업 하나는 요청 하나만 처리하고 남은 요청은 새 작업으로 이어가므로 워커를 오래 붙잡지 않음
+	///	\n 긴 탐색은 sliced pathfinding 으로 나누어 진행하며 슬라이스 사이에 쓰기 잠금을 양보함
+	///	\n 결과는 채널별 완료 큐에 쌓이고 시스템이 Poll 로 가져감
+	///	\n
+	///	\n 네비메쉬를 변경하는 코드(타일 캐시 갱신 등)는 LockForWrite 로 잠근 뒤 수행해야 함
+	class PathQueryService
+	{
+	public:
+		// 동시에 처리할 최대 요청 수 (0 이면 JobSystem 워커 수에 맞춰 결정)
+		explicit PathQueryService(uint32_t workerCount = 0);
+		~PathQueryService();
+
+		PathQueryService(const PathQueryService&) = delete;
+		PathQueryService& operator=(const PathQueryService&) = delete;
+
+		// 네비메쉬 연결 / 해제 (진행 중인 작업이 끝날 때까지 대기, 대기 중인 요청과 결과는 버려짐)
+		bool Attach(dtNavMesh* navMesh);
+		void Detach();
+		bool IsAttached() const { return _navMesh != nullptr; }
+
+		// 요청 (연결되지 않았으면 INVALID_PATH_QUERY)
+		PathQueryHandle Request(const PathQueryRequest& request);
+
+		// 여러 요청을 한번에 추가 (잠금과 통지를 한 번만 수행)
+		void Request(std::span<const PathQueryRequest> requests, std::vector<PathQueryHandle>* outHandles = nullptr);
+
+		// 아직 Poll 되지 않은 요청 취소 (결과가 전달되지 않음)
+		void Cancel(PathQueryHandle handle);
+
+		// 채널의 완료된 결과를 모두 가져옴
+		size_t Poll(entt::id_type channel, std::vector<PathQueryResult>& outResults);
+
+		// 네비메쉬 변경용 쓰기 잠금 (워커는 슬라이스 단위로 읽기 잠금을 잡음)
+		std::unique_lock<std::shared_mutex> LockForWrite() { return std::unique_lock(_navMeshMutex); }
+
+	private:
+		struct Job
+		{
+			PathQueryHandle handle = INVALID_PATH_QUERY;
+			PathQueryRequest request;
+		};
+
+		// 쉬고 있는 쿼리 객체만큼 JobSystem 작업 시작 (_jobMutex 를 잡은 상태에서 호출)
+		void startDrains();
+		// 요청 하나를 처리하고 남은 요청이 있으면 같은 쿼리 객체로 다음 작업 추가
+		void drain(dtNavMeshQuery* query);
+		void execute(dtNavMeshQuery* query, const Job& job, PathQueryResult& result);
+		bool findPath(dtNavMeshQuery* query, const dtQueryFilter& filter, const Job& job, PathQueryResult& result);
+		void complete(PathQueryResult&& result);
+
+		uint32_t _workerCount = 1;
+		dtNavMesh* _navMesh = nullptr;
+
+		std::vector<dtNavMeshQuery*> _queries;
+		std::vector<dtNavMeshQuery*> _freeQueries;	// 작업에 빌려주지 않은 쿼리 객체 (_jobMutex)
+
+		// 진행 중인 작업 (Detach 에서 대기), 슬라이스 사이에 확인하여 중단
+		JobCounter _drains;
+		std::atomic<bool> _isStopping = false;
+
+		// 요청 큐
+		std::mutex _jobMutex;
+		std::deque<Job> _jobs;
+		std::unordered_set<PathQueryHandle> _running;	// 작업이 꺼내 처리 중인 요청
+		std::unordered_set<PathQueryHandle> _cancelled;	// 처리 중에 취소된 요청 (항상 _running 의 부분집합)
+		PathQueryHandle _nextHandle = INVALID_PATH_QUERY;
+
+		// 채널별 완료 큐
+		std::mutex _resultMutex;
+		std::unordered_map<entt::id_type, std::vector<PathQueryResult>> _results;
+
+		// 네비메쉬 읽기(워커) / 쓰기(타일 캐시 갱신) 잠금
+		std::shared_mutex _navMeshMutex;
+	};
+}
@@ -8,6 +8,8 @@
 #include "RenderComponents.h"
 #include "CoreSystemEvents.h"
 #include "CoreTagsAndLayers.h"
+#include "Profiler.h"
+#include "FrameAllocator.h"
 #include "CorePhysicsComponents.h"
 
 #include <../Animavision/Mesh.h>
@@ -38,15 +40,30 @@ core::PhysicsScene::~PhysicsScene()
 	_resources.SceneFinalize();
 }
 
+void core::PhysicsScene::CookMesh(const Mesh& mesh, const MeshCollider& collider)
+{
+	if (collider.convex)
+		_resources.GetConvexMesh(mesh, collider);
+	else
+		_resources.GetTriangleMesh(mesh, collider);
+}
+
 void core::PhysicsScene::Update(float tick)
 {
 	using namespace physx;
 
 	// 시뮬레이션 업데이트
-	_pxScene->simulate(tick);
-	_pxScene->fetchResults(true);
+	{
+		PROFILE_SCOPE("PhysX simulate");
+		_pxScene->simulate(tick);
+	}
+	{
+		PROFILE_SCOPE("PhysX fetchResults");
+		_pxScene->fetchResults(true);
+	}
 
 	// 실제 씬 적용
+	PROFILE_SCOPE("PhysicsScene::sceneFetch");
 	sceneFetch();
 }
 
@@ -305,7 +322,8 @@ bool core::PhysicsScene::LoadMaterial(const std::filesystem::path& path)
 	return false;
 }
 
-bool core::PhysicsScene::Raycast(Vector3 origin, Vector3 direction, std::vector<physics::RaycastHit>& hits, uint32_t maxHit, float maxDistance, uint32_t layerMask, physics::QueryTriggerInteraction queryTriggerInteraction)
+template <typename Allocator>
+bool core::PhysicsScene::Raycast(Vector3 origin, Vector3 direction, std::vector<physics::RaycastHit, Allocator>& hits, uint32_t maxHit, float maxDistance, uint32_t layerMask, physics::QueryTriggerInteraction queryTriggerInteraction)
 {
 	using namespace physx;
 
@@ -365,11 +383,18 @@ bool core::PhysicsScene::Raycast(Vector3 origin, Vector3 direction, std::vector<
 	return false;
 }
 
-bool core::PhysicsScene::Raycast(const physics::Ray& ray, std::vector<physics::RaycastHit>& hitInfo, uint32_t maxHit, float maxDistance, uint32_t layerMask, physics::QueryTriggerInteraction queryTriggerInteraction)
+template <typename Allocator>
+bool core::PhysicsScene::Raycast(const physics::Ray& ray, std::vector<physics::RaycastHit, Allocator>& hitInfo, uint32_t maxHit, float maxDistance, uint32_t layerMask, physics::QueryTriggerInteraction queryTriggerInteraction)
 {
 	return Raycast(ray.origin, ray.direction, hitInfo, maxHit, maxDistance, layerMask, queryTriggerInteraction);
 }
 
+// 보관용(std::vector), 프레임 임시용(FrameVector)
+template bool core::PhysicsScene::Raycast(Vector3, Vector3, std::vector<physics::RaycastHit>&, uint32_t, float, uint32_t, physics::QueryTriggerInteraction);
+template bool core::PhysicsScene::Raycast(Vector3, Vector3, core::FrameVector<physics::RaycastHit>&, uint32_t, float, uint32_t, physics::QueryTriggerInteraction);
+template bool core::PhysicsScene::Raycast(const physics::Ray&, std::vector<physics::RaycastHit>&, uint32_t, float, uint32_t, physics::QueryTriggerInteraction);
+template bool core::PhysicsScene::Raycast(const physics::Ray&, core::FrameVector<physics::RaycastHit>&, uint32_t, float, uint32_t, physics::QueryTriggerInteraction);
+
 bool core::PhysicsScene::Boxcast(Vector3 center, Vector3 halfExtents, Vector3 direction, std::vector<physics::RaycastHit>& hits, Quaternion orientation, float maxDistance, uint32_t layerMask, physics::QueryTriggerInteraction queryTriggerInteraction)
 {
 	using namespace physx;
@@ -421,125 +446,166 @@ void core::PhysicsScene::GetStaticPoly(std::vector<float>& vertices, std::vector
 {
 	using namespace physx;
 
-	for (auto& staticActor : _entityToStatic | std::views::values) {
-		// PxShape 가져오기
-		PxRigidActor* actor = staticActor;
-		uint32_t shapeCount = actor->getNbShapes();
-		std::vector<PxShape*> shapes(shapeCount);
-		actor->getShapes(shapes.data(), shapeCount);
+	// 해시(캐시 키)가 실행마다 같도록 엔티티 순서로 정렬
+	std::vector<std::pair<entt::entity, PxRigidStatic*>> statics(_entityToStatic.begin(), _entityToStatic.end());
+	std::ranges::sort(statics, {}, &std::pair<entt::entity, PxRigidStatic*>::first);
+
+	// 박스의 8개의 꼭짓점 부호
+	constexpr float boxSigns[8][3] = {
+		{-1, -1, -1}, { 1, -1, -1}, { 1,  1, -1}, {-1,  1, -1},
+		{-1, -1,  1}, { 1, -1,  1}, { 1,  1,  1}, {-1,  1,  1}
+	};
+
+	// 박스의 인덱스 (삼각형 목록)
+	constexpr int boxIndices[36] = {
+		0, 1, 2, 0, 2, 3, // Bottom face
+		4, 6, 5, 4, 7, 6, // Top face
+		0, 5, 1, 0, 4, 5, // Front face
+		1, 6, 2, 1, 5, 6, // Right face
+		2, 7, 3, 2, 6, 7, // Back face
+		3, 4, 0, 3, 7, 4  // Left face
+	};
+
+	std::vector<PxShape*> shapes;
+
+	// 쉐이프 순회 (레이어 필터링 포함)
+	auto forEachShape = [&](auto&& func)
+		{
+			for (auto& actor : statics | std::views::values)
+			{
+				uint32_t shapeCount = actor->getNbShapes();
+				shapes.resize(shapeCount);
+				actor->getShapes(shapes.data(), shapeCount);
 
-		// 각 쉐이프의 버텍스/인덱스 추출
-		for (PxShape* shape : shapes) {
+				const PxTransform actorPose = actor->getGlobalPose();
 
-			// 레이어 필터링을 위해 필터 데이터 가져오기
-			PxFilterData filterData = shape->getSimulationFilterData();
-			uint32_t shapeLayer = filterData.word0;
+				for (PxShape* shape : shapes)
+				{
+					// 지정된 레이어와 일치하지 않으면 스킵
+					if ((shape->getSimulationFilterData().word0 & layerMask) == 0)
+						continue;
 
-			// 지정된 레이어와 일치하지 않으면 스킵
-			if ((shapeLayer & layerMask) == 0)
-				continue;
+					func(shape, actorPose * shape->getLocalPose());
+				}
+			}
+		};
 
-			// PxGeometryHolder를 사용하여 지오메트리 유형을 처리
+	// 1 pass : 필요한 버텍스/인덱스 개수 계산 후 한번에 예약
+	size_t vertexCount = 0;
+	size_t indexCount = 0;
+
+	forEachShape([&](PxShape* shape, const PxTransform&)
+		{
 			PxGeometryHolder geomHolder = shape->getGeometry();
 
-			// eBOX 처리
-			if (geomHolder.getType() == PxGeometryType::eBOX) {
-				const PxBoxGeometry& boxGeom = geomHolder.box();
-				const PxVec3& halfExtents = boxGeom.halfExtents;
-
-				// 박스의 8개의 꼭짓점을 추가
-				const PxVec3 boxVertices[8] = {
-					{-halfExtents.x, -halfExtents.y, -halfExtents.z},
-					{ halfExtents.x, -halfExtents.y, -halfExtents.z},
-					{ halfExtents.x,  halfExtents.y, -halfExtents.z},
-					{-halfExtents.x,  halfExtents.y, -halfExtents.z},
-					{-halfExtents.x, -halfExtents.y,  halfExtents.z},
-					{ halfExtents.x, -halfExtents.y,  halfExtents.z},
-					{ halfExtents.x,  halfExtents.y,  halfExtents.z},
-					{-halfExtents.x,  halfExtents.y,  halfExtents.z}
-				};
-
-				// 박스의 인덱스 (삼각형 목록)
-				const int boxIndices[36] = {
-					0, 1, 2, 0, 2, 3, // Bottom face
-					4, 6, 5, 4, 7, 6, // Top face
-					0, 5, 1, 0, 4, 5, // Front face
-					1, 6, 2, 1, 5, 6, // Right face
-					2, 7, 3, 2, 6, 7, // Back face
-					3, 4, 0, 3, 7, 4  // Left face
-				};
-
-				// 박스의 버텍스 추가
-				for (int i = 0; i < 8; ++i) {
-					vertices.push_back(boxVertices[i].x);
-					vertices.push_back(boxVertices[i].y);
-					vertices.push_back(boxVertices[i].z);
-				}
+			switch (geomHolder.getType())
+			{
+			case PxGeometryType::eBOX:
+				vertexCount += 8;
+				indexCount += 36;
+				break;
+			case PxGeometryType::eCONVEXMESH:
+			{
+				const PxConvexMesh* convexMesh = geomHolder.convexMesh().convexMesh;
+				vertexCount += convexMesh->getNbVertices();
 
-				// 박스의 인덱스 추가
-				for (int i = 0; i < 36; ++i) {
-					indices.push_back(boxIndices[i]);
+				for (PxU32 i = 0; i < convexMesh->getNbPolygons(); ++i)
+				{
+					PxHullPolygon polygon;
+					convexMesh->getPolygonData(i, polygon);
+					indexCount += (polygon.mNbVerts - 2) * 3;
 				}
+				break;
+			}
+			case PxGeometryType::eTRIANGLEMESH:
+			{
+				const PxTriangleMesh* triMesh = geomHolder.triangleMesh().triangleMesh;
+				vertexCount += triMesh->getNbVertices();
+				indexCount += triMesh->getNbTriangles() * 3;
+				break;
+			}
+			default:
+				break;
 			}
-			if (geomHolder.getType() == PxGeometryType::eCONVEXMESH) {
-				// Convex Mesh 처리
+		});
+
+	vertices.reserve(vertices.size() + vertexCount * 3);
+	indices.reserve(indices.size() + indexCount);
+
+	// 2 pass : 월드 공간으로 변환하여 추가
+	auto pushVertex = [&vertices](const PxVec3& v)
+		{
+			vertices.insert(vertices.end(), { v.x, v.y, v.z });
+		};
+
+	forEachShape([&](PxShape* shape, const PxTransform& pose)
+		{
+			PxGeometryHolder geomHolder = shape->getGeometry();
+			const int baseVertex = static_cast<int>(vertices.size() / 3);
+
+			// eBOX 처리
+			if (geomHolder.getType() == PxGeometryType::eBOX)
+			{
+				const PxVec3& halfExtents = geomHolder.box().halfExtents;
+
+				for (const auto& sign : boxSigns)
+					pushVertex(pose.transform(PxVec3(sign[0] * halfExtents.x, sign[1] * halfExtents.y, sign[2] * halfExtents.z)));
+
+				for (int index : boxIndices)
+					indices.push_back(baseVertex + index);
+			}
+			// Convex Mesh 처리
+			else if (geomHolder.getType() == PxGeometryType::eCONVEXMESH)
+			{
 				const PxConvexMeshGeometry& convexGeom = geomHolder.convexMesh();
 				const PxConvexMesh* convexMesh = convexGeom.convexMesh;
-				const PxU32 nbVerts = convexMesh->getNbVertices();
 				const PxVec3* verts = convexMesh->getVertices();
-				const PxU32 nbPolygons = convexMesh->getNbPolygons();
 
-				// Convex 메쉬의 버텍스를 벡터에 추가
-				for (PxU32 i = 0; i < nbVerts; ++i) {
-					vertices.push_back(verts[i].x);
-					vertices.push_back(verts[i].y);
-					vertices.push_back(verts[i].z);
-				}
+				for (PxU32 i = 0; i < convexMesh->getNbVertices(); ++i)
+					pushVertex(pose.transform(convexGeom.scale.transform(verts[i])));
 
-				for (PxU32 i = 0; i < nbPolygons; ++i) {
+				// 볼록 다각형을 삼각형 팬으로 분할
+				for (PxU32 i = 0; i < convexMesh->getNbPolygons(); ++i)
+				{
 					PxHullPolygon polygon;
 					convexMesh->getPolygonData(i, polygon);
 
 					auto indexBuffer = convexMesh->getIndexBuffer() + polygon.mIndexBase;
-					for (PxU32 j = 0; j < polygon.mNbVerts; ++j) {
-						indices.push_back(indexBuffer[j]);
+					for (PxU32 j = 2; j < polygon.mNbVerts; ++j)
+					{
+						indices.push_back(baseVertex + indexBuffer[0]);
+						indices.push_back(baseVertex + indexBuffer[j - 1]);
+						indices.push_back(baseVertex + indexBuffer[j]);
 					}
 				}
-
-				// Convex Mesh는 일반적으로 인덱스 정보가 없으므로 별도로 처리할 필요 없음
 			}
-			else if (geomHolder.getType() == PxGeometryType::eTRIANGLEMESH) {
-				// Triangle Mesh 처리
+			// Triangle Mesh 처리
+			else if (geomHolder.getType() == PxGeometryType::eTRIANGLEMESH)
+			{
 				const PxTriangleMeshGeometry& triMeshGeom = geomHolder.triangleMesh();
 				const PxTriangleMesh* triMesh = triMeshGeom.triangleMesh;
-				const PxU32 nbVerts = triMesh->getNbVertices();
 				const PxVec3* verts = triMesh->getVertices();
 				const PxU32 nbTris = triMesh->getNbTriangles();
 				const void* tris = triMesh->getTriangles();
 
-				// Triangle 메쉬의 버텍스를 벡터에 추가
-				for (PxU32 i = 0; i < nbVerts; ++i) {
-					vertices.push_back(verts[i].x);
-					vertices.push_back(verts[i].y);
-					vertices.push_back(verts[i].z);
-				}
+				for (PxU32 i = 0; i < triMesh->getNbVertices(); ++i)
+					pushVertex(pose.transform(triMeshGeom.scale.transform(verts[i])));
 
-				// Triangle 메쉬의 인덱스를 벡터에 추가 (16-bit 또는 32-bit 인덱스일 수 있음)
-				if (triMesh->getTriangleMeshFlags() & PxTriangleMeshFlag::e16_BIT_INDICES) {
+				// 16-bit 또는 32-bit 인덱스일 수 있음
+				if (triMesh->getTriangleMeshFlags() & PxTriangleMeshFlag::e16_BIT_INDICES)
+				{
 					const PxU16* indices16 = static_cast<const PxU16*>(tris);
-					for (PxU32 i = 0; i < nbTris * 3; ++i) {
-						indices.push_back(indices16[i]);
-					}
+					for (PxU32 i = 0; i < nbTris * 3; ++i)
+						indices.push_back(baseVertex + indices16[i]);
 				}
-				else {
+				else
+				{
 					const PxU32* indices32 = static_cast<const PxU32*>(tris);
-					for (PxU32 i = 0; i < nbTris * 3; ++i) {
-						indices.push_back(indices32[i]);
-					}
+					for (PxU32 i = 0; i < nbTris * 3; ++i)
+						indices.push_back(baseVertex + static_cast<int>(indices32[i]));
 				}
 			}
-		}
-	}
+		});
 }
 
 void core::PhysicsScene::SetLinearVelocity(entt::entity entity, const Vector3& velocity)
@@ -561,7 +627,8 @@ void core::PhysicsScene::sceneFetch()
 	using namespace physx;
 
 	auto registry = _scene->GetRegistry();
-	auto dispatcher = _scene->GetDispatcher();
+	// 바디마다 쌓았다가 함수 끝에서 한 번에 전달
+	auto events = _scene->GetEventBus();
 
 	// 동적 액터 업데이트
 	for (auto&& [entity, actor] : _entityToDynamic)
@@ -592,7 +659,7 @@ void core::PhysicsScene::sceneFetch()
 			world.rotation = Convert<Quaternion>(pxTransform.q);
 		}
 
-		dispatcher->trigger<OnUpdateTransform>({ entity, registry });
+		events->Push<OnUpdateTransform>(entity, registry);
 	}
 
 	// 컨트롤러 업데이트
@@ -610,8 +677,12 @@ void core::PhysicsScene::sceneFetch()
 		auto pxPosition = pxController->getPosition();
 
 		world.position = Convert<Vector3>(pxPosition);
-		dispatcher->trigger<OnUpdateTransform>({ entity, registry });
+		events->Push<OnUpdateTransform>(entity, registry);
 	}
+
+	// PhysicsSystem 은 Update 단계에서 TransformSystem 보다 먼저 실행되므로 단계 끝까지 미루면
+	// TransformSystem 이 이전 LocalTransform 으로 world 를 덮어쓰고, 그 값이 다시 액터로 들어가 바디가 움직이지 않음
+	events->Flush<OnUpdateTransform>();
 }
 
 physx::PxShape* core::PhysicsScene::createShape(Entity entity, physx::PxMaterial* material)
@@ -933,56 +1004,8 @@ physx::PxShape* core::PhysicsScene::createConvexMesh(const MeshRenderer& meshDat
 {
 	using namespace physx;
 
-	auto& physics = _resources.physics;
-
-	// 물리 엔진에서 사용할 메쉬 데이터를 저장할 버퍼를 준비합니다.
-	std::vector<PxVec3> vertices;
-
-	// 메쉬 데이터를 가져옵니다.
-	auto& mesh = meshData.mesh;
-
-	// 메쉬의 정점 데이터를 변환하여 PhysX 포맷으로 저장합니다.
-	for (const auto& vertex : mesh->vertices)
-		vertices.emplace_back(vertex.x, vertex.y, vertex.z);
-
-	// PhysX 메쉬 디스크립터를 생성합니다.
-	PxConvexMeshDesc convexDesc;
-	convexDesc.points.count = static_cast<PxU32>(vertices.size());
-	convexDesc.points.stride = sizeof(PxVec3);
-	convexDesc.points.data = vertices.data();
-	convexDesc.flags = PxConvexFlag::eCOMPUTE_CONVEX | PxConvexFlag::eQUANTIZE_INPUT;
-
-
-	// PhysX 쿡킹 파라미터를 설정합니다.
-	PxCookingParams params(physics->getTolerancesScale());
-	params.midphaseDesc.setToDefault(PxMeshMidPhase::eBVH34);
-
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::CookForFasterSimulation)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_ACTIVE_EDGES_PRECOMPUTE;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::DisableMeshCleaning)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_CLEAN_MESH;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::WeldColocatedVertices)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eWELD_VERTICES;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::UseLegacyMidphase)
-		params.midphaseDesc = PxMeshMidPhase::eBVH33;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::BuildGPUData)
-	{
-		params.buildGPUData = true;
-		convexDesc.vertexLimit = 64;
-	}
-
-
-	// 요리된 데이터를 저장할 스트림
-	PxDefaultMemoryOutputStream buf;
-	PxConvexMeshCookingResult::Enum result;
-
-	// 삼각형 메쉬를 요리합니다.
-	if (!PxCookConvexMesh(params, convexDesc, buf, &result))
-		return nullptr;
-
-	// 메모리에서 요리된 데이터를 읽어들입니다.
-	PxDefaultMemoryInputData input(buf.getData(), buf.getSize());
-	PxConvexMesh* convexMesh = physics->createConvexMesh(input);
+	// 같은 메쉬, 같은 옵션이면 쿡킹 결과를 공유 (스케일은 기하에서 적용)
+	PxConvexMesh* convexMesh = _resources.GetConvexMesh(*meshData.mesh, collider);
 
 	if (!convexMesh)
 		return nullptr;
@@ -995,64 +1018,14 @@ physx::PxShape* core::PhysicsScene::createConvexMesh(const MeshRenderer& meshDat
 	PxConvexMeshGeometry meshGeometry(convexMesh, meshScale);
 
 	// 콜라이더 쉐이프를 생성합니다.
-	return physics->createShape(meshGeometry, *material, true);
+	return _resources.physics->createShape(meshGeometry, *material, true);
 }
 
 physx::PxShape* core::PhysicsScene::createTriangleMesh(const MeshRenderer& meshData, const MeshCollider& collider, const Vector3& worldScale, physx::PxMaterial* material)
 {
 	using namespace physx;
 
-	auto& physics = _resources.physics;
-
-	// 물리 엔진에서 사용할 메쉬 데이터를 저장할 버퍼를 준비합니다.
-	std::vector<PxVec3> vertices;
-	std::vector<PxU32> indices;
-
-	// 메쉬 데이터를 가져옵니다.
-	auto& mesh = meshData.mesh;
-
-	// 메쉬의 정점 데이터를 변환하여 PhysX 포맷으로 저장합니다.
-	vertices.reserve(mesh->vertices.size());
-	for (const auto& vertex : mesh->vertices)
-		vertices.emplace_back(vertex.x, vertex.y, vertex.z);
-
-	// 메쉬의 인덱스 데이터를 변환하여 PhysX 포맷으로 저장합니다.
-	indices.reserve(mesh->indices.size());
-	for (size_t i = 0; i < mesh->indices.size(); i += 3)
-	{
-		indices.emplace_back(mesh->indices[i]);
-		indices.emplace_back(mesh->indices[i + 1]);
-		indices.emplace_back(mesh->indices[i + 2]);
-	}
-
-	PxTriangleMeshDesc meshDesc;
-	meshDesc.points.count = static_cast<PxU32>(vertices.size());
-	meshDesc.points.stride = sizeof(PxVec3);
-	meshDesc.points.data = vertices.data();
-	meshDesc.triangles.count = static_cast<PxU32>(indices.size() / 3);
-	meshDesc.triangles.stride = 3 * sizeof(PxU32);
-	meshDesc.triangles.data = indices.data();
-
-	// PhysX 쿡킹 파라미터를 설정합니다.
-	PxCookingParams params(physics->getTolerancesScale());
-
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::CookForFasterSimulation)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_ACTIVE_EDGES_PRECOMPUTE;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::DisableMeshCleaning)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_CLEAN_MESH;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::WeldColocatedVertices)
-		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eWELD_VERTICES;
-	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::UseLegacyMidphase)
-		params.midphaseDesc = PxMeshMidPhase::eBVH33;
-
-	PxDefaultMemoryOutputStream writeBuffer;
-	PxTriangleMeshCookingResult::Enum result;
-
-	if (!PxCookTriangleMesh(params, meshDesc, writeBuffer, &result))
-		return nullptr;
-
-	PxDefaultMemoryInputData readBuffer(writeBuffer.getData(), writeBuffer.getSize());
-	PxTriangleMesh* triangleMesh = physics->createTriangleMesh(readBuffer);
+	PxTriangleMesh* triangleMesh = _resources.GetTriangleMesh(*meshData.mesh, collider);
 
 	if (!triangleMesh)
 		return nullptr;
@@ -1065,7 +1038,7 @@ physx::PxShape* core::PhysicsScene::createTriangleMesh(const MeshRenderer& meshD
 	PxTriangleMeshGeometry meshGeometry(triangleMesh, meshScale);
 
 	// 콜라이더 쉐이프를 생성합니다.
-	return physics->createShape(meshGeometry, *material, true);
+	return _resources.physics->createShape(meshGeometry, *material, true);
 }
 
 physx::PxController* core::PhysicsScene::createController(physx::PxMaterial* material, const CharacterController& controller, const physx::PxVec3T<double>& worldPos)
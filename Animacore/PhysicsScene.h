@@ -5,6 +5,8 @@
 #include "CoreTagsAndLayers.h"
 #include "CorePhysicsComponents.h"
 
+class Mesh;
+
 namespace physics
 {
 	class ControllerFilters;
@@ -77,10 +79,13 @@ namespace core
 		/// \param[in] layerMask 충돌 검사에 사용할 레이어 마스크
 		/// \param[in] queryTriggerInteraction 트리거 오브젝트와의 상호작용 설정
 		/// \return 충돌 성공 여부
-		bool Raycast(Vector3 origin, Vector3 direction, std::vector<physics::RaycastHit>& hits, uint32_t maxHit, float maxDistance = FLT_MAX, uint32_t layerMask = UINT_MAX & ~layer::IgnoreRaycast::mask, physics::QueryTriggerInteraction queryTriggerInteraction = physics::QueryTriggerInteraction::Collide);
+		/// \n hits 는 std::vector 또는 FrameVector (프레임 임시 결과)
+		template <typename Allocator>
+		bool Raycast(Vector3 origin, Vector3 direction, std::vector<physics::RaycastHit, Allocator>& hits, uint32_t maxHit, float maxDistance = FLT_MAX, uint32_t layerMask = UINT_MAX & ~layer::IgnoreRaycast::mask, physics::QueryTriggerInteraction queryTriggerInteraction = physics::QueryTriggerInteraction::Collide);
 
 		// Raycast 참고
-		bool Raycast(const physics::Ray& ray, std::vector<physics::RaycastHit>& hitInfo, uint32_t maxHit, float maxDistance = FLT_MAX, uint32_t layerMask = UINT_MAX & ~layer::IgnoreRaycast::mask, physics::QueryTriggerInteraction queryTriggerInteraction = physics::QueryTriggerInteraction::Collide);
+		template <typename Allocator>
+		bool Raycast(const physics::Ray& ray, std::vector<physics::RaycastHit, Allocator>& hitInfo, uint32_t maxHit, float maxDistance = FLT_MAX, uint32_t layerMask = UINT_MAX & ~layer::IgnoreRaycast::mask, physics::QueryTriggerInteraction queryTriggerInteraction = physics::QueryTriggerInteraction::Collide);
 
 		/// \brief 중심으로부터 박스 크기의 영역을 지정 방향으로 최대 거리까지 충돌 검사
 		/// \param[in] center 상자의 중심 위치
@@ -118,6 +123,9 @@ namespace core
 		// 물리 씬 초기화
 		void Clear();
 
+		// 메쉬 콜라이더 미리 쿡킹 (스레드 안전, 씬 간 공유)
+		static void CookMesh(const Mesh& mesh, const MeshCollider& collider);
+
 	private:
 		// 씬 패치 (값 할당)
 		void sceneFetch();
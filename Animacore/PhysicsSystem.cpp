@@ -16,7 +16,7 @@ core::PhysicsSystem::PhysicsSystem(Scene& scene)
 
 	_dispatcher->sink<OnCreateEntity>().connect<&PhysicsSystem::createEntity>(this);
 	_dispatcher->sink<OnDestroyEntity>().connect<&PhysicsSystem::destroyEntity>(this);
-
+	_dispatcher->sink<OnUpdateTransforms>().connect<&PhysicsSystem::updateWorlds>(this);
 }
 
 void core::PhysicsSystem::preStartSystem(const OnStartSystem& event)
@@ -86,6 +86,15 @@ void core::PhysicsSystem::updateWorld(entt::registry& registry, entt::entity ent
 	_physicsScene->UpdateTransform(entity, registry.get<WorldTransform>(entity));
 }
 
+void core::PhysicsSystem::updateWorlds(const OnUpdateTransforms& event)
+{
+	if (!_physicsScene)
+		return;
+
+	for (auto entity : event.entities)
+		_physicsScene->UpdateTransform(entity, event.registry->get<WorldTransform>(entity));
+}
+
 void core::PhysicsSystem::updateRigidbody(entt::registry& registry, entt::entity entity)
 {
 	_physicsScene->UpdateRigidbody(entity, registry.get<Rigidbody>(entity), true);
@@ -24,6 +24,7 @@ namespace core
 
 		void updateLocal(entt::registry& registry, entt::entity entity);
 		void updateWorld(entt::registry& registry, entt::entity entity);
+		void updateWorlds(const OnUpdateTransforms& event);
 		void updateRigidbody(entt::registry& registry, entt::entity entity);
 		void updateColliderCommon(entt::registry& registry, entt::entity entity);
 
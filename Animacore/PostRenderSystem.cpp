@@ -3,7 +3,9 @@
 
 #include "Scene.h"
 #include "RenderComponents.h"
+#include "AssetResolver.h"
 #include "CoreComponents.h"
+#include "FrameAllocator.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -87,6 +89,23 @@ namespace
 		int gEnableTextureBlending;
 	};
 
+	core::FramePacket::Text toPacketText(const core::Text& text)
+	{
+		core::FramePacket::Text packetText;
+		packetText.font = text.font.get();
+		packetText.text = text.text;
+		packetText.position = text.position;
+		packetText.size = text.size;
+		packetText.scale = text.scale;
+		packetText.color = text.color;
+		packetText.fontSize = text.fontSize;
+		packetText.leftPadding = text.leftPadding;
+		packetText.textAlign = static_cast<int>(text.textAlign);
+		packetText.textBoxAlign = static_cast<int>(text.textBoxAlign);
+		packetText.useUnderline = text.useUnderline;
+		packetText.useStrikeThrough = text.useStrikeThrough;
+		return packetText;
+	}
 }
 
 core::PostRenderSystem::PostRenderSystem(Scene& scene)
@@ -108,150 +127,419 @@ core::PostRenderSystem::~PostRenderSystem()
 
 void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float tick)
 {
-	float widthRatio = _width / _defaultWidth;
-	float heightRatio = _height / _defaultHeight;
+	auto& renderRes = scene.GetRegistry()->ctx().get<core::RenderResources>();
+
+	//   : PreRenderSystem   ī޶ Ŷ ä ٷ 
+	_packet.Clear();
+	_packet.tick = tick;
+	_packet.isPlaying = scene.IsPlaying();
+	_packet.camera.view = renderRes.viewMatrix;
+	_packet.camera.proj = renderRes.projectionMatrix;
+	_packet.camera.viewProj = renderRes.viewProjectionMatrix;
+	_packet.camera.hasMainCamera = renderRes.mainCamera != nullptr;
+	if (renderRes.cameraTransform)
+	{
+		_packet.camera.world = renderRes.cameraTransform->matrix;
+		_packet.camera.position = renderRes.cameraTransform->position;
+	}
 
+	Extract(scene, renderer, _packet);
+	Submit(_packet, renderer);
+}
+
+void core::PostRenderSystem::Extract(Scene& scene, Renderer& renderer, FramePacket& packet)
+{
 	auto& registry = *scene.GetRegistry();
-	auto& renderRes = scene.GetRegistry()->ctx().get<core::RenderResources>();
-	const Matrix& view = renderRes.viewMatrix;
-	const Matrix& proj = renderRes.projectionMatrix;
-	const Matrix& viewProj = renderRes.viewProjectionMatrix;
-	auto cameraTransform = renderRes.cameraTransform;
-	auto mainCamera = renderRes.mainCamera;
 
-	Vector3 camPos = Vector3::Zero;
-	Matrix camMatrix = Matrix::Identity;
+	_oitPass.extractTransparents(scene, renderer, packet);
 
-	if (cameraTransform)
+	_deferredShadePass.Extract(scene, renderer, packet);
+
+	if (packet.camera.hasMainCamera)
 	{
-		camPos = cameraTransform->position;
-		camMatrix = cameraTransform->matrix;
+		std::filesystem::path path = "./Resources/Materials/DefaultSky.material";
+		if (auto skyMaterial = renderer.GetMaterial(path.string()); skyMaterial && skyMaterial->GetShader())
+		{
+			if (auto skyMesh = renderer.GetMesh("Sphere"))
+			{
+				packet.skyMaterial = skyMaterial.get();
+				packet.skyMesh = skyMesh.get();
+			}
+		}
 	}
 
+	_particleSystemPass.extractParticles(scene, renderer, packet);
 
+	for (auto&& [entity, transform, meshRenderer, renderAttributes] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
+	{
+		if (!meshRenderer.isOn)
+			continue;
+
+		if (!(renderAttributes.flags & core::RenderAttributes::Flag::IsWater))
+			continue;
 
+		if (!AssetResolver::ResolveMesh(renderer, meshRenderer))
+			continue;
 
-	auto& deferredTextures = renderRes.deferredTextures;
+		if (!AssetResolver::ResolveMaterials(renderer, meshRenderer))
+			continue;
 
-	auto _renderTarget = renderRes.renderTarget;
+		FramePacket::MeshInstance instance;
+		instance.mesh = meshRenderer.mesh.get();
+		instance.world = transform.matrix;
+		instance.worldInvTranspose = transform.matrix.Invert().Transpose();
+		instance.canReceivingDecal = meshRenderer.canReceivingDecal;
+		instance.firstDraw = static_cast<uint32_t>(packet.draws.size());
 
-	DirectX::BoundingFrustum frustum;
-	DirectX::BoundingFrustum::CreateFromMatrix(frustum, proj);
-	frustum.Transform(frustum, view.Invert());
+		for (uint32_t i = 0; i < (uint32_t)meshRenderer.materials.size(); ++i)
+		{
+			auto& material = meshRenderer.materials[i];
+			if (material == nullptr)
+			{
+				continue;
+			}
+			if (i >= meshRenderer.mesh->subMeshCount)
+			{
+				OutputDebugStringA(std::to_string(uint32_t(entity)).c_str());
+				OutputDebugStringA("Submesh index out of range\n");
+				continue;
+			}
 
-	_oitPass.oitPass(scene, renderer, view, proj, viewProj, camPos);
+			FramePacket::SubMeshDraw draw;
+			draw.material = material.get();
+			draw.subMeshIndex = i;
+			packet.draws.push_back(draw);
+		}
+
+		instance.drawCount = static_cast<uint32_t>(packet.draws.size()) - instance.firstDraw;
+		packet.waterMeshes.push_back(instance);
+	}
 
-	_deferredShadePass.Run(scene, renderer, tick, renderRes);
+	extractOutline(scene, packet);
 
-	if (renderRes.mainCamera)
+	for (auto&& [entity, volume] : registry.view<core::PostProcessingVolume>().each())
 	{
-		Texture* textures[] = { _renderTarget.get() };
-		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
-		std::filesystem::path path = "./Resources/Materials/DefaultSky.material";
-		if (auto skyMaterial = renderer.GetMaterial(path.string()))
+		FramePacket::PostProcessVolume& packetVolume = packet.postProcessVolumes.emplace_back();
+		packetVolume.bloomTint = volume.bloomTint;
+		packetVolume.bloomIntensity = volume.bloomIntensity;
+		packetVolume.bloomThreshold = volume.bloomThreshold;
+		packetVolume.bloomScatter = volume.bloomScatter;
+		packetVolume.bloomCurve = static_cast<int>(volume.bloomCurve);
+		packetVolume.useBloom = volume.useBloom;
+		packetVolume.useBloomScatter = volume.useBloomScatter;
+
+		packetVolume.fogColor = volume.fogColor;
+		packetVolume.fogDensity = volume.fogDensity;
+		packetVolume.fogStart = volume.fogStart;
+		packetVolume.fogRange = volume.fogRange;
+		packetVolume.useFog = volume.useFog;
+
+		packetVolume.exposure = volume.exposure;
+		packetVolume.contrast = volume.contrast;
+		packetVolume.saturation = volume.saturation;
+		packetVolume.useExposure = volume.useExposure;
+	}
+
+	extractUI(scene, renderer, packet);
+}
+
+void core::PostRenderSystem::extractUI(Scene& scene, Renderer& renderer, FramePacket& packet)
+{
+	float widthRatio = _width / _defaultWidth;
+	float heightRatio = _height / _defaultHeight;
+
+	auto& registry = *scene.GetRegistry();
+
+	for (auto&& [entity, world, text] : registry.view<core::WorldTransform, core::Text>().each())
+	{
+		if (!text.isOn)
+			continue;
+
+		if (text.font == nullptr || _textTexture == nullptr)
 		{
-			if (auto skyShader = skyMaterial->GetShader())
-			{
-				if (auto skyMesh = renderer.GetMesh("Sphere"))
-				{
-					renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::CULL_FRONT, DepthStencilState::DEPTH_ENABLED_LESS_EQUAL);
-					skyShader->MapConstantBuffer(renderer.GetContext());
-					skyShader->SetMatrix("gWorld", Matrix::CreateScale(2000));
-					skyShader->SetMatrix("gTexTransform", Matrix::Identity);
-					skyShader->SetFloat3("gEyePosW", camPos);
-					skyShader->SetMatrix("gViewProj", viewProj);
-					skyShader->UnmapConstantBuffer(renderer.GetContext());
-
-					renderer.Submit(*skyMesh, *skyMaterial, 0, PrimitiveTopology::TRIANGLELIST, 1);
-				}
-			}
+			float rtClearColor[4] = { 0.0f,0.0f,0.0f,1.0f };
+
+			text.font = renderer.GetFont(text.fontString);
+			_textTexture = renderer.CreateEmptyTexture("TxtTexture", Texture::Type::Texture2D, _width, _height, 1, Texture::Format::R8G8B8A8_UNORM, Texture::Usage::RTV, rtClearColor);
+			continue;
 		}
+
+		FramePacket::Text& worldText = packet.worldTexts.emplace_back(toPacketText(text));
+		worldText.world = Matrix::CreateScale(world.scale) * world.matrix;
 	}
 
-	_oitPass.oitCompositePass(scene, renderer, view, proj, viewProj, _renderResources->quadMesh, _renderTarget);
+	for (auto&& [entity, world, common, ui] : registry.view<core::WorldTransform, core::UICommon, core::UI3D>().each())
+	{
+		AssetResolver::ResolveUITexture(renderer, common);
+
+		if (common.texture == nullptr)
+			continue;
 
-	/// ⿡ particle pass ߰
-	_particleSystemPass.initParticles(scene, renderer, tick);
-	_particleSystemPass.renderParticles(scene, renderer, tick, view, proj, _renderResources->renderTarget, _renderResources->depthTexture);
+		if (common.isOn == false)
+			continue;
+
+		FramePacket::UIQuad& quad = packet.worldUIs.emplace_back();
+		quad.texture = common.texture;
+		quad.world = world.matrix;
+		quad.color = common.color;
+		quad.maskProgress = common.percentage;
+		quad.maskMode = static_cast<int>(common.maskingOption);
+	}
 
 	{
-		for (auto&& [entity, world, text] : registry.view<core::WorldTransform, core::Text>().each())
+		// ̾ ̰ ū ͺ
+		core::FrameVector<entt::entity> bgs;
+		core::FrameMap<uint32_t, core::FrameVector<entt::entity>, std::greater<uint32_t>> uis;
+
+		for (auto&& [entity, common, ui] : registry.view<core::UICommon, core::UI2D>().each())
 		{
-			if (!text.isOn)
+			if (common.isOn == false)
 				continue;
 
-			float rtClearColor[4] = { 0.0f,0.0f,0.0f,1.0f };
+			// ̸ ٲų ٽ ε ؽó ̹  ǳʶ (̸ ؽô ٲ )
+			if (AssetResolver::ResolveUITexture(renderer, common) || common.texture == nullptr)
+				continue;
 
-			if (text.font == nullptr || _textTexture == nullptr)
+			if (core::Button* button = registry.try_get<core::Button>(entity))
 			{
-				text.font = renderer.GetFont(text.fontString);
-				std::string entityStr = std::to_string(static_cast<uint32_t>(entity));
-				_textTexture = renderer.CreateEmptyTexture("TxtTexture", Texture::Type::Texture2D, _width, _height, 1, Texture::Format::R8G8B8A8_UNORM, Texture::Usage::RTV, rtClearColor);
-				continue;
+				if (core::CheckBox* checkBox = registry.try_get<core::CheckBox>(entity))
+				{
+					if (checkBox->isChecked)
+					{
+						common.textureString = checkBox->checkedTextureString;
+						AssetResolver::ResolveUITexture(renderer, common);
+					}
+					else
+					{
+						common.textureString = checkBox->uncheckedTextureString;
+						AssetResolver::ResolveUITexture(renderer, common);
+					}
+				}
+				else
+				{
+					if (button->defaultTextureString.empty())
+						button->defaultTextureString = common.textureString;
+
+					if (button->isHovered && !button->isPressed)
+					{
+						common.color.w = 1.0f;
+						if (common.texture != button->highlightTexture)
+						{
+							if (!button->highlightTextureString.empty())
+							{
+								common.textureString = button->highlightTextureString;
+
+								if (button->highlightTexture == nullptr)
+									AssetResolver::ResolveUITexture(renderer, common);
+							}
+
+							if (button->highlightTexture)
+								common.texture = button->highlightTexture;
+						}
+					}
+					if (button->isPressed)
+					{
+						common.color.w = 1.0f;
+						if (common.texture != button->selectedTexture)
+						{
+							if (!button->selectedTextureString.empty())
+							{
+								common.textureString = button->selectedTextureString;
+
+								if (button->selectedTexture == nullptr)
+									AssetResolver::ResolveUITexture(renderer, common);
+							}
+
+							if (button->selectedTexture)
+								common.texture = button->selectedTexture;
+						}
+					}
+					if (!button->isHovered && !button->isPressed)
+					{
+						common.textureString = button->defaultTextureString;
+
+						if (core::Text* text = registry.try_get<core::Text>(entity))
+						{
+							core::ComboBox* comboBox = registry.try_get<core::ComboBox>(entity);
+
+							if (!comboBox)
+								common.color.w = 0.0f;
+						}
+					}
+				}
 			}
 
-			renderer.ClearTexture(_textTexture.get(), rtClearColor);
-			renderer.SubmitText(_textTexture.get(), text.font.get(), text.text, text.position, text.size, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign), text.useUnderline, text.useStrikeThrough);
+			if (ui.isCanvas)
+				bgs.emplace_back(entity);
+			else
+			{
+				uis[ui.layerDepth].emplace_back(entity);
+			}
+		}
 
-			Texture* textures[] = { _renderTarget.get() };
-			renderer.SetRenderTargets(1, textures, renderRes.depthTexture.get(), false);
-			renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+		for (auto& entity : bgs)
+		{
+			core::UICommon& common = registry.get<core::UICommon>(entity);
+			core::UI2D& ui = registry.get<core::UI2D>(entity);
+
+			Matrix uiNDC = Matrix::Identity;
+
+			uiNDC *= Matrix::CreateRotationZ(ui.rotation * DirectX::XM_PI / 180.0f);
+			uiNDC *= Matrix::CreateScale(ui.size.x / _width * widthRatio, ui.size.y / _height * heightRatio, 1.0f);
+			uiNDC *= Matrix::CreateTranslation(ui.position.x * 2 / _width * heightRatio, ui.position.y * 2 / _height * heightRatio, 0);
+
+			FramePacket::UIQuad& quad = packet.canvasUIs.emplace_back();
+			quad.texture = common.texture;
+			quad.world = uiNDC;
+			quad.layerDepth = ui.layerDepth / 100.0f;
+			quad.color = common.color;
+			quad.maskProgress = common.percentage;
+			quad.maskMode = static_cast<int>(common.maskingOption);
+		}
 
-			auto&& uiShader = _uiMaterial->GetShader();
+		for (auto& vec : uis | std::views::values)
+		{
+			for (auto& entity : vec)
+			{
+				core::UICommon& common = registry.get<core::UICommon>(entity);
+				core::UI2D& ui = registry.get<core::UI2D>(entity);
 
-			Matrix worldMatrix = world.matrix;
+				Matrix uiNDC = Matrix::Identity;
 
-			worldMatrix = Matrix::CreateScale(world.scale) * worldMatrix;
-			_uiMaterial->SetTexture("gDiffuseMap", _textTexture);
-			uiShader->MapConstantBuffer(renderer.GetContext());
-			uiShader->SetMatrix("gWorld", worldMatrix);
-			uiShader->SetMatrix("gViewProj", view * proj);
-			uiShader->SetFloat("layerDepth", 0.0f);
-			uiShader->SetFloat4("gColor", { 1.0f,1.0f,1.0f,1.0f });
-			uiShader->SetInt("isOn", text.isOn);
-			uiShader->SetInt("is3D", true);
-			uiShader->SetFloat("maskProgress", 1);
-			uiShader->SetInt("maskMode", 0);
-			uiShader->UnmapConstantBuffer(renderer.GetContext());
+				uiNDC *= Matrix::CreateRotationZ(ui.rotation * DirectX::XM_PI / 180.0f);
+				uiNDC *= Matrix::CreateScale(ui.size.x / _width * widthRatio, ui.size.y / _height * heightRatio, 1.0f);
+				uiNDC *= Matrix::CreateTranslation(ui.position.x * 2 / _width * widthRatio, ui.position.y * 2 / _height * heightRatio, 0);
 
-			renderer.Submit(*renderRes.quadMesh, *_uiMaterial);
+				FramePacket::UIQuad& quad = packet.screenUIs.emplace_back();
+				quad.texture = common.texture;
+				quad.world = uiNDC;
+				quad.layerDepth = ui.layerDepth / 100.0f;
+				quad.color = common.color;
+				quad.maskProgress = common.percentage;
+				quad.maskMode = static_cast<int>(common.maskingOption);
+			}
 		}
 	}
 
+	auto& config = registry.ctx().get<core::Configuration>();
+
+	for (auto&& [entity, text] : registry.view<core::Text>(entt::exclude_t<core::WorldTransform, core::ComboBox>()).each())
 	{
-		Texture* textures[] = { _renderTarget.get() };
-		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
-		renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+		if (text.isOn == false)
+			continue;
 
-		auto&& uiShader = _uiMaterial->GetShader();
+		if (text.font == nullptr)
+		{
+			text.font = renderer.GetFont(text.fontString);
+			continue;
+		}
 
-		for (auto&& [entity, world, common, ui] : registry.view<core::WorldTransform, core::UICommon, core::UI3D>().each())
+		Vector2 textPos = { text.position.x * widthRatio,text.position.y * heightRatio };
+		textPos.x += config.width / 2.0f;
+		textPos.y += config.height / 2.0f;
+		textPos.x += text.leftPadding;
+
+		FramePacket::Text& screenText = packet.screenTexts.emplace_back(toPacketText(text));
+		screenText.position = textPos;
+	}
+
+	for (auto&& [entity, text, comboBox] : registry.view<core::Text, core::ComboBox>(entt::exclude_t<core::WorldTransform>()).each())
+	{
+		if (text.isOn == false)
+			continue;
+
+		if (text.font == nullptr)
 		{
-			if (common.texture == nullptr)
-			{
-				common.texture = renderer.GetUITexture(common.textureString);
-				continue;
-			}
+			text.font = renderer.GetFont(text.fontString);
+			continue;
+		}
 
-			if (common.isOn == false)
-				continue;
+		Vector2 textPos = { text.position.x * widthRatio,text.position.y * heightRatio };
+		textPos.x += config.width / 2.0f;
+		textPos.y += config.height / 2.0f;
+		textPos.x += text.leftPadding;
+
+		FramePacket::ComboBox& packetComboBox = packet.comboBoxes.emplace_back();
+		packetComboBox.text = toPacketText(text);
+		packetComboBox.text.position = textPos;
+		packetComboBox.text.size = { text.size.x * widthRatio, text.size.y * heightRatio };
+		packetComboBox.curIndex = comboBox.curIndex;
+		packetComboBox.isOpen = comboBox.isOn;
+
+		for (const auto& comboBoxText : comboBox.comboBoxTexts)
+			packetComboBox.items.push_back(comboBoxText.text);
+	}
+}
+
+void core::PostRenderSystem::Submit(const FramePacket& packet, Renderer& renderer)
+{
+	const auto& camera = packet.camera;
+	const Matrix& view = camera.view;
+	const Matrix& proj = camera.proj;
+	const Matrix& viewProj = camera.viewProj;
+
+	Vector3 camPos = camera.position;
+	Matrix camMatrix = camera.world;
+
+	auto& renderRes = *_renderResources;
+
+	auto _renderTarget = renderRes.renderTarget;
+
+	_oitPass.oitPass(packet, renderer, renderRes);
+
+	_deferredShadePass.Run(packet, renderer, renderRes);
 
-			_uiMaterial->SetTexture("gDiffuseMap", common.texture);
-			uiShader->MapConstantBuffer(renderer.GetContext());
-			uiShader->SetMatrix("gWorld", world.matrix);
-			uiShader->SetMatrix("gViewProj", view * proj);
-			uiShader->SetFloat("layerDepth", 0.0f);
-			uiShader->SetFloat4("gColor", common.color);
-			uiShader->SetInt("isOn", common.isOn);
-			uiShader->SetInt("is3D", true);
-			uiShader->SetFloat("maskProgress", common.percentage);
-			uiShader->SetInt("maskMode", static_cast<int>(common.maskingOption));
-			uiShader->UnmapConstantBuffer(renderer.GetContext());
-
-			renderer.Submit(*_renderResources->quadMesh, *_uiMaterial);
+	if (camera.hasMainCamera)
+	{
+		Texture* textures[] = { _renderTarget.get() };
+		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
+		if (packet.skyMaterial && packet.skyMesh)
+		{
+			auto skyShader = packet.skyMaterial->GetShader();
+
+			renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::CULL_FRONT, DepthStencilState::DEPTH_ENABLED_LESS_EQUAL);
+			skyShader->MapConstantBuffer(renderer.GetContext());
+			skyShader->SetMatrix("gWorld", Matrix::CreateScale(2000));
+			skyShader->SetMatrix("gTexTransform", Matrix::Identity);
+			skyShader->SetFloat3("gEyePosW", camPos);
+			skyShader->SetMatrix("gViewProj", viewProj);
+			skyShader->UnmapConstantBuffer(renderer.GetContext());
+
+			renderer.Submit(*packet.skyMesh, *packet.skyMaterial, 0, PrimitiveTopology::TRIANGLELIST, 1);
 		}
 	}
 
+	_oitPass.oitCompositePass(packet, renderer, _renderResources->quadMesh, _renderTarget);
+
+	/// ⿡ particle pass ߰
+	_particleSystemPass.renderParticles(packet, renderer, _renderResources->renderTarget, _renderResources->depthTexture);
+
+	for (const auto& text : packet.worldTexts)
+	{
+		float rtClearColor[4] = { 0.0f,0.0f,0.0f,1.0f };
+
+		renderer.ClearTexture(_textTexture.get(), rtClearColor);
+		renderer.SubmitText(_textTexture.get(), text.font, text.text, text.position, text.size, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign), text.useUnderline, text.useStrikeThrough);
+
+		Texture* textures[] = { _renderTarget.get() };
+		renderer.SetRenderTargets(1, textures, renderRes.depthTexture.get(), false);
+		renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+		FramePacket::UIQuad quad;
+		quad.texture = _textTexture;
+		quad.world = text.world;
+		submitUIQuad(renderer, quad, view * proj, true);
+	}
+
+	{
+		Texture* textures[] = { _renderTarget.get() };
+		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
+		renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+		for (const auto& quad : packet.worldUIs)
+			submitUIQuad(renderer, quad, view * proj, true);
+	}
+
 
 	{
 		{
@@ -273,7 +561,7 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 		}
 
 		static float elapsedTime = 0.0f;
-		elapsedTime += tick;
+		elapsedTime += packet.tick;
 		cbWaterMatrix cbWater;
 		cbWater.gDrawMode = 1.0f;
 		cbWater.gFresnelMode = 0;
@@ -297,54 +585,21 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 		renderer.SetRenderTargets(1, textures, renderRes.depthTexture.get(), false);
 		renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
 
-		for (auto&& [entity, transform, meshRenderer, renderAttributes] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
+		for (const auto& instance : packet.waterMeshes)
 		{
-			if (!meshRenderer.isOn)
-				continue;
-
-			if (!(renderAttributes.flags & core::RenderAttributes::Flag::IsWater))
-				continue;
-
-			if (meshRenderer.mesh == nullptr)
+			for (uint32_t d = instance.firstDraw; d < instance.firstDraw + instance.drawCount; ++d)
 			{
-				meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
-				continue;
-			}
-
-			if (meshRenderer.materials.size() <= 0)
-			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-				}
-				continue;
-			}
-
-			auto& world = transform.matrix;
-			auto worldInvTranspose = world.Invert().Transpose();
-
-			for (uint32_t i = 0; i < (uint32_t)meshRenderer.materials.size(); ++i)
-			{
-				auto material = meshRenderer.materials[i];
-				if (material == nullptr)
-				{
-					continue;
-				}
-				if (i >= meshRenderer.mesh->subMeshCount)
-				{
-					OutputDebugStringA(std::to_string(uint32_t(entity)).c_str());
-					OutputDebugStringA("Submesh index out of range\n");
-					continue;
-				}
+				const auto& draw = packet.draws[d];
+				auto material = draw.material;
 
 				perObject.gProj = proj;
 				perObject.gView = view;
 				perObject.gViewProj = viewProj;
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
+				perObject.gWorld = instance.world;
+				perObject.gWorldInvTranspose = instance.worldInvTranspose;
 				perObject.gTexTransform = Matrix::Identity;
 
-				float waterHeight = transform.position.y;
+				float waterHeight = instance.world.Translation().y;
 				float reflectionCamYCoord = -cameraPosition.y + 2 * waterHeight;
 				Vector3 reflectionCamPosition = Vector3(cameraPosition.x, reflectionCamYCoord, cameraPosition.z);
 
@@ -364,26 +619,22 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 				material->m_Shader->SetConstant("cbPerObject", &perObject, sizeof(PerObject));
 				material->m_Shader->SetConstant("cbWaterMatrix", &cbWater, sizeof(cbWaterMatrix));
 				material->m_Shader->SetFloat3("gEyePosW", cameraPosition);
-				material->m_Shader->SetInt("gRecieveDecal", meshRenderer.canReceivingDecal);
+				material->m_Shader->SetInt("gRecieveDecal", instance.canReceivingDecal);
 				material->m_Shader->SetInt("gReflect", false);
 				material->m_Shader->SetInt("gRefract", false);
 
 				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
-
-
-
-
+				renderer.Submit(*instance.mesh, *material, draw.subMeshIndex, PrimitiveTopology::TRIANGLELIST, 1);
 			}
 		}
 	}
 
 	/// ⿡ ƿ н
-	outlinePass(scene, renderer, tick, view, proj, frustum);
+	outlinePass(packet, renderer);
 
 	/// ⿡ bloom ߰
-	_bloomPass.Run(scene, renderer, tick, renderRes);
+	_bloomPass.Run(packet, renderer, renderRes);
 
 	/// post proccesing
 	{
@@ -394,8 +645,11 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 
 		auto&& postProcessingShader = _postProcessingMaterial->GetShader();
 
-		for (auto&& [entity, volume] : registry.view<core::PostProcessingVolume>().each())
+		//    ù 
+		if (!packet.postProcessVolumes.empty())
 		{
+			const auto& volume = packet.postProcessVolumes.front();
+
 			BloomParams bloomParams = {};
 			FogParams fogParams = {};
 			ExposureParams exposureParams = {};
@@ -404,7 +658,7 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 			bloomParams.threshold = volume.bloomThreshold;
 			bloomParams.intensity = volume.bloomIntensity;
 			bloomParams.useBloom = volume.useBloom;
-			bloomParams.bloomCurveType = static_cast<int>(volume.bloomCurve);
+			bloomParams.bloomCurveType = volume.bloomCurve;
 
 			fogParams.fogColor = volume.fogColor;
 			fogParams.fogDensity = volume.fogDensity;
@@ -433,8 +687,6 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 			postProcessingShader->UnmapConstantBuffer(renderer.GetContext());
 
 			renderer.Submit(*_renderResources->quadMesh, *_postProcessingMaterial);
-
-			break;
 		}
 
 		Texture* textures[] = { _renderTarget.get() };
@@ -476,218 +728,29 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 	}
 
 	{
-		auto comp = [](const uint32_t& lhs, const uint32_t& rhs) {
-			return lhs > rhs;
-			};
-
-		std::vector<entt::entity> bgs;
-		std::map<uint32_t, std::vector<entt::entity>, std::function<bool(uint32_t, uint32_t)>> uis(comp);
-
 		Texture* textures[] = { _renderTarget.get() };
 		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
 		renderer.ClearTexture(_renderResources->depthTexture.get(), _renderResources->depthTexture->GetClearValue());
-		auto&& uiShader = _uiMaterial->GetShader();
-
-		for (auto&& [entity, common, ui] : registry.view<core::UICommon, core::UI2D>().each())
-		{
-			if (common.isOn == false)
-				continue;
-
-			auto& texture = common.texture;
-
-			if (common.texture == nullptr || texture != renderer.GetUITexture(common.textureString))
-			{
-				common.texture = renderer.GetUITexture(common.textureString);
-				continue;
-			}
-
-			if (core::Button* button = registry.try_get<core::Button>(entity))
-			{
-				if (core::CheckBox* checkBox = registry.try_get<core::CheckBox>(entity))
-				{
-					if (checkBox->isChecked)
-					{
-						common.textureString = checkBox->checkedTextureString;
-						common.texture = renderer.GetUITexture(checkBox->checkedTextureString);
-					}
-					else
-					{
-						common.textureString = checkBox->uncheckedTextureString;
-						common.texture = renderer.GetUITexture(checkBox->uncheckedTextureString);
-					}
-				}
-				else
-				{
-					if (button->defaultTextureString.empty())
-						button->defaultTextureString = common.textureString;
-
-					if (button->isHovered && !button->isPressed)
-					{
-						common.color.w = 1.0f;
-						if (common.texture != button->highlightTexture)
-						{
-							if (!button->highlightTextureString.empty())
-							{
-								common.textureString = button->highlightTextureString;
-
-								if (button->highlightTexture == nullptr)
-									common.texture = renderer.GetUITexture(button->highlightTextureString);
-							}
-
-							if (button->highlightTexture)
-								common.texture = button->highlightTexture;
-						}
-					}
-					if (button->isPressed)
-					{
-						common.color.w = 1.0f;
-						if (common.texture != button->selectedTexture)
-						{
-							if (!button->selectedTextureString.empty())
-							{
-								common.textureString = button->selectedTextureString;
-
-								if (button->selectedTexture == nullptr)
-									common.texture = renderer.GetUITexture(button->selectedTextureString);
-							}
-
-							if (button->selectedTexture)
-								common.texture = button->selectedTexture;
-						}
-					}
-					if (!button->isHovered && !button->isPressed)
-					{
-						common.textureString = button->defaultTextureString;
-
-						if (core::Text* text = registry.try_get<core::Text>(entity))
-						{
-							core::ComboBox* comboBox = registry.try_get<core::ComboBox>(entity);
-
-							if (!comboBox)
-								common.color.w = 0.0f;
-						}
-					}
-				}
-			}
-
-			if (ui.isCanvas)
-				bgs.emplace_back(entity);
-			else
-			{
-				auto findIt = uis.find(ui.layerDepth);
-				if (findIt != uis.end())
-					findIt->second.emplace_back(entity);
-				else
-				{
-					std::vector<entt::entity> curUIs;
-					curUIs.emplace_back(entity);
-					uis[ui.layerDepth] = curUIs;
-				}
-			}
-		}
 
 		renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
-		for (auto& entity : bgs)
-		{
-			core::UICommon& common = registry.get<core::UICommon>(entity);
-			core::UI2D& ui = registry.get<core::UI2D>(entity);
-
-			_uiMaterial->SetTexture("gDiffuseMap", common.texture);
-			uiShader->MapConstantBuffer(renderer.GetContext());
-
-			Matrix uiNDC = Matrix::Identity;
-
-			uiNDC *= Matrix::CreateRotationZ(ui.rotation * DirectX::XM_PI / 180.0f);
-			uiNDC *= Matrix::CreateScale(ui.size.x / _width * widthRatio, ui.size.y / _height * heightRatio, 1.0f);
-			uiNDC *= Matrix::CreateTranslation(ui.position.x * 2 / _width * heightRatio, ui.position.y * 2 / _height * heightRatio, 0);
-
-			uiShader->SetMatrix("gWorld", uiNDC);
-			uiShader->SetMatrix("gViewProj", Matrix::Identity);
-
-			uiShader->SetFloat("layerDepth", ui.layerDepth / 100.0f);
-			uiShader->SetFloat4("gColor", common.color);
-			uiShader->SetInt("isOn", common.isOn);
-			uiShader->SetInt("is3D", false);
-			uiShader->SetFloat("maskProgress", common.percentage);
-			uiShader->SetInt("maskMode", static_cast<int>(common.maskingOption));
-			uiShader->UnmapConstantBuffer(renderer.GetContext());
-
-			renderer.Submit(*_renderResources->quadMesh, *_uiMaterial);
-		}
+		for (const auto& quad : packet.canvasUIs)
+			submitUIQuad(renderer, quad, Matrix::Identity, false);
 
 		renderer.ApplyRenderState(BlendState::ALPHA_BLEND, RasterizerState::CULL_BACK, DepthStencilState::NO_DEPTH_WRITE);
-		for (auto& vec : uis | std::views::values)
-		{
-			for (auto& entity : vec)
-			{
-				core::UICommon& common = registry.get<core::UICommon>(entity);
-				core::UI2D& ui = registry.get<core::UI2D>(entity);
-
-				_uiMaterial->SetTexture("gDiffuseMap", common.texture);
-				uiShader->MapConstantBuffer(renderer.GetContext());
-
-				Matrix uiNDC = Matrix::Identity;
-
-				uiNDC *= Matrix::CreateRotationZ(ui.rotation * DirectX::XM_PI / 180.0f);
-				uiNDC *= Matrix::CreateScale(ui.size.x / _width * widthRatio, ui.size.y / _height * heightRatio, 1.0f);
-				uiNDC *= Matrix::CreateTranslation(ui.position.x * 2 / _width * widthRatio, ui.position.y * 2 / _height * heightRatio, 0);
-
-				uiShader->SetMatrix("gWorld", uiNDC);
-				uiShader->SetMatrix("gViewProj", Matrix::Identity);
-
-				uiShader->SetFloat("layerDepth", ui.layerDepth / 100.0f);
-				uiShader->SetFloat4("gColor", common.color);
-				uiShader->SetInt("isOn", common.isOn);
-				uiShader->SetInt("is3D", false);
-				uiShader->SetFloat("maskProgress", common.percentage);
-				uiShader->SetInt("maskMode", static_cast<int>(common.maskingOption));
-				uiShader->UnmapConstantBuffer(renderer.GetContext());
-
-				renderer.Submit(*_renderResources->quadMesh, *_uiMaterial);
-			}
-		}
+		for (const auto& quad : packet.screenUIs)
+			submitUIQuad(renderer, quad, Matrix::Identity, false);
 	}
 
-	auto& config = registry.ctx().get<core::Configuration>();
-
-	for (auto&& [entity, text] : registry.view<core::Text>(entt::exclude_t<core::WorldTransform, core::ComboBox>()).each())
+	for (const auto& text : packet.screenTexts)
 	{
-		if (text.isOn == false)
-			continue;
-
-		if (text.font == nullptr)
-		{
-			text.font = renderer.GetFont(text.fontString);
-			continue;
-		}
-
-		Vector2 textPos = { text.position.x * widthRatio,text.position.y * heightRatio };
-		textPos.x += config.width / 2.0f;
-		textPos.y += config.height / 2.0f;
-		textPos.x += text.leftPadding;
-
-		renderer.SubmitText(_renderTarget.get(), text.font.get(), text.text, textPos, text.size, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign), text.useUnderline, text.useStrikeThrough);
+		renderer.SubmitText(_renderTarget.get(), text.font, text.text, text.position, text.size, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign), text.useUnderline, text.useStrikeThrough);
 	}
 
-	for (auto&& [entity, text, comboBox] : registry.view<core::Text, core::ComboBox>(entt::exclude_t<core::WorldTransform>()).each())
+	for (const auto& comboBox : packet.comboBoxes)
 	{
-		if (text.isOn == false)
-			continue;
+		const auto& text = comboBox.text;
 
-		if (text.font == nullptr)
-		{
-			text.font = renderer.GetFont(text.fontString);
-			continue;
-		}
-
-		Vector2 textPos = { text.position.x * widthRatio,text.position.y * heightRatio };
-		textPos.x += config.width / 2.0f;
-		textPos.y += config.height / 2.0f;
-		textPos.x += text.leftPadding;
-
-		Vector2 tempSize = { text.size.x * widthRatio, text.size.y * heightRatio };
-
-		renderer.SubmitComboBox(_renderTarget.get(), text.font.get(), reinterpret_cast<std::vector<std::string>&>(comboBox.comboBoxTexts), comboBox.curIndex, comboBox.isOn, textPos, text.leftPadding, tempSize, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign));
+		renderer.SubmitComboBox(_renderTarget.get(), text.font, comboBox.items, comboBox.curIndex, comboBox.isOpen, text.position, text.leftPadding, text.size, text.scale, text.color, text.fontSize, static_cast<TextAlign>(text.textAlign), static_cast<TextBoxAlign>(text.textBoxAlign));
 	}
 
 	{
@@ -711,6 +774,25 @@ void core::PostRenderSystem::PostRender(Scene& scene, Renderer& renderer, float
 	}
 }
 
+void core::PostRenderSystem::submitUIQuad(Renderer& renderer, const FramePacket::UIQuad& quad, const Matrix& viewProj, bool is3D)
+{
+	auto&& uiShader = _uiMaterial->GetShader();
+
+	_uiMaterial->SetTexture("gDiffuseMap", quad.texture);
+	uiShader->MapConstantBuffer(renderer.GetContext());
+	uiShader->SetMatrix("gWorld", quad.world);
+	uiShader->SetMatrix("gViewProj", viewProj);
+	uiShader->SetFloat("layerDepth", quad.layerDepth);
+	uiShader->SetFloat4("gColor", quad.color);
+	uiShader->SetInt("isOn", true);
+	uiShader->SetInt("is3D", is3D);
+	uiShader->SetFloat("maskProgress", quad.maskProgress);
+	uiShader->SetInt("maskMode", quad.maskMode);
+	uiShader->UnmapConstantBuffer(renderer.GetContext());
+
+	renderer.Submit(*_renderResources->quadMesh, *_uiMaterial);
+}
+
 void core::PostRenderSystem::startSystem(const OnStartSystem& event)
 {
 	auto&& renderResources = event.scene->GetRegistry()->ctx().get<core::RenderResources>();
@@ -753,6 +835,9 @@ void core::PostRenderSystem::finishSystem(const OnFinishSystem& event)
 
 	_particleSystemPass.finishParticlePass(*event.scene);
 
+	// Ŷ  ִ ƼŬ , ؽó 
+	_packet.Clear();
+
 	event.scene->GetRegistry()->ctx().erase<core::RenderResources>();
 }
 
@@ -784,63 +869,77 @@ void core::PostRenderSystem::finishOutline()
 	_outlineComputeMaterial.reset();
 }
 
-void core::PostRenderSystem::outlinePass(Scene& scene, Renderer& renderer, float tick, const Matrix& view, const Matrix& proj, const DirectX::BoundingFrustum& frustum)
+void core::PostRenderSystem::extractOutline(Scene& scene, FramePacket& packet)
 {
-	if(!scene.IsPlaying())
+	if (!packet.isPlaying)
 		return;
 
 	auto& registry = *scene.GetRegistry();
 
-	std::vector<entt::entity> selectedEntities;
+	DirectX::BoundingFrustum frustum;
+	DirectX::BoundingFrustum::CreateFromMatrix(frustum, packet.camera.proj);
+	frustum.Transform(frustum, packet.camera.view.Invert());
 
+	for (auto&& [entity, transform, meshRenderer, renderAttribute] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
 	{
-		Texture* textures[] = { _pickingTexture.get() };
-		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
-		float R32ClearColor[] = { -1, -1, -1, -1 };
-		renderer.Clear(R32ClearColor);
-		renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+		if (meshRenderer.mesh == nullptr)
+		{
+			continue;
+		}
+
+		// render Attribute´. try get
+		if (!(renderAttribute.flags & core::RenderAttributes::Flag::OutLine))
+			continue;
 
-		for (auto&& [entity, transform, meshRenderer, renderAttribute] : registry.view<core::WorldTransform, core::MeshRenderer, core::RenderAttributes>().each())
+		DirectX::BoundingBox boundingBox = meshRenderer.mesh->boundingBox;
+		boundingBox.Transform(boundingBox, transform.matrix);
+		if (frustum.Intersects(boundingBox) == DirectX::DISJOINT)
+			continue;
+
+		if (meshRenderer.materials.size() <= 0)
 		{
-			if (meshRenderer.mesh == nullptr)
-			{
-				continue;
-			}
+			continue;
+		}
 
-			DirectX::BoundingBox boundingBox = meshRenderer.mesh->boundingBox;
-			boundingBox.Transform(boundingBox, transform.matrix);
-			if (frustum.Intersects(boundingBox) == DirectX::DISJOINT)
-				continue;
+		FramePacket::OutlineMesh& outline = packet.outlineMeshes.emplace_back();
+		outline.mesh = meshRenderer.mesh.get();
+		outline.world = transform.matrix;
+		outline.entity = static_cast<int>(entity);
+		outline.subMeshCount = std::min<uint32_t>(static_cast<uint32_t>(meshRenderer.materials.size()), meshRenderer.mesh->subMeshCount);
+	}
+}
 
-			if (meshRenderer.materials.size() <= 0)
-			{
-				continue;
-			}
+void core::PostRenderSystem::outlinePass(const FramePacket& packet, Renderer& renderer)
+{
+	if (!packet.isPlaying)
+		return;
 
-			auto& world = transform.matrix;
+	std::vector<entt::entity> selectedEntities;
 
-			auto worldInvTranspose = world.Invert().Transpose();
-			Matrix viewProj = view * proj;
+	{
+		Texture* textures[] = { _pickingTexture.get() };
+		renderer.SetRenderTargets(1, textures, _renderResources->depthTexture.get(), false);
+		float R32ClearColor[] = { -1, -1, -1, -1 };
+		renderer.Clear(R32ClearColor);
+		renderer.ApplyRenderState(BlendState::NO_BLEND, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
 
-			// render Attribute´. try get
-			if (!(renderAttribute.flags & core::RenderAttributes::Flag::OutLine))
-				continue;
+		Matrix viewProj = packet.camera.view * packet.camera.proj;
 
-			for (uint32_t i = 0; i < (uint32_t)meshRenderer.materials.size(); ++i)
+		for (const auto& outline : packet.outlineMeshes)
+		{
+			for (uint32_t i = 0; i < outline.subMeshCount; ++i)
 			{
 				auto material = _pickingMaterial;
-				if (i >= meshRenderer.mesh->subMeshCount)
-					continue;
 
 				material->m_Shader->MapConstantBuffer(renderer.GetContext());
-				material->m_Shader->SetMatrix("gWorld", world);
+				material->m_Shader->SetMatrix("gWorld", outline.world);
 				material->m_Shader->SetMatrix("gViewProj", viewProj);
 
-				material->m_Shader->SetInt("pickingColor", static_cast<int>(entity));
-				selectedEntities.push_back(entity);
+				material->m_Shader->SetInt("pickingColor", outline.entity);
+				selectedEntities.push_back(static_cast<entt::entity>(outline.entity));
 
 				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
+				renderer.Submit(*outline.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
 			}
 		}
 	}
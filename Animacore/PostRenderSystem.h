@@ -2,6 +2,7 @@
 #include "SystemInterface.h"
 #include "SystemTraits.h"
 #include "CoreSystemEvents.h"
+#include "FramePacket.h"
 
 #include "ParticleSystemPass.h"
 #include "OITPass.h"
@@ -16,7 +17,7 @@ class Texture;
 namespace core
 {
 	struct RenderResources;
-	class PostRenderSystem : public ISystem, public IPostRenderSystem
+	class PostRenderSystem : public ISystem, public IPostRenderSystem, public IFramePacketSystem
 	{
 	public:
 
@@ -25,7 +26,13 @@ namespace core
 
 		void PostRender(Scene& scene, Renderer& renderer, float tick) override;
 
+		void Extract(Scene& scene, Renderer& renderer, FramePacket& packet) override;
+		void Submit(const FramePacket& packet, Renderer& renderer) override;
+
 	private:
+		void extractUI(Scene& scene, Renderer& renderer, FramePacket& packet);
+		void extractOutline(Scene& scene, FramePacket& packet);
+
 		void startSystem(const OnStartSystem& event);
 		void finishSystem(const OnFinishSystem& event);
 
@@ -34,7 +41,9 @@ namespace core
 
 		void initOutline(Scene& scene, Renderer& renderer);
 		void finishOutline();
-		void outlinePass(Scene& scene, Renderer& renderer, float tick, const Matrix& view, const Matrix& proj, const DirectX::BoundingFrustum& frustum);
+		void outlinePass(const FramePacket& packet, Renderer& renderer);
+
+		void submitUIQuad(Renderer& renderer, const FramePacket::UIQuad& quad, const Matrix& viewProj, bool is3D);
 
 	private:
 		entt::dispatcher* _dispatcher = nullptr;
@@ -70,6 +79,9 @@ namespace core
 		DeferredShadePass _deferredShadePass;
 		BloomPass _bloomPass;
 
+		//   ϴ Ŷ
+		FramePacket _packet;
+
 		static constexpr float _defaultWidth = 1920.0f;
 		static constexpr float _defaultHeight = 1080.0f;
 	};
@@ -61,6 +61,22 @@ core::PreRenderSystem::~PreRenderSystem()
 }
 
 void core::PreRenderSystem::PreRender(Scene& scene, Renderer& renderer, float tick)
+{
+	updateMainCamera(scene);
+	bindGeometryTargets(renderer);
+}
+
+void core::PreRenderSystem::Extract(Scene& scene, Renderer& renderer, FramePacket& packet)
+{
+	packet.camera = updateMainCamera(scene);
+}
+
+void core::PreRenderSystem::Submit(const FramePacket& packet, Renderer& renderer)
+{
+	bindGeometryTargets(renderer);
+}
+
+core::FramePacket::Camera core::PreRenderSystem::updateMainCamera(Scene& scene)
 {
 	// Camera 
 	auto& registry = *scene.GetRegistry();
@@ -116,7 +132,19 @@ void core::PreRenderSystem::PreRender(Scene& scene, Renderer& renderer, float ti
 	renderRes.cameraTransform = _mainCameraTransform;
 	renderRes.mainCamera = _mainCamera;
 
+	FramePacket::Camera camera{ view, proj, viewProj };
+	camera.hasMainCamera = _mainCamera != nullptr;
+	if (_mainCameraTransform)
+	{
+		camera.world = _mainCameraTransform->matrix;
+		camera.position = _mainCameraTransform->position;
+	}
 
+	return camera;
+}
+
+void core::PreRenderSystem::bindGeometryTargets(Renderer& renderer)
+{
 	auto deferredTextures = _renderResources->deferredTextures;
 
 	Texture* textures[] = {
@@ -1,6 +1,7 @@
 #pragma once
 #include "SystemTraits.h"
 #include "SystemInterface.h"
+#include "FramePacket.h"
 
 class Material;
 class Mesh;
@@ -12,7 +13,7 @@ namespace core
 	struct WorldTransform;
 	struct RenderResources;
 
-	class PreRenderSystem : public ISystem, public IPreRenderSystem
+	class PreRenderSystem : public ISystem, public IPreRenderSystem, public IFramePacketSystem
 	{
 	public:
 		PreRenderSystem(Scene& scene);
@@ -20,7 +21,13 @@ namespace core
 
 		void PreRender(Scene& scene, Renderer& renderer, float tick) override;
 
+		void Extract(Scene& scene, Renderer& renderer, FramePacket& packet) override;
+		void Submit(const FramePacket& packet, Renderer& renderer) override;
+
 	private:
+		FramePacket::Camera updateMainCamera(Scene& scene);
+		void bindGeometryTargets(Renderer& renderer);
+
 		void preStartSystem(const OnPreStartSystem& event);
 		void startSystem(const OnStartSystem& event);
 		void finishSystem(const OnFinishSystem& event);
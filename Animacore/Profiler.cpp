@@ -0,0 +1,219 @@
+﻿#include "pch.h"
+#include "Profiler.h"
+
+#include <chrono>
+#include <fstream>
+
+namespace
+{
+	std::string escapeJson(std::string_view text)
+	{
+		std::string result;
+		result.reserve(text.size());
+
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				result.push_back('\\');
+
+			result.push_back(c);
+		}
+
+		return result;
+	}
+}
+
+core::Profiler& core::Profiler::Get()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+void core::Profiler::SetThreadName(std::string_view name)
+{
+	ThreadBuffer& buffer = threadBuffer();
+
+	std::lock_guard lock(_mutex);
+	buffer.name = name;
+}
+
+const char* core::Profiler::Intern(std::string_view name)
+{
+	std::lock_guard lock(_mutex);
+	return _names.emplace(name).first->c_str();
+}
+
+void core::Profiler::NextFrame()
+{
+	const int64_t now = Now();
+
+	std::lock_guard lock(_mutex);
+
+	if (_frameBegin != 0)
+	{
+		_lastFrameBegin = _frameBegin;
+		_lastFrameEnd = now;
+	}
+
+	_frameBegin = now;
+}
+
+std::pair<int64_t, int64_t> core::Profiler::GetLastFrame() const
+{
+	std::lock_guard lock(_mutex);
+	return { _lastFrameBegin, _lastFrameEnd };
+}
+
+std::vector<core::ProfileThread> core::Profiler::Collect(int64_t from) const
+{
+	std::lock_guard lock(_mutex);
+
+	std::vector<ProfileThread> threads;
+	threads.reserve(_threads.size());
+
+	for (const auto& buffer : _threads)
+	{
+		ProfileThread& thread = threads.emplace_back();
+		thread.id = buffer->id;
+		thread.name = buffer->name;
+
+		// 구간은 끝난 순서로 기록되므로 뒤에서부터 from 이전이 나올 때까지만 복사
+		const uint64_t count = buffer->count.load(std::memory_order_acquire);
+		const uint64_t first = count > RING_CAPACITY ? count - RING_CAPACITY : 0;
+
+		uint64_t index = count;
+		while (index > first)
+		{
+			const ProfileZone& zone = buffer->zones[(index - 1) % RING_CAPACITY];
+			if (zone.end < from)
+				break;
+
+			thread.zones.push_back(zone);
+			--index;
+		}
+
+		// 복사하는 동안 소유 스레드가 덮어쓴 오래된 구간은 버림
+		const uint64_t after = buffer->count.load(std::memory_order_acquire);
+		if (after > RING_CAPACITY)
+		{
+			const uint64_t validFirst = after - RING_CAPACITY;
+			while (!thread.zones.empty() && index < validFirst)
+			{
+				thread.zones.pop_back();
+				++index;
+			}
+		}
+
+		std::ranges::reverse(thread.zones);
+	}
+
+	return threads;
+}
+
+bool core::Profiler::ExportChromeTrace(const std::filesystem::path& path) const
+{
+	std::ofstream file(path);
+
+	if (!file.is_open())
+		return false;
+
+	const auto threads = Collect();
+
+	int64_t origin = INT64_MAX;
+	for (const auto& thread : threads)
+	{
+		for (const auto& zone : thread.zones)
+			origin = (std::min)(origin, zone.begin);
+	}
+
+	file << "{\"traceEvents\":[\n";
+
+	bool isFirst = true;
+	auto separator = [&isFirst]() -> const char*
+		{
+			const char* result = isFirst ? "" : ",\n";
+			isFirst = false;
+			return result;
+		};
+
+	for (const auto& thread : threads)
+	{
+		file << separator() << std::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+			thread.id, escapeJson(thread.name));
+
+		for (const auto& zone : thread.zones)
+		{
+			file << separator() << std::format(R"({{"name":"{}","cat":"cpu","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+				escapeJson(zone.name), thread.id,
+				static_cast<double>(zone.begin - origin) / 1000.0,
+				static_cast<double>(zone.end - zone.begin) / 1000.0);
+		}
+	}
+
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	return file.good();
+}
+
+int64_t core::Profiler::Now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t core::Profiler::BeginZone()
+{
+	return threadBuffer().depth++;
+}
+
+void core::Profiler::EndZone(const char* name, int64_t begin, uint32_t depth)
+{
+	const int64_t end = Now();
+
+	ThreadBuffer& buffer = threadBuffer();
+	buffer.depth = depth;
+
+	const uint64_t index = buffer.count.load(std::memory_order_relaxed);
+	buffer.zones[index % RING_CAPACITY] = { name, begin, end, depth };
+	buffer.count.store(index + 1, std::memory_order_release);
+}
+
+core::Profiler::ThreadBuffer& core::Profiler::threadBuffer()
+{
+	// 스레드가 끝나면 버퍼를 반납해 이후 생성되는 스레드(씬 로더 등)가 재사용
+	struct Slot
+	{
+		ThreadBuffer* buffer = nullptr;
+
+		~Slot()
+		{
+			if (buffer)
+				buffer->isFree.store(true, std::memory_order_release);
+		}
+	};
+	thread_local Slot slot;
+
+	if (slot.buffer)
+		return *slot.buffer;
+
+	std::lock_guard lock(_mutex);
+
+	for (auto& buffer : _threads)
+	{
+		if (buffer->isFree.load(std::memory_order_acquire))
+		{
+			slot.buffer = buffer.get();
+			break;
+		}
+	}
+
+	if (!slot.buffer)
+		slot.buffer = _threads.emplace_back(std::make_unique<ThreadBuffer>()).get();
+
+	slot.buffer->id = _nextThreadId++;
+	slot.buffer->name = std::format("Thread {}", slot.buffer->id);
+	slot.buffer->depth = 0;
+	slot.buffer->count.store(0, std::memory_order_relaxed);
+	slot.buffer->isFree.store(false, std::memory_order_relaxed);
+
+	return *slot.buffer;
+}
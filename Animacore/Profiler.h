@@ -0,0 +1,139 @@
+﻿#pragma once
+
+#include <atomic>
+
+// CORE_DISABLE_PROFILER 를 정의하면 PROFILE_* 매크로가 비어 측정 코드가 남지 않음
+#if !defined(CORE_DISABLE_PROFILER)
+#define CORE_PROFILER_ENABLED 1
+#else
+#define CORE_PROFILER_ENABLED 0
+#endif
+
+namespace core
+{
+	struct ProfileZone
+	{
+		const char* name = nullptr;		// 프로그램 수명 동안 유지되는 문자열 (리터럴 또는 Profiler::Intern)
+		int64_t begin = 0;				// ns (Profiler::Now 기준)
+		int64_t end = 0;
+		uint32_t depth = 0;				// 같은 스레드 안에서의 중첩 깊이
+	};
+
+	struct ProfileThread
+	{
+		uint32_t id = 0;
+		std::string name;
+		std::vector<ProfileZone> zones;	// 끝난 순서 (자식이 부모보다 먼저)
+	};
+
+	/// \brief
+	/// \n 계층형 CPU 프로파일러
+	///	\n 스레드마다 고정 크기 링 버퍼를 가지며, 기록은 소유 스레드만 하므로 잠금 없이 진행됨
+	///	\n 읽는 쪽(패널, 내보내기)은 기록 개수를 먼저 읽고 복사한 뒤 다시 읽어 덮어써진 구간을 버림
+	class Profiler
+	{
+	public:
+		static constexpr size_t RING_CAPACITY = 1 << 14;	// 스레드별로 남겨두는 최근 구간 수
+
+		static Profiler& Get();
+
+		// 계측 여부 (꺼져 있으면 구간이 기록되지 않음)
+		void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+		bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+		// 현재 스레드 이름 (타임라인, Chrome trace 표시용)
+		void SetThreadName(std::string_view name);
+
+		// 동적 문자열을 프로파일러 수명 동안 유지되는 포인터로 변환 (매 프레임 호출하지 말 것)
+		const char* Intern(std::string_view name);
+
+		// 프레임 경계 (메인 루프에서 프레임마다 한 번)
+		void NextFrame();
+
+		// 마지막으로 끝난 프레임 구간 [begin, end)
+		std::pair<int64_t, int64_t> GetLastFrame() const;
+
+		// 각 스레드 버퍼에 남아 있는 구간 중 from 이후에 끝난 것
+		std::vector<ProfileThread> Collect(int64_t from = 0) const;
+
+		// chrome://tracing, Perfetto 에서 열 수 있는 JSON 으로 저장
+		bool ExportChromeTrace(const std::filesystem::path& path) const;
+
+		static int64_t Now();
+
+		// ProfileScope 전용
+		uint32_t BeginZone();
+		void EndZone(const char* name, int64_t begin, uint32_t depth);
+
+	private:
+		struct ThreadBuffer
+		{
+			uint32_t id = 0;
+			std::string name;						// _mutex 로 보호
+			uint32_t depth = 0;						// 소유 스레드만 접근
+			std::atomic<uint64_t> count = 0;		// 지금까지 기록한 구간 수 (링 인덱스 = count % RING_CAPACITY)
+			std::atomic<bool> isFree = false;		// 스레드가 끝나 다른 스레드가 재사용 가능
+			std::array<ProfileZone, RING_CAPACITY> zones;
+		};
+
+		Profiler() = default;
+
+		ThreadBuffer& threadBuffer();
+
+		std::atomic<bool> _enabled = true;
+
+		mutable std::mutex _mutex;		// 스레드 등록, 이름, Intern, 프레임 경계
+		std::vector<std::unique_ptr<ThreadBuffer>> _threads;
+		std::unordered_set<std::string> _names;		// 노드 기반이라 c_str 가 유지됨
+		uint32_t _nextThreadId = 1;
+
+		int64_t _frameBegin = 0;
+		int64_t _lastFrameBegin = 0;
+		int64_t _lastFrameEnd = 0;
+	};
+
+	/// \brief 생성부터 소멸까지를 한 구간으로 기록
+	class ProfileScope
+	{
+	public:
+		explicit ProfileScope(const char* name)
+		{
+			Profiler& profiler = Profiler::Get();
+
+			if (name && profiler.IsEnabled())
+			{
+				_name = name;
+				_depth = profiler.BeginZone();
+				_begin = Profiler::Now();
+			}
+		}
+
+		~ProfileScope()
+		{
+			if (_name)
+				Profiler::Get().EndZone(_name, _begin, _depth);
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* _name = nullptr;
+		int64_t _begin = 0;
+		uint32_t _depth = 0;
+	};
+}
+
+#if CORE_PROFILER_ENABLED
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) core::ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+#define PROFILE_FRAME() core::Profiler::Get().NextFrame()
+#define PROFILE_THREAD(name) core::Profiler::Get().SetThreadName(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_FRAME() ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
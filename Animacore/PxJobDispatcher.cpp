@@ -0,0 +1,19 @@
+﻿#include "pch.h"
+#include "PxJobDispatcher.h"
+
+#include "JobSystem.h"
+
+void core::PxJobDispatcher::submitTask(physx::PxBaseTask& task)
+{
+	// 태스크는 실행 후 release 로 후속 태스크를 제출함
+	GetJobSystem().Run([&task]
+		{
+			task.run();
+			task.release();
+		});
+}
+
+uint32_t core::PxJobDispatcher::getWorkerCount() const
+{
+	return GetJobSystem().GetWorkerCount();
+}
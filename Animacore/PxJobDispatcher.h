@@ -0,0 +1,14 @@
+﻿#pragma once
+
+namespace core
+{
+	/// \brief
+	/// \n PhysX 태스크를 엔진 공용 JobSystem 에서 실행하는 디스패처
+	///	\n 엔진과 물리가 각자 스레드 풀을 만들어 코어를 초과 점유하지 않도록 함
+	class PxJobDispatcher : public physx::PxCpuDispatcher
+	{
+	public:
+		void submitTask(physx::PxBaseTask& task) override;
+		uint32_t getWorkerCount() const override;
+	};
+}
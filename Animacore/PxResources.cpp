@@ -3,12 +3,16 @@
 
 #include "Scene.h"
 #include "PxUtils.h"
+#include "Profiler.h"
 #include "CollisionCallback.h"
 
 #include <fstream>
 
 #include "PhysicsScene.h"
 
+#include <../Animavision/Mesh.h>
+#include <../Animavision/MeshQuantizer.h>
+
 physx::PxScene* core::PxResources::SceneInitialize(Scene* scene)
 {
 	using namespace physx;
@@ -34,9 +38,8 @@ physx::PxScene* core::PxResources::SceneInitialize(Scene* scene)
 
 	// PxScene 생성
 	PxSceneDesc sceneDesc(physics->getTolerancesScale());
-	PxDefaultCpuDispatcher* pxDispatcher = PxDefaultCpuDispatcherCreate(4);
 	sceneDesc.gravity = PxVec3(0.0f, -9.81f * 2.f, 0.0f);
-	sceneDesc.cpuDispatcher = pxDispatcher;
+	sceneDesc.cpuDispatcher = &cpuDispatcher;
 	sceneDesc.filterShader = core::CustomFilterShader;
 
 	auto pxScene = physics->createScene(sceneDesc);
@@ -60,6 +63,8 @@ int core::PxResources::SceneFinalize()
 	--_sceneCounter;
 	 
 	if (_sceneCounter == 0) {
+		releaseCookedMeshes();
+
 		if (physics) {
 			physics->release();
 			physics = nullptr;
@@ -139,3 +144,175 @@ physx::PxMaterial* core::PxResources::LoadMaterial(const std::filesystem::path&
 
 	return material;
 }
+
+physx::PxConvexMesh* core::PxResources::GetConvexMesh(const Mesh& mesh, const MeshCollider& collider)
+{
+	CookedMeshKey key{ mesh.name, static_cast<uint32_t>(collider.cookingOptions), true };
+
+	{
+		std::lock_guard lock(_cookedMeshMutex);
+		if (auto it = _cookedMeshes.find(key); it != _cookedMeshes.end())
+			return static_cast<physx::PxConvexMesh*>(it->second);
+	}
+
+	// 쿡킹은 락 밖에서 진행, 같은 메쉬를 동시에 쿡킹했다면 먼저 등록된 쪽을 사용
+	physx::PxConvexMesh* convexMesh = cookConvexMesh(mesh, collider);
+
+	if (!convexMesh)
+		return nullptr;
+
+	std::lock_guard lock(_cookedMeshMutex);
+	auto [it, inserted] = _cookedMeshes.try_emplace(key, convexMesh);
+	if (!inserted)
+		convexMesh->release();
+
+	return static_cast<physx::PxConvexMesh*>(it->second);
+}
+
+physx::PxTriangleMesh* core::PxResources::GetTriangleMesh(const Mesh& mesh, const MeshCollider& collider)
+{
+	CookedMeshKey key{ mesh.name, static_cast<uint32_t>(collider.cookingOptions), false };
+
+	{
+		std::lock_guard lock(_cookedMeshMutex);
+		if (auto it = _cookedMeshes.find(key); it != _cookedMeshes.end())
+			return static_cast<physx::PxTriangleMesh*>(it->second);
+	}
+
+	physx::PxTriangleMesh* triangleMesh = cookTriangleMesh(mesh, collider);
+
+	if (!triangleMesh)
+		return nullptr;
+
+	std::lock_guard lock(_cookedMeshMutex);
+	auto [it, inserted] = _cookedMeshes.try_emplace(key, triangleMesh);
+	if (!inserted)
+		triangleMesh->release();
+
+	return static_cast<physx::PxTriangleMesh*>(it->second);
+}
+
+physx::PxConvexMesh* core::PxResources::cookConvexMesh(const Mesh& mesh, const MeshCollider& collider)
+{
+	PROFILE_FUNCTION();
+
+	using namespace physx;
+
+	// 물리 엔진에서 사용할 메쉬 데이터를 저장할 버퍼를 준비합니다.
+	std::vector<PxVec3> vertices;
+
+	// 메쉬의 정점 데이터를 변환하여 PhysX 포맷으로 저장합니다. (압축 정점은 복원)
+	std::vector<Vector3> positions;
+	MeshQuantizer::DecodePositions(mesh, positions);
+
+	for (const auto& vertex : positions)
+		vertices.emplace_back(vertex.x, vertex.y, vertex.z);
+
+	// PhysX 메쉬 디스크립터를 생성합니다.
+	PxConvexMeshDesc convexDesc;
+	convexDesc.points.count = static_cast<PxU32>(vertices.size());
+	convexDesc.points.stride = sizeof(PxVec3);
+	convexDesc.points.data = vertices.data();
+	convexDesc.flags = PxConvexFlag::eCOMPUTE_CONVEX | PxConvexFlag::eQUANTIZE_INPUT;
+
+
+	// PhysX 쿡킹 파라미터를 설정합니다.
+	PxCookingParams params(physics->getTolerancesScale());
+	params.midphaseDesc.setToDefault(PxMeshMidPhase::eBVH34);
+
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::CookForFasterSimulation)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_ACTIVE_EDGES_PRECOMPUTE;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::DisableMeshCleaning)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_CLEAN_MESH;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::WeldColocatedVertices)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eWELD_VERTICES;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::UseLegacyMidphase)
+		params.midphaseDesc = PxMeshMidPhase::eBVH33;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::BuildGPUData)
+	{
+		params.buildGPUData = true;
+		convexDesc.vertexLimit = 64;
+	}
+
+
+	// 요리된 데이터를 저장할 스트림
+	PxDefaultMemoryOutputStream buf;
+	PxConvexMeshCookingResult::Enum result;
+
+	// 삼각형 메쉬를 요리합니다.
+	if (!PxCookConvexMesh(params, convexDesc, buf, &result))
+		return nullptr;
+
+	// 메모리에서 요리된 데이터를 읽어들입니다.
+	PxDefaultMemoryInputData input(buf.getData(), buf.getSize());
+	return physics->createConvexMesh(input);
+}
+
+physx::PxTriangleMesh* core::PxResources::cookTriangleMesh(const Mesh& mesh, const MeshCollider& collider)
+{
+	PROFILE_FUNCTION();
+
+	using namespace physx;
+
+	// 물리 엔진에서 사용할 메쉬 데이터를 저장할 버퍼를 준비합니다.
+	std::vector<PxVec3> vertices;
+	std::vector<PxU32> indices;
+
+	// 메쉬의 정점 데이터를 변환하여 PhysX 포맷으로 저장합니다. (압축 정점은 복원)
+	std::vector<Vector3> positions;
+	MeshQuantizer::DecodePositions(mesh, positions);
+
+	vertices.reserve(positions.size());
+	for (const auto& vertex : positions)
+		vertices.emplace_back(vertex.x, vertex.y, vertex.z);
+
+	// 메쉬의 인덱스 데이터를 변환하여 PhysX 포맷으로 저장합니다. (LOD 인덱스는 제외)
+	const size_t indexCount = mesh.GetBaseIndexCount();
+	indices.reserve(indexCount);
+	for (size_t i = 0; i < indexCount; i += 3)
+	{
+		indices.emplace_back(mesh.indices[i]);
+		indices.emplace_back(mesh.indices[i + 1]);
+		indices.emplace_back(mesh.indices[i + 2]);
+	}
+
+	PxTriangleMeshDesc meshDesc;
+	meshDesc.points.count = static_cast<PxU32>(vertices.size());
+	meshDesc.points.stride = sizeof(PxVec3);
+	meshDesc.points.data = vertices.data();
+	meshDesc.triangles.count = static_cast<PxU32>(indices.size() / 3);
+	meshDesc.triangles.stride = 3 * sizeof(PxU32);
+	meshDesc.triangles.data = indices.data();
+
+	// PhysX 쿡킹 파라미터를 설정합니다.
+	PxCookingParams params(physics->getTolerancesScale());
+
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::CookForFasterSimulation)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_ACTIVE_EDGES_PRECOMPUTE;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::DisableMeshCleaning)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eDISABLE_CLEAN_MESH;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::WeldColocatedVertices)
+		params.meshPreprocessParams |= PxMeshPreprocessingFlag::eWELD_VERTICES;
+	if (collider.cookingOptions & MeshCollider::MeshColliderCookingOptions::UseLegacyMidphase)
+		params.midphaseDesc = PxMeshMidPhase::eBVH33;
+
+	PxDefaultMemoryOutputStream writeBuffer;
+	PxTriangleMeshCookingResult::Enum result;
+
+	if (!PxCookTriangleMesh(params, meshDesc, writeBuffer, &result))
+		return nullptr;
+
+	PxDefaultMemoryInputData readBuffer(writeBuffer.getData(), writeBuffer.getSize());
+	return physics->createTriangleMesh(readBuffer);
+}
+
+void core::PxResources::releaseCookedMeshes()
+{
+	std::lock_guard lock(_cookedMeshMutex);
+
+	// 쉐이프가 참조 중인 메쉬는 쉐이프가 해제될 때 함께 해제됨
+	for (auto* mesh : _cookedMeshes | std::views::values)
+		mesh->release();
+
+	_cookedMeshes.clear();
+}
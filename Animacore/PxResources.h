@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include "CorePhysicsComponents.h"
+#include "PxJobDispatcher.h"
+
+class Mesh;
 
 namespace core
 {
@@ -28,18 +31,37 @@ namespace core
         // 물리 머터리얼 로드 (시스템 내부적으로 사용)
         physx::PxMaterial* LoadMaterial(const std::filesystem::path& path);
 
+        // 쿡킹된 메쉬 반환 (메쉬 이름 + 쿡킹 옵션 단위로 공유, 없으면 쿡킹)
+        // 스레드 안전 : 씬 로딩 스레드에서 미리 호출해 두면 액터 생성 시 쿡킹을 건너뜀
+        physx::PxConvexMesh* GetConvexMesh(const Mesh& mesh, const MeshCollider& collider);
+        physx::PxTriangleMesh* GetTriangleMesh(const Mesh& mesh, const MeshCollider& collider);
+
         physx::PxPhysics* physics = nullptr;
         physx::PxPvd* pvd = nullptr;
         physx::PxFoundation* foundation = nullptr;
         physx::PxDefaultAllocator allocator;
         physx::PxDefaultErrorCallback errorCallback;
 
+        // 모든 물리 씬이 공유 (엔진 JobSystem 사용)
+        PxJobDispatcher cpuDispatcher;
+
     private:
+        physx::PxConvexMesh* cookConvexMesh(const Mesh& mesh, const MeshCollider& collider);
+        physx::PxTriangleMesh* cookTriangleMesh(const Mesh& mesh, const MeshCollider& collider);
+
+        // 쿡킹 캐시 정리 (physics 해제 전)
+        void releaseCookedMeshes();
+
         int _sceneCounter = 0;
 
         // 물리 공유 자원
         std::vector<physx::PxShape*> _shapes;
         std::unordered_map<std::string, physx::PxMaterial*> _materials;
+
+        // 쿡킹된 메쉬 (메쉬 이름, 쿡킹 옵션, convex 여부)
+        using CookedMeshKey = std::tuple<std::string, uint32_t, bool>;
+        std::mutex _cookedMeshMutex;
+        std::map<CookedMeshKey, physx::PxBase*> _cookedMeshes;
     };
 }
 
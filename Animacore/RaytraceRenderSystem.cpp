@@ -3,6 +3,7 @@
 
 #include "Scene.h"
 #include "RenderComponents.h"
+#include "AssetResolver.h"
 #include "CoreComponents.h"
 #include "LightStructure.h"
 
@@ -37,20 +38,11 @@ void core::RaytraceRenderSystem::operator()(Scene& scene, Renderer& renderer, fl
 
 	for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
 	{
-		if (meshRenderer.mesh == nullptr)
-		{
-			meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
+		if (!AssetResolver::ResolveMesh(renderer, meshRenderer))
 			continue;
-		}
 
-		if (meshRenderer.materials.size() <= 0)
-		{
-			for (auto&& materialString : meshRenderer.materialStrings)
-			{
-				meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-			}
+		if (!AssetResolver::ResolveMaterials(renderer, meshRenderer))
 			continue;
-		}
 
 		// â : ̰ Ʈ̽ ϸ ؾߵ
 		if (meshRenderer.isSkinned && meshRenderer.animator)
@@ -156,20 +148,11 @@ void core::RaytraceRenderSystem::startSystem(const OnStartSystem& event)
 	//ó ٸ
 	for (auto&& [entity, meshRenderer] : registry.view<core::MeshRenderer>().each())
 	{
-		if (meshRenderer.mesh == nullptr)
-		{
-			meshRenderer.mesh = renderer->GetMesh(meshRenderer.meshString);
+		if (!AssetResolver::ResolveMesh(*renderer, meshRenderer))
 			continue;
-		}
 
-		if (meshRenderer.materials.size() <= 0)
-		{
-			for (auto&& materialString : meshRenderer.materialStrings)
-			{
-				meshRenderer.materials.push_back(renderer->GetMaterial(materialString));
-			}
+		if (!AssetResolver::ResolveMaterials(*renderer, meshRenderer))
 			continue;
-		}
 
 
 		// ̺κ   ° ?
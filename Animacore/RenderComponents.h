@@ -3,6 +3,8 @@
 #include "AnimatorState.h"
 #include "ButtonEvent.h"
 
+#include "../Animavision/AssetHandle.h"
+
 class Mesh;
 class Material;
 class Texture;
@@ -28,7 +30,7 @@ namespace core
 	{
 		std::string meshString;
 		std::shared_ptr<Mesh> mesh;
-		std::list<std::string> materialStrings;
+		std::vector<std::string> materialStrings;
 		std::vector<std::shared_ptr<Material>> materials;
 
 		bool isOn = true;
@@ -43,6 +45,11 @@ namespace core
 		uint32_t hitDistribution = 0;;
 		bool isCustom = false;
 		bool isForward = false;
+		uint32_t lod = 0;		// RenderSystem  ȭ ũ  LOD ܰ (׸ڴ MeshLod::SHADOW_BIAS ŭ ĥ)
+
+		// AssetResolver  ä (̸    )
+		AssetHandle meshHandle;
+		std::vector<AssetHandle> materialHandles;
 
 		// submesh[ bone [] ]
 		std::vector<std::vector<WorldTransform*>> bones;
@@ -155,6 +162,8 @@ namespace core
 
 		std::string materialString;
 		std::shared_ptr<Material> material;
+
+		AssetHandle materialHandle;
 	};
 
 	/*------------------------------
@@ -215,6 +224,7 @@ namespace core
 		Color color = { 1.0f, 1.0f, 1.0f, 1.0f };
 		std::string textureString;
 		std::shared_ptr<Texture> texture;
+		AssetHandle textureHandle;
 
 		// ô, 
 		float percentage = 1.0f;
@@ -5,6 +5,8 @@
 #include "RenderComponents.h"
 #include "CoreComponents.h"
 #include "LightStructure.h"
+#include "MeshLod.h"
+#include "AssetResolver.h"
 
 #include "../Animavision/Renderer.h"
 #include "../Animavision/ShaderResource.h"
@@ -65,7 +67,8 @@ core::RenderSystem::RenderSystem(Scene& scene) :
 void core::RenderSystem::changeMesh(const OnChangeMesh& event)
 {
 	auto& meshRenderer = event.entity.Get<core::MeshRenderer>();
-	meshRenderer.mesh = event.renderer->GetMesh(meshRenderer.meshString);
+	meshRenderer.mesh = nullptr;
+	AssetResolver::ResolveMesh(*event.renderer, meshRenderer);
 }
 
 void core::RenderSystem::destroyRenderResources(const OnDestroyRenderResources& event)
@@ -147,18 +150,8 @@ void core::RenderSystem::preStartSystem(const OnPreStartSystem& event)
 	// ʱ Ҵ
 	for (auto&& [entity, meshRenderer] : registry->view<core::MeshRenderer>().each())
 	{
-		if (meshRenderer.mesh == nullptr)
-		{
-			meshRenderer.mesh = event.renderer->GetMesh(meshRenderer.meshString);
-		}
-
-		if (meshRenderer.materials.size() <= 0)
-		{
-			for (auto&& materialString : meshRenderer.materialStrings)
-			{
-				meshRenderer.materials.push_back(event.renderer->GetMaterial(materialString));
-			}
-		}
+		AssetResolver::ResolveMesh(*event.renderer, meshRenderer);
+		AssetResolver::ResolveMaterials(*event.renderer, meshRenderer);
 	}
 }
 
@@ -179,23 +172,29 @@ void core::RenderSystem::createEntity(const OnCreateEntity& event)
 
 void core::RenderSystem::operator()(Scene& scene, Renderer& renderer, float tick)
 {
-	auto& registry = *scene.GetRegistry();
 	auto& renderRes = scene.GetRegistry()->ctx().get<core::RenderResources>();
-	const Matrix& view = renderRes.viewMatrix;
-	const Matrix& proj = renderRes.projectionMatrix;
-	const Matrix& viewProj = renderRes.viewProjectionMatrix;
-	auto& cameraTransform = *renderRes.cameraTransform;
 
-	DirectX::BoundingFrustum frustum;
-	DirectX::BoundingFrustum::CreateFromMatrix(frustum, proj);
-	frustum.Transform(frustum, view.Invert());
+	//   : PreRenderSystem   ī޶ Ŷ ä ٷ 
+	_packet.Clear();
+	_packet.camera.view = renderRes.viewMatrix;
+	_packet.camera.proj = renderRes.projectionMatrix;
+	_packet.camera.viewProj = renderRes.viewProjectionMatrix;
+	if (renderRes.cameraTransform)
+		_packet.camera.position = renderRes.cameraTransform->position;
 
-	PerObject perObject;
-	cbDissolveFactor dissolveFactor;
+	Extract(scene, renderer, _packet);
+	Submit(_packet, renderer);
+}
 
-	dissolveFactor.gDissolveColor = Vector3(1.0f, 0.0f, 0.0f);
-	dissolveFactor.gDissolveFactor = 0.0f;
-	dissolveFactor.gEdgeWidth = -0.1f;
+void core::RenderSystem::Extract(Scene& scene, Renderer& renderer, FramePacket& packet)
+{
+	auto& registry = *scene.GetRegistry();
+	const auto& camera = packet.camera;
+	const auto& renderRes = registry.ctx().get<core::RenderResources>();
+
+	DirectX::BoundingFrustum frustum;
+	DirectX::BoundingFrustum::CreateFromMatrix(frustum, camera.proj);
+	frustum.Transform(frustum, camera.view.Invert());
 
 	{
 		auto&& attributeView = registry.view<core::RenderAttributes, core::MeshRenderer>();
@@ -208,7 +207,44 @@ void core::RenderSystem::operator()(Scene& scene, Renderer& renderer, float tick
 		}
 	}
 
-	// deferredGeometry Pass
+	// ؽó Ʈ ǵ : ̴ ޽(۵, ), Į ȭ ũ Ƽ ؽó  û
+	{
+		const float screenHeight = static_cast<float>(renderRes.height);
+
+		for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
+		{
+			if (!meshRenderer.isOn || meshRenderer.mesh == nullptr)
+				continue;
+
+			DirectX::BoundingSphere boundingSphere = meshRenderer.mesh->boundingSphere;
+			boundingSphere.Transform(boundingSphere, transform.matrix);
+
+			if (frustum.Intersects(boundingSphere) == DirectX::DISJOINT && !meshRenderer.isSkinned)
+				continue;
+
+			const float screenPixels = MeshLod::ScreenSize(boundingSphere, camera.position, camera.proj) * screenHeight;
+			for (auto& material : meshRenderer.materials)
+			{
+				if (material != nullptr)
+					renderer.RequestTextureResidency(*material, screenPixels);
+			}
+		}
+
+		// Į  ť긦  ķ ø 
+		for (auto&& [entity, transform, decal] : registry.view<core::WorldTransform, core::Decal>().each())
+		{
+			if (decal.material == nullptr)
+				continue;
+
+			const DirectX::BoundingSphere boundingSphere(transform.position, transform.scale.Length() * 0.5f);
+			if (frustum.Intersects(boundingSphere) == DirectX::DISJOINT)
+				continue;
+
+			renderer.RequestTextureResidency(*decal.material, MeshLod::ScreenSize(boundingSphere, camera.position, camera.proj) * screenHeight);
+		}
+	}
+
+	// deferredGeometry Pass : ø  ޽  İ  ȷƮ Ŷ 
 	{
 		auto&& geometryViewIter = registry.view<core::WorldTransform, core::MeshRenderer>().each();
 		for (auto&& [entity, transform, meshRenderer] : geometryViewIter)
@@ -216,39 +252,34 @@ void core::RenderSystem::operator()(Scene& scene, Renderer& renderer, float tick
 			if (!meshRenderer.isOn || meshRenderer.isForward || meshRenderer.isCustom)
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
+			if (!AssetResolver::ResolveMesh(renderer, meshRenderer))
 				continue;
-			}
 
 			DirectX::BoundingSphere boundingSphere = meshRenderer.mesh->boundingSphere;
 			boundingSphere.Transform(boundingSphere, transform.matrix);
 
+			// ׸ н  ܰ踦 Ƿ ø  
+			const float screenSize = MeshLod::ScreenSize(boundingSphere, camera.position, camera.proj);
+			meshRenderer.lod = MeshLod::Select(*meshRenderer.mesh, screenSize, static_cast<float>(renderRes.height), meshRenderer.lod);
+
 			if (frustum.Intersects(boundingSphere) == DirectX::DISJOINT && !meshRenderer.isSkinned)
 				continue;
 
-			if (!meshRenderer.isCulling)
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
-			else
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
-
-			if (meshRenderer.materials.size() <= 0)
-			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-				}
+			if (!AssetResolver::ResolveMaterials(renderer, meshRenderer))
 				continue;
-			}
 
-			auto world = transform.matrix;
-
-			auto worldInvTranspose = world.Invert().Transpose();
+			FramePacket::MeshInstance instance;
+			instance.mesh = meshRenderer.mesh.get();
+			instance.world = transform.matrix;
+			instance.worldInvTranspose = transform.matrix.Invert().Transpose();
+			instance.emissiveFactor = meshRenderer.emissiveFactor;
+			instance.isCulling = meshRenderer.isCulling;
+			instance.canReceivingDecal = meshRenderer.canReceivingDecal;
+			instance.firstDraw = static_cast<uint32_t>(packet.draws.size());
 
 			for (uint32_t i = 0; i < static_cast<uint32_t>(meshRenderer.materials.size()); ++i)
 			{
-				auto material = meshRenderer.materials[i];
+				auto& material = meshRenderer.materials[i];
 				if (material == nullptr)
 				{
 					continue;
@@ -260,48 +291,93 @@ void core::RenderSystem::operator()(Scene& scene, Renderer& renderer, float tick
 					continue;
 				}
 
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
-				perObject.gTexTransform = Matrix::Identity;
-				perObject.gView = view;
-				perObject.gProj = proj;
-				perObject.gViewProj = viewProj;
-
-				material->m_Shader->MapConstantBuffer(renderer.GetContext());
-				material->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
-				material->m_Shader->SetFloat3(G_EYE_POS_W, cameraTransform.position);
-				material->m_Shader->SetInt(G_RECIEVE_DECAL, meshRenderer.canReceivingDecal);
-				material->m_Shader->SetFloat(G_EMISSIVE_FACTOR, meshRenderer.emissiveFactor);
-				material->m_Shader->SetConstant(CB_DISSOLVE_FACTOR, &dissolveFactor, sizeof(cbDissolveFactor));
+				FramePacket::SubMeshDraw draw;
+				draw.material = material.get();
+				draw.subMeshIndex = i;
+				draw.lod = meshRenderer.lod;
+				draw.isSkinned = meshRenderer.isSkinned;
 
 				if (meshRenderer.isSkinned)
 				{
 					SubMeshDescriptor& subMesh = meshRenderer.mesh->subMeshDescriptors[i];
+					draw.paletteOffset = static_cast<uint32_t>(packet.bonePalettes.size());
+
 					if (meshRenderer.animator)
 					{
-						std::vector<Matrix> boneTransforms;
-						boneTransforms.reserve(subMesh.boneIndexMap.size());
+						draw.isAnimated = true;
 
 						for (int j = 0; j < meshRenderer.bones[i].size(); j++)
 						{
 							auto boneMatrix = meshRenderer.boneOffsets[i][j] * (meshRenderer.bones[i][j] ? meshRenderer.bones[i][j]->matrix : Matrix::Identity);
-							boneTransforms.push_back(boneMatrix);
+							packet.bonePalettes.push_back(boneMatrix);
 						}
-						material->m_Shader->SetConstant("BoneMatrixBuffer", boneTransforms.data(), static_cast<uint32_t>(sizeof(Matrix) * boneTransforms.size()));
-						material->m_Shader->SetMatrix("gWorld", Matrix::Identity);
 					}
 					else
 					{
-						std::vector<Matrix> boneTransforms;
-						boneTransforms.resize(subMesh.boneIndexMap.size(), Matrix::Identity);
-						material->m_Shader->SetConstant("BoneMatrixBuffer", boneTransforms.data(), static_cast<uint32_t>(sizeof(Matrix) * boneTransforms.size()));
+						packet.bonePalettes.resize(packet.bonePalettes.size() + subMesh.boneIndexMap.size(), Matrix::Identity);
 					}
+
+					draw.paletteCount = static_cast<uint32_t>(packet.bonePalettes.size()) - draw.paletteOffset;
 				}
 
-				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+				packet.draws.push_back(draw);
+			}
+
+			instance.drawCount = static_cast<uint32_t>(packet.draws.size()) - instance.firstDraw;
+			packet.meshes.push_back(instance);
+		}
+	}
+}
 
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
+void core::RenderSystem::Submit(const FramePacket& packet, Renderer& renderer)
+{
+	const auto& camera = packet.camera;
+
+	PerObject perObject;
+	perObject.gTexTransform = Matrix::Identity;
+	perObject.gView = camera.view;
+	perObject.gProj = camera.proj;
+	perObject.gViewProj = camera.viewProj;
+
+	cbDissolveFactor dissolveFactor;
+
+	dissolveFactor.gDissolveColor = Vector3(1.0f, 0.0f, 0.0f);
+	dissolveFactor.gDissolveFactor = 0.0f;
+	dissolveFactor.gEdgeWidth = -0.1f;
+
+	for (const auto& instance : packet.meshes)
+	{
+		if (!instance.isCulling)
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
+		else
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+		perObject.gWorld = instance.world;
+		perObject.gWorldInvTranspose = instance.worldInvTranspose;
+
+		for (uint32_t d = instance.firstDraw; d < instance.firstDraw + instance.drawCount; ++d)
+		{
+			const auto& draw = packet.draws[d];
+			auto& material = *draw.material;
+
+			material.m_Shader->MapConstantBuffer(renderer.GetContext());
+			material.m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
+			material.m_Shader->SetFloat3(G_EYE_POS_W, camera.position);
+			material.m_Shader->SetInt(G_RECIEVE_DECAL, instance.canReceivingDecal);
+			material.m_Shader->SetFloat(G_EMISSIVE_FACTOR, instance.emissiveFactor);
+			material.m_Shader->SetConstant(CB_DISSOLVE_FACTOR, &dissolveFactor, sizeof(cbDissolveFactor));
+
+			if (draw.isSkinned)
+			{
+				material.m_Shader->SetConstant("BoneMatrixBuffer", packet.bonePalettes.data() + draw.paletteOffset, static_cast<uint32_t>(sizeof(Matrix) * draw.paletteCount));
+
+				if (draw.isAnimated)
+					material.m_Shader->SetMatrix("gWorld", Matrix::Identity);
 			}
+
+			material.m_Shader->UnmapConstantBuffer(renderer.GetContext());
+
+			renderer.Submit(*instance.mesh, material, draw.subMeshIndex, PrimitiveTopology::TRIANGLELIST, 1, draw.lod);
 		}
 	}
 }
@@ -2,6 +2,7 @@
 #include "SystemTraits.h"
 #include "CoreSystemEvents.h"
 #include "SystemInterface.h"
+#include "FramePacket.h"
 
 class Material;
 class Mesh;
@@ -11,7 +12,7 @@ namespace core
 {
 	struct RenderResources;
 
-	class RenderSystem : public ISystem, public IRenderSystem
+	class RenderSystem : public ISystem, public IRenderSystem, public IFramePacketSystem
 
 	{
 	public:
@@ -20,6 +21,9 @@ namespace core
 
 		void operator()(Scene& scene, Renderer& renderer, float tick) override;
 
+		void Extract(Scene& scene, Renderer& renderer, FramePacket& packet) override;
+		void Submit(const FramePacket& packet, Renderer& renderer) override;
+
 	private:
 		void preStartSystem(const OnPreStartSystem& event);
 		void startSystem(const OnStartSystem& event);
@@ -36,6 +40,9 @@ namespace core
 		// ̱ Ʈ ޾ƿ°
 		core::RenderResources* _renderResources = nullptr;
 
+		//   ϴ Ŷ
+		FramePacket _packet;
+
 		const static inline std::string CB_PER_OBJECT = "cbPerObject";
 		const static inline std::string G_EYE_POS_W = "gEyePosW";
 		const static inline std::string G_RECIEVE_DECAL = "gRecieveDecal";
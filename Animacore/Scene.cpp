@@ -3,6 +3,13 @@
 
 #include "MetaCtxs.h"
 #include "PhysicsScene.h"
+#include "PathQueryService.h"
+#include "FramePacket.h"
+#include "Profiler.h"
+#include "FrameAllocator.h"
+#include "AssetLoader.h"
+#include "SceneManifest.h"
+#include "../Animavision/VirtualFileSystem.h"
 #include "CoreSerialize.h" // Relationship 때문에 사용
 #include "CoreComponents.h"
 
@@ -23,6 +30,7 @@ core::Scene::Scene()
 	: _gen(std::random_device{}())
 {
 	_physicsScene = std::make_shared<PhysicsScene>(*this);
+	_pathQueryService = std::make_shared<PathQueryService>();
 
 	_dispatcher.sink<OnRemoveComponent>().connect<&Scene::removeComponent>(this);
 	_dispatcher.sink<OnSetTimeScale>().connect<&Scene::setTimeScale>(this);
@@ -42,6 +50,12 @@ core::Scene::Scene()
 	_soundSystem = new SoundSystem(*this);
 }
 
+core::Scene::~Scene()
+{
+	// 씬 교체 시 이전 씬이 해제되므로 FMOD 시스템도 함께 정리
+	delete _soundSystem;
+}
+
 core::Entity core::Scene::CreateEntity()
 {
 	Entity entity = { _registry.create(), _registry };
@@ -166,6 +180,10 @@ void core::Scene::SaveScene(const std::filesystem::path& path, bool clearEmptyEn
 	{
 		outFile << ss.str();
 		outFile.close();
+
+		// 실행할 때 이 씬이 참조하는 에셋만 읽도록 의존성 목록도 저장
+		if (!SceneManifest::Collect(_registry).Save(SceneManifest::GetPath(savePath)))
+			LOG_WARN(*this, "Cannot save scene manifest : {}", path.filename().string());
 	}
 	else
 	{
@@ -177,86 +195,98 @@ void core::Scene::LoadScene(std::filesystem::path path)
 {
 	Clear();
 
-	std::ifstream file(path);
+	std::vector<std::string> systemNames;
 
-	if (!file.is_open() or path.extension() != SCENE_EXTENSION)
+	if (loadSnapshot(path, systemNames))
+		loadSystems(systemNames);
+}
+
+bool core::Scene::loadSnapshot(const std::filesystem::path& path, std::vector<std::string>& systemNames)
+{
+	PROFILE_FUNCTION();
+
+	// 팩을 마운트했으면 팩에서
+	std::vector<char> data;
+
+	if (path.extension() != SCENE_EXTENSION or !VirtualFileSystem::Read(path, data))
 	{
 		LOG_ERROR(*this, "Cannot open file : {}", path.filename().string());
-		return;
+		return false;
 	}
 
 	_name = path.filename().replace_extension().string();
 
-	std::stringstream ss;
-	ss << file.rdbuf();
-	file.close();
+	MemoryStream ss(data);
 
 	// 씬 스냅샷 로드
-	{
-		cereal::JSONInputArchive archive(ss);
-		entt::snapshot_loader loader(_registry);
+	cereal::JSONInputArchive archive(ss);
+	entt::snapshot_loader loader(_registry);
 
-		// 불필요 엔티티 제거
-		loader.orphans();
+	// 불필요 엔티티 제거
+	loader.orphans();
 
-		loader.get<entt::entity>(archive);
+	loader.get<entt::entity>(archive);
 
-		for (auto&& [id, type] : entt::resolve(global::componentMetaCtx))
+	for (auto&& [id, type] : entt::resolve(global::componentMetaCtx))
+	{
+		if (auto getName = type.func("GetName"_hs))
 		{
-			if (auto getName = type.func("GetName"_hs))
-			{
-				const char* name = nullptr;
-				name = getName.invoke({}).cast<const char*>();
+			const char* name = nullptr;
+			name = getName.invoke({}).cast<const char*>();
 
-				// Archive에 저장된 컴포넌트 이름과 일치하는지 확인
-				if (!name or !archive.getNodeName() or strcmp(archive.getNodeName(), name))
-					continue;
-			}
+			// Archive에 저장된 컴포넌트 이름과 일치하는지 확인
+			if (!name or !archive.getNodeName() or strcmp(archive.getNodeName(), name))
+				continue;
+		}
 
-			// 컴포넌트 로드 시도
-			if (auto loadStorage = type.func("LoadSnapshot"_hs))
+		// 컴포넌트 로드 시도
+		if (auto loadStorage = type.func("LoadSnapshot"_hs))
+		{
+			try
+			{
+				loadStorage.invoke({}, &loader, &archive);  // 정상적으로 로드
+			}
+			catch (const std::exception& e)
 			{
-				try
-				{
-					loadStorage.invoke({}, &loader, &archive);  // 정상적으로 로드
-				}
-				catch (const std::exception& e)
-				{
-					LOG_WARN(*this, "Failed to load component: {}", e.what());
-				}
+				LOG_WARN(*this, "Failed to load component: {}", e.what());
 			}
 		}
+	}
 
-		// 로드할 시스템 목록
-		std::vector<std::string> systemNames;
+	// 로드할 시스템 목록
+	try
+	{
+		archive(cereal::make_nvp("systems", systemNames));
+	}
+	catch (const std::exception& e)
+	{
+		LOG_ERROR(*this, "Invalid Scene file : Failed to load systems", e.what());
+		return false;
+	}
 
-		try
-		{
-			archive(cereal::make_nvp("systems", systemNames));
-		}
-		catch (const std::exception& e)
-		{
-			LOG_ERROR(*this, "Invalid Scene file : Failed to load systems", e.what());
-			return;
-		}
+	// 씬 설정(Configuration) 저장
+	//archive(cereal::make_nvp("configuration", _registry.ctx().get<Configuration>()));
+
+	return true;
+}
 
-		for (auto&& [id, type] : entt::resolve(global::systemMetaCtx))
+void core::Scene::loadSystems(std::vector<std::string>& systemNames)
+{
+	PROFILE_FUNCTION();
+
+	for (auto&& [id, type] : entt::resolve(global::systemMetaCtx))
+	{
+		if (auto loadSystem = type.func("LoadSystem"_hs))
 		{
-			if (auto loadSystem = type.func("LoadSystem"_hs))
+			try
 			{
-				try
-				{
-					loadSystem.invoke({}, this, &systemNames);
-				}
-				catch (const std::exception& e)
-				{
-					LOG_WARN(*this, "Failed to load system: {}", e.what());
-				}
+				loadSystem.invoke({}, this, &systemNames);
+			}
+			catch (const std::exception& e)
+			{
+				LOG_WARN(*this, "Failed to load system: {}", e.what());
 			}
 		}
-
-		// 씬 설정(Configuration) 저장
-		//archive(cereal::make_nvp("configuration", _registry.ctx().get<Configuration>()));
 	}
 }
 
@@ -297,17 +327,19 @@ void core::Scene::SavePrefab(const std::filesystem::path& path, core::Entity& en
 		}
 	}
 
-	std::ofstream outFile;
-	if (path.extension() == PREFAB_EXTENSION)
-		outFile.open(path.generic_string(), std::ios::out | std::ios::trunc);
-	else
-		outFile.open(path.generic_string() + PREFAB_EXTENSION, std::ios::out | std::ios::trunc);
+	const auto savePath = path.extension() == PREFAB_EXTENSION ? path.generic_string() : path.generic_string() + PREFAB_EXTENSION;
+
+	std::ofstream outFile(savePath, std::ios::out | std::ios::trunc);
 
 	// 프리팹 파일 저장
 	if (outFile)
 	{
 		outFile << ss.str();
 		outFile.close();
+
+		if (!SceneManifest::Collect(_registry, descendents).Save(SceneManifest::GetPath(savePath)))
+			LOG_WARN(*this, "Cannot save prefab manifest : {}", path.filename().string());
+
 		LOG_INFO(*this, "Prefab Saved : {}", path.filename().string());
 	}
 	else
@@ -318,17 +350,19 @@ void core::Scene::SavePrefab(const std::filesystem::path& path, core::Entity& en
 
 entt::entity core::Scene::LoadPrefab(const std::filesystem::path& path)
 {
-	std::ifstream file(path);
+	std::vector<char> data;
 
-	if (!file.is_open() or path.extension() != PREFAB_EXTENSION)
+	if (path.extension() != PREFAB_EXTENSION or !VirtualFileSystem::Read(path, data))
 	{
 		LOG_ERROR(*this, "Cannot Open File : {}", path.filename().string());
 		return entt::null;
 	}
 
-	std::stringstream ss;
-	ss << file.rdbuf();
-	file.close();
+	MemoryStream ss(data);
+
+	// 프리팹이 참조하는 에셋은 메인 스레드의 다음 AssetLoader::Pump 에서 읽음 (그 전까지는 AssetResolver 가 비워 둠)
+	if (SceneManifest manifest; manifest.Load(SceneManifest::GetPath(path)))
+		AssetLoader::Get().Prefetch(manifest);
 
 	// 프리팹 스냅샷 로드
 	cereal::JSONInputArchive archive(ss);
@@ -403,26 +437,50 @@ entt::entity core::Scene::LoadPrefab(const std::filesystem::path& path)
 
 void core::Scene::Update(float tick)
 {
+	PROFILE_FUNCTION();
+
 	_accumulator += tick;
 
-	for (auto& preUpdate : _preUpdates)
+	if (_scheduleDirty)
+		buildSchedule();
+
+	_scheduler.ResetTimings();
+	_events.ResetStats();
+
 	{
-		preUpdate->PreUpdate(*this, tick);
+		PROFILE_SCOPE("PreUpdate");
+		_scheduler.Run(SystemType::PreUpdate, [this, tick](size_t index)
+			{
+				_preUpdates[index]->PreUpdate(*this, tick);
+			});
 	}
 
-	for (auto& update : _updates)
+	// 동기화 지점 : 단계가 끝날 때마다 쌓인 이벤트를 일괄 전달
+	_events.Flush();
+
+	// SoundSystem 은 씬이 직접 소유하며 업데이트 단계의 마지막 노드
 	{
-		(*update)(*this, tick);
+		PROFILE_SCOPE("Update");
+		_scheduler.Run(SystemType::Update, [this, tick](size_t index)
+			{
+				if (index < _updates.size())
+					(*_updates[index])(*this, tick);
+				else
+					(*_soundSystem)(*this, tick);
+			});
 	}
-	(*_soundSystem)(*this, tick);
+
+	_events.Flush();
 
 	// 고정 업데이트는 누적된 시간이 고정 시간 간격을 넘어설 때마다 실행
 	while (_accumulator >= IFixedSystem::FIXED_TIME_STEP)
 	{
-		for (auto& fixed : _fixeds)
-		{
-			(*fixed)(*this);
-		}
+		PROFILE_SCOPE("FixedUpdate");
+		_scheduler.Run(SystemType::FixedUpdate, [this](size_t index)
+			{
+				(*_fixeds[index])(*this);
+			});
+		_events.Flush();
 		_accumulator -= IFixedSystem::FIXED_TIME_STEP;
 	}
 
@@ -432,30 +490,81 @@ void core::Scene::Update(float tick)
 
 void core::Scene::Render(float tick, Renderer* renderer)
 {
+	PROFILE_FUNCTION();
+
+	if (_scheduleDirty)
+		buildSchedule();
+
 	// 렌더
-	for (auto& preRender : _preRenders)
 	{
-		preRender->PreRender(*this, *renderer, tick);
+		PROFILE_SCOPE("PreRender");
+		_scheduler.Run(SystemType::PreRender, [this, tick, renderer](size_t index)
+			{
+				_preRenders[index]->PreRender(*this, *renderer, tick);
+			});
 	}
 
-	for (auto& render : _renders)
 	{
-		(*render)(*this, *renderer, tick);
+		PROFILE_SCOPE("Render");
+		_scheduler.Run(SystemType::Render, [this, tick, renderer](size_t index)
+			{
+				(*_renders[index])(*this, *renderer, tick);
+			});
 	}
 
-	for (auto& postRender : _postRenders)
 	{
-		postRender->PostRender(*this, *renderer, tick);
+		PROFILE_SCOPE("PostRender");
+		_scheduler.Run(SystemType::PostRender, [this, tick, renderer](size_t index)
+			{
+				_postRenders[index]->PostRender(*this, *renderer, tick);
+			});
 	}
 }
 
+bool core::Scene::CanPipelineRender()
+{
+	if (_scheduleDirty)
+		buildSchedule();
+
+	return _canPipelineRender;
+}
+
+void core::Scene::ExtractFramePacket(FramePacket& packet, float tick, Renderer* renderer)
+{
+	PROFILE_FUNCTION();
+
+	if (_scheduleDirty)
+		buildSchedule();
+
+	packet.tick = tick;
+	packet.isPlaying = IsPlaying();
+	packet.submitters = _framePacketSystems;
+
+	// 앞 단계가 채운 값(카메라 등)을 뒤 단계가 읽으므로 제출 순서대로 직렬 실행
+	for (auto& system : _framePacketSystems)
+		system->Extract(*this, *renderer, packet);
+}
+
+void core::Scene::SubmitFramePacket(const FramePacket& packet, Renderer* renderer)
+{
+	PROFILE_FUNCTION();
+
+	for (auto& system : packet.submitters)
+		system->Submit(packet, *renderer);
+}
+
 void core::Scene::ProcessEvent()
 {
-	// 이벤트 처리
+	// 이벤트 처리 (렌더 단계, 충돌 콜백에서 쌓인 이벤트 포함)
+	_events.Flush();
 	_dispatcher.update();
+	_events.Flush();
 
 	// 엔티티 삭제
 	destroyEntities();
+
+	// 프레임 임시 메모리 초기화 (업데이트, 렌더 단계의 작업은 모두 끝난 시점)
+	FrameArena::ResetAll();
 }
 
 void core::Scene::Start(Renderer* renderer)
@@ -469,6 +578,7 @@ void core::Scene::Start(Renderer* renderer)
 void core::Scene::Finish(Renderer* renderer)
 {
 	_dispatcher.trigger<OnFinishSystem>({ *this, renderer });
+	_events.Clear();
 }
 
 void core::Scene::Clear()
@@ -481,6 +591,10 @@ void core::Scene::Clear()
 	_dispatcher.clear();
 
 	_systemMap.clear();
+	_systemAccess.clear();
+	_scheduleDirty = true;
+	_framePacketSystems.clear();
+	_canPipelineRender = false;
 	_systems.clear();
 	_preUpdates.clear();
 	_updates.clear();
@@ -501,6 +615,69 @@ void core::Scene::Clear()
 	RegisterSystem<TransformSystem>();
 }
 
+void core::Scene::buildSchedule()
+{
+	std::map<SystemType, std::vector<SystemScheduler::SystemDesc>> phases;
+	phases[SystemType::PreUpdate].resize(_preUpdates.size());
+	phases[SystemType::Update].resize(_updates.size());
+	phases[SystemType::FixedUpdate].resize(_fixeds.size());
+	phases[SystemType::PreRender].resize(_preRenders.size());
+	phases[SystemType::Render].resize(_renders.size());
+	phases[SystemType::PostRender].resize(_postRenders.size());
+
+	for (const auto& [name, info] : _systemMap)
+	{
+		auto it = phases.find(info.type);
+		if (it == phases.end() || info.systemIndex >= it->second.size())
+			continue;
+
+		auto& desc = it->second[info.systemIndex];
+		desc.name = name.c_str();
+		desc.access = _systemAccess[name];
+
+		// 렌더 단계는 Renderer 를 공유
+		const bool isRenderPhase = info.type == SystemType::PreRender || info.type == SystemType::Render || info.type == SystemType::PostRender;
+		if (isRenderPhase && !desc.access.exclusive)
+			desc.access.writes.push_back(entt::type_hash<access::Renderer>::value());
+	}
+
+	phases[SystemType::Update].push_back({ SystemTraits<SoundSystem>::name, MakeSystemAccess<SoundSystem>() });
+
+	// 렌더 단계가 모두 패킷으로 제출 가능하고, 업데이트 단계가 Renderer 를 쓰지 않아야 파이프라인 가능
+	_framePacketSystems.clear();
+	_canPipelineRender = true;
+
+	auto collectPacketSystems = [this](const auto& systems)
+		{
+			for (const auto& system : systems)
+			{
+				if (auto packetSystem = std::dynamic_pointer_cast<IFramePacketSystem>(system))
+					_framePacketSystems.push_back(std::move(packetSystem));
+				else
+					_canPipelineRender = false;
+			}
+		};
+	collectPacketSystems(_preRenders);
+	collectPacketSystems(_renders);
+	collectPacketSystems(_postRenders);
+
+	const auto rendererId = entt::type_hash<access::Renderer>::value();
+	for (auto type : { SystemType::PreUpdate, SystemType::Update, SystemType::FixedUpdate })
+	{
+		for (const auto& desc : phases[type])
+		{
+			if (std::ranges::find(desc.access.reads, rendererId) != desc.access.reads.end() ||
+				std::ranges::find(desc.access.writes, rendererId) != desc.access.writes.end())
+				_canPipelineRender = false;
+		}
+	}
+
+	for (auto& [type, descs] : phases)
+		_scheduler.Build(type, std::move(descs), _registry);
+
+	_scheduleDirty = false;
+}
+
 void core::Scene::updateSystemMapIndex(SystemType type, size_t oldIndex, size_t newIndex)
 {
 	// 시스템 맵에서 스왑된 시스템을 찾아 인덱스를 업데이트
@@ -2,7 +2,9 @@
 #include <random>
 
 #include "Entity.h"
+#include "EventBus.h"
 #include "SystemTraits.h"
+#include "SystemScheduler.h"
 
 class Renderer;
 
@@ -11,12 +13,15 @@ namespace core
 	class ISystem;
 	class Graphics;
 	class PhysicsScene;
+	class PathQueryService;
 	class IFixedSystem;
 	class IPreUpdateSystem;
 	class IUpdateSystem;
 	class IPreRenderSystem;
 	class IRenderSystem;
 	class IPostRenderSystem;
+	class IFramePacketSystem;
+	struct FramePacket;
 	class PhysicsSystem;
 	struct OnChangeScene;
 	struct OnDestroyEntity;
@@ -44,6 +49,7 @@ namespace core
 		static constexpr const char* SOUND_EXTENSION = ".wav";
 
 		Scene();
+		~Scene();
 
 		// 엔티티 생성
 		Entity CreateEntity();
@@ -69,6 +75,12 @@ namespace core
 		void Update(float tick);
 		void Render(float tick, Renderer* renderer);
 
+		// 파이프라인 렌더 : 렌더 단계 시스템이 모두 IFramePacketSystem 이고
+		// 업데이트 단계에서 Renderer 를 쓰는 시스템이 없을 때만 가능
+		bool CanPipelineRender();
+		void ExtractFramePacket(FramePacket& packet, float tick, Renderer* renderer);
+		static void SubmitFramePacket(const FramePacket& packet, Renderer* renderer);
+
 		void ProcessEvent();
 
 		void Start(Renderer* renderer);
@@ -80,11 +92,16 @@ namespace core
 		void SetName(const std::string& name) { _name = name; }
 		entt::registry* GetRegistry() { return &_registry; }
 		entt::dispatcher* GetDispatcher() { return &_dispatcher; }
+		EventBus* GetEventBus() { return &_events; }
 		std::shared_ptr<PhysicsScene> GetPhysicsScene() { return _physicsScene; }
+		std::shared_ptr<PathQueryService> GetPathQueryService() { return _pathQueryService; }
 		std::mt19937* GetGenerator() { return &_gen; }
 		float GetTimeScale() const { return _timeScale; }
 		bool IsPlaying() const { return _timeScale > 0.0f; }
 
+		// 시스템 실행 그래프 (병렬/직렬 전환, 시스템별 시간)
+		SystemScheduler& GetScheduler() { return _scheduler; }
+
 #ifdef _EDITOR
 		template <typename T> requires HasSystemTraits<T>
 		T* GetSystem(SystemType sysType);
@@ -95,6 +112,11 @@ namespace core
 	private:
 		void destroyEntity(entt::entity topEntity);
 		void updateSystemMapIndex(SystemType type, size_t oldIndex, size_t newIndex);
+		void buildSchedule();
+
+		// LoadScene 단계 (SceneLoader 는 스냅샷을 워커에서, 시스템 등록은 메인 스레드에서 진행)
+		bool loadSnapshot(const std::filesystem::path& path, std::vector<std::string>& systemNames);
+		void loadSystems(std::vector<std::string>& systemNames);
 
 		// system event
 		void removeComponent(const OnRemoveComponent& event);
@@ -109,7 +131,9 @@ namespace core
 		std::string _name = DEFAULT_SCENE_NAME;
 		entt::registry _registry;
 		entt::dispatcher _dispatcher;
+		EventBus _events;	// 자주 발생하는 이벤트 (단계 사이에서 일괄 전달)
 		std::shared_ptr<PhysicsScene> _physicsScene;
+		std::shared_ptr<PathQueryService> _pathQueryService;
 		std::mt19937 _gen;
 
 		// 시스템 컨테이너
@@ -123,6 +147,15 @@ namespace core
 		std::vector<std::shared_ptr<IPostRenderSystem>> _postRenders;
 		std::vector<std::shared_ptr<ICollisionHandler>> _collisionHandlers;
 
+		// 시스템별 접근 선언 및 단계별 실행 그래프 (시스템 추가/삭제 시 다시 구성)
+		std::unordered_map<std::string, SystemAccess> _systemAccess;
+		SystemScheduler _scheduler;
+		bool _scheduleDirty = true;
+
+		// 렌더 단계 순서대로 정렬된 패킷 시스템 (buildSchedule 에서 갱신)
+		std::vector<std::shared_ptr<IFramePacketSystem>> _framePacketSystems;
+		bool _canPipelineRender = false;
+
 		// 모든 이벤트 처리 후 삭제를 위한 대기 큐
 		std::queue<entt::entity> _destroyedEntities;
 		std::vector<entt::entity> _destroyedEntitiesEvent;
@@ -133,6 +166,9 @@ namespace core
 
 		// sound
 		SoundSystem* _soundSystem = nullptr;
+
+		friend class SceneLoader;
+		friend class SceneManifestWriter;
 	};
 
 	template <typename T> requires HasSystemTraits<T>
@@ -187,6 +223,9 @@ namespace core
 			_collisionHandlers.push_back(system);
 			_systemMap.insert({ name, { SystemType::CollisionHandler, _collisionHandlers.size() - 1, systemId } });
 		}
+
+		_systemAccess[name] = MakeSystemAccess<T>();
+		_scheduleDirty = true;
 	}
 
 	template <typename T> requires HasSystemTraits<T>
@@ -274,6 +313,9 @@ namespace core
 
 		if (_systemMap.contains(name))
 			_systemMap.erase(name);
+
+		_systemAccess.erase(name);
+		_scheduleDirty = true;
 	}
 
 #ifdef _EDITOR
@@ -0,0 +1,155 @@
+﻿#include "pch.h"
+#include "SceneLoader.h"
+
+#include "Scene.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "FrameAllocator.h"
+#include "PhysicsScene.h"
+#include "RenderComponents.h"
+#include "CorePhysicsComponents.h"
+
+#include "../Animavision/Renderer.h"
+#include "../Animavision/Mesh.h"
+
+#include <set>
+
+namespace
+{
+	// 진행률 구간 (스냅샷 로드가 대부분을 차지)
+	constexpr float SNAPSHOT_PROGRESS = 0.5f;
+	constexpr float RESOLVE_PROGRESS = 0.6f;
+}
+
+bool core::SceneLoader::LoadAsync(const std::filesystem::path& path, Renderer* renderer)
+{
+	if (GetState() != State::Idle)
+		return false;
+
+	if (_thread.joinable())
+		_thread.join();
+
+	_path = path;
+	_systemNames.clear();
+	_progress.store(0.0f, std::memory_order_relaxed);
+
+	// 시스템 생성자가 디스패처, FMOD, PhysX 씬을 만들기 때문에 씬 생성과 초기화는 메인 스레드에서
+	_staging = std::make_shared<Scene>();
+	_staging->Clear();
+
+	_state.store(State::Loading, std::memory_order_release);
+	_thread = std::jthread([this, renderer](std::stop_token token) { load(token, renderer); });
+
+	return true;
+}
+
+void core::SceneLoader::Wait()
+{
+	if (GetState() == State::Loading && _thread.joinable())
+		_thread.join();
+}
+
+std::shared_ptr<core::Scene> core::SceneLoader::TakeScene()
+{
+	const State state = GetState();
+
+	if (state == State::Idle || state == State::Loading)
+		return nullptr;
+
+	if (_thread.joinable())
+		_thread.join();
+
+	std::shared_ptr<Scene> scene;
+
+	if (state == State::Ready)
+	{
+		PROFILE_SCOPE("SceneLoader::TakeScene");
+		_staging->loadSystems(_systemNames);
+		scene = std::move(_staging);
+	}
+
+	_staging.reset();
+	_systemNames.clear();
+	_progress.store(0.0f, std::memory_order_relaxed);
+	_state.store(State::Idle, std::memory_order_release);
+
+	return scene;
+}
+
+void core::SceneLoader::load(std::stop_token token, Renderer* renderer)
+{
+	PROFILE_THREAD("Scene Loader");
+	PROFILE_FUNCTION();
+
+	// 메인 프레임과 따로 돌기 때문에 ResetAll 에서 제외 (스레드가 끝나면 해제)
+	FrameArena::Get().SetSelfReset(true);
+
+	auto& registry = *_staging->GetRegistry();
+
+	// 파일 읽기 + 스냅샷 로드
+	if (!_staging->loadSnapshot(_path, _systemNames))
+	{
+		_state.store(State::Failed, std::memory_order_release);
+		return;
+	}
+	_progress.store(SNAPSHOT_PROGRESS, std::memory_order_relaxed);
+
+	if (token.stop_requested())
+		return;
+
+	// 메쉬/머터리얼 연결 (Renderer 라이브러리는 조회만 하므로 메인 스레드와 동시에 접근 가능)
+	// RenderSystem, AnimatorSystem 은 시작 시 비어 있는 것만 채우므로 여기서 채우면 건너뜀
+	// 핸들은 레지스트리에 써야 하므로 여기서 만들지 않고 메인 스레드의 AssetResolver 가 첫 조회 때 채움
+	{
+		PROFILE_SCOPE("SceneLoader::resolveResources");
+
+		for (auto&& [entity, meshRenderer] : registry.view<MeshRenderer>().each())
+		{
+			if (!meshRenderer.mesh)
+				meshRenderer.mesh = renderer->GetMesh(meshRenderer.meshString);
+
+			if (meshRenderer.materials.empty())
+			{
+				for (auto&& materialString : meshRenderer.materialStrings)
+					meshRenderer.materials.push_back(renderer->GetMaterial(materialString));
+			}
+		}
+	}
+	_progress.store(RESOLVE_PROGRESS, std::memory_order_relaxed);
+
+	if (token.stop_requested())
+		return;
+
+	// 메쉬 콜라이더 쿡킹 (메쉬, 옵션이 같으면 한 번만), 결과는 PhysX 공유 캐시에 남아 액터 생성 시 재사용
+	std::vector<std::pair<const Mesh*, MeshCollider>> cookList;
+	{
+		std::set<std::tuple<const Mesh*, uint32_t, bool>> cooked;
+
+		for (auto&& [entity, meshCollider, meshRenderer] : registry.view<MeshCollider, MeshRenderer>().each())
+		{
+			if (!meshRenderer.mesh)
+				continue;
+
+			if (cooked.emplace(meshRenderer.mesh.get(), static_cast<uint32_t>(meshCollider.cookingOptions), meshCollider.convex).second)
+				cookList.emplace_back(meshRenderer.mesh.get(), meshCollider);
+		}
+	}
+
+	std::atomic<size_t> cookedCount = 0;
+	GetJobSystem().ParallelFor(cookList.size(), 1, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (token.stop_requested())
+					return;
+
+				PhysicsScene::CookMesh(*cookList[i].first, cookList[i].second);
+
+				const float ratio = static_cast<float>(++cookedCount) / static_cast<float>(cookList.size());
+				_progress.store(RESOLVE_PROGRESS + (1.0f - RESOLVE_PROGRESS) * ratio, std::memory_order_relaxed);
+			}
+		});
+
+	_progress.store(1.0f, std::memory_order_relaxed);
+	_state.store(State::Ready, std::memory_order_release);
+}
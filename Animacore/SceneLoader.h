@@ -0,0 +1,58 @@
+﻿#pragma once
+
+#include <thread>
+
+class Renderer;
+
+namespace core
+{
+	class Scene;
+
+	/// \brief
+	/// \n 다음 씬을 별도 스레드에서 스테이징 씬으로 읽어 두고, 프레임 경계에서 교체
+	///	\n 워커 : 파일 읽기, 스냅샷 로드, 메쉬/머터리얼 연결, 메쉬 콜라이더 쿡킹
+	///	\n 메인 : 스테이징 씬 생성, 시스템 등록 (TakeScene)
+	///	\n 스테이징 씬은 로딩이 끝날 때까지 워커만 접근하므로 현재 씬은 그대로 실행됨
+	class SceneLoader
+	{
+	public:
+		enum class State
+		{
+			Idle,
+			Loading,
+			Ready,
+			Failed,
+		};
+
+		SceneLoader() = default;
+
+		SceneLoader(const SceneLoader&) = delete;
+		SceneLoader& operator=(const SceneLoader&) = delete;
+
+		// 로딩 시작 (메인 스레드), 이미 로딩 중이거나 결과를 가져가지 않았으면 false
+		bool LoadAsync(const std::filesystem::path& path, Renderer* renderer);
+
+		State GetState() const { return _state.load(std::memory_order_acquire); }
+		float GetProgress() const { return _progress.load(std::memory_order_relaxed); }
+		const std::filesystem::path& GetPath() const { return _path; }
+
+		// 로딩 중이면 끝날 때까지 대기 (입력 재생처럼 교체 프레임을 맞춰야 할 때)
+		void Wait();
+
+		// Ready 면 시스템까지 등록한 씬을 넘기고 Idle 로 돌아감 (Failed 도 Idle 로 돌아가며 nullptr)
+		std::shared_ptr<Scene> TakeScene();
+
+	private:
+		void load(std::stop_token token, Renderer* renderer);
+
+		std::filesystem::path _path;
+		std::shared_ptr<Scene> _staging;
+		std::vector<std::string> _systemNames;
+
+		std::atomic<State> _state = State::Idle;
+		std::atomic<float> _progress = 0.0f;
+
+		// 가장 먼저 정리되도록 마지막에 선언 (소멸 시 중단 요청 후 join, 스테이징 씬은 그 뒤에 해제)
+		std::jthread _thread;
+	};
+}
@@ -0,0 +1,144 @@
+﻿#include "pch.h"
+#include "SceneManifest.h"
+
+#include "CoreComponents.h"
+#include "RenderComponents.h"
+#include "../Animavision/VirtualFileSystem.h"
+
+#include <set>
+#include <fstream>
+
+namespace
+{
+	void add(std::set<std::string>& names, const std::string& name)
+	{
+		if (!name.empty())
+			names.insert(name);
+	}
+}
+
+core::SceneManifest core::SceneManifest::Collect(entt::registry& registry, const std::vector<entt::entity>& entities)
+{
+	// 중복 제거, 저장 결과가 매번 같도록 정렬
+	std::set<std::string> meshes;
+	std::set<std::string> materials;
+	std::set<std::string> controllers;
+	std::set<std::string> uiTextures;
+	std::set<std::string> particleTextures;
+	std::set<std::string> sounds;
+
+	auto collect = [&](entt::entity entity)
+		{
+			if (!registry.valid(entity))
+				return;
+
+			if (auto* meshRenderer = registry.try_get<MeshRenderer>(entity))
+			{
+				add(meshes, meshRenderer->meshString);
+				for (const auto& material : meshRenderer->materialStrings)
+					add(materials, material);
+			}
+
+			if (auto* decal = registry.try_get<Decal>(entity))
+				add(materials, decal->materialString);
+
+			if (auto* animator = registry.try_get<Animator>(entity))
+				add(controllers, animator->animatorFileName);
+
+			if (auto* common = registry.try_get<UICommon>(entity))
+				add(uiTextures, common->textureString);
+
+			if (auto* button = registry.try_get<Button>(entity))
+			{
+				add(uiTextures, button->highlightTextureString);
+				add(uiTextures, button->pressedTextureString);
+				add(uiTextures, button->selectedTextureString);
+				add(uiTextures, button->disabledTextureString);
+				add(uiTextures, button->defaultTextureString);
+			}
+
+			if (auto* checkBox = registry.try_get<CheckBox>(entity))
+			{
+				add(uiTextures, checkBox->checkedTextureString);
+				add(uiTextures, checkBox->uncheckedTextureString);
+			}
+
+			if (auto* particleSystem = registry.try_get<ParticleSystem>(entity))
+			{
+				add(particleTextures, particleSystem->renderData.baseColorTextureString);
+				add(particleTextures, particleSystem->renderData.emissiveTextureString);
+			}
+
+			if (auto* sound = registry.try_get<Sound>(entity))
+				add(sounds, sound->path);
+		};
+
+	if (entities.empty())
+	{
+		for (auto entity : registry.view<entt::entity>())
+			collect(entity);
+
+		if (auto* bgm = registry.ctx().find<BGM>())
+			add(sounds, bgm->sound.path);
+	}
+	else
+	{
+		for (auto entity : entities)
+			collect(entity);
+	}
+
+	SceneManifest manifest;
+	manifest.meshes.assign(meshes.begin(), meshes.end());
+	manifest.materials.assign(materials.begin(), materials.end());
+	manifest.controllers.assign(controllers.begin(), controllers.end());
+	manifest.uiTextures.assign(uiTextures.begin(), uiTextures.end());
+	manifest.particleTextures.assign(particleTextures.begin(), particleTextures.end());
+	manifest.sounds.assign(sounds.begin(), sounds.end());
+
+	return manifest;
+}
+
+std::filesystem::path core::SceneManifest::GetPath(const std::filesystem::path& assetPath)
+{
+	return assetPath.string() + EXTENSION;
+}
+
+bool core::SceneManifest::Save(const std::filesystem::path& path) const
+{
+	std::ofstream file(path, std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(cereal::make_nvp("manifest", *this));
+	}
+
+	return file.good();
+}
+
+bool core::SceneManifest::Load(const std::filesystem::path& path)
+{
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+		return false;
+
+	try
+	{
+		MemoryStream stream(data);
+		cereal::JSONInputArchive archive(stream);
+		archive(cereal::make_nvp("manifest", *this));
+	}
+	catch (const std::exception&)
+	{
+		*this = {};
+		return false;
+	}
+
+	return true;
+}
+
+uint32_t core::SceneManifest::GetCount() const
+{
+	return static_cast<uint32_t>(meshes.size() + materials.size() + controllers.size() + uiTextures.size() + particleTextures.size());
+}
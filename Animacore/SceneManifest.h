@@ -0,0 +1,39 @@
+﻿#pragma once
+
+namespace core
+{
+	/// \brief
+	/// \n 씬(프리팹)이 참조하는 에셋 이름 목록, 씬을 저장할 때 옆에 같이 저장 (<scene>.deps)
+	///	\n 실행할 때는 에셋 디렉터리를 전부 읽는 대신 이 목록만 AssetLoader 로 읽음
+	///	\n 이름은 컴포넌트에 저장된 그대로 (메시 이름, 머티리얼 경로, UI / 파티클 텍스처 파일 이름, 컨트롤러 경로)
+	struct SceneManifest
+	{
+		static constexpr const char* EXTENSION = ".deps";
+
+		std::vector<std::string> meshes;
+		std::vector<std::string> materials;
+		std::vector<std::string> controllers;
+		std::vector<std::string> uiTextures;
+		std::vector<std::string> particleTextures;
+		std::vector<std::string> sounds;			// SoundSystem 이 씬을 시작할 때 직접 읽으므로 기록만
+
+		// entities 가 비어 있으면 레지스트리 전체 (+ BGM)
+		static SceneManifest Collect(entt::registry& registry, const std::vector<entt::entity>& entities = {});
+
+		// "title.scene" -> "title.scene.deps"
+		static std::filesystem::path GetPath(const std::filesystem::path& assetPath);
+
+		bool Save(const std::filesystem::path& path) const;
+		bool Load(const std::filesystem::path& path);
+
+		// AssetLoader 가 읽는 에셋 수 (sounds 제외)
+		uint32_t GetCount() const;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(meshes), CEREAL_NVP(materials), CEREAL_NVP(controllers),
+				CEREAL_NVP(uiTextures), CEREAL_NVP(particleTextures), CEREAL_NVP(sounds));
+		}
+	};
+}
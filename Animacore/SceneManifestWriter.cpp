@@ -0,0 +1,125 @@
+﻿#include "pch.h"
+#include "SceneManifestWriter.h"
+
+#include "Scene.h"
+#include "SceneManifest.h"
+
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+	struct FileReport
+	{
+		std::string path;
+		uint32_t assets = 0;
+		uint32_t sounds = 0;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(path), CEREAL_NVP(assets), CEREAL_NVP(sounds));
+		}
+	};
+}
+
+core::SceneManifestWriter::SceneManifestWriter(SceneManifestWriterSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+bool core::SceneManifestWriter::Run()
+{
+	std::vector<std::string> errors;
+	std::vector<FileReport> reports;
+
+	// 원본은 디스크에만 있으므로 팩을 마운트하기 전에 디렉터리를 훑음
+	std::vector<std::filesystem::path> files;
+	std::error_code ec;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(_settings.sourcePath, ec))
+	{
+		if (!entry.is_regular_file())
+			continue;
+
+		const auto extension = entry.path().extension();
+		if (extension == Scene::SCENE_EXTENSION || extension == Scene::PREFAB_EXTENSION)
+			files.push_back(entry.path());
+	}
+
+	std::ranges::sort(files);
+
+	for (const auto& file : files)
+	{
+		// 시스템은 만들지 않고 스냅샷만 읽음 (프리팹은 빈 씬에 하나만 올림)
+		Scene scene;
+		bool isLoaded = false;
+
+		try
+		{
+			if (file.extension() == Scene::SCENE_EXTENSION)
+			{
+				std::vector<std::string> systemNames;
+				isLoaded = scene.loadSnapshot(file, systemNames);
+			}
+			else
+			{
+				isLoaded = scene.LoadPrefab(file) != entt::null;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			errors.push_back("load failed : " + file.generic_string() + " (" + e.what() + ")");
+			continue;
+		}
+
+		if (!isLoaded)
+		{
+			errors.push_back("load failed : " + file.generic_string());
+			continue;
+		}
+
+		const SceneManifest manifest = SceneManifest::Collect(*scene.GetRegistry());
+		if (!manifest.Save(SceneManifest::GetPath(file)))
+		{
+			errors.push_back("save failed : " + SceneManifest::GetPath(file).generic_string());
+			continue;
+		}
+
+		reports.push_back({ file.generic_string(), manifest.GetCount(), static_cast<uint32_t>(manifest.sounds.size()) });
+	}
+
+	std::ofstream report(_settings.reportPath);
+	if (report.is_open())
+	{
+		cereal::JSONOutputArchive archive(report);
+		archive(
+			cereal::make_nvp("source", _settings.sourcePath.generic_string()),
+			cereal::make_nvp("files", reports),
+			cereal::make_nvp("errors", errors)
+		);
+	}
+
+	return errors.empty() && report.good();
+}
+
+bool core::SceneManifestWriter::ParseArguments(const std::vector<std::string>& args, SceneManifestWriterSettings& settings)
+{
+	bool isWrite = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size() && !args[i + 1].starts_with("--");
+
+		if (arg == "--write-deps")
+		{
+			if (hasValue)
+				settings.sourcePath = args[++i];
+			isWrite = true;
+		}
+		else if (arg == "--report" && hasValue)
+			settings.reportPath = args[++i];
+	}
+
+	return isWrite;
+}
@@ -0,0 +1,30 @@
+﻿#pragma once
+
+namespace core
+{
+	struct SceneManifestWriterSettings
+	{
+		std::filesystem::path sourcePath = "./Resources";
+		std::filesystem::path reportPath = "./scene_deps.json";
+	};
+
+	/// \brief
+	/// \n sourcePath 아래 모든 씬, 프리팹을 창과 렌더러 없이 읽어 옆에 의존성 목록(<scene>.deps)을 다시 쓰는 오프라인 도구
+	///	\n 에디터에서 저장하지 않은 씬도 런타임이 필요한 에셋만 읽도록 --pack-assets 보다 먼저 실행
+	///	\n 메타 데이터(RegisterCoreMetaData, 게임 메타)는 호출하는 쪽에서 미리 등록해야 함
+	class SceneManifestWriter
+	{
+	public:
+		explicit SceneManifestWriter(SceneManifestWriterSettings settings);
+
+		// 읽지 못한 파일은 건너뛰고 계속 진행, 하나라도 실패하면 false
+		bool Run();
+
+		// "--write-deps [dir] [--report path]"
+		// --write-deps 가 없으면 false
+		static bool ParseArguments(const std::vector<std::string>& args, SceneManifestWriterSettings& settings);
+
+	private:
+		SceneManifestWriterSettings _settings;
+	};
+}
@@ -8,12 +8,31 @@
 
 #include <fmod/fmod_errors.h>
 
+#include "../Animavision/VirtualFileSystem.h"
+
 #ifdef _DEBUG
 #pragma comment(lib, "fmodL_vc.lib")
 #else
 #pragma comment(lib, "fmod_vc.lib")
 #endif
 
+// 보이스 풀
+// 실제로 믹싱되는 보이스 수, 나머지는 가상 보이스로 우선순위/가청도에 따라 교체됨
+constexpr int MAX_REAL_VOICES = 64;
+constexpr int MAX_VIRTUAL_VOICES = 512;
+constexpr float VIRTUAL_VOLUME = 0.001f;
+
+// 우선순위 (0 이 가장 높음, FMOD 기본 128)
+constexpr int BGM_PRIORITY = 0;
+constexpr int LOOP_PRIORITY = 64;
+constexpr int ONE_SHOT_2D_PRIORITY = 96;
+constexpr int ONE_SHOT_3D_PRIORITY = 128;
+
+// 이 크기 이하는 디코딩하여 메모리에 (재생 비용 최소)
+constexpr uintmax_t DECOMPRESS_THRESHOLD = 256 * 1024;
+// 이 크기 이하는 압축 상태로 메모리에, 초과하면 스트리밍
+constexpr uintmax_t STREAM_THRESHOLD = 4 * 1024 * 1024;
+
 
 core::SoundSystem::SoundSystem(Scene& scene)
 	: ISystem(scene)
@@ -21,7 +40,14 @@ core::SoundSystem::SoundSystem(Scene& scene)
 	// FMOD 시스템 생성 및 초기화
 	FMOD::System_Create(&_fmodSystem);
 
-	_fmodSystem->init(512, FMOD_INIT_NORMAL, 0);
+	// 소리가 작은 보이스는 가상화하여 실제 보이스를 우선순위가 높은 소리에 양보
+	FMOD_ADVANCEDSETTINGS settings = {};
+	settings.cbSize = sizeof(FMOD_ADVANCEDSETTINGS);
+	settings.vol0virtualvol = VIRTUAL_VOLUME;
+	_fmodSystem->setAdvancedSettings(&settings);
+	_fmodSystem->setSoftwareChannels(MAX_REAL_VOICES);
+
+	_fmodSystem->init(MAX_VIRTUAL_VOICES, FMOD_INIT_NORMAL | FMOD_INIT_VOL0_BECOMES_VIRTUAL, 0);
 
 	_dispatcher = scene.GetDispatcher();
 	_dispatcher->sink<OnStartSystem>().connect<&SoundSystem::startSystem>(this);
@@ -38,6 +64,7 @@ core::SoundSystem::~SoundSystem()
 		fmodSound->release();
 	}
 	_soundMap.clear();
+	_soundMemory.clear();
 
 	// 시스템 해제
 	if (_fmodSystem)
@@ -52,23 +79,10 @@ core::SoundSystem::~SoundSystem()
 void core::SoundSystem::operator()(Scene& scene, float tick)
 {
 	auto& registry = *scene.GetRegistry();
-	auto soundView = registry.view<Sound>();
 	auto listenerView = registry.view<SoundListener, WorldTransform>();
 
-	for (auto&& [entity, sound] : soundView.each())
-	{
-		if (bool isPlaying = false; sound._channel->isPlaying(&isPlaying))
-			sound.isPlaying = isPlaying;
-
-		if (sound.is3D)
-		{
-			if (auto world = registry.try_get<WorldTransform>(entity))
-			{
-				FMOD_VECTOR pos = { world->position.x, world->position.y, world->position.z };
-				sound._channel->set3DAttributes(&pos, nullptr);
-			}
-		}
-	}
+	updatePendingVoices(registry);
+	updateVoices(registry);
 
 	for (auto&& [entity, listener, world] : listenerView.each())
 	{
@@ -98,16 +112,34 @@ void core::SoundSystem::operator()(Scene& scene, float tick)
 	_fmodSystem->update();
 }
 
-FMOD::Sound* core::SoundSystem::loadSound(const Sound& sound, FMOD_RESULT& result)
+FMOD::Sound* core::SoundSystem::loadSound(const Sound& sound, FMOD_RESULT& result, bool nonBlocking)
 {
-	if (_soundMap.contains(sound.path))
-		return _soundMap[sound.path];
+	result = FMOD_OK;
+
+	if (auto it = _soundMap.find(sound.path); it != _soundMap.end())
+		return it->second;
 
 	FMOD::Sound* newSound = nullptr;
-	FMOD_MODE mode = FMOD_DEFAULT;
+	FMOD_MODE mode = getLoadMode(sound.path);
 	mode |= sound.is3D ? FMOD_3D : FMOD_2D;
 	mode |= sound.isLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-	result = _fmodSystem->createSound(sound.path.c_str(), mode, nullptr, &newSound);
+	mode |= nonBlocking ? FMOD_NONBLOCKING : 0;
+
+	// 팩 안의 사운드는 메모리에서 (스트림, 비동기 로드는 사운드를 해제할 때까지 읽으므로 데이터를 들고 있음)
+	if (std::vector<char> data; VirtualFileSystem::IsInPack(sound.path) && VirtualFileSystem::Read(sound.path, data))
+	{
+		FMOD_CREATESOUNDEXINFO info = {};
+		info.cbsize = sizeof(info);
+		info.length = static_cast<unsigned int>(data.size());
+
+		result = _fmodSystem->createSound(data.data(), mode | FMOD_OPENMEMORY, &info, &newSound);
+		if (result == FMOD_OK)
+			_soundMemory[sound.path] = std::move(data);
+	}
+	else
+	{
+		result = _fmodSystem->createSound(sound.path.c_str(), mode, nullptr, &newSound);
+	}
 
 	if (result != FMOD_OK)
 		return nullptr;
@@ -116,101 +148,210 @@ FMOD::Sound* core::SoundSystem::loadSound(const Sound& sound, FMOD_RESULT& resul
 	return newSound;
 }
 
-void core::SoundSystem::updateSound(entt::registry& registry, entt::entity entity)
+FMOD_MODE core::SoundSystem::getLoadMode(const std::string& path)
 {
-	auto& sound = registry.get<Sound>(entity);
+	uint64_t size = 0;
+	const bool isFound = VirtualFileSystem::GetSize(path, size);
+
+	// 짧은 효과음은 디코딩, 중간 크기는 압축 상태로 메모리에, 긴 사운드(BGM 등)는 스트리밍
+	// (스트림은 동시에 한 번만 재생 가능)
+	if (!isFound || size <= DECOMPRESS_THRESHOLD)
+		return FMOD_CREATESAMPLE;
+	if (size <= STREAM_THRESHOLD)
+		return FMOD_CREATECOMPRESSEDSAMPLE;
+	return FMOD_CREATESTREAM;
+}
 
-	// 사운드가 아직 로드되지 않은 경우 로드
-	if (!_soundMap.contains(sound.path))
-		if (FMOD_RESULT result; !loadSound(sound, result))
-			return;
+bool core::SoundSystem::isReady(FMOD::Sound* fmodSound)
+{
+	FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+	fmodSound->getOpenState(&state, nullptr, nullptr, nullptr);
 
-	// 사운드 재생 여부 및 사운드 교체
-	bool isCurrentlyPlaying = false;
-	if (sound._channel)
+	// 스트림은 재생 중에도 버퍼링 상태가 될 수 있음
+	return state == FMOD_OPENSTATE_READY || state == FMOD_OPENSTATE_PLAYING || state == FMOD_OPENSTATE_STARVING;
+}
+
+int core::SoundSystem::getVoicePriority(const Sound& sound)
+{
+	if (sound.isLoop)
+		return LOOP_PRIORITY;
+
+	return sound.is3D ? ONE_SHOT_3D_PRIORITY : ONE_SHOT_2D_PRIORITY;
+}
+
+void core::SoundSystem::preloadSounds(entt::registry& registry)
+{
+	// 재생 전에 모두 로드해 게임 도중 첫 재생에서 디코딩/파일 읽기가 일어나지 않도록 함
+	for (auto&& [entity, sound] : registry.view<Sound>().each())
 	{
-		FMOD::Sound* currentSound = nullptr;
-		sound._channel->getCurrentSound(&currentSound);
-		if (currentSound != _soundMap[sound.path])
-		{
-			sound._channel->stop();
-			sound._channel = nullptr;
-		}
+		if (sound.path.empty())
+			continue;
 
-		sound._channel->isPlaying(&isCurrentlyPlaying);
+		if (FMOD_RESULT result; !loadSound(sound, result))
+			LOG_ERROR_D(*_dispatcher, "Loading Sound Error {} : {}, {}", entity, FMOD_ErrorString(result), sound.path);
 	}
 
-	// 재생 요청 처리
-	if (sound.isPlaying)
+	if (auto* bgm = registry.ctx().find<BGM>(); bgm && !bgm->sound.path.empty())
 	{
-		// 사운드가 재생 중이 아니면 새롭게 재생
-		if (!isCurrentlyPlaying)
-		{
-			FMOD_RESULT result = _fmodSystem->playSound(_soundMap[sound.path], nullptr, false, &sound._channel);
-			if (result != FMOD_OK)
-				return;
+		if (FMOD_RESULT result; !loadSound(bgm->sound, result))
+			LOG_ERROR_D(*_dispatcher, "Loading BGM Error : {}, {}", FMOD_ErrorString(result), bgm->sound.path);
+	}
+}
 
-			// 3D 사운드일 경우 위치 설정
-			if (sound.is3D && registry.all_of<WorldTransform>(entity))
+void core::SoundSystem::updateVoices(entt::registry& registry)
+{
+	// 채널이 할당된 사운드만 확인 (재생하지 않는 사운드는 FMOD 호출 없음)
+	for (size_t i = 0; i < _activeVoices.size();)
+	{
+		const entt::entity entity = _activeVoices[i];
+		Sound* sound = registry.valid(entity) ? registry.try_get<Sound>(entity) : nullptr;
+
+		// 가상화된 보이스도 재생 중으로 취급
+		bool isPlaying = false;
+		if (sound && sound->_channel && sound->_channel->isPlaying(&isPlaying) == FMOD_OK && isPlaying)
+		{
+			if (sound->is3D)
 			{
-				auto& world = registry.get<WorldTransform>(entity);
-				FMOD_VECTOR pos = { world.position.x, world.position.y, world.position.z };
-				sound._channel->set3DAttributes(&pos, nullptr);
-				sound._channel->set3DMinMaxDistance(sound.minDistance, sound.maxDistance);
+				if (auto world = registry.try_get<WorldTransform>(entity))
+				{
+					FMOD_VECTOR pos = { world->position.x, world->position.y, world->position.z };
+					sound->_channel->set3DAttributes(&pos, nullptr);
+				}
 			}
 
-			// 개별 볼륨에 _masterVolume 곱해서 최종 볼륨 설정
-			sound._channel->setVolume(sound.volume * _masterVolume);
-			sound._channel->setPitch(sound.pitch);
+			++i;
+			continue;
 		}
-		else
-		{
-			// 이미 재생 중인 경우 볼륨만 업데이트
-			FMOD_RESULT result = _fmodSystem->playSound(_soundMap[sound.path], nullptr, false, &sound._channel);
-			if (result != FMOD_OK)
-				return;
 
-			sound._channel->setVolume(sound.volume * _masterVolume);
+		// 재생이 끝났거나 더 높은 우선순위에 밀려 정지된 보이스
+		if (sound)
+		{
+			sound->isPlaying = false;
+			sound->_channel = nullptr;
 		}
+
+		_activeVoices[i] = _activeVoices.back();
+		_activeVoices.pop_back();
 	}
-	else if (!sound.isPlaying && isCurrentlyPlaying)
+}
+
+void core::SoundSystem::updatePendingVoices(entt::registry& registry)
+{
+	for (size_t i = 0; i < _pendingVoices.size();)
 	{
-		// 사운드가 재생 중인데 isPlaying이 false인 경우 정지
-		sound._channel->stop();
-		sound._channel = nullptr; // 채널 초기화
+		const entt::entity entity = _pendingVoices[i];
+		Sound* sound = registry.valid(entity) ? registry.try_get<Sound>(entity) : nullptr;
+		auto it = sound ? _soundMap.find(sound->path) : _soundMap.end();
+
+		FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+		if (it != _soundMap.end())
+			it->second->getOpenState(&state, nullptr, nullptr, nullptr);
+
+		// 아직 로드 중
+		if (state == FMOD_OPENSTATE_LOADING || state == FMOD_OPENSTATE_CONNECTING || state == FMOD_OPENSTATE_BUFFERING)
+		{
+			++i;
+			continue;
+		}
+
+		_pendingVoices[i] = _pendingVoices.back();
+		_pendingVoices.pop_back();
+
+		// 로드 실패 (업데이트 중에는 다른 시스템과 동시에 실행될 수 있으므로 로그 없이 재생만 취소)
+		if (state == FMOD_OPENSTATE_ERROR)
+		{
+			if (sound)
+				sound->isPlaying = false;
+			continue;
+		}
+
+		if (sound->isPlaying)
+			updateSound(registry, entity);
 	}
+}
 
-	// 속성 업데이트 (사운드, 볼륨, 피치)
-	if (sound._channel && isCurrentlyPlaying)
+bool core::SoundSystem::playVoice(entt::registry& registry, entt::entity entity, Sound& sound, FMOD::Sound* fmodSound)
+{
+	// 일시정지 상태로 재생하여 속성을 모두 설정한 뒤 시작
+	FMOD::Channel* channel = nullptr;
+	if (_fmodSystem->playSound(fmodSound, nullptr, true, &channel) != FMOD_OK)
+		return false;
+
+	sound._channel = channel;
+
+	FMOD_MODE currentMode;
+	channel->getMode(&currentMode);
+	FMOD_MODE newMode = (currentMode & ~(FMOD_2D | FMOD_3D | FMOD_LOOP_OFF | FMOD_LOOP_NORMAL))
+		| (sound.is3D ? FMOD_3D : FMOD_2D) | (sound.isLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
+	if (currentMode != newMode)
+		channel->setMode(newMode);
+
+	// 3D 사운드일 경우 위치 설정
+	if (sound.is3D && registry.all_of<WorldTransform>(entity))
 	{
-		// 볼륨 업데이트
-		float currentVolume;
-		sound._channel->getVolume(&currentVolume);
-		float targetVolume = sound.volume * _masterVolume;
-		if (std::fabsf(currentVolume - targetVolume) > DBL_EPSILON)
-			sound._channel->setVolume(targetVolume);
+		auto& world = registry.get<WorldTransform>(entity);
+		FMOD_VECTOR pos = { world.position.x, world.position.y, world.position.z };
+		channel->set3DAttributes(&pos, nullptr);
+		channel->set3DMinMaxDistance(sound.minDistance, sound.maxDistance);
+	}
 
-		// 피치 업데이트
-		float currentPitch;
-		sound._channel->getPitch(&currentPitch);
-		if (std::fabsf(currentPitch - sound.pitch) > DBL_EPSILON)
-			sound._channel->setPitch(sound.pitch);
+	// 개별 볼륨에 _masterVolume 곱해서 최종 볼륨 설정
+	channel->setVolume(sound.volume * _masterVolume);
+	channel->setPitch(sound.pitch);
+	channel->setPriority(getVoicePriority(sound));
+	channel->setPaused(false);
 
-		// 감쇠 거리 업데이트
-		if (sound.is3D)
+	if (std::ranges::find(_activeVoices, entity) == _activeVoices.end())
+		_activeVoices.push_back(entity);
+
+	return true;
+}
+
+void core::SoundSystem::updateSound(entt::registry& registry, entt::entity entity)
+{
+	auto& sound = registry.get<Sound>(entity);
+
+	// 미리 로드되지 않은 사운드(런타임 생성 등)는 백그라운드에서 로드 후 재생
+	FMOD_RESULT result;
+	FMOD::Sound* fmodSound = loadSound(sound, result, true);
+
+	if (!fmodSound)
+		return;
+
+	if (!isReady(fmodSound))
+	{
+		if (sound.isPlaying && std::ranges::find(_pendingVoices, entity) == _pendingVoices.end())
+			_pendingVoices.push_back(entity);
+		return;
+	}
+
+	// 사운드 재생 여부 및 사운드 교체
+	bool isCurrentlyPlaying = false;
+	if (sound._channel)
+	{
+		FMOD::Sound* currentSound = nullptr;
+		sound._channel->getCurrentSound(&currentSound);
+		if (currentSound != fmodSound)
 		{
-			float min, max;
-			sound._channel->get3DMinMaxDistance(&min, &max);
-			if (std::fabs(min - sound.minDistance) + std::fabs(max - sound.maxDistance) > DBL_EPSILON)
-				sound._channel->set3DMinMaxDistance(sound.minDistance, sound.maxDistance);
+			sound._channel->stop();
+			sound._channel = nullptr;
 		}
+		else
+		{
+			sound._channel->isPlaying(&isCurrentlyPlaying);
+		}
+	}
 
-		// 모드 업데이트
-		FMOD_MODE currentMode;
-		sound._channel->getMode(&currentMode);
-		FMOD_MODE newMode = (sound.is3D ? FMOD_3D : FMOD_2D) | (sound.isLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
-		if (currentMode != newMode)
-			sound._channel->setMode(newMode);
+	// 재생 요청 처리 (이미 재생 중이어도 새로 재생)
+	if (sound.isPlaying)
+	{
+		playVoice(registry, entity, sound, fmodSound);
+	}
+	else if (isCurrentlyPlaying)
+	{
+		// 사운드가 재생 중인데 isPlaying이 false인 경우 정지
+		sound._channel->stop();
+		sound._channel = nullptr; // 채널 초기화
 	}
 }
 
@@ -271,11 +412,10 @@ void core::SoundSystem::startSystem(const OnStartSystem& event)
 	}
 
 	// 사운드 로드
+	preloadSounds(registry);
+
 	for (auto&& [entity, sound] : soundView.each())
 	{
-		if (FMOD_RESULT result; !loadSound(sound, result))
-			LOG_ERROR(*event.scene, "Loading Sound Error {} : {}, {}", entity, FMOD_ErrorString(result), sound.path);
-
 		updateSound(registry, entity);
 
 		if (sound.is3D && !registry.any_of<WorldTransform>(entity))
@@ -301,7 +441,16 @@ void core::SoundSystem::finishSystem(const OnFinishSystem& event)
 		}
 	}
 
+	_activeVoices.clear();
+	_pendingVoices.clear();
+
+	// 다음 씬 시작 시 다시 미리 로드
+	for (auto&& fmodSound : std::views::values(_soundMap))
+	{
+		fmodSound->release();
+	}
 	_soundMap.clear();
+	_soundMemory.clear();
 	event.scene->GetRegistry()->on_update<Sound>().disconnect(this);
 	event.scene->GetRegistry()->on_update<SoundListener>().disconnect(this);
 }
@@ -336,8 +485,10 @@ void core::SoundSystem::updateBGMState(const OnUpdateBGMState& event)
 			sound._channel->stop();
 			sound._channel = nullptr;
 		}
-
-		sound._channel->isPlaying(&isCurrentlyPlaying);
+		else
+		{
+			sound._channel->isPlaying(&isCurrentlyPlaying);
+		}
 	}
 
 	// 재생 요청 처리
@@ -352,6 +503,7 @@ void core::SoundSystem::updateBGMState(const OnUpdateBGMState& event)
 
 			sound._channel->setVolume(sound.volume);
 			sound._channel->setPitch(sound.pitch);
+			sound._channel->setPriority(BGM_PRIORITY);
 		}
 		// 사운드 다시 재생
 		else
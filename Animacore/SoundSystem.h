@@ -7,6 +7,9 @@
 namespace core
 {
 	struct Sound;
+	struct Rigidbody;
+	struct SoundListener;
+	struct WorldTransform;
 	struct OnSetVolume;
 	struct OnUpdateBGMState;
 
@@ -18,9 +21,23 @@ namespace core
 
         void operator()(Scene& scene, float tick) override;
 
-        FMOD::Sound* loadSound(const Sound& sound, FMOD_RESULT& result);
+        // nonBlocking 이면 백그라운드에서 로드 (준비되기 전까지 재생 불가)
+        FMOD::Sound* loadSound(const Sound& sound, FMOD_RESULT& result, bool nonBlocking = false);
 
     private:
+        // 파일 크기에 따른 로드 방식 (디코딩 / 압축 상태로 메모리 / 스트리밍)
+        static FMOD_MODE getLoadMode(const std::string& path);
+        static bool isReady(FMOD::Sound* fmodSound);
+        static int getVoicePriority(const Sound& sound);
+
+        // 씬에서 사용하는 사운드를 시작 시 미리 로드
+        void preloadSounds(entt::registry& registry);
+
+        // 재생 중인 보이스만 갱신
+        void updateVoices(entt::registry& registry);
+        void updatePendingVoices(entt::registry& registry);
+        bool playVoice(entt::registry& registry, entt::entity entity, Sound& sound, FMOD::Sound* fmodSound);
+
         void updateSound(entt::registry& registry, entt::entity entity);
         void updateListener(entt::registry& registry, entt::entity entity);
         void destroyListener(entt::registry& registry, entt::entity entity);
@@ -33,8 +50,16 @@ namespace core
 
         FMOD::System* _fmodSystem = nullptr;
         std::unordered_map<std::string, FMOD::Sound*> _soundMap;
+        // 팩에서 읽어 FMOD_OPENMEMORY 로 만든 사운드의 데이터 (_soundMap 과 함께 해제)
+        std::unordered_map<std::string, std::vector<char>> _soundMemory;
+
+        // 채널이 할당된 엔티티 / 비동기 로드가 끝나면 재생할 엔티티
+        std::vector<entt::entity> _activeVoices;
+        std::vector<entt::entity> _pendingVoices;
         entt::dispatcher* _dispatcher = nullptr;
         float _masterVolume = 1.f;
     };
 }
 DEFINE_SYSTEM_TRAITS(core::SoundSystem)
+DEFINE_SYSTEM_READS(core::SoundSystem, core::WorldTransform, core::SoundListener, core::Rigidbody)
+DEFINE_SYSTEM_WRITES(core::SoundSystem, core::Sound)
@@ -6,6 +6,7 @@ namespace core
 {
 	class Scene;
 	class Entity;
+	struct FramePacket;
 
 	class ISystem
 	{
@@ -92,6 +93,23 @@ namespace core
 	};
 
 
+	/*------------------------------
+		Frame Packet
+	------------------------------*/
+	// 렌더 단계 시스템이 함께 구현하면 업데이트와 렌더를 한 프레임 겹쳐 실행할 수 있음
+	class IFramePacketSystem
+	{
+	public:
+		virtual ~IFramePacketSystem() = default;
+
+		// 메인 스레드 : 업데이트 직후 렌더에 필요한 값만 패킷으로 복사 (렌더 스레드는 대기 중)
+		virtual void Extract(Scene& scene, Renderer& renderer, FramePacket& packet) = 0;
+
+		// 렌더 스레드 : 레지스트리에 접근하지 않고 패킷만으로 제출
+		virtual void Submit(const FramePacket& packet, Renderer& renderer) = 0;
+	};
+
+
 	/*------------------------------
 		Collision
 	------------------------------*/
@@ -0,0 +1,187 @@
+﻿#include "pch.h"
+#include "SystemScheduler.h"
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#include <chrono>
+
+core::SystemScheduler::SystemScheduler()
+	: _jobSystem(&GetJobSystem())
+{
+}
+
+void core::SystemScheduler::Build(SystemType phase, std::vector<SystemDesc> descs, entt::registry& registry)
+{
+	auto& graph = _graphs[phase];
+	graph.nodes.clear();
+	graph.nodes.resize(descs.size());
+	graph.timings.assign(descs.size(), {});
+	graph.parallelizable = false;
+
+	for (size_t i = 0; i < descs.size(); ++i)
+	{
+		graph.nodes[i].desc = std::move(descs[i]);
+
+		// 씬 교체 후에도 프로파일러 기록이 이름을 가리킬 수 있도록 고정
+		if (graph.nodes[i].desc.name)
+			graph.nodes[i].desc.name = Profiler::Get().Intern(graph.nodes[i].desc.name);
+
+		graph.timings[i].name = graph.nodes[i].desc.name;
+
+		// 워커에서 view 를 만들 때 풀이 추가되지 않도록 미리 생성
+		if (graph.nodes[i].desc.access.assure)
+			graph.nodes[i].desc.access.assure(registry);
+	}
+
+	// 충돌하는 쌍은 등록 순서대로 연결
+	for (size_t i = 0; i < graph.nodes.size(); ++i)
+	{
+		for (size_t j = i + 1; j < graph.nodes.size(); ++j)
+		{
+			if (graph.nodes[i].desc.access.Conflicts(graph.nodes[j].desc.access))
+			{
+				graph.nodes[i].successors.push_back(j);
+				++graph.nodes[j].predecessorCount;
+			}
+			else
+			{
+				graph.parallelizable = true;
+			}
+		}
+	}
+}
+
+void core::SystemScheduler::Run(SystemType phase, const std::function<void(size_t)>& invoke)
+{
+	auto it = _graphs.find(phase);
+	if (it == _graphs.end() || it->second.nodes.empty())
+		return;
+
+	if (_parallel && it->second.parallelizable && _jobSystem->GetWorkerCount() > 0)
+		runParallel(it->second, invoke);
+	else
+		runSerial(it->second, invoke);
+}
+
+const std::vector<core::SystemTiming>& core::SystemScheduler::GetTimings(SystemType phase) const
+{
+	static const std::vector<SystemTiming> empty;
+
+	auto it = _graphs.find(phase);
+	return it != _graphs.end() ? it->second.timings : empty;
+}
+
+void core::SystemScheduler::ResetTimings()
+{
+	for (auto& graph : _graphs | std::views::values)
+	{
+		for (auto& timing : graph.timings)
+			timing.milliseconds = 0.f;
+	}
+}
+
+void core::SystemScheduler::runSerial(Graph& graph, const std::function<void(size_t)>& invoke)
+{
+	for (size_t i = 0; i < graph.nodes.size(); ++i)
+		runNode(graph, i, invoke);
+}
+
+void core::SystemScheduler::runParallel(Graph& graph, const std::function<void(size_t)>& invoke)
+{
+	const size_t nodeCount = graph.nodes.size();
+
+	std::vector<std::atomic<uint32_t>> remaining(nodeCount);
+	for (size_t i = 0; i < nodeCount; ++i)
+		remaining[i].store(graph.nodes[i].predecessorCount, std::memory_order_relaxed);
+
+	std::atomic<size_t> unfinished = nodeCount;
+
+	// 메인 스레드 전용 시스템은 준비되면 이 목록에 넣고 메인 스레드가 꺼내 실행
+	std::mutex mainThreadMutex;
+	std::vector<size_t> mainThreadReady;
+
+	JobCounter counter;
+	std::function<void(size_t)> schedule;
+
+	auto complete = [&](size_t index)
+		{
+			for (size_t successor : graph.nodes[index].successors)
+			{
+				if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+					schedule(successor);
+			}
+
+			unfinished.fetch_sub(1, std::memory_order_release);
+		};
+
+	schedule = [&](size_t index)
+		{
+			// 선언이 없는 시스템도 메인 스레드에서 (스레드 종속 API, PhysX fetchResults 대기 등)
+			const auto& access = graph.nodes[index].desc.access;
+
+			if (access.mainThread || access.exclusive)
+			{
+				std::lock_guard lock(mainThreadMutex);
+				mainThreadReady.push_back(index);
+				return;
+			}
+
+			_jobSystem->Run(counter, [&, index]
+				{
+					runNode(graph, index, invoke);
+					complete(index);
+				});
+		};
+
+	for (size_t i = 0; i < nodeCount; ++i)
+	{
+		if (graph.nodes[i].predecessorCount == 0)
+			schedule(i);
+	}
+
+	// 메인 스레드도 대기하는 동안 작업을 처리
+	while (unfinished.load(std::memory_order_acquire) > 0)
+	{
+		size_t index = SIZE_MAX;
+
+		{
+			std::lock_guard lock(mainThreadMutex);
+
+			if (!mainThreadReady.empty())
+			{
+				index = mainThreadReady.back();
+				mainThreadReady.pop_back();
+			}
+		}
+
+		if (index != SIZE_MAX)
+		{
+			runNode(graph, index, invoke);
+			complete(index);
+		}
+		else if (!_jobSystem->TryRunOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// 완료 처리 이후 작업 종료까지 대기 (지역 변수 참조 보호)
+	_jobSystem->Wait(counter);
+}
+
+void core::SystemScheduler::runNode(Graph& graph, size_t index, const std::function<void(size_t)>& invoke)
+{
+	PROFILE_SCOPE(graph.nodes[index].desc.name);
+
+	const auto start = std::chrono::steady_clock::now();
+
+	invoke(index);
+
+	const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	// FixedUpdate 는 한 프레임에 여러 번 돌 수 있으므로 누적
+	auto& timing = graph.timings[index];
+	timing.milliseconds += elapsed.count();
+	timing.workerIndex = _jobSystem->GetCurrentWorkerIndex();
+}
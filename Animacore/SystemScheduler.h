@@ -0,0 +1,67 @@
+﻿#pragma once
+#include "SystemTraits.h"
+
+namespace core
+{
+	class JobSystem;
+
+	struct SystemTiming
+	{
+		const char* name = nullptr;
+		float milliseconds = 0.f;
+		int workerIndex = -1;		// 실행한 워커 (-1 : 메인 스레드)
+	};
+
+	/// \brief
+	/// \n 단계(PreUpdate, Update, ...)별 시스템 실행 그래프
+	///	\n 같은 단계에서 접근이 충돌하는 시스템은 등록 순서대로 간선을 만들고 (결과가 직렬 실행과 같음)
+	///	\n 충돌하지 않는 시스템은 작업 스레드 풀에서 동시에 실행 (선언이 없는 시스템은 메인 스레드에서)
+	///	\n 직렬 모드에서는 등록 순서대로 메인 스레드에서 실행 (디버깅용)
+	class SystemScheduler
+	{
+	public:
+		struct SystemDesc
+		{
+			const char* name = nullptr;
+			SystemAccess access;
+		};
+
+		SystemScheduler();
+
+		// 단계 그래프 재구성 (descs 의 순서 = 등록 순서 = 실행 함수의 인덱스)
+		void Build(SystemType phase, std::vector<SystemDesc> descs, entt::registry& registry);
+
+		// 그래프 순서대로 실행, invoke(index) 가 해당 시스템을 호출
+		void Run(SystemType phase, const std::function<void(size_t)>& invoke);
+
+		void SetParallel(bool parallel) { _parallel = parallel; }
+		bool IsParallel() const { return _parallel; }
+
+		// 마지막 실행의 시스템별 시간 (FixedUpdate 는 프레임 내 누적)
+		const std::vector<SystemTiming>& GetTimings(SystemType phase) const;
+		void ResetTimings();
+
+	private:
+		struct Node
+		{
+			SystemDesc desc;
+			std::vector<size_t> successors;
+			uint32_t predecessorCount = 0;
+		};
+
+		struct Graph
+		{
+			std::vector<Node> nodes;
+			std::vector<SystemTiming> timings;
+			bool parallelizable = false;	// 동시에 실행 가능한 시스템이 하나라도 있는지
+		};
+
+		void runSerial(Graph& graph, const std::function<void(size_t)>& invoke);
+		void runParallel(Graph& graph, const std::function<void(size_t)>& invoke);
+		void runNode(Graph& graph, size_t index, const std::function<void(size_t)>& invoke);
+
+		std::unordered_map<SystemType, Graph> _graphs;
+		JobSystem* _jobSystem = nullptr;
+		bool _parallel = true;
+	};
+}
@@ -7,10 +7,47 @@
         static constexpr auto name = #SystemClass; \
     };
 
+// 시스템이 읽고 쓰는 컴포넌트(및 core::access 자원) 선언
+// registry.ctx() 의 값은 컴포넌트가 아니므로 core::access::Context<T> 로 선언
+// 선언이 없는 시스템은 다른 모든 시스템과 충돌하는 것으로 보고 등록 순서대로 단독 실행됨
+// registry.patch / dispatcher.trigger 로 실행되는 다른 시스템의 콜백이 접근하는 것도 포함해야 함
+#define DEFINE_SYSTEM_READS(SystemClass, ...) \
+    template<> \
+    struct SystemReads<SystemClass> \
+    { \
+        using type = core::TypeList<__VA_ARGS__>; \
+    };
+
+#define DEFINE_SYSTEM_WRITES(SystemClass, ...) \
+    template<> \
+    struct SystemWrites<SystemClass> \
+    { \
+        using type = core::TypeList<__VA_ARGS__>; \
+    };
+
 namespace core
 {
 	class ISystem;
 
+	template <typename... Ts>
+	struct TypeList {};
+
+	// 컴포넌트가 아닌 공유 자원 (읽기/쓰기 선언에 컴포넌트와 같이 사용)
+	namespace access
+	{
+		struct Tag {};
+
+		struct MainThread : Tag {};	// 메인 스레드에서만 실행 (Win32 입력, 포커스 등)
+		struct Structure : Tag {};	// 엔티티/컴포넌트 생성, 삭제 (Scene::DestroyEntity 포함)
+		struct Dispatcher : Tag {};	// 이벤트 trigger/enqueue, 로그
+		struct Physics : Tag {};	// PhysicsScene
+		struct Renderer : Tag {};	// Renderer (렌더 단계 시스템은 자동으로 포함)
+
+		// registry.ctx() 의 T (컴포넌트 풀을 만들지 않고 같은 T 를 선언한 시스템끼리만 충돌)
+		template <typename T>
+		struct Context : Tag {};
+	}
+
 	enum class SystemType
 	{
 		None,
@@ -28,8 +65,107 @@ namespace core
 template <typename T>
 struct SystemTraits;
 
+template <typename T>
+struct SystemReads
+{
+	using type = void;
+};
+
+template <typename T>
+struct SystemWrites
+{
+	using type = void;
+};
+
 template <typename T>
 concept HasSystemTraits = requires
 {
 	{ SystemTraits<T>::name } -> std::convertible_to<const char*>;
-}&& std::is_base_of_v<core::ISystem, T>;
\ No newline at end of file
+}&& std::is_base_of_v<core::ISystem, T>;
+
+namespace core
+{
+	// 스케줄러가 사용하는 런타임 접근 정보
+	struct SystemAccess
+	{
+		bool exclusive = true;		// 선언 없음 : 모든 시스템과 충돌
+		bool mainThread = false;
+		std::vector<entt::id_type> reads;
+		std::vector<entt::id_type> writes;
+
+		// 병렬 실행 전에 메인 스레드에서 컴포넌트 풀을 미리 생성 (view 생성 시 풀 추가 경합 방지)
+		void(*assure)(entt::registry&) = nullptr;
+
+		bool Conflicts(const SystemAccess& other) const
+		{
+			if (exclusive || other.exclusive)
+				return true;
+
+			auto intersects = [](const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs)
+				{
+					return std::ranges::any_of(lhs, [&rhs](entt::id_type id) { return std::ranges::find(rhs, id) != rhs.end(); });
+				};
+
+			return intersects(writes, other.writes) || intersects(writes, other.reads) || intersects(reads, other.writes);
+		}
+	};
+
+	namespace detail
+	{
+		template <typename... Ts>
+		void appendAccess(TypeList<Ts...>, SystemAccess& access, std::vector<entt::id_type>& ids)
+		{
+			(([&]
+				{
+					if constexpr (std::is_same_v<Ts, access::MainThread>)
+						access.mainThread = true;
+					else
+						ids.push_back(entt::type_hash<Ts>::value());
+				}()), ...);
+		}
+
+		template <typename... Ts>
+		void assureStorage(entt::registry& registry, TypeList<Ts...>)
+		{
+			(([&]
+				{
+					if constexpr (!std::is_base_of_v<access::Tag, Ts>)
+						registry.storage<Ts>();
+				}()), ...);
+		}
+
+		template <typename List>
+		void assureStorage(entt::registry& registry)
+		{
+			if constexpr (!std::is_void_v<List>)
+				assureStorage(registry, List{});
+		}
+	}
+
+	template <typename T>
+	SystemAccess MakeSystemAccess()
+	{
+		using Reads = typename SystemReads<T>::type;
+		using Writes = typename SystemWrites<T>::type;
+
+		SystemAccess access;
+
+		if constexpr (std::is_void_v<Reads> && std::is_void_v<Writes>)
+			return access;
+
+		access.exclusive = false;
+
+		if constexpr (!std::is_void_v<Reads>)
+			detail::appendAccess(Reads{}, access, access.reads);
+		if constexpr (!std::is_void_v<Writes>)
+			detail::appendAccess(Writes{}, access, access.writes);
+
+		access.assure = [](entt::registry& registry)
+			{
+				detail::assureStorage<Reads>(registry);
+				detail::assureStorage<Writes>(registry);
+			};
+
+		return access;
+	}
+}
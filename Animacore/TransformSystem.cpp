@@ -5,13 +5,18 @@
 #include "CoreComponents.h"
 #include "CorePhysicsComponents.h"
 #include "CoreSystemEvents.h"
+#include "FrameAllocator.h"
 
 core::TransformSystem::TransformSystem(Scene& scene)
 	: ISystem(scene)
 {
 	_dispatcher = scene.GetDispatcher();
 	_dispatcher->sink<OnCreateEntity>().connect<&TransformSystem::createEntity>(this);
-	_dispatcher->sink<OnUpdateTransform>().connect<&TransformSystem::updateWorldByPhysics>(this);
+	_dispatcher->sink<OnUpdateTransforms>().connect<&TransformSystem::updateWorlds>(this);
+
+	_events = scene.GetEventBus();
+	_events->Sink<OnUpdateTransform>().connect<&TransformSystem::updateWorldsByPhysics>(this);
+	_events->Sink<OnUpdateLocalTransform>().connect<&TransformSystem::updateLocals>(this);
 
 	_registry = scene.GetRegistry();
 	_registry->on_update<LocalTransform>().connect<&TransformSystem::updateLocal>(this);
@@ -21,6 +26,7 @@ core::TransformSystem::TransformSystem(Scene& scene)
 core::TransformSystem::~TransformSystem()
 {
 	_dispatcher->disconnect(this);
+	_events->Disconnect(this);
 	_registry->on_update<LocalTransform>().disconnect(this);
 	_registry->on_update<WorldTransform>().disconnect(this);
 }
@@ -31,21 +37,23 @@ void core::TransformSystem::operator()(Scene& scene, float tick)
 	auto& registry = *scene.GetRegistry();
 	auto group = registry.group<LocalTransform, WorldTransform>();
 
+	// 너비 우선 순회용 (최상위 엔티티마다 비우고 재사용)
+	FrameVector<entt::entity> queue;
+
 	// 최상위 엔티티의 matrix 업데이트
-	group.each([this, &registry, &group](entt::entity entity, LocalTransform& local, WorldTransform& world)
+	group.each([this, &registry, &group, &queue](entt::entity entity, LocalTransform& local, WorldTransform& world)
 		{
 			// 부모가 없거나 최상위 엔티티인 경우에만 처리
 			auto parent = registry.try_get<Relationship>(entity);
 
 			if (!parent || parent->parent == entt::null || !registry.any_of<LocalTransform>(parent->parent))
 			{
-				std::queue<entt::entity> queue;
-				queue.push(entity);
+				queue.clear();
+				queue.push_back(entity);
 
-				while (!queue.empty())
+				for (size_t front = 0; front < queue.size(); ++front)
 				{
-					entt::entity current = queue.front();
-					queue.pop();
+					entt::entity current = queue[front];
 
 					// LocalTransform과 WorldTransform을 가진 현재 엔티티의 트랜스폼 업데이트
 					updateTransform(registry, current);
@@ -57,7 +65,7 @@ void core::TransformSystem::operator()(Scene& scene, float tick)
 						for (auto child : relationship.children)
 						{
 							if (group.contains(child))
-								queue.push(child);
+								queue.push_back(child);
 						}
 					}
 				}
@@ -69,6 +77,8 @@ void core::TransformSystem::createEntity(const OnCreateEntity& event)
 {
 	auto& registry = *event.scene->GetRegistry();
 
+	FrameVector<entt::entity> queue;
+
 	for (auto entity : event.entities)
 	{
 		if (!registry.all_of<LocalTransform, WorldTransform>(entity))
@@ -78,13 +88,12 @@ void core::TransformSystem::createEntity(const OnCreateEntity& event)
 		updateTransform(registry, entity);
 
 		// 최상위 엔티티의 matrix 업데이트
-		std::queue<entt::entity> queue;
-		queue.push(entity);
+		queue.clear();
+		queue.push_back(entity);
 
-		while (!queue.empty())
+		for (size_t front = 0; front < queue.size(); ++front)
 		{
-			entt::entity current = queue.front();
-			queue.pop();
+			entt::entity current = queue[front];
 
 			if (!registry.all_of<LocalTransform, WorldTransform>(current))
 				continue;
@@ -96,7 +105,7 @@ void core::TransformSystem::createEntity(const OnCreateEntity& event)
 				const auto& relationship = registry.get<Relationship>(current);
 				for (auto child : relationship.children)
 				{
-					queue.push(child);
+					queue.push_back(child);
 				}
 			}
 		}
@@ -143,9 +152,23 @@ void core::TransformSystem::updateTransform(entt::registry& registry, entt::enti
 	}
 }
 
-void core::TransformSystem::updateWorldByPhysics(const OnUpdateTransform& event)
+void core::TransformSystem::updateWorldsByPhysics(std::span<const OnUpdateTransform> events)
+{
+	for (const auto& event : events)
+		updateWorld(*event.registry, event.entity);
+}
+
+void core::TransformSystem::updateLocals(std::span<const OnUpdateLocalTransform> events)
 {
-	updateWorld(*event.registry, event.entity); 
+	// 애니메이터마다 한 번 patch (LocalTransform 을 구독하는 다른 시스템에도 전달)
+	for (const auto& event : events)
+		event.registry->patch<LocalTransform>(event.entity);
+}
+
+void core::TransformSystem::updateWorlds(const OnUpdateTransforms& event)
+{
+	for (auto entity : event.entities)
+		updateWorld(*event.registry, entity);
 }
 
 void core::TransformSystem::updateWorld(entt::registry& registry, entt::entity entity)
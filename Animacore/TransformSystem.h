@@ -7,7 +7,10 @@ namespace core
 {
 	struct OnStartSystem;
 	struct OnCreateEntity;
+	struct OnUpdateTransform;
+	struct OnUpdateLocalTransform;
 	class Scene;
+	class EventBus;
 
 	class TransformSystem : public ISystem, public IUpdateSystem
 	{
@@ -23,13 +26,16 @@ namespace core
 
 	private:
 		void createEntity(const OnCreateEntity& event);
-		void updateWorldByPhysics(const OnUpdateTransform& event);
+		void updateWorldsByPhysics(std::span<const OnUpdateTransform> events);
+		void updateLocals(std::span<const OnUpdateLocalTransform> events);
+		void updateWorlds(const OnUpdateTransforms& event);
 
 		void updateTransform(entt::registry& registry, entt::entity entity);
 		void updateLocal(entt::registry& registry, entt::entity entity);
 		void updateWorld(entt::registry& registry, entt::entity entity);
 
 		entt::dispatcher* _dispatcher = nullptr;
+		EventBus* _events = nullptr;
 		entt::registry* _registry = nullptr;
 	};
 }
@@ -9,6 +9,7 @@
 #include <any>
 #include <map>
 #include <list>
+#include <span>
 #include <array>
 #include <mutex>
 #include <queue>
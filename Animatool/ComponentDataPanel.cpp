@@ -7,6 +7,7 @@
 #include <Animacore/AnimatorSystem.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
+#include <Animacore/AssetResolver.h>
 #include <Animacore/CoreTagsAndLayers.h>
 #include <Animacore/CorePhysicsComponents.h>
 #include <midnight_cleanup/McComponents.h>
@@ -127,7 +128,8 @@ void tool::ComponentDataPanel::RenderPanel(float deltaTime)
 							if (oldRenderer.meshString != newRenderer.meshString)
 							{
 								selected.meshString = newRenderer.meshString;
-								selected.mesh = _renderer->GetMesh(selected.meshString);
+								selected.mesh = nullptr;
+								core::AssetResolver::ResolveMesh(*_renderer, selected);
 							}
 
 							bool isMaterialChanged = false;
@@ -152,16 +154,9 @@ void tool::ComponentDataPanel::RenderPanel(float deltaTime)
 
 							if (isMaterialChanged)
 							{
-								auto size = newRenderer.materialStrings.size();
+								selected.materialStrings = newRenderer.materialStrings;
 								selected.materials.clear();
-								selected.materialStrings.clear();
-								selected.materials.reserve(size);
-
-								for (auto iter = newRenderer.materialStrings.begin(); iter != newRenderer.materialStrings.end(); ++iter)
-								{
-									selected.materials.push_back(_renderer->GetMaterial(*iter));
-									selected.materialStrings.push_back(*iter);
-								}
+								core::AssetResolver::ResolveMaterials(*_renderer, selected);
 
 							}
 
@@ -193,7 +188,7 @@ void tool::ComponentDataPanel::RenderPanel(float deltaTime)
 						for (auto entity : _selectedEntities)
 						{
 							auto&& ui = core::Entity{ entity, *ToolProcess::scene->GetRegistry() }.Get<core::UICommon>();
-							ui.texture = _renderer->GetUITexture(ui.textureString);
+							core::AssetResolver::ResolveUITexture(*_renderer, ui);
 							_dispatcher->trigger<OnToolModifyRenderer>({ entity });
 						}
 					}
@@ -227,7 +222,8 @@ void tool::ComponentDataPanel::RenderPanel(float deltaTime)
 						{
 							auto&& decal = core::Entity{ entity, *ToolProcess::scene->GetRegistry() }.Get<core::Decal>();
 
-							decal.material = _renderer->GetMaterial(decal.materialString);
+							decal.material = nullptr;
+							core::AssetResolver::ResolveMaterial(*_renderer, decal);
 
 							_dispatcher->trigger<OnToolModifyRenderer>({ entity });
 						}
@@ -977,7 +973,7 @@ void tool::ComponentDataPanel::renderMaterials(const entt::meta_data& data, entt
 {
 	if (ImGui::TreeNode("Materials"))
 	{
-		auto val = data.get(entt::meta_handle{ instance }).cast<std::list<std::string>>();
+		auto val = data.get(entt::meta_handle{ instance }).cast<std::vector<std::string>>();
 
 		if (val.size() == 0)
 		{
@@ -116,6 +116,10 @@ void tool::MenuBar::renderMenu()
 			{
 				_dispatcher->enqueue<OnToolRequestAddPanel>(PanelType::Animator);
 			}
+			if (ImGui::MenuItem("Profiler"))
+			{
+				_dispatcher->enqueue<OnToolRequestAddPanel>(PanelType::Profiler);
+			}
 			ImGui::EndMenu();
 		}
 
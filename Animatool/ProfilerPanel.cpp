@@ -0,0 +1,236 @@
+﻿#include "pch.h"
+#include "ProfilerPanel.h"
+
+#include "ToolProcess.h"
+#include "ToolEvents.h"
+
+#include <Animacore/Scene.h>
+#include <Animavision/Renderer.h>
+
+namespace
+{
+	constexpr const char* TRACE_PATH = "./profile.json";
+
+	float toMegabytes(uint64_t bytes)
+	{
+		return static_cast<float>(bytes) / (1024.f * 1024.f);
+	}
+
+	// 같은 이름은 항상 같은 색
+	ImU32 zoneColor(std::string_view name)
+	{
+		const size_t hash = std::hash<std::string_view>{}(name);
+		const float hue = static_cast<float>(hash % 360) / 360.f;
+
+		return ImColor::HSV(hue, 0.5f, 0.75f);
+	}
+}
+
+tool::ProfilerPanel::ProfilerPanel(entt::dispatcher& dispatcher, Renderer* renderer)
+	: Panel(dispatcher)
+	, _renderer(renderer)
+{
+}
+
+void tool::ProfilerPanel::RenderPanel(float deltaTime)
+{
+	auto& profiler = core::Profiler::Get();
+
+	if (ImGui::Begin("Profiler", &_isOpen))
+	{
+		bool isEnabled = profiler.IsEnabled();
+		if (ImGui::Checkbox("Capture", &isEnabled))
+			profiler.SetEnabled(isEnabled);
+
+		ImGui::SameLine();
+		ImGui::Checkbox("Pause", &_isPaused);
+
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(150.f);
+		ImGui::SliderFloat("Zoom", &_zoom, 1.f, 20.f, "%.1fx");
+
+		ImGui::SameLine();
+		if (ImGui::Button("Export Chrome Trace"))
+		{
+			if (profiler.ExportChromeTrace(TRACE_PATH))
+				LOG_INFO(*ToolProcess::scene, "Profiler trace saved : {}", TRACE_PATH);
+			else
+				LOG_ERROR(*ToolProcess::scene, "Failed to save profiler trace : {}", TRACE_PATH);
+		}
+
+		if (!_isPaused)
+			capture();
+
+		const double frameMs = static_cast<double>(_frame.second - _frame.first) / 1'000'000.0;
+		ImGui::Text("Frame : %.3f ms", frameMs);
+
+		ImGui::Separator();
+		renderTimeline();
+
+		ImGui::Separator();
+		renderSummary();
+
+		ImGui::Separator();
+		renderTextureStreaming();
+	}
+	ImGui::End();
+
+	if (!_isOpen)
+	{
+		_dispatcher->enqueue<OnToolRemovePanel>(PanelType::Profiler);
+	}
+}
+
+void tool::ProfilerPanel::capture()
+{
+	auto& profiler = core::Profiler::Get();
+
+	const auto frame = profiler.GetLastFrame();
+	if (frame.second <= frame.first)
+		return;
+
+	_frame = frame;
+	_threads = profiler.Collect(_frame.first);
+	_stats.clear();
+
+	// 다음 프레임에 시작한 구간 제외
+	for (auto& thread : _threads)
+		std::erase_if(thread.zones, [this](const core::ProfileZone& zone) { return zone.begin >= _frame.second; });
+
+	std::erase_if(_threads, [](const core::ProfileThread& thread) { return thread.zones.empty(); });
+
+	// 이름별 합계 (같은 이름이 중첩되면 중복 집계됨)
+	std::unordered_map<std::string_view, size_t> statIndices;
+
+	for (const auto& thread : _threads)
+	{
+		for (const auto& zone : thread.zones)
+		{
+			auto [it, isInserted] = statIndices.try_emplace(zone.name, _stats.size());
+			if (isInserted)
+				_stats.push_back({ zone.name });
+
+			auto& stat = _stats[it->second];
+			stat.milliseconds += static_cast<double>(zone.end - zone.begin) / 1'000'000.0;
+			++stat.calls;
+		}
+	}
+
+	std::ranges::sort(_stats, std::greater{}, &ZoneStat::milliseconds);
+}
+
+void tool::ProfilerPanel::renderTimeline()
+{
+	const float timelineHeight = ImGui::GetContentRegionAvail().y * 0.6f;
+
+	if (!ImGui::BeginChild("Timeline", ImVec2(0, timelineHeight), true, ImGuiWindowFlags_HorizontalScrollbar))
+	{
+		ImGui::EndChild();
+		return;
+	}
+
+	const double frameNs = static_cast<double>((std::max)(_frame.second - _frame.first, int64_t{ 1 }));
+	const float width = ImGui::GetContentRegionAvail().x * _zoom;
+	const float laneHeight = ImGui::GetTextLineHeight() + 4.f;
+
+	ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+	for (const auto& thread : _threads)
+	{
+		ImGui::TextUnformatted(thread.name.c_str());
+
+		uint32_t depthCount = 0;
+		for (const auto& zone : thread.zones)
+			depthCount = (std::max)(depthCount, zone.depth + 1);
+
+		const ImVec2 origin = ImGui::GetCursorScreenPos();
+
+		for (const auto& zone : thread.zones)
+		{
+			// 프레임 밖으로 걸친 구간은 잘라서 표시
+			const int64_t begin = (std::max)(zone.begin, _frame.first);
+			const int64_t end = (std::min)(zone.end, _frame.second);
+
+			const float x0 = origin.x + static_cast<float>(static_cast<double>(begin - _frame.first) / frameNs) * width;
+			const float x1 = (std::max)(origin.x + static_cast<float>(static_cast<double>(end - _frame.first) / frameNs) * width, x0 + 1.f);
+			const float y0 = origin.y + static_cast<float>(zone.depth) * laneHeight;
+			const float y1 = y0 + laneHeight - 1.f;
+
+			drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), zoneColor(zone.name));
+
+			// 이름이 들어갈 만큼 넓은 구간에만 이름 표시
+			if (x1 - x0 > ImGui::GetFontSize() * 2.f)
+			{
+				drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+				drawList->AddText(ImVec2(x0 + 2.f, y0 + 2.f), IM_COL32_WHITE, zone.name);
+				drawList->PopClipRect();
+			}
+
+			if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1)))
+				ImGui::SetTooltip("%s\n%.3f ms", zone.name, static_cast<double>(zone.end - zone.begin) / 1'000'000.0);
+		}
+
+		ImGui::Dummy(ImVec2(width, static_cast<float>(depthCount) * laneHeight));
+	}
+
+	ImGui::EndChild();
+}
+
+void tool::ProfilerPanel::renderSummary()
+{
+	const ImGuiTableFlags flags =
+		ImGuiTableFlags_Borders |
+		ImGuiTableFlags_RowBg |
+		ImGuiTableFlags_ScrollY;
+
+	if (ImGui::BeginTable("ProfilerSummary", 3, flags))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Zone");
+		ImGui::TableSetupColumn("Total (ms)");
+		ImGui::TableSetupColumn("Calls");
+		ImGui::TableHeadersRow();
+
+		for (const auto& stat : _stats)
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(stat.name.data(), stat.name.data() + stat.name.size());
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", stat.milliseconds);
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", stat.calls);
+		}
+
+		ImGui::EndTable();
+	}
+}
+
+void tool::ProfilerPanel::renderTextureStreaming()
+{
+	if (_renderer == nullptr || !ImGui::CollapsingHeader("Texture Streaming"))
+		return;
+
+	const TextureStreamingStats stats = _renderer->GetTextureStreamingStats();
+
+	// 스트리밍을 지원하지 않는 렌더러는 예산이 0
+	if (stats.budgetBytes == 0)
+	{
+		ImGui::TextDisabled("Not supported by this renderer");
+		return;
+	}
+
+	int budget = static_cast<int>(stats.budgetBytes >> 20);
+	ImGui::SetNextItemWidth(200.f);
+	if (ImGui::SliderInt("Budget (MB)", &budget, 16, 2048))
+		_renderer->SetTextureStreamingBudget(static_cast<uint64_t>(budget) << 20);
+
+	ImGui::Text("Resident : %.1f / %.1f MB (wanted %.1f MB)", toMegabytes(stats.residentBytes), toMegabytes(stats.budgetBytes), toMegabytes(stats.wantedBytes));
+	ImGui::Text("Pending : %u loads, %.1f MB", stats.pendingLoads, toMegabytes(stats.pendingBytes));
+	ImGui::Text("Textures : %u (starved %u)", stats.textures, stats.starvedTextures);
+	ImGui::Text("This frame : %u loads, %u evictions", stats.loads, stats.evictions);
+	ImGui::Text("Total : %.1f MB loaded, %.1f MB evicted", toMegabytes(stats.totalLoadedBytes), toMegabytes(stats.totalEvictedBytes));
+}
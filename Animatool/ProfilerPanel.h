@@ -0,0 +1,44 @@
+﻿#pragma once
+#include "Panel.h"
+
+#include <Animacore/Profiler.h>
+
+class Renderer;
+
+namespace tool
+{
+	/// \brief
+	/// \n 마지막 프레임의 스레드별 구간 타임라인과 이름별 합계
+	///	\n 구간은 core::Profiler 의 스레드 버퍼에서 매 프레임 복사 (일시정지하면 마지막 복사본 유지)
+	///	\n 텍스처 스트리밍 예산, 상주량, 읽기 대기도 함께 표시
+	class ProfilerPanel : public Panel
+	{
+	public:
+		ProfilerPanel(entt::dispatcher& dispatcher, Renderer* renderer);
+
+		void RenderPanel(float deltaTime) override;
+		PanelType GetType() override { return PanelType::Profiler; }
+
+	private:
+		struct ZoneStat
+		{
+			std::string_view name;
+			double milliseconds = 0.0;
+			uint32_t calls = 0;
+		};
+
+		void capture();
+		void renderTimeline();
+		void renderSummary();
+		void renderTextureStreaming();
+
+		Renderer* _renderer = nullptr;
+
+		std::vector<core::ProfileThread> _threads;
+		std::vector<ZoneStat> _stats;
+		std::pair<int64_t, int64_t> _frame;
+
+		bool _isPaused = false;
+		float _zoom = 1.f;
+	};
+}
@@ -8,8 +8,10 @@
 #include <Animacore/Scene.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
+#include <Animacore/AssetResolver.h>
 
 #include <Animavision/Mesh.h>
+#include <Animavision/MeshQuantizer.h>
 #include <Animavision/Shader.h>
 #include <Animavision/Material.h>
 #include <Animavision/Renderer.h>
@@ -582,11 +584,8 @@ void tool::Scene::RenderScene(float deltaTime, core::Scene& scene)
 			if (!(renderAttributes.flags & core::RenderAttributes::Flag::IsWater))
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 				continue;
-			}
 
 			if (meshRenderer.materials.size() <= 0)
 			{
@@ -596,11 +595,12 @@ void tool::Scene::RenderScene(float deltaTime, core::Scene& scene)
 					{
 						materialString = _defaultMaterialName;
 					}
-					meshRenderer.materials.push_back(_renderer->GetMaterial(materialString));
 				}
-				continue;
 			}
 
+			if (!core::AssetResolver::ResolveMaterials(*_renderer, meshRenderer))
+				continue;
+
 			auto& world = transform.matrix;
 			auto worldInvTranspose = world.Invert().Transpose();
 
@@ -809,11 +809,10 @@ void tool::Scene::RenderScene(float deltaTime, core::Scene& scene)
 			if (common.isOn == false)
 				continue;
 
+			core::AssetResolver::ResolveUITexture(*_renderer, common);
+
 			if (common.texture == nullptr)
-			{
-				common.texture = _renderer->GetUITexture(common.textureString);
 				continue;
-			}
 
 			Matrix worldMatrix = world.matrix;
 
@@ -876,11 +875,10 @@ void tool::Scene::RenderScene(float deltaTime, core::Scene& scene)
 			if (common.isOn == false)
 				continue;
 
+			core::AssetResolver::ResolveUITexture(*_renderer, common);
+
 			if (common.texture == nullptr)
-			{
-				common.texture = _renderer->GetUITexture(common.textureString);
 				continue;
-			}
 
 			if (ui.isCanvas)
 				bgs.emplace_back(entity);
@@ -1183,20 +1181,11 @@ void tool::Scene::RenderRaytracingScene(core::Scene& scene)
 		//ó ٸ
 		for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
 		{
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 				continue;
-			}
 
-			if (meshRenderer.materials.size() <= 0)
-			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(_renderer->GetMaterial(materialString));
-				}
+			if (!core::AssetResolver::ResolveMaterials(*_renderer, meshRenderer))
 				continue;
-			}
 
 			// 			if (meshRenderer.isSkinned)
 			// 			{
@@ -1225,20 +1214,11 @@ void tool::Scene::RenderRaytracingScene(core::Scene& scene)
 
 	for (auto&& [entity, transform, meshRenderer] : registry.view<core::WorldTransform, core::MeshRenderer>().each())
 	{
-		if (meshRenderer.mesh == nullptr)
-		{
-			meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+		if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 			continue;
-		}
 
-		if (meshRenderer.materials.size() <= 0)
-		{
-			for (auto&& materialString : meshRenderer.materialStrings)
-			{
-				meshRenderer.materials.push_back(_renderer->GetMaterial(materialString));
-			}
+		if (!core::AssetResolver::ResolveMaterials(*_renderer, meshRenderer))
 			continue;
-		}
 
 		_renderer->AddBottomLevelASInstance(meshRenderer.meshString, meshRenderer.hitDistribution, &transform.matrix.m[0][0]);
 	}
@@ -1343,7 +1323,11 @@ void tool::Scene::pickItemByCPU(int mouseXPos, int mouseYPos)
 		{
 			Matrix invWorld = transform.matrix.Invert();
 
-			for (UINT i = 0; i < meshRenderer.mesh->indices.size() / 3; ++i)
+			//    ޽õ ŷ  ֵ ġ 
+			std::vector<Vector3> positions;
+			MeshQuantizer::DecodePositions(*meshRenderer.mesh, positions);
+
+			for (UINT i = 0; i < meshRenderer.mesh->GetBaseIndexCount() / 3; ++i)
 			{
 				UINT i0 = meshRenderer.mesh->indices[i * 3 + 0];
 				UINT i1 = meshRenderer.mesh->indices[i * 3 + 1];
@@ -1353,9 +1337,9 @@ void tool::Scene::pickItemByCPU(int mouseXPos, int mouseYPos)
 				// 				Vector3 v1 = meshRenderer.mesh->vertices[i1];
 				// 				Vector3 v2 = meshRenderer.mesh->vertices[i2];
 
-				Vector3 v0 = Vector3::Transform(meshRenderer.mesh->vertices[i0], transform.matrix);
-				Vector3 v1 = Vector3::Transform(meshRenderer.mesh->vertices[i1], transform.matrix);
-				Vector3 v2 = Vector3::Transform(meshRenderer.mesh->vertices[i2], transform.matrix);
+				Vector3 v0 = Vector3::Transform(positions[i0], transform.matrix);
+				Vector3 v1 = Vector3::Transform(positions[i1], transform.matrix);
+				Vector3 v2 = Vector3::Transform(positions[i2], transform.matrix);
 
 				if (ray.Intersects(v0, v1, v2, t))
 				{
@@ -1956,11 +1940,8 @@ void tool::Scene::shadowPass(core::Scene& scene, const Matrix& view, const Matri
 				if (!meshRenderer.isOn || !meshRenderer.receiveShadow || distance >= 100.0f)
 					continue;
 
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+				if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 					continue;
-				}
 
 				if (!meshRenderer.isCulling)
 					_renderer->ApplyRenderState(BlendState::NO_BLEND, RasterizerState::SHADOW_CULL_NONE, DepthStencilState::DEPTH_ENABLED);
@@ -2024,11 +2005,8 @@ void tool::Scene::shadowPass(core::Scene& scene, const Matrix& view, const Matri
 				if (!meshRenderer.isOn || !meshRenderer.receiveShadow)
 					continue;
 
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+				if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 					continue;
-				}
 
 				auto&& meshPosition = transform.position;
 				auto&& lightPosition = _pointLights[pLightIndex].position;
@@ -2078,11 +2056,8 @@ void tool::Scene::shadowPass(core::Scene& scene, const Matrix& view, const Matri
 				if (!meshRenderer.isOn || !meshRenderer.receiveShadow)
 					continue;
 
-				if (meshRenderer.mesh == nullptr)
-				{
-					meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+				if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 					continue;
-				}
 
 				auto meshPosition = transform.position;
 				auto lightPosition = _spotLights[sLightIndex].position;
@@ -2151,11 +2126,8 @@ void tool::Scene::deferredGeometryPass(core::Scene& scene, const Matrix& view, c
 			if (!meshRenderer.isOn)
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 				continue;
-			}
 
 			auto* renderAttributes = registry.try_get<core::RenderAttributes>(entity);
 
@@ -2182,11 +2154,12 @@ void tool::Scene::deferredGeometryPass(core::Scene& scene, const Matrix& view, c
 					{
 						materialString = _defaultMaterialName;
 					}
-					meshRenderer.materials.push_back(_renderer->GetMaterial(materialString));
 				}
-				continue;
 			}
 
+			if (!core::AssetResolver::ResolveMaterials(*_renderer, meshRenderer))
+				continue;
+
 			auto& world = transform.matrix;
 			auto worldInvTranspose = world.Invert().Transpose();
 
@@ -2277,11 +2250,8 @@ void tool::Scene::oitPass(core::Scene& scene, const Matrix& view, const Matrix&
 				|| renderAttributes.flags & core::RenderAttributes::Flag::IsWater)
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = _renderer->GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(*_renderer, meshRenderer))
 				continue;
-			}
 
 			if (meshRenderer.materials.size() <= 0)
 			{
@@ -2291,11 +2261,12 @@ void tool::Scene::oitPass(core::Scene& scene, const Matrix& view, const Matrix&
 					{
 						materialString = _defaultMaterialName;
 					}
-					meshRenderer.materials.push_back(_renderer->GetMaterial(materialString));
 				}
-				continue;
 			}
 
+			if (!core::AssetResolver::ResolveMaterials(*_renderer, meshRenderer))
+				continue;
+
 			auto& world = transform.matrix;
 			auto worldInvTranspose = world.Invert().Transpose();
 
@@ -2374,14 +2345,8 @@ void tool::Scene::decalPass(core::Scene& scene, const Matrix& view, const Matrix
 
 		for (auto&& [entity, transform, decal] : registry.view<core::WorldTransform, core::Decal>().each())
 		{
-			if (decal.material == nullptr)
-			{
-				if (!decal.materialString.empty())
-				{
-					decal.material = _renderer->GetMaterial(decal.materialString);
-				}
+			if (!core::AssetResolver::ResolveMaterial(*_renderer, decal))
 				continue;
-			}
 
 			decal.material->SetTexture("gNormalTexture", _deferredTextures[DeferredSlot::Normal]);
 			decal.material->SetTexture("gDepthTexture", _deferredTextures[DeferredSlot::PositionW]);
@@ -23,6 +23,7 @@ namespace tool
 		Hierarchy,
 		MenuBar,
 		Console,
+		Profiler,
 	};
 
 	struct OnToolPlayScene {};
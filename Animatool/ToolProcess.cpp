@@ -8,6 +8,7 @@
 
 #include <Animacore/Timer.h>
 #include <Animacore/Scene.h>
+#include <Animacore/Profiler.h>
 #include <Animacore/AnimatorSystem.h>
 #include <Animacore/TransformSystem.h>
 #include <Animacore/CoreSystemEvents.h>
@@ -19,6 +20,7 @@
 #include "Hierarchy.h"
 #include "Inspector.h"
 #include "AnimatorPanel.h"
+#include "ProfilerPanel.h"
 #include "Animacore/CorePhysicsComponents.h"
 #include "Animacore/CoreTagsAndLayers.h"
 #include "Animavision/IModelParser.h"
@@ -35,6 +37,8 @@ extern "C" { __declspec(dllexport) extern const char* D3D12SDKPath = ".\\D3D12\\
 tool::ToolProcess::ToolProcess(const core::ProcessInfo& info)
 	: mc::McProcess(info)
 {
+	PROFILE_THREAD("Main");
+
 	// ImGui 초기화
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
@@ -91,19 +95,43 @@ tool::ToolProcess::ToolProcess(const core::ProcessInfo& info)
 	// 씬 이벤트 연결 (todo: 씬이 여러개가 된다면 분리 설정 필요)
 	scene->GetDispatcher()->sink<core::OnThrow>().connect<&ToolProcess::throwException>(this);
 
-	_renderer->LoadMeshesFromDrive("./Resources/Models");
+	{
+		PROFILE_SCOPE("LoadMeshesFromDrive");
+		_renderer->LoadMeshesFromDrive("./Resources/Models");
+	}
 	if (_renderer->IsRayTracing())
 	{
 		_renderer->InitializeTopLevelAS();
 	}
-	_renderer->LoadMaterialsFromDrive("./Resources");
-	_renderer->LoadShadersFromDrive("./Shaders");
-	_renderer->LoadAnimationClipsFromDrive("./Resources/Animations");
-	_renderer->LoadUITexturesFromDrive("./Resources/UI");
-	_renderer->LoadParticleTexturesFromDrive("./Resources/Particles");
-	_renderer->LoadFontsFromDrive("./Resources/Fonts");
+	{
+		PROFILE_SCOPE("LoadMaterialsFromDrive");
+		_renderer->LoadMaterialsFromDrive("./Resources");
+	}
+	{
+		PROFILE_SCOPE("LoadShadersFromDrive");
+		_renderer->LoadShadersFromDrive("./Shaders");
+	}
+	{
+		PROFILE_SCOPE("LoadAnimationClipsFromDrive");
+		_renderer->LoadAnimationClipsFromDrive("./Resources/Animations");
+	}
+	{
+		PROFILE_SCOPE("LoadUITexturesFromDrive");
+		_renderer->LoadUITexturesFromDrive("./Resources/UI");
+	}
+	{
+		PROFILE_SCOPE("LoadParticleTexturesFromDrive");
+		_renderer->LoadParticleTexturesFromDrive("./Resources/Particles");
+	}
+	{
+		PROFILE_SCOPE("LoadFontsFromDrive");
+		_renderer->LoadFontsFromDrive("./Resources/Fonts");
+	}
 
-	core::AnimatorSystem::controllerManager.LoadControllersFromDrive("./Resources", _renderer.get());
+	{
+		PROFILE_SCOPE("LoadControllersFromDrive");
+		core::AnimatorSystem::controllerManager.LoadControllersFromDrive("./Resources", _renderer.get());
+	}
 
 	// 패널 생성
 	_panels.emplace_back(new Project(_dispatcher, _renderer.get()));
@@ -184,6 +212,8 @@ void tool::ToolProcess::Loop()
 		}
 		else
 		{
+			PROFILE_FRAME();
+
 			timer.Update();
 			const auto tick = timer.GetTick();
 
@@ -434,6 +464,9 @@ void tool::ToolProcess::requestAddPanel(const tool::OnToolRequestAddPanel& event
 	case PanelType::Animator:
 		_panels.emplace_back(new AnimatorPanel(_dispatcher, _renderer.get()));
 		break;
+	case PanelType::Profiler:
+		_panels.emplace_back(new ProfilerPanel(_dispatcher, _renderer.get()));
+		break;
 	default:
 		break;
 	}
@@ -650,6 +683,8 @@ void tool::ToolProcess::processSnapEntities(const OnProcessSnapEntities& event)
 
 void tool::ToolProcess::renderGui(float deltaTime)
 {
+	PROFILE_FUNCTION();
+
 	ImGui::DockSpaceOverViewport();
 
 	for (auto panel : _panels)
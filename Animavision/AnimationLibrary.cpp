@@ -2,6 +2,7 @@
 #include "AnimationLibrary.h"
 #include "Mesh.h"
 #include "ModelLoader.h"
+#include "VirtualFileSystem.h"
 #include <fstream>
 
 void AnimationLibrary::LoadAnimationClipsFromFile(const std::string& path)
@@ -11,17 +12,19 @@ void AnimationLibrary::LoadAnimationClipsFromFile(const std::string& path)
 	if (filePath.extension() != ".fbx")
 		return;
 
+	if (!m_LoadedFiles.insert(AssetIndex::MakeKey(filePath)).second)
+		return;
+
+	m_Index.AddFile(path);
+
 	std::filesystem::path mcaPath = filePath;
 
 	mcaPath.replace_extension(".mca");
 
-	MCAFormat* mca = nullptr;
+	//  Ʈ   ĳ
+	MCAFormat* mca = loadAnimationClipsFromMCA(mcaPath.string());
 
-	if (std::filesystem::exists(mcaPath))
-	{
-		mca = loadAnimationClipsFromMCA(mcaPath.string());
-	}
-	else
+	if (!mca && std::filesystem::exists(filePath))
 	{
 		mca = loadAnimationClipsFromFBX(path);
 		if (mca)
@@ -36,6 +39,7 @@ void AnimationLibrary::LoadAnimationClipsFromFile(const std::string& path)
 		for (auto& animationClip : mca->animationClips)
 		{
 			m_AnimationClips[animationClip->name] = animationClip;
+			m_Index.Add(animationClip->name, path);
 		}
 
 		delete mca;
@@ -48,14 +52,11 @@ void AnimationLibrary::LoadAnimationClipsFromDirectory(const std::string& path)
 
 
 	std::filesystem::path directory(path);
-	if (!std::filesystem::exists(directory))
-		return;
 
-	for (const auto& entry : std::filesystem::directory_iterator(directory))
-	{
-		if (entry.is_regular_file())
-			LoadAnimationClipsFromFile(entry.path().string());
-	}
+	for (const auto& source : AssetIndex::ListSources(directory, ".mca", false))
+		LoadAnimationClipsFromFile(source);
+
+	m_Index.Save(directory / INDEX_FILE);
 
 	auto end = std::chrono::high_resolution_clock::now();
 
@@ -67,6 +68,42 @@ void AnimationLibrary::LoadAnimationClipsFromDirectory(const std::string& path)
 
 }
 
+void AnimationLibrary::IndexDirectory(const std::string& path)
+{
+	std::filesystem::path directory(path);
+
+	m_Index.Load(directory / INDEX_FILE);
+
+	//  Ŀ ߰ fbx (  )   о ̸ ˾Ƴ
+	bool isChanged = false;
+	for (const auto& source : AssetIndex::ListSources(directory, ".mca", false))
+	{
+		if (!m_Index.HasFile(source))
+		{
+			LoadAnimationClipsFromFile(source);
+			isChanged = true;
+		}
+	}
+
+	if (isChanged)
+		m_Index.Save(directory / INDEX_FILE);
+}
+
+bool AnimationLibrary::LoadAnimationClip(const std::string& name)
+{
+	if (m_AnimationClips.contains(name))
+		return true;
+
+	const std::string* source = m_Index.Find(name);
+	if (source == nullptr || m_LoadedFiles.contains(*source))
+		return false;
+
+	//  fbx  ٸ Ŭ Բ ö
+	LoadAnimationClipsFromFile(std::string(*source));
+
+	return m_AnimationClips.contains(name);
+}
+
 void AnimationLibrary::AddAnimationClip(std::shared_ptr<AnimationClip> animationClip)
 {
 	m_AnimationClips[animationClip->name] = animationClip;
@@ -83,7 +120,11 @@ std::shared_ptr<AnimationClip> AnimationLibrary::GetAnimationClip(const std::str
 
 MCAFormat* AnimationLibrary::loadAnimationClipsFromMCA(const std::string& path)
 {
-	std::ifstream is(path, std::ios::binary);
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+		return nullptr;
+
+	MemoryStream is(data);
 	cereal::BinaryInputArchive archive(is);
 
 	MCAFormat* mca = new MCAFormat;
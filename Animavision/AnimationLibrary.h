@@ -1,5 +1,7 @@
 #pragma once
 
+#include "AssetIndex.h"
+
 struct AnimationClip;
 
 class MCAFormat
@@ -18,11 +20,20 @@ public:
 class AnimationLibrary
 {
 public:
+	static constexpr const char* INDEX_FILE = "clips.index";	// Ŭ ̸ -> fbx (͸)
+
 	AnimationLibrary() = default;
 	~AnimationLibrary() = default;
 
+	// ̹   ٽ  
 	void LoadAnimationClipsFromFile(const std::string& path);
+	//    INDEX_FILE  
 	void LoadAnimationClipsFromDirectory(const std::string& path);
+
+	//  ε : INDEX_FILE   (ο   fbx  ٷ а  ), ͸ ϳ 
+	void IndexDirectory(const std::string& path);
+	// name  ִ fbx   (̹  true)
+	bool LoadAnimationClip(const std::string& name);
 	void AddAnimationClip(std::shared_ptr<AnimationClip> animationClip);
 
 	std::shared_ptr<AnimationClip> GetAnimationClip(const std::string& name);
@@ -35,5 +46,8 @@ private:
 
 private:
 	std::map<std::string, std::shared_ptr<AnimationClip>> m_AnimationClips;
+
+	AssetIndex m_Index;
+	robin_hood::unordered_set<std::string> m_LoadedFiles;	// AssetIndex::MakeKey
 };
 
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <robin_hood.h>
+
+/// ̸  εϴ   (Renderer::IndexAssetsFromDrive, LoadAsset)
+enum class AssetType : uint8_t
+{
+	Mesh,				// ޽ ̸
+	Material,			// Ƽ 
+	AnimationClip,		// Ŭ ̸
+	UITexture,			//  ̸
+	ParticleTexture,	//  ̸
+};
+
+/// ̸   ؽؼ    ȣ
+/// index  Ʈ  ִ  ٲ ʰ,  ̸  ٽ ε(ü)Ǹ generation  ö
+struct AssetHandle
+{
+	static constexpr uint32_t INVALID_INDEX = ~0u;
+
+	uint32_t index = INVALID_INDEX;
+	uint32_t generation = 0;
+
+	bool IsValid() const { return index != INVALID_INDEX; }
+	bool operator==(const AssetHandle& other) const = default;
+};
+
+/// ̸ -> ڵ (ؽ  ) ->  (迭 ε)
+///  ε  ̸ ڸ ϹǷ ߿ εǸ generation  ٲ ڵ     
+/// /ȭ  ̸ ,    ڵ ڵ鸸 
+template <typename T>
+class AssetRegistry
+{
+public:
+	AssetHandle Intern(const std::string& name)
+	{
+		auto [it, isInserted] = _indices.try_emplace(name, static_cast<uint32_t>(_slots.size()));
+		if (isInserted)
+			_slots.push_back({ name, nullptr, 0 });
+
+		return { it->second, _slots[it->second].generation };
+	}
+
+	//  ڸ  ʰ INVALID
+	AssetHandle Find(const std::string& name) const
+	{
+		auto it = _indices.find(name);
+		if (it == _indices.end())
+			return {};
+
+		return { it->second, _slots[it->second].generation };
+	}
+
+	// generation  ޶   ڸ ִ  (ü    )
+	std::shared_ptr<T> Get(AssetHandle handle) const
+	{
+		if (handle.index >= _slots.size())
+			return nullptr;
+
+		return _slots[handle.index].asset;
+	}
+
+	bool IsCurrent(AssetHandle handle) const
+	{
+		return handle.index < _slots.size() && _slots[handle.index].generation == handle.generation;
+	}
+
+	//  ڸ ֽ generation
+	AssetHandle Refresh(AssetHandle handle) const
+	{
+		if (handle.index >= _slots.size())
+			return {};
+
+		return { handle.index, _slots[handle.index].generation };
+	}
+
+	const std::string& GetName(AssetHandle handle) const
+	{
+		static const std::string empty;
+		if (handle.index >= _slots.size())
+			return empty;
+
+		return _slots[handle.index].name;
+	}
+
+	void Set(const std::string& name, std::shared_ptr<T> asset)
+	{
+		Slot& slot = _slots[Intern(name).index];
+		if (slot.asset == asset)
+			return;
+
+		slot.asset = std::move(asset);
+		++slot.generation;
+	}
+
+	void Remove(const std::string& name)
+	{
+		auto it = _indices.find(name);
+		if (it == _indices.end() || _slots[it->second].asset == nullptr)
+			return;
+
+		_slots[it->second].asset = nullptr;
+		++_slots[it->second].generation;
+	}
+
+	// ¸  ȣ  ( ִ ڵ  IsCurrent  false)
+	void Clear()
+	{
+		for (auto& slot : _slots)
+		{
+			if (slot.asset == nullptr)
+				continue;
+
+			slot.asset = nullptr;
+			++slot.generation;
+		}
+	}
+
+	uint32_t GetSize() const { return static_cast<uint32_t>(_slots.size()); }
+
+private:
+	struct Slot
+	{
+		std::string name;
+		std::shared_ptr<T> asset;
+		uint32_t generation = 0;
+	};
+
+	robin_hood::unordered_map<std::string, uint32_t> _indices;
+	std::vector<Slot> _slots;
+};
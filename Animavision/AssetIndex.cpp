@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "AssetIndex.h"
+#include "VirtualFileSystem.h"
+
+#include <fstream>
+#include <algorithm>
+
+bool AssetIndex::Load(const std::filesystem::path& path)
+{
+	Clear();
+
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+		return false;
+
+	MemoryStream is(data);
+	cereal::BinaryInputArchive archive(is);
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	archive(magic, version);
+
+	if (magic != MAGIC || version != VERSION)
+		return false;
+
+	std::vector<std::string> files;
+	std::vector<std::pair<std::string, std::string>> sources;
+	archive(files, sources);
+
+	for (auto& file : files)
+		_files.insert(std::move(file));
+
+	for (auto& [name, file] : sources)
+		_sources.emplace(std::move(name), std::move(file));
+
+	return true;
+}
+
+bool AssetIndex::Save(const std::filesystem::path& path) const
+{
+	std::vector<std::string> files(_files.begin(), _files.end());
+	std::vector<std::pair<std::string, std::string>> sources(_sources.begin(), _sources.end());
+
+	//   Ź  
+	std::ranges::sort(files);
+	std::ranges::sort(sources);
+
+	std::ofstream os(path, std::ios::binary);
+	if (!os.is_open())
+		return false;
+
+	{
+		cereal::BinaryOutputArchive archive(os);
+		archive(MAGIC, VERSION, files, sources);
+	}
+
+	return os.good();
+}
+
+void AssetIndex::AddFile(const std::string& file)
+{
+	_files.insert(MakeKey(file));
+}
+
+void AssetIndex::Add(const std::string& name, const std::string& file)
+{
+	std::string key = MakeKey(file);
+	_files.insert(key);
+	_sources[name] = std::move(key);
+}
+
+const std::string* AssetIndex::Find(const std::string& name) const
+{
+	auto it = _sources.find(name);
+	if (it == _sources.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+bool AssetIndex::HasFile(const std::string& file) const
+{
+	return _files.contains(MakeKey(file));
+}
+
+void AssetIndex::Clear()
+{
+	_sources.clear();
+	_files.clear();
+}
+
+std::string AssetIndex::MakeKey(const std::filesystem::path& path)
+{
+	return path.lexically_normal().generic_string();
+}
+
+std::vector<std::string> AssetIndex::ListSources(const std::filesystem::path& directory, const std::string& cacheExtension, bool isRecursive)
+{
+	std::vector<std::string> sources;
+	robin_hood::unordered_set<std::string> keys;
+
+	//  Ʈϸ   (ĳð   )
+	const auto files = VirtualFileSystem::List(directory, isRecursive);
+
+	for (const auto& file : files)
+	{
+		std::filesystem::path path = file;
+
+		if (path.extension() == cacheExtension)
+			path.replace_extension(".fbx");
+		else if (path.extension() != ".fbx")
+			continue;
+
+		// fbx  ĳð Բ   
+		if (keys.insert(MakeKey(path)).second)
+			sources.push_back(path.string());
+	}
+
+	return sources;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <robin_hood.h>
+
+///  ̸ ->   ִ   ( ε)
+/// ޽, ִϸ̼ Ŭó    ̸   ִ  ͸       ΰ
+///  ʹ  θ   ʿ ̸ ִ ϸ ε
+class AssetIndex
+{
+public:
+	static constexpr uint32_t MAGIC = 0x58444941;	// "AIDX"
+	static constexpr uint32_t VERSION = 1;
+
+	//  ų  ٸ  false
+	bool Load(const std::filesystem::path& path);
+	bool Save(const std::filesystem::path& path) const;
+
+	//  ϳ  ϵ AddFile  ؾ   Ϸ  
+	void AddFile(const std::string& file);
+	void Add(const std::string& name, const std::string& file);
+
+	//  nullptr
+	const std::string* Find(const std::string& name) const;
+	bool HasFile(const std::string& file) const;
+
+	void Clear();
+
+	// , "./" ̸   Ű
+	static std::string MakeKey(const std::filesystem::path& path);
+
+	// directory Ʒ (fbx)  ( Ʈ  , ƴϸ ũ)
+	// ѿ ĳø Ƿ cacheExtension ϸ ־  η 
+	static std::vector<std::string> ListSources(const std::filesystem::path& directory, const std::string& cacheExtension, bool isRecursive);
+
+private:
+	robin_hood::unordered_map<std::string, std::string> _sources;
+	robin_hood::unordered_set<std::string> _files;
+};
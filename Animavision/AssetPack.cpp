@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "AssetPack.h"
+
+#include "Lz4Codec.h"
+
+#include <algorithm>
+
+AssetPack::~AssetPack()
+{
+	Close();
+}
+
+bool AssetPack::Open(const std::filesystem::path& path)
+{
+	Close();
+
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	_file = file;
+
+	LARGE_INTEGER size = {};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(AssetPackHeader)))
+	{
+		Close();
+		return false;
+	}
+
+	_size = static_cast<uint64_t>(size.QuadPart);
+
+	_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (_mapping == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	_view = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (_view == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	AssetPackHeader header;
+	memcpy(&header, _view, sizeof(header));
+
+	const bool isValid = header.magic == MAGIC
+		&& header.version == VERSION
+		&& header.entriesOffset <= _size
+		&& header.entryCount <= (_size - header.entriesOffset) / sizeof(AssetPackEntry)
+		&& header.stringsOffset <= _size
+		&& header.stringsSize <= _size - header.stringsOffset;
+
+	if (!isValid)
+	{
+		Close();
+		return false;
+	}
+
+	_entries = reinterpret_cast<const AssetPackEntry*>(_view + header.entriesOffset);
+	_entryCount = header.entryCount;
+	_strings = reinterpret_cast<const char*>(_view + header.stringsOffset);
+
+	//   ׸  ջ 
+	for (const AssetPackEntry& entry : GetEntries())
+	{
+		if (entry.offset > _size || entry.storedSize > _size - entry.offset
+			|| static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > header.stringsSize)
+		{
+			Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AssetPack::Close()
+{
+	if (_view != nullptr)
+		UnmapViewOfFile(_view);
+	if (_mapping != nullptr)
+		CloseHandle(_mapping);
+	if (_file != nullptr)
+		CloseHandle(_file);
+
+	_file = nullptr;
+	_mapping = nullptr;
+	_view = nullptr;
+	_size = 0;
+	_entries = nullptr;
+	_entryCount = 0;
+	_strings = nullptr;
+}
+
+const AssetPackEntry* AssetPack::Find(std::string_view key) const
+{
+	const uint64_t hash = Hash(key);
+
+	const AssetPackEntry* const end = _entries + _entryCount;
+	const AssetPackEntry* it = std::lower_bound(_entries, end, hash, [](const AssetPackEntry& entry, uint64_t value) { return entry.hash < value; });
+
+	// ؽ 浹 η 
+	for (; it != end && it->hash == hash; ++it)
+	{
+		const std::string_view path = GetPath(*it);
+		if (path.size() == key.size() && std::ranges::equal(path, key, {}, [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); }))
+			return it;
+	}
+
+	return nullptr;
+}
+
+bool AssetPack::Read(const AssetPackEntry& entry, void* destination) const
+{
+	const uint8_t* source = _view + entry.offset;
+
+	switch (entry.compression)
+	{
+		case AssetCompression::None:
+			if (entry.storedSize != entry.size)
+				return false;
+
+			if (entry.size > 0)
+				memcpy(destination, source, entry.size);
+			return true;
+		case AssetCompression::LZ4:
+			return Lz4Codec::Decompress(source, entry.storedSize, destination, entry.size) == entry.size;
+		default:
+			return false;
+	}
+}
+
+const uint8_t* AssetPack::GetData(const AssetPackEntry& entry) const
+{
+	if (entry.compression != AssetCompression::None || entry.storedSize != entry.size)
+		return nullptr;
+
+	return _view + entry.offset;
+}
+
+std::string_view AssetPack::GetPath(const AssetPackEntry& entry) const
+{
+	return { _strings + entry.pathOffset, entry.pathLength };
+}
+
+std::string AssetPack::MakeKey(const std::filesystem::path& path)
+{
+	std::string key = path.lexically_normal().generic_string();
+	std::ranges::transform(key, key.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+	while (key.starts_with("./"))
+		key.erase(0, 2);
+
+	return key;
+}
+
+uint64_t AssetPack::Hash(std::string_view key)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (const char c : key)
+	{
+		hash ^= static_cast<uint8_t>(std::tolower(static_cast<unsigned char>(c)));
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
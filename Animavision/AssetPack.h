@@ -0,0 +1,86 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+#include <span>
+#include <string_view>
+
+enum class AssetCompression : uint32_t
+{
+	None,
+	LZ4,		// Lz4Codec  ϳ
+};
+
+///     (ALIGNMENT  0  ä)
+struct AssetPackHeader
+{
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint32_t entryCount = 0;
+	uint32_t reserved = 0;
+	uint64_t entriesOffset = 0;		// AssetPackEntry[entryCount], hash 
+	uint64_t stringsOffset = 0;		//  ҹڸ   (  )
+	uint64_t stringsSize = 0;
+};
+
+///  ׸ ϳ (  ϳ)
+struct AssetPackEntry
+{
+	uint64_t hash = 0;				// AssetPack::Hash(MakeKey())
+	uint64_t offset = 0;			// ALIGNMENT 
+	uint64_t storedSize = 0;		//   ũ
+	uint64_t size = 0;				//  ũ
+	uint32_t pathOffset = 0;		// ڿ ̺  ġ
+	uint32_t pathLength = 0;
+	AssetCompression compression = AssetCompression::None;
+	uint32_t reserved = 0;
+};
+
+///      б   (AssetPacker  )
+///  ü ޸ ϰ  ؽ  迭̶  ų ͸  ʰ  Ž ã
+/// ׸   ĵǾ ְ, ؼ ̵  ׸(̹   ) ״ 
+class ANIMAVISION_DLL AssetPack
+{
+public:
+	static constexpr uint32_t MAGIC = 0x4B504D41;	// "AMPK"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint64_t ALIGNMENT = 4096;
+
+	AssetPack() = default;
+	~AssetPack();
+
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	// , ,     false
+	bool Open(const std::filesystem::path& path);
+	void Close();
+
+	bool IsOpen() const { return _view != nullptr; }
+
+	// key  MakeKey 
+	const AssetPackEntry* Find(std::string_view key) const;
+
+	// destination  entry.size Ʈ ̻,     false
+	bool Read(const AssetPackEntry& entry, void* destination) const;
+	//   ׸ ε Ʈ ( , Close  ȿ),  ׸ nullptr
+	const uint8_t* GetData(const AssetPackEntry& entry) const;
+
+	std::string_view GetPath(const AssetPackEntry& entry) const;
+	std::span<const AssetPackEntry> GetEntries() const { return { _entries, _entryCount }; }
+
+	// ҹ, , "./" ̸   
+	static std::string MakeKey(const std::filesystem::path& path);
+	// FNV-1a 64
+	static uint64_t Hash(std::string_view key);
+
+private:
+	void* _file = nullptr;		// HANDLE
+	void* _mapping = nullptr;
+	const uint8_t* _view = nullptr;
+	uint64_t _size = 0;
+
+	const AssetPackEntry* _entries = nullptr;
+	size_t _entryCount = 0;
+	const char* _strings = nullptr;
+};
@@ -0,0 +1,411 @@
+#include "pch.h"
+#include "AssetPacker.h"
+
+#include "AssetPack.h"
+#include "Lz4Codec.h"
+
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+	struct FileReport
+	{
+		std::string path;
+		std::string compression;
+		uint64_t size = 0;
+		uint64_t storedSize = 0;
+		float looseReadMilliseconds = 0.f;		//   + ü б
+		float packReadMilliseconds = 0.f;		//  Ž + ( ) 
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(path), CEREAL_NVP(compression), CEREAL_NVP(size), CEREAL_NVP(storedSize),
+				CEREAL_NVP(looseReadMilliseconds), CEREAL_NVP(packReadMilliseconds));
+		}
+	};
+
+	struct TotalReport
+	{
+		uint32_t files = 0;
+		uint32_t compressed = 0;
+		uint32_t mapped = 0;					//     ؽó (Ÿ ε Ʈ ״ )
+		uint32_t rawFallbacks = 0;				//     ޶ ״ 
+		uint32_t failed = 0;
+		uint64_t sourceBytes = 0;
+		uint64_t storedBytes = 0;
+		uint64_t packFileBytes = 0;				//  е,  
+		float looseScanMilliseconds = 0.f;		// ͸ ȸ
+		float looseReadMilliseconds = 0.f;
+		float packOpenMilliseconds = 0.f;		//  +  ˻ (ѿ ȸ  ̰͸)
+		float packReadMilliseconds = 0.f;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(files), CEREAL_NVP(compressed), CEREAL_NVP(mapped), CEREAL_NVP(rawFallbacks), CEREAL_NVP(failed),
+				CEREAL_NVP(sourceBytes), CEREAL_NVP(storedBytes), CEREAL_NVP(packFileBytes),
+				CEREAL_NVP(looseScanMilliseconds), CEREAL_NVP(looseReadMilliseconds),
+				CEREAL_NVP(packOpenMilliseconds), CEREAL_NVP(packReadMilliseconds));
+		}
+	};
+
+	struct PackedFile
+	{
+		std::filesystem::path source;
+		std::string path;		//    ( ҹ)
+		AssetPackEntry entry;
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	float elapsedMilliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	std::string lowerExtension(const std::filesystem::path& path)
+	{
+		std::string extension = path.extension().string();
+		std::ranges::transform(extension, extension.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+		return extension;
+	}
+
+	bool readFile(const std::filesystem::path& path, std::vector<char>& data)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+			return false;
+
+		data.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+		return static_cast<bool>(file);
+	}
+
+	void writePadding(std::ofstream& file, uint64_t alignment)
+	{
+		static const char zeros[AssetPack::ALIGNMENT] = {};
+
+		const uint64_t position = static_cast<uint64_t>(file.tellp());
+		const uint64_t padding = (alignment - position % alignment) % alignment;
+		file.write(zeros, static_cast<std::streamsize>(padding));
+	}
+}
+
+AssetPacker::AssetPacker(AssetPackSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+bool AssetPacker::Run()
+{
+	std::vector<PackedFile> files;
+	std::vector<std::string> warnings;
+	std::vector<std::string> errors;
+	TotalReport total;
+
+	const auto scanStart = Clock::now();
+
+	if (std::filesystem::exists(_settings.sourcePath))
+	{
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(_settings.sourcePath))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			const std::filesystem::path& path = entry.path();
+
+			// ĳð  fbx  Ÿ Ѹδ    (̳    εϸ )
+			if (lowerExtension(path) == ".fbx")
+			{
+				std::filesystem::path mcm = path;
+				std::filesystem::path mca = path;
+				if (!std::filesystem::exists(mcm.replace_extension(".mcm")) && !std::filesystem::exists(mca.replace_extension(".mca")))
+					warnings.push_back("fbx without cache, not packed : " + path.generic_string());
+				continue;
+			}
+
+			if (!IsPackable(path))
+				continue;
+
+			PackedFile file;
+			file.source = path;
+			//  ͸    (Ÿ "./Resources/..."  ã)
+			file.path = std::filesystem::proximate(path).lexically_normal().generic_string();
+			files.push_back(std::move(file));
+		}
+	}
+
+	total.looseScanMilliseconds = elapsedMilliseconds(scanStart);
+
+	//  ͸   ȿ پ ֵ   
+	std::ranges::sort(files, {}, &PackedFile::path);
+
+	std::filesystem::path temporaryPath = _settings.outputPath;
+	temporaryPath += ".tmp";
+
+	if (_settings.outputPath.has_parent_path())
+		std::filesystem::create_directories(_settings.outputPath.parent_path());
+
+	std::ofstream pack(temporaryPath, std::ios::binary | std::ios::trunc);
+	if (!pack.is_open())
+	{
+		errors.push_back("pack open failed : " + temporaryPath.generic_string());
+		files.clear();
+	}
+
+	//  ڸ (    ä)
+	const AssetPackHeader placeholder;
+	pack.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+	writePadding(pack, AssetPack::ALIGNMENT);
+
+	std::string strings;
+	std::vector<char> data;
+	std::vector<char> compressed;
+	std::vector<char> roundTrip;
+
+	for (auto it = files.begin(); it != files.end();)
+	{
+		if (!readFile(it->source, data))
+		{
+			errors.push_back("read failed : " + it->source.generic_string());
+			++total.failed;
+			it = files.erase(it);
+			continue;
+		}
+
+		AssetPackEntry& entry = it->entry;
+		entry.hash = AssetPack::Hash(it->path);
+		entry.size = data.size();
+		entry.pathOffset = static_cast<uint32_t>(strings.size());
+		entry.pathLength = static_cast<uint32_t>(it->path.size());
+		strings += it->path;
+
+		const char* stored = data.data();
+		entry.storedSize = data.size();
+
+		// پ  (wav   ) ״ 
+		// ؽó δ TextureStreamer  ε ׸񿡼 ٷ е ׻ ״ 
+		if (_settings.compress && !data.empty() && !IsMapped(it->source))
+		{
+			compressed.resize(Lz4Codec::GetMaxCompressedSize(data.size()));
+			const size_t compressedSize = Lz4Codec::Compress(data.data(), data.size(), compressed.data(), compressed.size());
+			if (compressedSize != 0 && compressedSize < data.size())
+			{
+				// ٽ Ǯ    ົ  (ڵ  ѿ  ʵ)
+				roundTrip.resize(data.size());
+				const size_t roundTripSize = Lz4Codec::Decompress(compressed.data(), compressedSize, roundTrip.data(), roundTrip.size());
+
+				if (roundTripSize == data.size() && memcmp(roundTrip.data(), data.data(), data.size()) == 0)
+				{
+					entry.compression = AssetCompression::LZ4;
+					entry.storedSize = compressedSize;
+					stored = compressed.data();
+					++total.compressed;
+				}
+				else
+				{
+					errors.push_back("lz4 round trip mismatch, stored raw : " + it->source.generic_string());
+					++total.rawFallbacks;
+				}
+			}
+		}
+
+		entry.offset = static_cast<uint64_t>(pack.tellp());
+		pack.write(stored, static_cast<std::streamsize>(entry.storedSize));
+		writePadding(pack, AssetPack::ALIGNMENT);
+
+		++total.files;
+		total.sourceBytes += entry.size;
+		total.storedBytes += entry.storedSize;
+
+		++it;
+	}
+
+	//  ؽ  ( ؽô  )
+	std::vector<AssetPackEntry> entries;
+	entries.reserve(files.size());
+	for (const auto& file : files)
+		entries.push_back(file.entry);
+
+	std::ranges::sort(entries, [&strings](const AssetPackEntry& a, const AssetPackEntry& b)
+		{
+			if (a.hash != b.hash)
+				return a.hash < b.hash;
+
+			return std::string_view(strings).substr(a.pathOffset, a.pathLength) < std::string_view(strings).substr(b.pathOffset, b.pathLength);
+		});
+
+	AssetPackHeader header;
+	header.magic = AssetPack::MAGIC;
+	header.version = AssetPack::VERSION;
+	header.entryCount = static_cast<uint32_t>(entries.size());
+	header.entriesOffset = static_cast<uint64_t>(pack.tellp());
+	pack.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(AssetPackEntry)));
+	header.stringsOffset = static_cast<uint64_t>(pack.tellp());
+	header.stringsSize = strings.size();
+	pack.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+	total.packFileBytes = static_cast<uint64_t>(pack.tellp());
+
+	pack.seekp(0);
+	pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	pack.close();
+
+	bool isSaved = pack.good();
+	if (isSaved)
+	{
+		//    д    ·  ʵ    ü
+		std::error_code ec;
+		std::filesystem::rename(temporaryPath, _settings.outputPath, ec);
+		isSaved = !ec;
+	}
+
+	if (!isSaved)
+		errors.push_back("pack save failed : " + _settings.outputPath.generic_string());
+
+	// ũ б vs ѿ б
+	std::vector<FileReport> reports;
+
+	AssetPack reader;
+	const auto openStart = Clock::now();
+	const bool isOpened = isSaved && reader.Open(_settings.outputPath);
+	total.packOpenMilliseconds = elapsedMilliseconds(openStart);
+
+	if (isSaved && !isOpened)
+		errors.push_back("pack verify failed : " + _settings.outputPath.generic_string());
+
+	for (const auto& file : files)
+	{
+		if (!isOpened)
+			break;
+
+		FileReport report;
+		report.path = file.path;
+		report.compression = file.entry.compression == AssetCompression::LZ4 ? "lz4" : "none";
+		report.size = file.entry.size;
+		report.storedSize = file.entry.storedSize;
+
+		const auto looseStart = Clock::now();
+		std::vector<char> loose;
+		readFile(file.source, loose);
+		report.looseReadMilliseconds = elapsedMilliseconds(looseStart);
+
+		const auto packStart = Clock::now();
+		std::vector<char> packed;
+		const AssetPackEntry* entry = reader.Find(AssetPack::MakeKey(file.path));
+		if (entry != nullptr)
+		{
+			packed.resize(entry->size);
+			if (!reader.Read(*entry, packed.data()))
+				entry = nullptr;
+		}
+		report.packReadMilliseconds = elapsedMilliseconds(packStart);
+
+		if (entry == nullptr || packed != loose)
+		{
+			errors.push_back("pack verify failed : " + file.path);
+			++total.failed;
+		}
+		else if (IsMapped(file.source))
+		{
+			// dds   ׸    Ƿ    ĵǾ ־ 
+			if (reader.GetData(*entry) == nullptr || entry->offset % AssetPack::ALIGNMENT != 0)
+			{
+				errors.push_back("texture not mappable : " + file.path);
+				++total.failed;
+			}
+			else
+			{
+				++total.mapped;
+			}
+		}
+
+		total.looseReadMilliseconds += report.looseReadMilliseconds;
+		total.packReadMilliseconds += report.packReadMilliseconds;
+
+		reports.push_back(std::move(report));
+	}
+
+	reader.Close();
+
+	// ũ  ɸ 
+	std::ranges::sort(reports, std::greater{}, &FileReport::looseReadMilliseconds);
+
+	std::ofstream file(_settings.reportPath);
+	if (file.is_open())
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(
+			cereal::make_nvp("source", _settings.sourcePath.generic_string()),
+			cereal::make_nvp("output", _settings.outputPath.generic_string()),
+			cereal::make_nvp("total", total),
+			cereal::make_nvp("files", reports),
+			cereal::make_nvp("warnings", warnings),
+			cereal::make_nvp("errors", errors)
+		);
+	}
+
+	return isOpened && file.good() && total.failed == 0;
+}
+
+bool AssetPacker::ParseArguments(const std::vector<std::string>& args, AssetPackSettings& settings)
+{
+	bool isPack = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size() && !args[i + 1].starts_with("--");
+
+		if (arg == "--pack-assets")
+		{
+			if (hasValue)
+				settings.sourcePath = args[++i];
+			isPack = true;
+		}
+		else if (arg == "--pack-out" && hasValue)
+			settings.outputPath = args[++i];
+		else if (arg == "--report" && hasValue)
+			settings.reportPath = args[++i];
+		else if (arg == "--pack-store")
+			settings.compress = false;
+	}
+
+	return isPack;
+}
+
+bool AssetPacker::IsPackable(const std::filesystem::path& path)
+{
+	static const char* const extensions[] = {
+		".mcm", ".mca", ".index",							// MeshLibrary, AnimationLibrary
+		".material", ".matlib",								// MaterialLibrary, MaterialCompiler
+		".scene", ".prefab", ".deps",						// Scene, SceneManifest
+		".controller",										// AnimatorController
+		".wav", ".mp3", ".ogg",								// SoundSystem
+		".manifest",										// TextureManifest
+	};
+
+	const std::string extension = lowerExtension(path);
+
+	return std::ranges::find(extensions, extension) != std::end(extensions) || IsMapped(path);
+}
+
+bool AssetPacker::IsMapped(const std::filesystem::path& path)
+{
+	// ؽó δ ޸𸮿   ִ  (exr  Ͽ   ־  )
+	static const char* const extensions[] = {
+		".dds",
+		".png", ".jpg", ".jpeg", ".bmp", ".tif", ".tiff",
+		".tga", ".hdr",
+	};
+
+	const std::string extension = lowerExtension(path);
+
+	return std::ranges::find(extensions, extension) != std::end(extensions);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+struct AssetPackSettings
+{
+	std::filesystem::path sourcePath = "./Resources";
+	std::filesystem::path outputPath = "./Resources.pack";		// VirtualFileSystem::DEFAULT_PACK_PATH
+	std::filesystem::path reportPath = "./asset_pack.json";
+	bool compress = true;										// false     
+};
+
+/// Ÿ VirtualFileSystem  д (mcm, mca, Ƽ, , , Ʈѷ, , , ؽó) AssetPack ϳ   
+/// fbx  ĳ(mcm, mca), ؽó    ķ  TextureStreamer  ε dds    
+///   ũ   ѿ   ð   JSON  
+class ANIMAVISION_DLL AssetPacker
+{
+public:
+	explicit AssetPacker(AssetPackSettings settings);
+
+	// ,   (    , ϳ ϸ false)
+	bool Run();
+
+	// "--pack-assets [dir] [--pack-out path] [--report path] [--pack-store]"
+	// --pack-assets   false
+	static bool ParseArguments(const std::vector<std::string>& args, AssetPackSettings& settings);
+
+	// ѿ ִ Ȯ
+	static bool IsPackable(const std::filesystem::path& path);
+	//  ʰ ִ ؽó Ȯ (VirtualFileSystem::Map  )
+	static bool IsMapped(const std::filesystem::path& path);
+
+private:
+	AssetPackSettings _settings;
+};
@@ -227,7 +227,7 @@ void ChangDXII::Submit(Mesh& mesh, Material& material, PrimitiveTopology primiti
 
 }
 
-void ChangDXII::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode /*= PrimitiveTopology::TRIANGLELIST*/, uint32_t instances /*= 1*/)
+void ChangDXII::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode /*= PrimitiveTopology::TRIANGLELIST*/, uint32_t instances /*= 1*/, uint32_t lod /*= 0*/)
 {
 	if (subMeshIndex >= mesh.subMeshDescriptors.size())
 	{
@@ -315,11 +315,12 @@ void ChangDXII::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, Pr
 	}
 
 	const SubMeshDescriptor& subMesh = mesh.subMeshDescriptors[subMeshIndex];
+	const SubMeshLod range = subMesh.GetLod(lod);
 
 	m_Context->SetPrimitiveTopology((D3D12_PRIMITIVE_TOPOLOGY)primitiveMode);
 	mesh.vertexBuffer->Bind(m_Context.get());
 	mesh.indexBuffer->Bind(m_Context.get());
-	m_Context->DrawIndexed(subMesh.indexCount, instances, subMesh.indexOffset, subMesh.vertexOffset);
+	m_Context->DrawIndexed(range.indexCount, instances, range.indexOffset, subMesh.vertexOffset);
 
 	shader12->Unbind();
 }
@@ -639,18 +640,14 @@ void ChangDXII::LoadMeshesFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 	{
-		return;
-	}
-
-	if (std::filesystem::is_directory(directory))
-	{
-		m_MeshLibrary->LoadMeshesFromDirectory(path);
+		m_MeshLibrary->LoadMeshesFromFile(path);
 	}
 	else
 	{
-		m_MeshLibrary->LoadMeshesFromFile(path);
+		m_MeshLibrary->LoadMeshesFromDirectory(path);
 	}
 }
 
@@ -658,18 +655,14 @@ void ChangDXII::LoadMaterialsFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
-	{
-		return;
-	}
-
-	if (std::filesystem::is_directory(directory))
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 	{
-		m_MaterialLibrary->LoadFromDirectory(path);
+		m_MaterialLibrary->LoadFromFile(path);
 	}
 	else
 	{
-		m_MaterialLibrary->LoadFromFile(path);
+		m_MaterialLibrary->LoadFromDirectory(path);
 	}
 
 	for (auto& material : m_MaterialLibrary->GetMaterials())
@@ -801,13 +794,11 @@ void ChangDXII::LoadAnimationClipsFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
-		return;
-
-	if (std::filesystem::is_directory(directory))
-		m_AnimationLibrary->LoadAnimationClipsFromDirectory(path);
-	else
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 		m_AnimationLibrary->LoadAnimationClipsFromFile(path);
+	else
+		m_AnimationLibrary->LoadAnimationClipsFromDirectory(path);
 }
 
 void* ChangDXII::AllocateShaderVisibleDescriptor(void* OutCpuHandle, void* OutGpuHandle)
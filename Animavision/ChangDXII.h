@@ -31,7 +31,7 @@ public:
 	void SetViewport(uint32_t width, uint32_t height) override;
 
 	void Submit(Mesh& mesh, Material& material, PrimitiveTopology primitiveMode, uint32_t instances) override;
-	void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) override;
+	void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1, uint32_t lod = 0) override;
 	void DispatchCompute(Material& material, uint32_t threadGroupCountX, uint32_t threadGroupCountY, uint32_t threadGroupCountZ);
 	void DispatchRays(Material& material, uint32_t width, uint32_t height, uint32_t depth) override;
 
@@ -80,12 +80,14 @@ public:
 	void LoadMeshesFromDrive(const std::string& path) override;
 	std::shared_ptr<Mesh> GetMesh(const std::string& name) override { return m_MeshLibrary->GetMesh(name); }
 	std::map<std::string, std::shared_ptr<Mesh>>* GetMeshes() override { return &m_MeshLibrary->GetMeshes(); }
+	AssetRegistry<Mesh>* GetMeshRegistry() override { return &m_MeshLibrary->GetRegistry(); }
 
 	void AddMaterial(const std::shared_ptr<Material>& material) override { m_MaterialLibrary->AddMaterial(material); }
 	void LoadMaterialsFromDrive(const std::string& path) override;
 	std::shared_ptr<Material> GetMaterial(const std::string& name) override { return m_MaterialLibrary->GetMaterial(name); }
 	void SaveMaterial(const std::string& name) override;
 	std::map<std::string, std::shared_ptr<Material>>* GetMaterials() override { return &m_MaterialLibrary->GetMaterials(); }
+	AssetRegistry<Material>* GetMaterialRegistry() override { return &m_MaterialLibrary->GetRegistry(); }
 
 	void LoadAnimationClipsFromDrive(const std::string& path) override;
 	std::shared_ptr<AnimationClip> GetAnimationClip(const std::string& name) override { return m_AnimationLibrary->GetAnimationClip(name); }
@@ -5,6 +5,9 @@
 #include "DX11Sampler.h"
 #include "NeoDX11Context.h"
 #include "DX11State.h"
+#include "TextureManifest.h"
+#include "VirtualFileSystem.h"
+#include "TextureStreamer.h"
 #include <DirectXTex.h>
 #include <DirectXTexEXR.h>
 
@@ -45,28 +48,39 @@ std::shared_ptr<DX11Texture> DX11ResourceManager::CreateTexture(const std::strin
 	DirectX::ScratchImage image;
 	DirectX::TexMetadata metadata = {};
 
-	std::wstring wpath(path.begin(), path.end());
+	// ũ dds     ( Ű  )
+	const std::string loadPath = TextureManifest::Resolve(path);
+
+	std::wstring wpath(loadPath.begin(), loadPath.end());
 	//std::wstring extension = wpath.substr(wpath.find_last_of(L".") + 1);
-	std::filesystem::path p = path;
+	std::filesystem::path p = loadPath;
 	std::wstring extension = p.extension().wstring();
 	extension = extension.substr(1);
 	std::wstring fileName = wpath.substr(wpath.find_last_of('/') + 1);
 
 	HRESULT hr = S_OK;
 
+	// ѿ   ε Ʈ  (AssetPacker  ؽó   )
+	std::span<const uint8_t> packed;
+	const bool isPacked = VirtualFileSystem::Map(loadPath, packed);
+
 	// WOO : wic flags ʿϸ 
 	if (extension == L"png" || extension == L"jpg" || extension == L"jpeg" || extension == L"tiff" || extension == L"bmp")
-		hr = DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromWICMemory(packed.data(), packed.size(), DirectX::WIC_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
 
 	// WOO : dds flags ʿϸ 
 	else if (extension == L"dds")
-		hr = DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromDDSMemory(packed.data(), packed.size(), DirectX::DDS_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
 
 	else if (extension == L"tga")
-		hr = DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromTGAMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
 
 	else if (extension == L"hdr")
-		hr = DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromHDRMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
 
 	auto texture = std::make_shared<DX11Texture>(m_Context, path, metadata, image);
 	m_TextureMap[path] = texture;
@@ -104,6 +118,22 @@ std::shared_ptr<DX11Texture> DX11ResourceManager::CreateTexture2D(const std::str
 	return texture;
 }
 
+std::shared_ptr<DX11Texture> DX11ResourceManager::CreateStreamingTexture2D(const std::string& path, TextureStreamer& streamer)
+{
+	auto it = m_TextureMap.find(path);
+	if (it != m_TextureMap.end())
+		return it->second;
+
+	// Ʈ   ؽó(dds  ƴϰų ̹ ) ü 
+	auto texture = streamer.Register(path);
+	if (texture == nullptr)
+		return CreateTexture2D(path);
+
+	m_TextureMap[path] = texture;
+
+	return texture;
+}
+
 std::shared_ptr<DX11Texture> DX11ResourceManager::CreateLightmapTexture(const std::string& path)
 {
 	std::filesystem::path currentPath = std::filesystem::current_path();
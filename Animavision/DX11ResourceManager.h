@@ -21,6 +21,7 @@ class NeoDX11Context;
 class DX11DepthStencilState;
 class DX11BlendState;
 class DX11RasterizerState;
+class TextureStreamer;
 
 using ParticleBuffers = std::tuple<std::shared_ptr<Texture>, std::shared_ptr<Texture>, std::shared_ptr<Texture>>;
 
@@ -37,6 +38,7 @@ public:
 	std::shared_ptr<DX11Texture> CreateEmptyTexture(std::string name, Texture::Type type, uint32_t width, uint32_t height, uint32_t mipLevels, Texture::Format format, Texture::Usage usage, float* clearColor, Texture::UAVType uavType, uint32_t arraySize);
 	std::shared_ptr<DX11Texture> CreateEmptyTexture(const TextureDesc& desc);
 	std::shared_ptr<DX11Texture> CreateTexture2D(const std::string& path);
+	std::shared_ptr<DX11Texture> CreateStreamingTexture2D(const std::string& path, TextureStreamer& streamer);
 	std::shared_ptr<DX11Texture> CreateLightmapTexture(const std::string& path);
 	std::shared_ptr<DX11Texture> CreateTexture3D(const std::string& path);
 	std::shared_ptr<DX11Texture> CreateTexture2DArray(const std::string& path);
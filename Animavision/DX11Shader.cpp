@@ -14,6 +14,21 @@
 #define SHADER_DEBUG_EXTENSION ".mcs11d"
 #define SHADER_EXTENSION ".mcs11"
 
+namespace
+{
+	// create*Shader  ϴ ,  (ShaderType )
+	constexpr std::pair<const char*, const char*> SHADER_STAGES[] =
+	{
+		{ "VSMain", "vs_5_0" },
+		{ "PSMain", "ps_5_0" },
+		{ "CSMain", "cs_5_0" },
+		{ "GSMain", "gs_5_0" },
+		{ "StreamOutGS", "gs_5_0" },
+		{ "HSMain", "hs_5_0" },
+		{ "DSMain", "ds_5_0" },
+	};
+}
+
 DX11Shader::DX11Shader(RendererContext* context, std::string_view path)
 	: m_Path(path)
 {
@@ -225,6 +240,10 @@ void DX11Shader::Recompile(RendererContext* context)
 {
 	this->Destroy();
 
+	// ģ  ٽ е
+	if (s_Cache)
+		s_Cache->Invalidate();
+
 	createVertexShader(context, m_Path);
 	createPixelShader(context, m_Path);
 	createComputeShader(context, m_Path);
@@ -296,6 +315,31 @@ ID3DBlob* DX11Shader::compileShaderFromFile(std::string_view path, std::string_v
 
 	Name = path;
 
+	if (s_Cache)
+	{
+		ShaderCompileRequest request{ std::string(path), std::string(name), std::string(version), {}, GetCompileFlags() };
+
+		auto entry = s_Cache->Compile(request);
+		if (!entry)
+			return nullptr;
+
+		if (!entry->isCompiled)
+		{
+			//   (X3501) ϹǷ  
+			if (entry->error.find("X3501") == std::string::npos)
+				OutputDebugStringA(entry->error.c_str());
+
+			return nullptr;
+		}
+
+		if (FAILED(D3DCreateBlob(entry->blob.size(), &blob)))
+			return nullptr;
+
+		memcpy(blob->GetBufferPointer(), entry->blob.data(), entry->blob.size());
+
+		return blob;
+	}
+
 	bool isExist = false;
 
 	std::filesystem::path savedPath = filePath.replace_extension(".hlsl");
@@ -324,14 +368,7 @@ ID3DBlob* DX11Shader::compileShaderFromFile(std::string_view path, std::string_v
 
 			const std::string shaderCode = strStream.str();
 
-			uint32_t debugFlag = 0;
-
-			/// ̰  ׷  ÿ ڵ带   
-#ifdef _DEBUG
-			debugFlag = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_PACK_MATRIX_ROW_MAJOR;
-#else
-			debugFlag = D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_OPTIMIZATION_LEVEL3 | D3DCOMPILE_SKIP_VALIDATION | D3DCOMPILE_PACK_MATRIX_ROW_MAJOR;
-#endif
+			uint32_t debugFlag = GetCompileFlags();
 
 			// shaderCode blob ȯ
 			HRESULT hr = D3DCompile(shaderCode.c_str(), shaderCode.size(), Name.c_str(), nullptr, &includeHandler, name.data(), version.data(), debugFlag, 0, &blob, &errorBlob);
@@ -354,6 +391,75 @@ ID3DBlob* DX11Shader::compileShaderFromFile(std::string_view path, std::string_v
 	return blob;
 }
 
+std::vector<ShaderCompileRequest> DX11Shader::GetCompileRequests(std::string_view path)
+{
+	std::vector<ShaderCompileRequest> requests;
+	requests.reserve(std::size(SHADER_STAGES));
+
+	for (const auto& [entryPoint, profile] : SHADER_STAGES)
+		requests.push_back({ std::string(path), entryPoint, profile, {}, GetCompileFlags() });
+
+	return requests;
+}
+
+std::vector<std::string> DX11Shader::GetTextureBindingNames(ShaderCache& cache, std::string_view path)
+{
+	std::vector<std::string> names;
+
+	for (const auto& request : GetCompileRequests(path))
+	{
+		auto entry = cache.Compile(request);
+		if (entry == nullptr || !entry->isCompiled)
+			continue;
+
+		Microsoft::WRL::ComPtr<ID3D11ShaderReflection> shaderReflection = nullptr;
+		HRESULT hr = D3DReflect(
+			entry->blob.data(),
+			entry->blob.size(),
+			IID_ID3D11ShaderReflection,
+			reinterpret_cast<void**>(shaderReflection.GetAddressOf()));
+
+		if (FAILED(hr))
+			continue;
+
+		D3D11_SHADER_DESC shaderDesc = {};
+		shaderReflection->GetDesc(&shaderDesc);
+
+		for (uint32_t boundResouceIndex = 0; boundResouceIndex < shaderDesc.BoundResources; boundResouceIndex++)
+		{
+			D3D11_SHADER_INPUT_BIND_DESC bindDesc = {};
+			shaderReflection->GetResourceBindingDesc(boundResouceIndex, &bindDesc);
+
+			if (bindDesc.Type == D3D_SIT_STRUCTURED || bindDesc.Type == D3D_SIT_TEXTURE)
+				names.emplace_back(bindDesc.Name);
+		}
+	}
+
+	return names;
+}
+
+uint64_t DX11Shader::HashTextureBindings(const std::vector<std::string>& names)
+{
+	const uint64_t count = names.size();
+	uint64_t hash = ShaderCache::Hash(&count, sizeof(count));
+
+	// '\0'  ־ ̸ 踦 
+	for (const auto& name : names)
+		hash = ShaderCache::Hash(name.c_str(), name.size() + 1, hash);
+
+	return hash != 0 ? hash : 1;
+}
+
+uint32_t DX11Shader::GetCompileFlags()
+{
+	/// ̰  ׷  ÿ ڵ带   
+#ifdef _DEBUG
+	return D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_PACK_MATRIX_ROW_MAJOR;
+#else
+	return D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_OPTIMIZATION_LEVEL3 | D3DCOMPILE_SKIP_VALIDATION | D3DCOMPILE_PACK_MATRIX_ROW_MAJOR;
+#endif
+}
+
 bool DX11Shader::saveShaderBlobToFile(ID3DBlob* blob, std::string_view path)
 {
 	// θ 丮  Ȯ
@@ -395,6 +501,7 @@ bool DX11Shader::loadShaderBlobFromFile(ID3DBlob** blob, std::string_view path)
 
 void DX11Shader::reflectShaderVariables()
 {
+	++m_ReflectionVersion;
 
 	for (uint32_t typeIndex = 0; typeIndex < static_cast<uint32_t>(ShaderType::Count); typeIndex++)
 	{
@@ -553,6 +660,13 @@ void DX11Shader::reflectShaderVariables()
 			}
 		}
 	}
+
+	std::vector<std::string> textureNames;
+	textureNames.reserve(m_TextureBindings.size());
+	for (const auto& binding : m_TextureBindings)
+		textureNames.push_back(binding.Name);
+
+	m_TextureBindingHash = HashTextureBindings(textureNames);
 }
 
 void DX11Shader::setConstantMapping(const std::string& name, const void* value)
@@ -1139,6 +1253,8 @@ void DX11Shader::Destroy()
 
 STDMETHODIMP ShaderIncludeHandler::Open(D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes)
 {
+	Includes.push_back(pFileName);
+
 	std::filesystem::path includePath = std::filesystem::current_path() / "Shaders" / pFileName;
 	std::ifstream file(includePath, std::ios::binary);
 	if (!file.is_open())
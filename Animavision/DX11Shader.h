@@ -3,6 +3,7 @@
 #include "Shader.h"
 
 #include "DX11Relatives.h"
+#include "ShaderCache.h"
 #include <array>
 
 class Buffer;
@@ -141,6 +142,19 @@ public:
 	ID3D11DomainShader* GetDomainShader() const { return static_cast<ID3D11DomainShader*>(m_Shaders[static_cast<uint32_t>(ShaderType::Domain)].Get()); }
 	void setConstantMapping(const std::string& name, const void* value);
 
+	// ̴ ϳ   ϴ   (ShaderCache::CompileAll  ̸   )
+	static std::vector<ShaderCompileRequest> GetCompileRequests(std::string_view path);
+	static uint32_t GetCompileFlags();
+
+	// path  ̴ cache  (밳 ) reflectShaderVariables    ؽó ε ̸ 
+	// ̽   (MaterialCompiler  Ƽ  ε    )
+	static std::vector<std::string> GetTextureBindingNames(ShaderCache& cache, std::string_view path);
+	// ؽó ε ̸  ؽ (0  ƴ)
+	static uint64_t HashTextureBindings(const std::vector<std::string>& names);
+
+	// Ǿ    ĳÿ  (NeoWooDXI  )
+	static inline ShaderCache* s_Cache = nullptr;
+
 private:
 	ID3DBlob* compileShaderFromFile(std::string_view path, std::string_view name, std::string_view version);
 	bool saveShaderBlobToFile(ID3DBlob* blob, std::string_view path);
@@ -191,6 +205,11 @@ public:
 	std::vector<DX11ResourceBinding> m_UAVBindings = {};
 	robin_hood::unordered_map<std::string, uint32_t> m_UAVRegisterMap = {};
 
+	// reflectShaderVariables    (ٽ ؼ ε ٲ Material  Ȯ)
+	uint32_t m_ReflectionVersion = 0;
+	// m_TextureBindings ̸  ؽ (CompiledMaterial::bindingHash    ̸ ã )
+	uint64_t m_TextureBindingHash = 0;
+
 	// ⺻ 
 	std::string m_Path = "";
 };
@@ -200,4 +219,7 @@ class ShaderIncludeHandler : public ID3DInclude
 public:
 	STDMETHOD(Open)(D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes) override;
 	STDMETHOD(Close)(LPCVOID pData) override;
+
+	//  ߿  include ̸ (ø , ShaderCache  )
+	std::vector<std::string> Includes;
 };
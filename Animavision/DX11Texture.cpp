@@ -2,6 +2,8 @@
 #include "DX11Texture.h"
 #include "NeoDX11Context.h"
 #include "Renderer.h"
+#include "TextureManifest.h"
+#include "VirtualFileSystem.h"
 
 #include <DirectXTex.h>
 #include <DirectXTexEXR.h>
@@ -12,12 +14,18 @@ DX11Texture::DX11Texture(RendererContext* context, std::string_view path, Type t
 	m_Type = textureType;
 	DirectX::ScratchImage image;
 	DirectX::TexMetadata metadata = {};
-	std::wstring wpath(m_Path.begin(), m_Path.end());
+
+	//  ũ(TextureBaker)   BCn + Ӹ dds  , ̸ δ  ״
+	const std::string loadPath = TextureManifest::Resolve(m_Path);
+	const bool isBaked = loadPath != m_Path;
+
+	std::wstring wpath(loadPath.begin(), loadPath.end());
 	//std::wstring extension = wpath.substr(wpath.find_last_of(L".") + 1);
-	std::filesystem::path p = path;
+	std::filesystem::path p = loadPath;
 	std::wstring extension = p.extension().wstring();
 	extension = extension.substr(1);
-	std::wstring fileName = wpath.substr(wpath.find_last_of('/') + 1);
+	std::wstring fileName = std::wstring(m_Path.begin(), m_Path.end());
+	fileName = fileName.substr(fileName.find_last_of('/') + 1);
 
 	// Ȯ 빮ڸ ҹڷ
 	std::ranges::transform(extension, extension.begin(), ::towlower);
@@ -27,19 +35,27 @@ DX11Texture::DX11Texture(RendererContext* context, std::string_view path, Type t
 
 	HRESULT hr = S_OK;
 
+	// ѿ   ε Ʈ  (AssetPacker  ؽó   )
+	std::span<const uint8_t> packed;
+	const bool isPacked = VirtualFileSystem::Map(loadPath, packed);
+
 	// WOO : wic flags ʿϸ 
 	if (extension == L"png" || extension == L"jpg" || extension == L"jpeg" || extension == L"tiff" || extension == L"tif" || extension == L"bmp")
-		hr = DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromWICMemory(packed.data(), packed.size(), DirectX::WIC_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
 
 	// WOO : dds flags ʿϸ 
 	else if (extension == L"dds")
-		hr = DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromDDSMemory(packed.data(), packed.size(), DirectX::DDS_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
 
 	else if (extension == L"tga")
-		hr = DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromTGAMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
 
 	else if (extension == L"hdr")
-		hr = DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromHDRMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
 
 	// unity light map exr Ϸ ´
 	else if (extension == L"exr")
@@ -61,7 +77,7 @@ DX11Texture::DX11Texture(RendererContext* context, std::string_view path, Type t
 	}
 
 	// Ӹʸ
-	if (metadata.mipLevels == 1)
+	if (!isBaked && metadata.mipLevels == 1)
 	{
 		DirectX::ScratchImage mipChain;
 		hr = DirectX::GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata, DirectX::TEX_FILTER_DEFAULT, 0, mipChain);
@@ -71,19 +87,23 @@ DX11Texture::DX11Texture(RendererContext* context, std::string_view path, Type t
 		// Ÿ 
 		metadata = image.GetMetadata();
 
-		// dds ϱ
-		// Ȯ dds ٲٱ
-		std::wstring newPath = wpath.substr(0, wpath.find_last_of(L"."));
-		newPath += L".dds";
-		hr = DirectX::SaveToDDSFile(image.GetImages(), image.GetImageCount(), metadata, DirectX::DDS_FLAGS_NONE, newPath.c_str());
-
-		m_Path = winrt::to_string(newPath);
-		fileName = newPath.substr(newPath.find_last_of(L'/') + 1);
-		m_Name = winrt::to_string(fileName);
-		//  png ϱ
-		if (wpath != newPath)
+		// ѿ о ũ  Ƿ ޸𸮿 
+		if (!isPacked)
 		{
-			std::filesystem::remove(wpath);
+			// dds ϱ
+			// Ȯ dds ٲٱ
+			std::wstring newPath = wpath.substr(0, wpath.find_last_of(L"."));
+			newPath += L".dds";
+			hr = DirectX::SaveToDDSFile(image.GetImages(), image.GetImageCount(), metadata, DirectX::DDS_FLAGS_NONE, newPath.c_str());
+
+			m_Path = winrt::to_string(newPath);
+			fileName = newPath.substr(newPath.find_last_of(L'/') + 1);
+			m_Name = winrt::to_string(fileName);
+			//  png ϱ
+			if (wpath != newPath)
+			{
+				std::filesystem::remove(wpath);
+			}
 		}
 	}
 
@@ -2727,21 +2747,14 @@ void DX11Texture::createTexture2D(RendererContext* context, const DirectX::Scrat
 	desc.MiscFlags = 0;	// WOO : flag  ʿѰ ִ 
 
 	std::vector<D3D11_SUBRESOURCE_DATA> subresourceData(metadata.mipLevels);
-	const uint8_t* pData = image.GetPixels();
-
-	uint32_t width = static_cast<uint32_t>(metadata.width);
-	uint32_t height = static_cast<uint32_t>(metadata.height);
 
+	// pitch  DirectXTex     (BC  4x4  )
 	for (uint32_t i = 0; i < metadata.mipLevels; ++i)
 	{
-		subresourceData[i].pSysMem = pData;
-		subresourceData[i].SysMemPitch = static_cast<uint32_t>(width * DirectX::BitsPerPixel(metadata.format) / 8);
-		subresourceData[i].SysMemSlicePitch = subresourceData[i].SysMemPitch * height;
-
-		//  Mipmap  ̵
-		pData += subresourceData[i].SysMemSlicePitch;
-		width = (std::max)(1u, width / 2);
-		height = (std::max)(1u, height / 2);
+		const DirectX::Image* img = image.GetImage(i, 0, 0);
+		subresourceData[i].pSysMem = img->pixels;
+		subresourceData[i].SysMemPitch = static_cast<uint32_t>(img->rowPitch);
+		subresourceData[i].SysMemSlicePitch = static_cast<uint32_t>(img->slicePitch);
 	}
 
 
@@ -6,6 +6,7 @@
 
 class RendererContext;
 struct TextureDesc;
+struct StreamedTexture;
 
 class DX11Texture : public Texture
 {
@@ -14,6 +15,7 @@ class DX11Texture : public Texture
 	friend class DX11RenderTarget;
 	friend class DX11DepthStencil;
 	friend class NeoDX11Context;
+	friend class TextureStreamer;
 
 public:
 	DX11Texture(RendererContext* context, std::string_view path, Type textureType);
@@ -96,5 +98,8 @@ private:
 	Microsoft::WRL::ComPtr<ID3D11Buffer> m_Buffer = nullptr;
 	std::string m_Name = "";
 
+	// TextureStreamer  ϵ ؽó   (ƴϸ nullptr)
+	StreamedTexture* m_Streaming = nullptr;
+
 	float m_ClearValue[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 };
@@ -7,6 +7,8 @@
 #include "Descriptor.h"
 #include "CommandObject.h"
 #include "Renderer.h"
+#include "TextureManifest.h"
+#include "VirtualFileSystem.h"
 
 DX12ResourceManager::DX12ResourceManager(winrt::com_ptr<ID3D12Device5> device, std::shared_ptr<CommandObjectPool> commandObjectPool, bool isRaytracing)
 {
@@ -128,23 +130,34 @@ std::shared_ptr<DX12Texture> DX12ResourceManager::CreateTexture(const std::strin
 	DirectX::ScratchImage image;
 	DirectX::TexMetadata metadata{};
 
-	std::wstring wpath(path.begin(), path.end());
+	// ũ dds     ( Ű  )
+	const std::string loadPath = TextureManifest::Resolve(path);
+
+	std::wstring wpath(loadPath.begin(), loadPath.end());
 	std::wstring extension = wpath.substr(wpath.find_last_of(L".") + 1);
-	std::wstring fileName = wpath.substr(path.find_last_of('/') + 1);
+	std::wstring fileName(path.begin() + (path.find_last_of('/') + 1), path.end());
 
 	HRESULT hr = S_OK;
 
+	// ѿ   ε Ʈ  (AssetPacker  ؽó   )
+	std::span<const uint8_t> packed;
+	const bool isPacked = VirtualFileSystem::Map(loadPath, packed);
+
 	if (extension == L"png" || extension == L"jpg" || extension == L"jpeg" || extension == L"tiff" || extension == L"bmp")
-		hr = DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromWICMemory(packed.data(), packed.size(), DirectX::WIC_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromWICFile(wpath.c_str(), DirectX::WIC_FLAGS_NONE, &metadata, image);
 
 	else if (extension == L"dds")
-		hr = DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
+		hr = isPacked ? DirectX::LoadFromDDSMemory(packed.data(), packed.size(), DirectX::DDS_FLAGS_NONE, &metadata, image)
+			: DirectX::LoadFromDDSFile(wpath.c_str(), DirectX::DDS_FLAGS_NONE, &metadata, image);
 
 	else if (extension == L"tga")
-		hr = DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromTGAMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromTGAFile(wpath.c_str(), &metadata, image);
 
 	else if (extension == L"hdr")
-		hr = DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
+		hr = isPacked ? DirectX::LoadFromHDRMemory(packed.data(), packed.size(), &metadata, image)
+			: DirectX::LoadFromHDRFile(wpath.c_str(), &metadata, image);
 
 	if (FAILED(hr))
 	{
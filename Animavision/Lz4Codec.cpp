@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "Lz4Codec.h"
+
+namespace
+{
+	constexpr size_t MIN_MATCH = 4;
+	constexpr size_t LAST_LITERALS = 5;		//  5 Ʈ ׻ ͷ
+	constexpr size_t MF_LIMIT = 12;			// ġ  12 Ʈ  
+	constexpr size_t MAX_DISTANCE = 65535;
+	constexpr uint32_t HASH_LOG = 16;
+
+	uint32_t read32(const uint8_t* p)
+	{
+		uint32_t value;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	uint32_t hash(uint32_t sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - HASH_LOG);
+	}
+
+	// 15 ̻   (255 )
+	uint8_t* writeLength(uint8_t* op, size_t length)
+	{
+		while (length >= 255)
+		{
+			*op++ = 255;
+			length -= 255;
+		}
+		*op++ = static_cast<uint8_t>(length);
+
+		return op;
+	}
+}
+
+size_t Lz4Codec::GetMaxCompressedSize(size_t size)
+{
+	return size + size / 255 + 16;
+}
+
+size_t Lz4Codec::Compress(const void* source, size_t size, void* destination, size_t capacity)
+{
+	const uint8_t* const begin = static_cast<const uint8_t*>(source);
+	const uint8_t* const end = begin + size;
+
+	uint8_t* op = static_cast<uint8_t*>(destination);
+	uint8_t* const opEnd = op + capacity;
+
+	const uint8_t* anchor = begin;
+
+	if (size > MF_LIMIT)
+	{
+		std::vector<uint32_t> table(size_t{ 1 } << HASH_LOG, ~0u);
+
+		const uint8_t* const matchLimit = end - LAST_LITERALS;
+		const uint8_t* const startLimit = end - MF_LIMIT;
+		const uint8_t* ip = begin;
+
+		while (ip <= startLimit)
+		{
+			const uint32_t sequence = read32(ip);
+			uint32_t& slot = table[hash(sequence)];
+			const uint32_t candidate = slot;
+			slot = static_cast<uint32_t>(ip - begin);
+
+			if (candidate == ~0u || static_cast<size_t>(ip - begin) - candidate > MAX_DISTANCE || read32(begin + candidate) != sequence)
+			{
+				++ip;
+				continue;
+			}
+
+			const uint8_t* match = begin + candidate;
+
+			//  Ȯ
+			while (ip > anchor && match > begin && ip[-1] == match[-1])
+			{
+				--ip;
+				--match;
+			}
+
+			//  Ȯ
+			const uint8_t* matchEnd = ip + MIN_MATCH;
+			const uint8_t* reference = match + MIN_MATCH;
+			while (matchEnd < matchLimit && *matchEnd == *reference)
+			{
+				++matchEnd;
+				++reference;
+			}
+
+			const size_t literalLength = ip - anchor;
+			const size_t matchLength = matchEnd - ip - MIN_MATCH;
+
+			if (static_cast<size_t>(opEnd - op) < 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1)
+				return 0;
+
+			uint8_t* token = op++;
+			*token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+			if (literalLength >= 15)
+				op = writeLength(op, literalLength - 15);
+
+			memcpy(op, anchor, literalLength);
+			op += literalLength;
+
+			const size_t offset = ip - match;
+			*op++ = static_cast<uint8_t>(offset);
+			*op++ = static_cast<uint8_t>(offset >> 8);
+
+			*token |= static_cast<uint8_t>(matchLength >= 15 ? 15 : matchLength);
+			if (matchLength >= 15)
+				op = writeLength(op, matchLength - 15);
+
+			ip = matchEnd;
+			anchor = ip;
+		}
+	}
+
+	//  ͷ
+	const size_t literalLength = end - anchor;
+	if (static_cast<size_t>(opEnd - op) < 1 + literalLength / 255 + 1 + literalLength)
+		return 0;
+
+	uint8_t* token = op++;
+	*token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+	if (literalLength >= 15)
+		op = writeLength(op, literalLength - 15);
+
+	memcpy(op, anchor, literalLength);
+	op += literalLength;
+
+	return op - static_cast<uint8_t*>(destination);
+}
+
+size_t Lz4Codec::Decompress(const void* source, size_t sourceSize, void* destination, size_t size)
+{
+	const uint8_t* ip = static_cast<const uint8_t*>(source);
+	const uint8_t* const ipEnd = ip + sourceSize;
+
+	uint8_t* const begin = static_cast<uint8_t*>(destination);
+	uint8_t* op = begin;
+	uint8_t* const opEnd = op + size;
+
+	auto readLength = [&](size_t& length)
+		{
+			uint8_t value = 255;
+			while (value == 255)
+			{
+				if (ip >= ipEnd)
+					return false;
+
+				value = *ip++;
+				length += value;
+			}
+
+			return true;
+		};
+
+	while (ip < ipEnd)
+	{
+		const uint8_t token = *ip++;
+
+		size_t literalLength = token >> 4;
+		if (literalLength == 15 && !readLength(literalLength))
+			return 0;
+
+		if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op))
+			return 0;
+
+		memcpy(op, ip, literalLength);
+		op += literalLength;
+		ip += literalLength;
+
+		//   ͷ 
+		if (ip == ipEnd)
+			break;
+
+		if (ipEnd - ip < 2)
+			return 0;
+
+		const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+		ip += 2;
+
+		if (offset == 0 || offset > static_cast<size_t>(op - begin))
+			return 0;
+
+		size_t matchLength = token & 15;
+		if (matchLength == 15 && !readLength(matchLength))
+			return 0;
+		matchLength += MIN_MATCH;
+
+		if (matchLength > static_cast<size_t>(opEnd - op))
+			return 0;
+
+		const uint8_t* match = op - offset;
+		if (offset >= matchLength)
+		{
+			memcpy(op, match, matchLength);
+			op += matchLength;
+		}
+		else
+		{
+			// ġ ġ տ  Ʈ (ݺ )
+			for (size_t i = 0; i < matchLength; ++i)
+				*op++ = match[i];
+		}
+	}
+
+	return op - begin;
+}
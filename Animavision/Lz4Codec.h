@@ -0,0 +1,19 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+/// LZ4    /  ( , üũ )
+///   ׸ ϳ  ϳ ,    켱 ؽ ̺   ȸϴ Ž Ī 
+/// ܺ ̺귯    Ἥ ߿ lz4  ٲ㵵  ٽ  ʿ 
+class ANIMAVISION_DLL Lz4Codec
+{
+public:
+	//    ʴ ũ
+	static size_t GetMaxCompressedSize(size_t size);
+
+	//  ũ, capacity  ڶ 0
+	static size_t Compress(const void* source, size_t size, void* destination, size_t capacity);
+
+	//  ũ, ջ Է̰ų size   0
+	static size_t Decompress(const void* source, size_t sourceSize, void* destination, size_t size);
+};
@@ -5,6 +5,8 @@
 #include "DX11Shader.h"
 
 #include "ShaderResource.h"
+#include "VirtualFileSystem.h"
+#include "AssetPack.h"
 #include <fstream>
 
 #include <cereal/types/unordered_map.hpp>
@@ -12,7 +14,7 @@
 namespace cereal
 {
 	template <class Archive>
-	void CEREAL_SAVE_FUNCTION_NAME(Archive& ar, robin_hood::unordered_map<std::string, Material::TextureSlot> const& map)
+	void CEREAL_SAVE_FUNCTION_NAME(Archive& ar, robin_hood::unordered_node_map<std::string, Material::TextureSlot> const& map)
 	{
 		ar(make_size_tag(static_cast<size_type>(map.size())));
 
@@ -22,7 +24,7 @@ namespace cereal
 
 	//! Loading for std-like pair associative containers
 	template <class Archive>
-	void CEREAL_LOAD_FUNCTION_NAME(Archive& ar, robin_hood::unordered_map<std::string, Material::TextureSlot>& map)
+	void CEREAL_LOAD_FUNCTION_NAME(Archive& ar, robin_hood::unordered_node_map<std::string, Material::TextureSlot>& map)
 	{
 		size_type size;
 		ar(make_size_tag(size));
@@ -156,6 +158,11 @@ void Material::SetShader(const std::shared_ptr<Shader>& shader)
 	this->m_Shader = shader;
 	this->m_ShaderString = shader->Name;
 
+	//  ̴  ٽ Ƿ
+	this->m_BoundShader = nullptr;
+	this->m_BoundTextures.clear();
+	this->m_CompiledBindings.clear();
+	this->m_CompiledBindingHash = 0;
 	this->m_Textures.clear();
 
 	switch (Renderer::s_Api)
@@ -192,20 +199,73 @@ void Material::SetShader(const std::shared_ptr<Shader>& shader)
 	}
 }
 
+const std::vector<Material::TextureSlot*>& Material::GetBoundTextures()
+{
+	if (Renderer::s_Api != Renderer::API::DirectX11 || m_Shader == nullptr)
+	{
+		m_BoundTextures.clear();
+		return m_BoundTextures;
+	}
+
+	auto dx11Shader = static_cast<const DX11Shader*>(m_Shader.get());
+	if (m_BoundShader == dx11Shader && m_BoundReflectionVersion == dx11Shader->m_ReflectionVersion)
+		return m_BoundTextures;
+
+	// ̺귯  ε   ̴  ̸ ã 
+	if (m_CompiledBindingHash == dx11Shader->m_TextureBindingHash && m_CompiledBindings.size() == dx11Shader->m_TextureBindings.size())
+	{
+		m_BoundTextures = m_CompiledBindings;
+	}
+	else
+	{
+		m_BoundTextures.clear();
+		m_BoundTextures.reserve(dx11Shader->m_TextureBindings.size());
+
+		for (const auto& binding : dx11Shader->m_TextureBindings)
+		{
+			auto it = m_Textures.find(binding.Name);
+			m_BoundTextures.push_back(it != m_Textures.end() ? &it->second : nullptr);
+		}
+	}
+
+	m_BoundShader = dx11Shader;
+	m_BoundReflectionVersion = dx11Shader->m_ReflectionVersion;
+
+	return m_BoundTextures;
+}
+
 std::shared_ptr<Material> MaterialLibrary::LoadFromFile(const std::string& path)
 {
 	std::string pathString = path;
 	std::replace(pathString.begin(), pathString.end(), '\\', '/');
 
-	std::filesystem::path filePath = std::filesystem::current_path();
-	filePath /= pathString;
+	if (!m_IsCompiledLoaded)
+		LoadCompiled();
 
-	std::ifstream file(filePath);
-	if (!file.is_open())
+	if (auto material = loadFromCompiled(pathString))
+	{
+		m_Materials[pathString] = material;
+		m_Registry.Set(pathString, material);
+
+		return material;
+	}
+
+	return LoadFromJson(pathString);
+}
+
+std::shared_ptr<Material> MaterialLibrary::LoadFromJson(const std::string& path)
+{
+	std::string pathString = path;
+	std::replace(pathString.begin(), pathString.end(), '\\', '/');
+
+	//  ͸    ״ (  ο )
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(pathString, data))
 	{
 		OutputDebugStringA("File is not found\n");
 		return nullptr;
 	}
+	MemoryStream file(data);
 	cereal::JSONInputArchive archive(file);
 
 	std::shared_ptr<Material> material = std::make_shared<Material>();
@@ -216,6 +276,7 @@ std::shared_ptr<Material> MaterialLibrary::LoadFromFile(const std::string& path)
 		material->m_Name = pathString;
 	}
 	m_Materials[pathString] = material;
+	m_Registry.Set(pathString, material);
 
 	return material;
 }
@@ -223,25 +284,245 @@ std::shared_ptr<Material> MaterialLibrary::LoadFromFile(const std::string& path)
 void MaterialLibrary::LoadFromDirectory(const std::string& path)
 {
 	std::filesystem::path directory = path;
-	if (!std::filesystem::exists(directory) || !std::filesystem::is_directory(directory))
+
+	//  + ũ
+	const std::vector<std::string> files = VirtualFileSystem::List(directory);
+	if (files.empty())
 	{
 		OutputDebugStringA("Directory is not found\n");
 		return;
 	}
 
-	// recursive iterator 
-	for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+	for (const auto& file : files)
 	{
-		if (entry.is_regular_file() && entry.path().extension() == ".material")
+		if (std::filesystem::path(file).extension() == ".material")
 		{
-			std::filesystem::path curPath = entry.path();
+			LoadFromFile(file);
+		}
+	}
+}
+
+bool MaterialLibrary::LoadCompiled(const std::string& path)
+{
+	m_IsCompiledLoaded = true;
+	m_Compiled = {};
+	m_CompiledIndices.clear();
+	m_CompiledPath.clear();
+
+	// ̺귯 ü   
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+		return false;
+
+	MemoryStream stream(data);
+
+	try
+	{
+		cereal::BinaryInputArchive archive(stream);
+
+		uint32_t magic = 0;
+		uint32_t version = 0;
+		archive(magic, version);
+
+		if (magic != CompiledMaterialLibrary::MAGIC || version != CompiledMaterialLibrary::VERSION)
+			return false;
+
+		archive(m_Compiled);
+	}
+	catch (const std::exception&)
+	{
+		m_Compiled = {};
+		return false;
+	}
+
+	m_CompiledIndices.reserve(m_Compiled.materials.size());
+	for (uint32_t i = 0; i < m_Compiled.materials.size(); ++i)
+		m_CompiledIndices.emplace(AssetPack::MakeKey(m_Compiled.materials[i].name), i);
 
-			auto absPath = relative(entry);
-			std::string pathString = curPath.string();
-			//std::replace(pathString.begin(), pathString.end(), '\\', '/');
-			LoadFromFile(pathString);
+	m_CompiledPath = path;
+
+	return true;
+}
+
+std::shared_ptr<Material> MaterialLibrary::loadFromCompiled(const std::string& pathString)
+{
+	auto it = m_CompiledIndices.find(AssetPack::MakeKey(pathString));
+	if (it == m_CompiledIndices.end())
+		return nullptr;
+
+	const CompiledMaterial& compiled = m_Compiled.materials[it->second];
+
+	auto material = std::make_shared<Material>();
+	material->m_Name = pathString;
+	if (compiled.shaderIndex < m_Compiled.shaders.size())
+		material->m_ShaderString = m_Compiled.shaders[compiled.shaderIndex];
+
+	std::vector<Material::TextureSlot*> slots;
+	slots.reserve(compiled.slots.size());
+
+	material->m_Textures.reserve(compiled.slots.size());
+	for (const auto& slot : compiled.slots)
+	{
+		std::string texturePath = slot.pathIndex < m_Compiled.texturePaths.size() ? m_Compiled.texturePaths[slot.pathIndex] : "";
+		auto [it, isInserted] = material->m_Textures.emplace(slot.name, Material::TextureSlot{ slot.type, std::move(texturePath), nullptr });
+		slots.push_back(&it->second);
+	}
+
+	// ε  (̴   GetBoundTextures  ؽø ϰ ״ )
+	if (compiled.bindingHash != 0)
+	{
+		material->m_CompiledBindings.reserve(compiled.bindings.size());
+		for (uint32_t index : compiled.bindings)
+			material->m_CompiledBindings.push_back(index < slots.size() ? slots[index] : nullptr);
+
+		material->m_CompiledBindingHash = compiled.bindingHash;
+	}
+
+	return material;
+}
+
+void MaterialLibrary::updateCompiled(const std::string& name, const Material& material)
+{
+	if (!m_IsCompiledLoaded)
+		LoadCompiled();
+
+	const std::string key = AssetPack::MakeKey(name);
+
+	//   ̺귯 ĥ  Ƿ ̹ ࿡   ( ٽ   ٽ )
+	if (m_CompiledPath.empty() || VirtualFileSystem::IsInPack(m_CompiledPath))
+	{
+		m_CompiledIndices.erase(key);
+		return;
+	}
+
+	std::vector<std::string> bindingNames;
+	if (Renderer::s_Api == Renderer::API::DirectX11 && material.m_Shader != nullptr)
+	{
+		for (const auto& binding : static_cast<const DX11Shader*>(material.m_Shader.get())->m_TextureBindings)
+			bindingNames.push_back(binding.Name);
+	}
+
+	m_CompiledIndices[key] = m_Compiled.Set(name, material, bindingNames);
+
+	if (!m_Compiled.Save(m_CompiledPath))
+	{
+		// ũ ̺귯 ״̹Ƿ  ࿡  , MaterialCompiler  ٽ  
+		OutputDebugStringA("Material library save failed\n");
+	}
+}
+
+void CompiledMaterialLibrary::buildIndices()
+{
+	m_ShaderIndices.clear();
+	m_PathIndices.clear();
+	m_MaterialIndices.clear();
+
+	for (uint32_t i = 0; i < shaders.size(); ++i)
+		m_ShaderIndices.emplace(shaders[i], i);
+	for (uint32_t i = 0; i < texturePaths.size(); ++i)
+		m_PathIndices.emplace(texturePaths[i], i);
+	for (uint32_t i = 0; i < materials.size(); ++i)
+		m_MaterialIndices.emplace(materials[i].name, i);
+}
+
+uint32_t CompiledMaterialLibrary::Set(const std::string& name, const Material& material, const std::vector<std::string>& bindingNames)
+{
+	if (m_MaterialIndices.size() != materials.size() || m_ShaderIndices.size() != shaders.size() || m_PathIndices.size() != texturePaths.size())
+		buildIndices();
+
+	//  ڿ NO_INDEX
+	auto intern = [](std::vector<std::string>& table, robin_hood::unordered_map<std::string, uint32_t>& indices, const std::string& value)
+	{
+		if (value.empty())
+			return CompiledMaterial::NO_INDEX;
+
+		auto [it, isInserted] = indices.try_emplace(value, static_cast<uint32_t>(table.size()));
+		if (isInserted)
+			table.push_back(value);
+
+		return it->second;
+	};
+
+	CompiledMaterial compiled;
+	compiled.name = name;
+	compiled.shaderIndex = intern(shaders, m_ShaderIndices, material.m_ShaderString);
+
+	// ε  ( ̸    ó  )
+	robin_hood::unordered_map<std::string, uint32_t> slotIndices;
+	for (const auto& bindingName : bindingNames)
+	{
+		auto it = material.m_Textures.find(bindingName);
+		if (it == material.m_Textures.end() || slotIndices.count(bindingName) != 0)
+			continue;
+
+		slotIndices.emplace(bindingName, static_cast<uint32_t>(compiled.slots.size()));
+		compiled.slots.push_back({ bindingName, it->second.Type, intern(texturePaths, m_PathIndices, it->second.Path) });
+	}
+
+	// ε   ڿ ̸  (  Ź )
+	const size_t boundCount = compiled.slots.size();
+	for (const auto& [slotName, slot] : material.m_Textures)
+	{
+		if (slotIndices.count(slotName) == 0)
+			compiled.slots.push_back({ slotName, slot.Type, intern(texturePaths, m_PathIndices, slot.Path) });
+	}
+
+	std::sort(compiled.slots.begin() + boundCount, compiled.slots.end(),
+		[](const CompiledMaterial::Slot& a, const CompiledMaterial::Slot& b) { return a.name < b.name; });
+
+	if (!bindingNames.empty())
+	{
+		compiled.bindings.reserve(bindingNames.size());
+		for (const auto& bindingName : bindingNames)
+		{
+			auto it = slotIndices.find(bindingName);
+			compiled.bindings.push_back(it != slotIndices.end() ? it->second : CompiledMaterial::NO_INDEX);
 		}
+
+		compiled.bindingHash = DX11Shader::HashTextureBindings(bindingNames);
 	}
+
+	auto [it, isInserted] = m_MaterialIndices.try_emplace(name, static_cast<uint32_t>(materials.size()));
+	if (isInserted)
+		materials.push_back(std::move(compiled));
+	else
+		materials[it->second] = std::move(compiled);
+
+	return it->second;
+}
+
+bool CompiledMaterialLibrary::Save(const std::filesystem::path& path, uint64_t* size) const
+{
+	std::filesystem::path temporaryPath = path;
+	temporaryPath += ".tmp";
+
+	if (path.has_parent_path())
+		std::filesystem::create_directories(path.parent_path());
+
+	bool isSaved = false;
+	{
+		std::ofstream os(temporaryPath, std::ios::binary | std::ios::trunc);
+		if (os.is_open())
+		{
+			{
+				cereal::BinaryOutputArchive archive(os);
+				archive(MAGIC, VERSION, *this);
+			}
+
+			if (size)
+				*size = static_cast<uint64_t>(os.tellp());
+			isSaved = os.good();
+		}
+	}
+
+	if (!isSaved)
+		return false;
+
+	//    д ̺귯   ·  ʵ    ü
+	std::error_code ec;
+	std::filesystem::rename(temporaryPath, path, ec);
+
+	return !ec;
 }
 
 void MaterialLibrary::SaveMaterial(const std::string& name)
@@ -253,6 +534,9 @@ void MaterialLibrary::SaveMaterial(const std::string& name)
 	if (material != m_Materials.end())
 	{
 		archive(*material->second);
+
+		// ̺귯 .material  ð  Ƿ    ħ
+		updateCompiled(name, *material->second);
 	}
 	else
 	{
@@ -2,6 +2,7 @@
 #include "RendererDLL.h"
 
 #include "ShaderResource.h"
+#include "AssetHandle.h"
 
 #define DEFAULT_TEXTURE2D_PATH "./Resources/Textures/Default/defaultmagentapng.dds"
 #define DEFAULT_TEXTURECUBE_PATH "./Resources/Textures/Default/winterLake.dds"
@@ -42,18 +43,97 @@ public:
 	}
 	void SetShader(const std::shared_ptr<Shader>& shader);
 	std::shared_ptr<Shader> GetShader() const { return m_Shader; }
-	robin_hood::unordered_map<std::string, TextureSlot>& GetTextures() { return m_Textures; }
+	robin_hood::unordered_node_map<std::string, TextureSlot>& GetTextures() { return m_Textures; }
 
 	robin_hood::unordered_map<std::string, std::shared_ptr<Texture>>& GetUAVTextures() { return m_UAVTextures; }
 
+	// DX11 ̴ m_TextureBindings  m_Textures   ( ̸ nullptr)
+	// ׸  ε ̸ ã ʵ ̴ ٲų ٽ ϵ  ٽ 
+	const std::vector<TextureSlot*>& GetBoundTextures();
+
 	std::string m_Name;
 
 	// Ʈ shader ã . serialize  ̰ 
 	std::string m_ShaderString;
 	std::shared_ptr<Shader> m_Shader;
-	robin_hood::unordered_map<std::string, TextureSlot> m_Textures;
+	robin_hood::unordered_node_map<std::string, TextureSlot> m_Textures;		//  ̶  ּҰ 
 
 	robin_hood::unordered_map<std::string, std::shared_ptr<Texture>> m_UAVTextures;
+
+private:
+	friend class MaterialLibrary;
+
+	std::vector<TextureSlot*> m_BoundTextures;
+	const Shader* m_BoundShader = nullptr;
+	uint32_t m_BoundReflectionVersion = 0;
+
+	// ϵ ̺귯 о  ̴ ε   (ؽð ̴  ״ m_BoundTextures)
+	std::vector<TextureSlot*> m_CompiledBindings;
+	uint64_t m_CompiledBindingHash = 0;
+};
+
+/// MaterialCompiler  .material(JSON)    ̳ʸ ̺귯
+/// ̴ ؽó δ ǥ   ΰ Ƽ ǥ ε Ƿ,  ϳ   о Ľ  
+struct CompiledMaterial
+{
+	static constexpr uint32_t NO_INDEX = ~0u;
+
+	struct Slot
+	{
+		std::string name;					// ̴ ؽó ε ̸
+		Texture::Type type = Texture::Type::Texture2D;
+		uint32_t pathIndex = NO_INDEX;		// texturePaths (ΰ   NO_INDEX)
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(name, type, pathIndex);
+		}
+	};
+
+	std::string name;						//  .material 
+	uint32_t shaderIndex = NO_INDEX;		// shaders
+	std::vector<Slot> slots;				// ̴ ε , ε   ڿ ̸ 
+	std::vector<uint32_t> bindings;			// ؽó ε slots ε (  NO_INDEX)
+	uint64_t bindingHash = 0;				// bindings   ε ̸  (DX11Shader::HashTextureBindings, 0 ̸ )
+
+	template <class Archive>
+	void serialize(Archive& archive)
+	{
+		archive(name, shaderIndex, slots, bindings, bindingHash);
+	}
+};
+
+struct CompiledMaterialLibrary
+{
+	static constexpr uint32_t MAGIC = 0x4C4D4D41;	// "AMML"
+	static constexpr uint32_t VERSION = 2;
+	static constexpr const char* DEFAULT_PATH = "./Resources/Materials.matlib";
+
+	std::vector<std::string> shaders;
+	std::vector<std::string> texturePaths;
+	std::vector<CompiledMaterial> materials;
+
+	// material  name  ְų ٲٰ materials ε 
+	// bindingNames  ̴ ؽó ε ̸  (𸣸 , ׷ Ÿӿ ̸ ã)
+	uint32_t Set(const std::string& name, const Material& material, const std::vector<std::string>& bindingNames);
+
+	// MAGIC, VERSION  Բ path   (   üϹǷ д      )
+	bool Save(const std::filesystem::path& path, uint64_t* size = nullptr) const;
+
+	template <class Archive>
+	void serialize(Archive& archive)
+	{
+		archive(shaders, texturePaths, materials);
+	}
+
+private:
+	void buildIndices();
+
+	// ȭ , Set  ó ȣ  
+	robin_hood::unordered_map<std::string, uint32_t> m_ShaderIndices;
+	robin_hood::unordered_map<std::string, uint32_t> m_PathIndices;
+	robin_hood::unordered_map<std::string, uint32_t> m_MaterialIndices;
 };
 
 
@@ -61,16 +141,28 @@ public:
 class ANIMAVISION_DLL MaterialLibrary
 {
 public:
+	// ϵ ̺귯  ű⼭,  JSON
+	// .material  ð   (Ϳ ϸ SaveMaterial  ̺귯 ħ)
 	std::shared_ptr<Material> LoadFromFile(const std::string& path);
+	std::shared_ptr<Material> LoadFromJson(const std::string& path);
 
 	void LoadFromDirectory(const std::string& path);
 
-	void AddMaterial(const std::shared_ptr<Material>& material) { m_Materials[material->m_Name] = material;	}
+	// ϵ ̺귯 о  (LoadFromFile  ó ȣ  ⺻ η  ), ų  ٸ false
+	bool LoadCompiled(const std::string& path = CompiledMaterialLibrary::DEFAULT_PATH);
+
+	void AddMaterial(const std::shared_ptr<Material>& material)
+	{
+		m_Materials[material->m_Name] = material;
+		m_Registry.Set(material->m_Name, material);
+	}
 
 	// save material in map to file
+	// ũ ִ ϵ ̺귯  ħ ( ̸ ̹ ࿡ JSON  )
 	void SaveMaterial(const std::string& name);
 
 	std::map<std::string, std::shared_ptr<Material>>& GetMaterials() { return m_Materials; }
+	AssetRegistry<Material>& GetRegistry() { return m_Registry; }
 
 	std::shared_ptr<Material> GetMaterial(const std::string& name)
 	{
@@ -88,6 +180,15 @@ public:
 	}
 
 private:
+	std::shared_ptr<Material> loadFromCompiled(const std::string& pathString);
+	void updateCompiled(const std::string& name, const Material& material);
+
 	std::map<std::string, std::shared_ptr<Material>> m_Materials;
+	AssetRegistry<Material> m_Registry;		//   ̸  ڵ ȸ
+
+	CompiledMaterialLibrary m_Compiled;
+	robin_hood::unordered_map<std::string, uint32_t> m_CompiledIndices;		// AssetPack::MakeKey(̸) -> materials
+	std::string m_CompiledPath;													//  ̺귯 (  ڿ)
+	bool m_IsCompiledLoaded = false;
 
 };
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include "pch.h"
+#include "MaterialCompiler.h"
+
+#include "Material.h"
+#include "DX11Shader.h"
+#include "VirtualFileSystem.h"
+
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+	struct FileReport
+	{
+		std::string path;
+		uint32_t slots = 0;
+		uint64_t size = 0;
+		float jsonLoadMilliseconds = 0.f;		// б + JSON Ľ
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(path), CEREAL_NVP(slots), CEREAL_NVP(size), CEREAL_NVP(jsonLoadMilliseconds));
+		}
+	};
+
+	struct TotalReport
+	{
+		uint32_t materials = 0;
+		uint32_t shaders = 0;					// ߺ  ̴ 
+		uint32_t texturePaths = 0;				// ߺ  ؽó  
+		uint32_t slots = 0;
+		uint32_t ordered = 0;					// ̴ ε   Ƽ  ( Ÿӿ ̸ ã)
+		uint32_t failed = 0;
+		uint64_t jsonBytes = 0;
+		uint64_t libraryBytes = 0;
+		float jsonLoadMilliseconds = 0.f;		//  : .material  а Ľ
+		float compiledLoadMilliseconds = 0.f;	//  : ̺귯   б +  Ƽ 
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(materials), CEREAL_NVP(shaders), CEREAL_NVP(texturePaths), CEREAL_NVP(slots), CEREAL_NVP(ordered), CEREAL_NVP(failed),
+				CEREAL_NVP(jsonBytes), CEREAL_NVP(libraryBytes),
+				CEREAL_NVP(jsonLoadMilliseconds), CEREAL_NVP(compiledLoadMilliseconds));
+		}
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	float elapsedMilliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	bool isSame(const Material& a, const Material& b)
+	{
+		if (a.m_ShaderString != b.m_ShaderString || a.m_Textures.size() != b.m_Textures.size())
+			return false;
+
+		for (const auto& [name, slot] : a.m_Textures)
+		{
+			auto it = b.m_Textures.find(name);
+			if (it == b.m_Textures.end() || it->second.Type != slot.Type || it->second.Path != slot.Path)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+MaterialCompiler::MaterialCompiler(MaterialCompileSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+bool MaterialCompiler::Run()
+{
+	std::vector<std::string> errors;
+	std::vector<FileReport> reports;
+	TotalReport total;
+
+	// Ÿ MaterialLibrary::LoadFromDirectory   ̸
+	std::vector<std::string> files;
+	for (auto file : VirtualFileSystem::List(_settings.sourcePath))
+	{
+		if (std::filesystem::path(file).extension() != ".material")
+			continue;
+
+		std::replace(file.begin(), file.end(), '\\', '/');
+		files.push_back(std::move(file));
+	}
+
+	std::ranges::sort(files);
+
+	//  : JSON
+	MaterialLibrary jsonLibrary;
+	std::vector<std::pair<std::string, std::shared_ptr<Material>>> sources;
+
+	const auto jsonStart = Clock::now();
+
+	for (const auto& file : files)
+	{
+		FileReport report;
+		report.path = file;
+		VirtualFileSystem::GetSize(file, report.size);
+
+		const auto start = Clock::now();
+		std::shared_ptr<Material> material;
+		try
+		{
+			material = jsonLibrary.LoadFromJson(file);
+		}
+		catch (const std::exception& e)
+		{
+			errors.push_back("parse failed : " + file + " (" + e.what() + ")");
+		}
+		report.jsonLoadMilliseconds = elapsedMilliseconds(start);
+
+		if (material == nullptr)
+		{
+			++total.failed;
+			continue;
+		}
+
+		report.slots = static_cast<uint32_t>(material->m_Textures.size());
+		total.jsonBytes += report.size;
+
+		reports.push_back(std::move(report));
+		sources.emplace_back(file, std::move(material));
+	}
+
+	total.jsonLoadMilliseconds = elapsedMilliseconds(jsonStart);
+
+	// ̴ ؽó ε  (̽  ̴ ĳ blob  ÷, ̴ ġ ʾ  )
+	ShaderCache shaderCache(std::make_unique<D3DShaderCompiler>());
+	shaderCache.Load();
+
+	std::unordered_map<std::string, std::vector<std::string>> bindingNames;
+
+	// ̴, ؽó  ǥ + ε ( ε   Ÿӿ ̸ ã )
+	CompiledMaterialLibrary library;
+
+	for (const auto& [file, material] : sources)
+	{
+		auto [names, isInserted] = bindingNames.try_emplace(material->m_ShaderString);
+		if (isInserted && !material->m_ShaderString.empty())
+			names->second = DX11Shader::GetTextureBindingNames(shaderCache, material->m_ShaderString);
+
+		const CompiledMaterial& compiled = library.materials[library.Set(file, *material, names->second)];
+
+		total.slots += static_cast<uint32_t>(compiled.slots.size());
+		if (compiled.bindingHash != 0)
+			++total.ordered;
+	}
+
+	shaderCache.Save();
+
+	total.materials = static_cast<uint32_t>(library.materials.size());
+	total.shaders = static_cast<uint32_t>(library.shaders.size());
+	total.texturePaths = static_cast<uint32_t>(library.texturePaths.size());
+
+	const bool isSaved = library.Save(_settings.outputPath, &total.libraryBytes);
+	if (!isSaved)
+		errors.push_back("library save failed : " + _settings.outputPath.generic_string());
+
+	//  : ̺귯 (ŸӰ  η а JSON  )
+	MaterialLibrary compiledLibrary;
+
+	const auto compiledStart = Clock::now();
+
+	const bool isLoaded = isSaved && compiledLibrary.LoadCompiled(_settings.outputPath.generic_string());
+	std::vector<std::shared_ptr<Material>> loaded;
+	loaded.reserve(sources.size());
+	for (const auto& [file, material] : sources)
+	{
+		if (!isLoaded)
+			break;
+
+		loaded.push_back(compiledLibrary.LoadFromFile(file));
+	}
+
+	total.compiledLoadMilliseconds = elapsedMilliseconds(compiledStart);
+
+	if (isSaved && !isLoaded)
+		errors.push_back("library verify failed : " + _settings.outputPath.generic_string());
+
+	for (size_t i = 0; i < loaded.size(); ++i)
+	{
+		if (loaded[i] == nullptr || !isSame(*sources[i].second, *loaded[i]))
+		{
+			errors.push_back("library verify failed : " + sources[i].first);
+			++total.failed;
+		}
+	}
+
+	// JSON   ɸ 
+	std::ranges::sort(reports, std::greater{}, &FileReport::jsonLoadMilliseconds);
+
+	std::ofstream file(_settings.reportPath);
+	if (file.is_open())
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(
+			cereal::make_nvp("source", _settings.sourcePath.generic_string()),
+			cereal::make_nvp("output", _settings.outputPath.generic_string()),
+			cereal::make_nvp("total", total),
+			cereal::make_nvp("files", reports),
+			cereal::make_nvp("errors", errors)
+		);
+	}
+
+	return isLoaded && file.good() && total.failed == 0;
+}
+
+bool MaterialCompiler::ParseArguments(const std::vector<std::string>& args, MaterialCompileSettings& settings)
+{
+	bool isCompile = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size() && !args[i + 1].starts_with("--");
+
+		if (arg == "--compile-materials")
+		{
+			if (hasValue)
+				settings.sourcePath = args[++i];
+			isCompile = true;
+		}
+		else if (arg == "--material-out" && hasValue)
+			settings.outputPath = args[++i];
+		else if (arg == "--report" && hasValue)
+			settings.reportPath = args[++i];
+	}
+
+	return isCompile;
+}
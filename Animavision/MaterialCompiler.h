@@ -0,0 +1,29 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+struct MaterialCompileSettings
+{
+	std::filesystem::path sourcePath = "./Resources";
+	std::filesystem::path outputPath = "./Resources/Materials.matlib";		// CompiledMaterialLibrary::DEFAULT_PATH
+	std::filesystem::path reportPath = "./material_compile.json";
+};
+
+/// .material(JSON)   о CompiledMaterialLibrary ϳ ϴ  
+///    Ƽ JSON    ̺귯   ð ,   Ȯ  JSON  
+///  ѿ  --pack-assets   
+class ANIMAVISION_DLL MaterialCompiler
+{
+public:
+	explicit MaterialCompiler(MaterialCompileSettings settings);
+
+	// ̺귯,   (  .material    , ϳ ϸ false)
+	bool Run();
+
+	// "--compile-materials [dir] [--material-out path] [--report path]"
+	// --compile-materials   false
+	static bool ParseArguments(const std::vector<std::string>& args, MaterialCompileSettings& settings);
+
+private:
+	MaterialCompileSettings _settings;
+};
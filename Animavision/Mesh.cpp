@@ -2,9 +2,13 @@
 #include "Mesh.h"
 #include "ShaderResource.h"
 #include "Renderer.h"
+#include "MeshQuantizer.h"
 
 void Mesh::CreateBuffers(Renderer* renderer)
 {
+	//    ε  Ǯ ٷ  (浹, ŷ MeshQuantizer::DecodePositions)
+	const bool isUnpacked = MeshQuantizer::Unpack(*this);
+
 	vertexBuffer = Buffer::Create(renderer, this, Buffer::Usage::Vertex);
 	indexBuffer = Buffer::Create(renderer, this, Buffer::Usage::Index);
 
@@ -13,6 +17,9 @@ void Mesh::CreateBuffers(Renderer* renderer)
 		// blas ߰Ѵ.
 		renderer->AddBottomLevelAS(*this, true);
 	}
+
+	if (isUnpacked)
+		MeshQuantizer::ReleaseUnpacked(*this);
 }
 
 std::shared_ptr<Mesh> MeshGenerator::CreateCube(float width, float height, float depth)
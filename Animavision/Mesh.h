@@ -91,6 +91,49 @@ struct AnimationClip
 // TODO ̰ IMesh ߰ڴ..
 // UV 3 4  þ  Ȯ ־ϳ..
 
+// FIFO  ĳ ùķ̼  (MeshOptimizer::AnalyzeVertexCache)
+struct VertexCacheStats
+{
+	float acmr = 0.0f;			// ﰢ ȯ   (0.5 ~ 3.0,  )
+	float atvr = 0.0f;			//   ȯ   (1.0  )
+	float overfetch = 0.0f;		// ĳ   Ʈ /   Ʈ (1.0  )
+};
+
+// Ʈ  ȭ   (.mcm   )
+struct MeshOptimizeStats
+{
+	VertexCacheStats before;
+	VertexCacheStats after;
+	uint32_t weldedVertices = 0;	// Ӽ   ģ  
+	uint32_t unusedVertices = 0;	// ε  ʾ   
+};
+
+// ܼȭ LOD ϳ ε  (MeshSimplifier, LOD 0     )
+struct SubMeshLod
+{
+	uint32_t indexCount = 0;
+	uint32_t indexOffset = 0;
+	float error = 0.0f;				// ޽ ٿ     
+};
+
+//   (MeshQuantizer, .mcm  CPU ֿ 24 Ʈ, float  64 Ʈ)
+struct PackedVertex
+{
+	uint16_t position[3];		// ޽ ٿ  unorm16
+	uint16_t bitangentSign;		// 1 : cross(normal, tangent) , 0 : ݴ
+	int16_t normal[2];			// ȸü snorm16
+	int16_t tangent[2];			// ȸü snorm16
+	uint16_t uv[2];				// half
+	uint16_t uv2[2];			// half
+};
+
+//   ġ (12 Ʈ, BoneWeight  32 Ʈ)
+struct PackedSkin
+{
+	uint16_t boneIndex[4];
+	uint8_t weight[4];			// unorm8,  255  ǵ 
+};
+
 struct SubMeshDescriptor
 {
 	SubMeshDescriptor() = default;
@@ -108,6 +151,24 @@ struct SubMeshDescriptor
 	// ޽ ε ޶  ֱ  ⿡ ; Ѵ..
 	std::unordered_map<std::string, std::pair<uint32_t, Matrix>> boneIndexMap;
 
+	MeshOptimizeStats optimizeStats;
+
+	//  ġ  : positionMin + position / 65535 * positionExtent
+	Vector3 positionMin;
+	Vector3 positionExtent;
+
+	// LOD 1  (LOD 0  indexCount / indexOffset), ε mesh.indices  LOD 0  ڿ 
+	std::vector<SubMeshLod> lods;
+
+	// ܰ谡   ģ LOD  ü
+	SubMeshLod GetLod(uint32_t level) const
+	{
+		if (level == 0 || lods.empty())
+			return { indexCount, indexOffset, 0.0f };
+
+		return lods[(std::min)(level, static_cast<uint32_t>(lods.size())) - 1];
+	}
+
 	// â : ٿڽ ߰ϱ ؾߵȴ. ŷ 
 	// BoundingBox boundingBox;
 };
@@ -127,6 +188,12 @@ public:
 	std::vector<BoneWeight> boneWeights;
 	std::vector<Vector4> colors;
 
+	//   (MeshQuantizer::Pack),  float 迭 ε  Ǯٰ 
+	std::vector<PackedVertex> packedVertices;
+	std::vector<PackedSkin> packedSkin;
+	std::vector<uint32_t> packedColors;		// RGBA unorm8
+	uint32_t packedAttributes = 0;			// MeshQuantizer::Attribute,   ִ float 迭
+
 	std::shared_ptr<Buffer> vertexBuffer = nullptr;
 	std::shared_ptr<Buffer> indexBuffer = nullptr;
 
@@ -137,17 +204,38 @@ public:
 	DirectX::BoundingBox boundingBox;
 	DirectX::BoundingSphere boundingSphere;
 
+	// LOD ܰ躰  (޽  ִ, ٿ  ), [0]  ̶ 0
+	std::vector<float> lodErrors;
+
 	void CreateBuffers(Renderer* renderer);
 
 	uint32_t GetVertexCount() const
 	{
-		return static_cast<uint32_t>(vertices.size());
+		return static_cast<uint32_t>(vertices.empty() ? packedVertices.size() : vertices.size());
 	}
 
 	uint32_t GetIndexCount() const
 	{
 		return static_cast<uint32_t>(indices.size());
 	}
+
+	uint32_t GetLodCount() const
+	{
+		return lodErrors.empty() ? 1 : static_cast<uint32_t>(lodErrors.size());
+	}
+
+	// LOD 0 ε  (ŷ, 浹 ޽ô   )
+	uint32_t GetBaseIndexCount() const
+	{
+		if (subMeshDescriptors.empty())
+			return GetIndexCount();
+
+		uint32_t count = 0;
+		for (const auto& subMesh : subMeshDescriptors)
+			count = (std::max)(count, subMesh.indexOffset + subMesh.indexCount);
+
+		return count;
+	}
 };
 
 namespace cereal
@@ -185,10 +273,44 @@ namespace cereal
 			smd.indexOffset, 
 			smd.vertexCount, 
 			smd.vertexOffset,
-			smd.boneIndexMap
+			smd.boneIndexMap,
+			smd.optimizeStats,
+			smd.positionMin,
+			smd.positionExtent,
+			smd.lods
 		);
 	}
 
+	template <class Archive>
+	void serialize(Archive& archive, PackedVertex& pv)
+	{
+		archive(pv.position, pv.bitangentSign, pv.normal, pv.tangent, pv.uv, pv.uv2);
+	}
+
+	template <class Archive>
+	void serialize(Archive& archive, PackedSkin& ps)
+	{
+		archive(ps.boneIndex, ps.weight);
+	}
+
+	template <class Archive>
+	void serialize(Archive& archive, SubMeshLod& lod)
+	{
+		archive(lod.indexCount, lod.indexOffset, lod.error);
+	}
+
+	template <class Archive>
+	void serialize(Archive& archive, VertexCacheStats& stats)
+	{
+		archive(stats.acmr, stats.atvr, stats.overfetch);
+	}
+
+	template <class Archive>
+	void serialize(Archive& archive, MeshOptimizeStats& stats)
+	{
+		archive(stats.before, stats.after, stats.weldedVertices, stats.unusedVertices);
+	}
+
 	template <class Archive>
 	void serialize(Archive& archive, Vector2& v2)
 	{
@@ -217,7 +339,9 @@ namespace cereal
 		        mesh.vertices, mesh.indices, mesh.normals, mesh.uv, mesh.uv2, mesh.tangents, mesh.bitangents,
 		        mesh.boneWeights, mesh.colors,
 		        mesh.subMeshCount, mesh.subMeshDescriptors,
-		        mesh.boundingBox, mesh.boundingSphere);
+		        mesh.boundingBox, mesh.boundingSphere,
+		        mesh.lodErrors,
+		        mesh.packedVertices, mesh.packedSkin, mesh.packedColors, mesh.packedAttributes);
 
 	}
 	
@@ -3,7 +3,12 @@
 
 #include "Mesh.h"
 #include "ModelLoader.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "MeshQuantizer.h"
+#include "VirtualFileSystem.h"
 
+#include <format>
 #include <fstream>
 
 
@@ -22,17 +27,22 @@ void MeshLibrary::LoadMeshesFromFile(const std::string& path)
 		return;
 	}
 
+	if (!_loadedFiles.insert(AssetIndex::MakeKey(filePath)).second)
+	{
+		return;
+	}
+
+	_index.AddFile(path);
+
 	std::filesystem::path mcmPath = filePath;
 
 	mcmPath.replace_extension(".mcm");
 
-	MCMFormat* mcm = nullptr;
+	//  Ʈ   ĳ
+	MCMFormat* mcm = loadMeshesFromMCM(mcmPath.string());
 
-	if (std::filesystem::exists(mcmPath))
-	{
-		mcm = loadMeshesFromMCM(mcmPath.string());
-	}
-	else
+	// ĳð ų  ̸ ٽ Ʈ
+	if (!mcm && std::filesystem::exists(filePath))
 	{
 		mcm = loadMeshesFromFBX(path);
 		if (mcm)
@@ -49,6 +59,8 @@ void MeshLibrary::LoadMeshesFromFile(const std::string& path)
 			mesh->CreateBuffers(_renderer);
 			assert(!_meshes.contains(mesh->name));
 			_meshes[mesh->name] = mesh;
+			_registry.Set(mesh->name, mesh);
+			_index.Add(mesh->name, path);
 		}
 
 		delete mcm;
@@ -57,9 +69,24 @@ void MeshLibrary::LoadMeshesFromFile(const std::string& path)
 
 MCMFormat* MeshLibrary::loadMeshesFromMCM(const std::string& path)
 {
-	std::ifstream is(path, std::ios::binary);
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+	{
+		return nullptr;
+	}
+
+	MemoryStream is(data);
 	cereal::BinaryInputArchive archive(is);
 
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	archive(magic, version);
+
+	if (magic != MCMFormat::MAGIC || version != MCMFormat::VERSION)
+	{
+		return nullptr;
+	}
+
 	MCMFormat* mcm = new MCMFormat;
 	archive(*mcm);
 
@@ -71,7 +98,7 @@ void MeshLibrary::saveMeshesToMCM(const std::string& path, MCMFormat* mcm)
 	std::ofstream os(path, std::ios::binary);
 	cereal::BinaryOutputArchive archive(os);
 
-	archive(*mcm);
+	archive(MCMFormat::MAGIC, MCMFormat::VERSION, *mcm);
 }
 
 /// mcm ־ ش.
@@ -103,11 +130,31 @@ MCMFormat* MeshLibrary::loadMeshesFromFBX(const std::string& path)
 
 	for (auto& mesh : model->GetMeshes())
 	{
+		//  ĳ, ο,  fetch  ġ ( .mcm  Ǿ  ʹ  )
+		MeshOptimizer::Optimize(*mesh);
+
+		// LOD ü ȭ LOD 0   ״ 
+		MeshSimplifier::GenerateLods(*mesh);
+
+		//  Ӽ  (.mcm   迭 )
+		[[maybe_unused]] const size_t unpackedBytes = MeshQuantizer::GetVertexMemory(*mesh);
+		MeshQuantizer::Pack(*mesh);
+
 		//_meshes[mesh->name] = std::shared_ptr<Mesh>(mesh);
 		mcm->meshes.push_back(std::shared_ptr<Mesh>(mesh));
 #ifdef _DEBUG
-		OutputDebugStringA(mesh->name.c_str());
-		OutputDebugStringA("\n");
+		OutputDebugStringA(std::format("{} : vertex memory {} -> {} bytes\n", mesh->name, unpackedBytes, MeshQuantizer::GetVertexMemory(*mesh)).c_str());
+
+		for (const auto& subMesh : mesh->subMeshDescriptors)
+		{
+			const auto& stats = subMesh.optimizeStats;
+			OutputDebugStringA(std::format("  {} : ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, overfetch {:.3f} -> {:.3f}, welded {}, unused {}\n",
+				subMesh.name, stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr,
+				stats.before.overfetch, stats.after.overfetch, stats.weldedVertices, stats.unusedVertices).c_str());
+
+			for (const auto& lod : subMesh.lods)
+				OutputDebugStringA(std::format("    LOD : {} triangles, error {:.4f}\n", lod.indexCount / 3, lod.error).c_str());
+		}
 #endif
 	}
 
@@ -119,24 +166,62 @@ void MeshLibrary::LoadMeshesFromDirectory(const std::string& path)
 	//  Լ ð غ
 
 	std::filesystem::path directory(path);
-	if (!std::filesystem::exists(directory))
+
+	for (const auto& source : AssetIndex::ListSources(directory, ".mcm", true))
 	{
-		return;
+		LoadMeshesFromFile(source);
 	}
 
-	for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+	_index.Save(directory / INDEX_FILE);
+}
+
+void MeshLibrary::IndexDirectory(const std::string& path)
+{
+	std::filesystem::path directory(path);
+
+	_index.Load(directory / INDEX_FILE);
+
+	//  Ŀ ߰ fbx (  )   о ̸ ˾Ƴ
+	bool isChanged = false;
+	for (const auto& source : AssetIndex::ListSources(directory, ".mcm", true))
 	{
-		if (entry.is_regular_file())
+		if (!_index.HasFile(source))
 		{
-			LoadMeshesFromFile(entry.path().string());
+			LoadMeshesFromFile(source);
+			isChanged = true;
 		}
 	}
+
+	if (isChanged)
+	{
+		_index.Save(directory / INDEX_FILE);
+	}
+}
+
+bool MeshLibrary::LoadMesh(const std::string& name)
+{
+	if (_meshes.contains(name))
+	{
+		return true;
+	}
+
+	const std::string* source = _index.Find(name);
+	if (source == nullptr || _loadedFiles.contains(*source))
+	{
+		return false;
+	}
+
+	//  fbx  ٸ ޽õ Բ ö
+	LoadMeshesFromFile(std::string(*source));
+
+	return _meshes.contains(name);
 }
 
 void MeshLibrary::AddMesh(std::shared_ptr<Mesh> mesh)
 {
 	mesh->CreateBuffers(_renderer);
 	_meshes[mesh->name] = mesh;
+	_registry.Set(mesh->name, mesh);
 }
 
 std::shared_ptr<Mesh> MeshLibrary::GetMesh(const std::string& name)
@@ -1,11 +1,20 @@
 #pragma once
 
+#include "AssetHandle.h"
+#include "AssetIndex.h"
+
 class Mesh;
 class Renderer;
 
 class MCMFormat
 {
 public:
+	//  տ , ٸ ĳø  FBX  ٽ Ʈ
+	static constexpr uint32_t MAGIC = 0x4D434D41;	// "AMCM"
+	static constexpr uint32_t VERSION = 3;			// 1 : ޽ ȭ (ε/ ġ, ȭ )
+													// 2 : ޽ LOD ε , ޽ LOD 
+													// 3 :   (PackedVertex, PackedSkin, ޽ ġ ٿ)
+
 	std::vector<std::shared_ptr<Mesh>> meshes;
 
 	template <class Archive>
@@ -18,17 +27,26 @@ public:
 class MeshLibrary
 {
 public:
+	static constexpr const char* INDEX_FILE = "meshes.index";	// ޽ ̸ -> fbx (͸)
+
 	MeshLibrary(Renderer* renderer);
 
+	// ̹   ٽ  
 	void LoadMeshesFromFile(const std::string& path);
+	//    INDEX_FILE  
 	void LoadMeshesFromDirectory(const std::string& path);
 
+	//  ε : INDEX_FILE   (ο   fbx  ٷ а  ), ͸ ϳ 
+	void IndexDirectory(const std::string& path);
+	// name  ִ fbx   (̹  true)
+	bool LoadMesh(const std::string& name);
 
 	void AddMesh(std::shared_ptr<Mesh> mesh);
 
 	std::shared_ptr<Mesh> GetMesh(const std::string& name);
 
 	std::map<std::string, std::shared_ptr<Mesh>>& GetMeshes() { return _meshes; }
+	AssetRegistry<Mesh>& GetRegistry() { return _registry; }
 
 private:
 	MCMFormat* loadMeshesFromFBX(const std::string& path);
@@ -38,5 +56,9 @@ private:
 private:
 	Renderer* _renderer = nullptr;
 	std::map<std::string, std::shared_ptr<Mesh>> _meshes;
+	AssetRegistry<Mesh> _registry;		//   ̸  ڵ ȸ
+
+	AssetIndex _index;
+	robin_hood::unordered_set<std::string> _loadedFiles;	// AssetIndex::MakeKey
 };
 
@@ -0,0 +1,597 @@
+#include "pch.h"
+#include "MeshOptimizer.h"
+
+#include "Mesh.h"
+
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+
+namespace
+{
+	constexpr uint32_t INVALID_INDEX = ~0u;
+
+	//  ĳ  (64 Ʈ, 128KB)
+	constexpr uint32_t CACHE_LINE_SIZE = 64;
+	constexpr uint32_t CACHE_LINE_COUNT = 128 * 1024 / CACHE_LINE_SIZE;
+
+	// FIFO ĳÿ  ְ ̽  ȯ (Ÿӽ ̷ ĳ ȿ ִ Ǵ)
+	uint32_t updateCache(const uint32_t* triangle, uint32_t cacheSize, std::vector<uint32_t>& timestamps, uint32_t& timestamp)
+	{
+		uint32_t misses = 0;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			if (timestamp - timestamps[triangle[i]] > cacheSize)
+			{
+				timestamps[triangle[i]] = timestamp++;
+				++misses;
+			}
+		}
+
+		return misses;
+	}
+
+	// ޽    Ӽ (迭 ũⰡ    Ӽ)
+	struct VertexAttributes
+	{
+		explicit VertexAttributes(const Mesh& mesh)
+		{
+			const size_t count = mesh.vertices.size();
+
+			auto add = [this, count](const auto& attribute)
+				{
+					if (attribute.size() == count)
+						streams.push_back({ reinterpret_cast<const uint8_t*>(attribute.data()), sizeof(attribute[0]) });
+				};
+
+			add(mesh.vertices);
+			add(mesh.normals);
+			add(mesh.uv);
+			add(mesh.uv2);
+			add(mesh.tangents);
+			add(mesh.bitangents);
+			add(mesh.boneWeights);
+			add(mesh.colors);
+		}
+
+		uint64_t Hash(uint32_t vertex) const
+		{
+			// FNV-1a
+			uint64_t hash = 14695981039346656037ull;
+
+			for (const auto& [data, size] : streams)
+			{
+				const uint8_t* bytes = data + static_cast<size_t>(vertex) * size;
+
+				for (size_t i = 0; i < size; ++i)
+					hash = (hash ^ bytes[i]) * 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+		bool Equals(uint32_t lhs, uint32_t rhs) const
+		{
+			for (const auto& [data, size] : streams)
+			{
+				if (memcmp(data + static_cast<size_t>(lhs) * size, data + static_cast<size_t>(rhs) * size, size) != 0)
+					return false;
+			}
+
+			return true;
+		}
+
+		std::vector<std::pair<const uint8_t*, size_t>> streams;
+	};
+
+	//  Ӽ   ó   ħ, ģ  ȯ
+	uint32_t weldVertices(std::vector<uint32_t>& indices, const VertexAttributes& attributes, uint32_t vertexOffset, uint32_t vertexCount)
+	{
+		std::vector<uint32_t> remap(vertexCount);
+		std::unordered_multimap<uint64_t, uint32_t> unique;
+		unique.reserve(vertexCount);
+
+		uint32_t welded = 0;
+
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			const uint64_t hash = attributes.Hash(vertexOffset + v);
+			remap[v] = v;
+
+			auto [begin, end] = unique.equal_range(hash);
+			for (auto it = begin; it != end; ++it)
+			{
+				if (attributes.Equals(vertexOffset + it->second, vertexOffset + v))
+				{
+					remap[v] = it->second;
+					++welded;
+					break;
+				}
+			}
+
+			if (remap[v] == v)
+				unique.emplace(hash, v);
+		}
+
+		if (welded > 0)
+		{
+			for (auto& index : indices)
+				index = remap[index];
+		}
+
+		return welded;
+	}
+
+	/*------------------------------
+		 ĳ (Tom Forsyth, Linear-Speed Vertex Cache Optimisation)
+	------------------------------*/
+	float vertexScore(int cachePosition, uint32_t liveTriangles)
+	{
+		constexpr float CACHE_DECAY_POWER = 1.5f;
+		constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+		constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+		if (liveTriangles == 0)
+			return -1.0f;
+
+		float score = 0.0f;
+
+		if (cachePosition >= 0)
+		{
+			//   ﰢ   ﰢ ٷ ̾ ʵ  
+			if (cachePosition < 3)
+			{
+				score = LAST_TRIANGLE_SCORE;
+			}
+			else
+			{
+				const float scaler = 1.0f / (MeshOptimizer::OPTIMIZE_CACHE_SIZE - 3);
+				score = std::pow(1.0f - (cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+			}
+		}
+
+		//  ﰢ     
+		score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(liveTriangles), -VALENCE_BOOST_POWER);
+
+		return score;
+	}
+
+	void optimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount)
+	{
+		constexpr int CACHE_SIZE = static_cast<int>(MeshOptimizer::OPTIMIZE_CACHE_SIZE);
+
+		const size_t triangleCount = indices.size() / 3;
+
+		if (triangleCount < 2)
+			return;
+
+		//  -> ﰢ   (CSR)
+		std::vector<uint32_t> liveTriangles(vertexCount, 0);
+		for (auto index : indices)
+			++liveTriangles[index];
+
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+
+		std::vector<uint32_t> adjacency(indices.size());
+		{
+			std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (size_t t = 0; t < triangleCount; ++t)
+			{
+				for (int i = 0; i < 3; ++i)
+					adjacency[fill[indices[t * 3 + i]]++] = static_cast<uint32_t>(t);
+			}
+		}
+
+		std::vector<int> cachePositions(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			vertexScores[v] = vertexScore(-1, liveTriangles[v]);
+
+		std::vector<float> triangleScores(triangleCount);
+		std::vector<bool> isEmitted(triangleCount, false);
+		for (size_t t = 0; t < triangleCount; ++t)
+			triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+		std::vector<uint32_t> cache;
+		std::vector<uint32_t> nextCache;
+		cache.reserve(CACHE_SIZE + 3);
+		nextCache.reserve(CACHE_SIZE + 3);
+
+		std::vector<uint32_t> result;
+		result.reserve(indices.size());
+
+		size_t bestTriangle = std::distance(triangleScores.begin(), std::ranges::max_element(triangleScores));
+		size_t scanCursor = 0;
+
+		for (size_t emitted = 0; emitted < triangleCount; ++emitted)
+		{
+			// ĳ ֺ ĺ     ﰢ  տ
+			if (bestTriangle == INVALID_INDEX)
+			{
+				while (isEmitted[scanCursor])
+					++scanCursor;
+
+				bestTriangle = scanCursor;
+			}
+
+			const uint32_t* triangle = &indices[bestTriangle * 3];
+			isEmitted[bestTriangle] = true;
+			result.insert(result.end(), triangle, triangle + 3);
+
+			//  Ͽ ﰢ  ( ִ   ü)
+			for (int i = 0; i < 3; ++i)
+			{
+				const uint32_t v = triangle[i];
+				uint32_t* begin = &adjacency[adjacencyOffsets[v]];
+				uint32_t* end = begin + liveTriangles[v];
+				uint32_t* it = std::find(begin, end, static_cast<uint32_t>(bestTriangle));
+
+				if (it != end)
+				{
+					std::swap(*it, *(end - 1));
+					--liveTriangles[v];
+				}
+			}
+
+			//  ĳ =     +  ĳ (ߺ )
+			nextCache.assign(triangle, triangle + 3);
+			for (auto v : cache)
+			{
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+					nextCache.push_back(v);
+			}
+			cache.swap(nextCache);
+
+			// ĳ  з 
+			for (size_t i = CACHE_SIZE; i < cache.size(); ++i)
+			{
+				cachePositions[cache[i]] = -1;
+				vertexScores[cache[i]] = vertexScore(-1, liveTriangles[cache[i]]);
+			}
+			if (cache.size() > CACHE_SIZE)
+				cache.resize(CACHE_SIZE);
+
+			for (size_t i = 0; i < cache.size(); ++i)
+			{
+				cachePositions[cache[i]] = static_cast<int>(i);
+				vertexScores[cache[i]] = vertexScore(static_cast<int>(i), liveTriangles[cache[i]]);
+			}
+
+			// ĳ   ﰢ ٽ  ϰ  ְ  ĺ
+			bestTriangle = INVALID_INDEX;
+			float bestScore = -1.0f;
+
+			for (auto v : cache)
+			{
+				for (uint32_t a = 0; a < liveTriangles[v]; ++a)
+				{
+					const uint32_t t = adjacency[adjacencyOffsets[v] + a];
+					const float score = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+					triangleScores[t] = score;
+
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestTriangle = t;
+					}
+				}
+			}
+		}
+
+		indices.swap(result);
+	}
+
+	/*------------------------------
+		ο (Sander et al., Fast Triangle Reordering for Vertex Locality and Reduced Overdraw)
+	------------------------------*/
+	//  ĳ  ϴ Ŭͷ , ٱ  Ŭͺ ׸ 
+	void optimizeOverdraw(std::vector<uint32_t>& indices, const Mesh& mesh, uint32_t vertexOffset, uint32_t vertexCount)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		const uint32_t cacheSize = MeshOptimizer::STATS_CACHE_SIZE;
+
+		if (triangleCount < 2)
+			return;
+
+		std::vector<uint32_t> timestamps(vertexCount, 0);
+		uint32_t timestamp = cacheSize + 1;
+
+		//    ̽ ﰢ = ĳ ȭ  ġ  
+		std::vector<uint32_t> hardBoundaries;
+		for (size_t t = 0; t < triangleCount; ++t)
+		{
+			if (updateCache(&indices[t * 3], cacheSize, timestamps, timestamp) == 3 || t == 0)
+				hardBoundaries.push_back(static_cast<uint32_t>(t));
+		}
+		hardBoundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+		// ġ ȿ  ACMR  ġ  * Ӱ谪 Ʒ   ٽ 
+		std::vector<uint32_t> clusters;
+		for (size_t c = 0; c + 1 < hardBoundaries.size(); ++c)
+		{
+			const uint32_t start = hardBoundaries[c];
+			const uint32_t end = hardBoundaries[c + 1];
+
+			timestamp += cacheSize + 1;
+			uint32_t patchMisses = 0;
+			for (uint32_t t = start; t < end; ++t)
+				patchMisses += updateCache(&indices[t * 3], cacheSize, timestamps, timestamp);
+
+			const float threshold = MeshOptimizer::OVERDRAW_THRESHOLD * static_cast<float>(patchMisses) / static_cast<float>(end - start);
+
+			timestamp += cacheSize + 1;
+			uint32_t clusterStart = start;
+			uint32_t clusterMisses = 0;
+
+			for (uint32_t t = start; t < end; ++t)
+			{
+				clusterMisses += updateCache(&indices[t * 3], cacheSize, timestamps, timestamp);
+
+				const float acmr = static_cast<float>(clusterMisses) / static_cast<float>(t - clusterStart + 1);
+
+				if (acmr <= threshold)
+				{
+					clusters.push_back(clusterStart);
+					clusterStart = t + 1;
+					clusterMisses = 0;
+					timestamp += cacheSize + 1;
+				}
+			}
+
+			if (clusterStart < end)
+				clusters.push_back(clusterStart);
+		}
+		clusters.push_back(static_cast<uint32_t>(triangleCount));
+
+		const size_t clusterCount = clusters.size() - 1;
+
+		if (clusterCount < 2)
+			return;
+
+		const bool hasNormals = mesh.normals.size() == mesh.vertices.size();
+		auto position = [&mesh, vertexOffset](uint32_t index) { return mesh.vertices[vertexOffset + index]; };
+
+		// ޽ ߽ ( )
+		Vector3 meshCenter;
+		float meshArea = 0.0f;
+
+		std::vector<Vector3> clusterCenters(clusterCount);
+		std::vector<Vector3> clusterNormals(clusterCount);
+
+		for (size_t c = 0; c < clusterCount; ++c)
+		{
+			Vector3 center;
+			Vector3 normal;
+			float area = 0.0f;
+
+			for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t)
+			{
+				const uint32_t* triangle = &indices[t * 3];
+				const Vector3 p0 = position(triangle[0]);
+				const Vector3 p1 = position(triangle[1]);
+				const Vector3 p2 = position(triangle[2]);
+
+				const float triangleArea = (p1 - p0).Cross(p2 - p0).Length() * 0.5f;
+				center += (p0 + p1 + p2) / 3.0f * triangleArea;
+				area += triangleArea;
+
+				//  (FLIP_WINDING_ORDER, ޼ ǥ)     װ  
+				if (hasNormals)
+					normal += mesh.normals[vertexOffset + triangle[0]] + mesh.normals[vertexOffset + triangle[1]] + mesh.normals[vertexOffset + triangle[2]];
+				else
+					normal += (p1 - p0).Cross(p2 - p0);
+			}
+
+			meshCenter += center;
+			meshArea += area;
+
+			clusterCenters[c] = area > 0.0f ? center / area : position(indices[clusters[c] * 3]);
+			normal.Normalize();
+			clusterNormals[c] = normal;
+		}
+
+		if (meshArea > 0.0f)
+			meshCenter /= meshArea;
+
+		// ߽ɿ ְ ٱ  Ŭ( ) 
+		std::vector<float> sortKeys(clusterCount);
+		for (size_t c = 0; c < clusterCount; ++c)
+			sortKeys[c] = (clusterCenters[c] - meshCenter).Dot(clusterNormals[c]);
+
+		std::vector<uint32_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), 0);
+		std::ranges::stable_sort(order, std::greater{}, [&sortKeys](uint32_t c) { return sortKeys[c]; });
+
+		std::vector<uint32_t> result;
+		result.reserve(indices.size());
+
+		for (auto c : order)
+			result.insert(result.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+
+		indices.swap(result);
+	}
+}
+
+void MeshOptimizer::Optimize(Mesh& mesh)
+{
+	const size_t totalVertices = mesh.vertices.size();
+
+	if (mesh.indices.empty() || totalVertices == 0 || mesh.subMeshDescriptors.empty())
+		return;
+
+	const uint32_t stride = GetVertexStride(mesh);
+	const VertexAttributes attributes(mesh);
+
+	//   迭  (   ε)
+	std::vector<uint32_t> order;
+	order.reserve(totalVertices);
+
+	for (auto& descriptor : mesh.subMeshDescriptors)
+	{
+		const uint32_t newOffset = static_cast<uint32_t>(order.size());
+		const uint32_t vertexCount = descriptor.vertexCount;
+
+		descriptor.optimizeStats = {};
+
+		const bool isValidRange =
+			descriptor.vertexOffset + vertexCount <= totalVertices &&
+			descriptor.indexOffset + descriptor.indexCount <= mesh.indices.size() &&
+			descriptor.indexCount % 3 == 0;
+
+		uint32_t* indexData = mesh.indices.data() + descriptor.indexOffset;
+
+		if (!isValidRange || std::any_of(indexData, indexData + descriptor.indexCount, [vertexCount](uint32_t index) { return index >= vertexCount; }))
+		{
+			// ﰢ Ʈ ƴϰų   ״ ű
+			for (uint32_t v = 0; v < vertexCount && descriptor.vertexOffset + v < totalVertices; ++v)
+				order.push_back(descriptor.vertexOffset + v);
+
+			descriptor.vertexOffset = newOffset;
+			descriptor.vertexCount = static_cast<uint32_t>(order.size()) - newOffset;
+			continue;
+		}
+
+		std::vector<uint32_t> indices(indexData, indexData + descriptor.indexCount);
+
+		MeshOptimizeStats& stats = descriptor.optimizeStats;
+		stats.before = AnalyzeVertexCache(indices.data(), indices.size(), vertexCount, stride);
+		stats.weldedVertices = weldVertices(indices, attributes, descriptor.vertexOffset, vertexCount);
+
+		optimizeVertexCache(indices, vertexCount);
+		optimizeOverdraw(indices, mesh, descriptor.vertexOffset, vertexCount);
+
+		//  fetch : ε ó ϴ   ٽ ġ ( ʴ  )
+		std::vector<uint32_t> fetchRemap(vertexCount, INVALID_INDEX);
+		uint32_t referenced = 0;
+
+		for (auto& index : indices)
+		{
+			if (fetchRemap[index] == INVALID_INDEX)
+			{
+				fetchRemap[index] = referenced++;
+				order.push_back(descriptor.vertexOffset + index);
+			}
+
+			index = fetchRemap[index];
+		}
+
+		std::copy(indices.begin(), indices.end(), indexData);
+
+		stats.unusedVertices = vertexCount - referenced - (std::min)(stats.weldedVertices, vertexCount - referenced);
+		stats.after = AnalyzeVertexCache(indices.data(), indices.size(), referenced, stride);
+
+		descriptor.vertexOffset = newOffset;
+		descriptor.vertexCount = referenced;
+	}
+
+	// Ӽ 迭   ٽ 
+	auto reorder = [&order, totalVertices](auto& attribute)
+		{
+			if (attribute.size() != totalVertices)
+				return;
+
+			std::remove_reference_t<decltype(attribute)> reordered;
+			reordered.reserve(order.size());
+
+			for (auto v : order)
+				reordered.push_back(attribute[v]);
+
+			attribute.swap(reordered);
+		};
+
+	reorder(mesh.normals);
+	reorder(mesh.uv);
+	reorder(mesh.uv2);
+	reorder(mesh.tangents);
+	reorder(mesh.bitangents);
+	reorder(mesh.boneWeights);
+	reorder(mesh.colors);
+	reorder(mesh.vertices);
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount)
+{
+	optimizeVertexCache(indices, vertexCount);
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t vertexStride)
+{
+	VertexCacheStats stats;
+
+	const size_t triangleCount = indexCount / 3;
+
+	if (triangleCount == 0 || vertexCount == 0)
+		return stats;
+
+	std::vector<uint32_t> timestamps(vertexCount, 0);
+	uint32_t timestamp = STATS_CACHE_SIZE + 1;
+	uint32_t misses = 0;
+
+	for (size_t t = 0; t < triangleCount; ++t)
+		misses += updateCache(indices + t * 3, STATS_CACHE_SIZE, timestamps, timestamp);
+
+	//    
+	std::vector<bool> isReferenced(vertexCount, false);
+	uint32_t referenced = 0;
+
+	for (size_t i = 0; i < triangleCount * 3; ++i)
+	{
+		if (!isReferenced[indices[i]])
+		{
+			isReferenced[indices[i]] = true;
+			++referenced;
+		}
+	}
+
+	// ĳ ̽     ĳ  (  ϳ ͸ ġ )
+	const size_t lineCount = (static_cast<size_t>(vertexCount) * vertexStride + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE;
+	std::vector<uint32_t> lineTimestamps(lineCount, 0);
+	uint32_t lineTimestamp = CACHE_LINE_COUNT + 1;
+	size_t fetchedBytes = 0;
+
+	std::ranges::fill(timestamps, 0);
+	timestamp = STATS_CACHE_SIZE + 1;
+
+	for (size_t i = 0; i < triangleCount * 3; ++i)
+	{
+		const uint32_t v = indices[i];
+
+		//  ĳÿ  ޸𸮸  
+		if (timestamp - timestamps[v] <= STATS_CACHE_SIZE)
+			continue;
+
+		timestamps[v] = timestamp++;
+
+		const size_t first = static_cast<size_t>(v) * vertexStride / CACHE_LINE_SIZE;
+		const size_t last = (static_cast<size_t>(v) * vertexStride + vertexStride - 1) / CACHE_LINE_SIZE;
+
+		for (size_t line = first; line <= last; ++line)
+		{
+			if (lineTimestamp - lineTimestamps[line] > CACHE_LINE_COUNT)
+			{
+				lineTimestamps[line] = lineTimestamp++;
+				fetchedBytes += CACHE_LINE_SIZE;
+			}
+		}
+	}
+
+	stats.acmr = static_cast<float>(misses) / static_cast<float>(triangleCount);
+	stats.atvr = referenced > 0 ? static_cast<float>(misses) / static_cast<float>(referenced) : 0.0f;
+	stats.overfetch = referenced > 0 ? static_cast<float>(fetchedBytes) / static_cast<float>(static_cast<size_t>(referenced) * vertexStride) : 0.0f;
+
+	return stats;
+}
+
+uint32_t MeshOptimizer::GetVertexStride(const Mesh& mesh)
+{
+	// position, normal, tangent, bitangent (Vector3 * 4) + uv + (uv2 Ǵ  ε / ġ)
+	constexpr uint32_t STATIC_STRIDE = sizeof(Vector3) * 4 + sizeof(Vector2) * 2;
+	constexpr uint32_t SKINNED_STRIDE = sizeof(Vector3) * 4 + sizeof(Vector2) + sizeof(BoneWeight);
+
+	return mesh.boneWeights.empty() ? STATIC_STRIDE : SKINNED_STRIDE;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+class Mesh;
+struct VertexCacheStats;
+
+/// Ʈ  ޽  ε/ ġ
+///   ->  ĳ(Forsyth) -> ο(Ŭ ) ->  fetch  
+/// ε ޽ (vertexOffset )̾ ϸ,  迭 vertexOffset / vertexCount  ٽ 
+class ANIMAVISION_DLL MeshOptimizer
+{
+public:
+	static constexpr uint32_t STATS_CACHE_SIZE = 16;		// , Ŭ ҿ FIFO ĳ ( ϵ )
+	static constexpr uint32_t OPTIMIZE_CACHE_SIZE = 32;		// ġ   LRU ĳ
+	static constexpr float OVERDRAW_THRESHOLD = 1.05f;		// Ŭ͸   ϴ ACMR  
+
+	// ޽ø ȭϰ  踦 SubMeshDescriptor::optimizeStats  
+	static void Optimize(Mesh& mesh);
+
+	// ﰢ   ĳÿ ġ (LOD εó  迭 ϴ )
+	static void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount);
+
+	// FIFO ĳ ùķ̼ (GPU  ACMR / ATVR / overfetch )
+	static VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, uint32_t vertexCount, uint32_t vertexStride);
+
+	//     ũ (DX11Buffer  Vertex / SkinnedVertex )
+	static uint32_t GetVertexStride(const Mesh& mesh);
+};
@@ -0,0 +1,412 @@
+#include "pch.h"
+#include "MeshQuantizer.h"
+
+#include "Mesh.h"
+
+#include <cmath>
+#include <algorithm>
+#include <DirectXPackedVector.h>
+
+namespace
+{
+	constexpr float UNORM16_MAX = 65535.0f;
+	constexpr float SNORM16_MAX = 32767.0f;
+
+	uint16_t quantizeUnorm16(float value, float minimum, float extent)
+	{
+		if (extent <= 0.0f)
+			return 0;
+
+		const float normalized = std::clamp((value - minimum) / extent, 0.0f, 1.0f);
+		return static_cast<uint16_t>(std::lround(normalized * UNORM16_MAX));
+	}
+
+	float dequantizeUnorm16(uint16_t value, float minimum, float extent)
+	{
+		return minimum + static_cast<float>(value) / UNORM16_MAX * extent;
+	}
+
+	int16_t quantizeSnorm16(float value)
+	{
+		return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * SNORM16_MAX));
+	}
+
+	float signNotZero(float value)
+	{
+		return value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	// ȸü   Ʒ   2  
+	void encodeOctahedral(const Vector3& direction, int16_t out[2])
+	{
+		const float length = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+
+		if (length <= 0.0f)
+		{
+			out[0] = 0;
+			out[1] = 0;
+			return;
+		}
+
+		float x = direction.x / length;
+		float y = direction.y / length;
+
+		if (direction.z < 0.0f)
+		{
+			const float foldedX = (1.0f - std::abs(y)) * signNotZero(x);
+			const float foldedY = (1.0f - std::abs(x)) * signNotZero(y);
+			x = foldedX;
+			y = foldedY;
+		}
+
+		out[0] = quantizeSnorm16(x);
+		out[1] = quantizeSnorm16(y);
+	}
+
+	Vector3 decodeOctahedral(const int16_t in[2])
+	{
+		const float x = (std::max)(static_cast<float>(in[0]) / SNORM16_MAX, -1.0f);
+		const float y = (std::max)(static_cast<float>(in[1]) / SNORM16_MAX, -1.0f);
+		const float z = 1.0f - std::abs(x) - std::abs(y);
+
+		Vector3 direction = z >= 0.0f
+			? Vector3(x, y, z)
+			: Vector3((1.0f - std::abs(y)) * signNotZero(x), (1.0f - std::abs(x)) * signNotZero(y), z);
+
+		direction.Normalize();
+		return direction;
+	}
+
+	uint8_t quantizeUnorm8(float value)
+	{
+		return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+	}
+
+	uint32_t packColor(const Vector4& color)
+	{
+		return
+			static_cast<uint32_t>(quantizeUnorm8(color.x)) |
+			static_cast<uint32_t>(quantizeUnorm8(color.y)) << 8 |
+			static_cast<uint32_t>(quantizeUnorm8(color.z)) << 16 |
+			static_cast<uint32_t>(quantizeUnorm8(color.w)) << 24;
+	}
+
+	Vector4 unpackColor(uint32_t color)
+	{
+		return {
+			static_cast<float>(color & 0xFF) / 255.0f,
+			static_cast<float>((color >> 8) & 0xFF) / 255.0f,
+			static_cast<float>((color >> 16) & 0xFF) / 255.0f,
+			static_cast<float>((color >> 24) & 0xFF) / 255.0f
+		};
+	}
+
+	// ݿø   ū ġ   Ȯ 255  ǰ 
+	bool packSkin(const BoneWeight& boneWeight, PackedSkin& out)
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < 4; ++i)
+			sum += (std::max)(boneWeight.weight[i], 0.0f);
+
+		int total = 0;
+		int largest = 0;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			if (boneWeight.boneIndex[i] > UINT16_MAX)
+				return false;
+
+			out.boneIndex[i] = static_cast<uint16_t>(boneWeight.boneIndex[i]);
+			out.weight[i] = sum > 0.0f ? quantizeUnorm8((std::max)(boneWeight.weight[i], 0.0f) / sum) : 0;
+			total += out.weight[i];
+
+			if (boneWeight.weight[i] > boneWeight.weight[largest])
+				largest = i;
+		}
+
+		if (total > 0)
+			out.weight[largest] = static_cast<uint8_t>(std::clamp(out.weight[largest] + 255 - total, 0, 255));
+
+		return true;
+	}
+
+	BoneWeight unpackSkin(const PackedSkin& skin)
+	{
+		BoneWeight boneWeight;
+		for (int i = 0; i < 4; ++i)
+		{
+			boneWeight.boneIndex[i] = skin.boneIndex[i];
+			boneWeight.weight[i] = static_cast<float>(skin.weight[i]) / 255.0f;
+		}
+
+		return boneWeight;
+	}
+
+	//  ġ ٿ带  ޽ ( ġų     迭)
+	std::vector<uint32_t> findOwners(const Mesh& mesh, size_t vertexCount)
+	{
+		constexpr uint32_t NO_OWNER = ~0u;
+
+		std::vector<uint32_t> owners(vertexCount, NO_OWNER);
+
+		for (uint32_t s = 0; s < static_cast<uint32_t>(mesh.subMeshDescriptors.size()); ++s)
+		{
+			const auto& subMesh = mesh.subMeshDescriptors[s];
+
+			if (subMesh.vertexOffset + subMesh.vertexCount > vertexCount)
+				return {};
+
+			for (uint32_t v = subMesh.vertexOffset; v < subMesh.vertexOffset + subMesh.vertexCount; ++v)
+			{
+				if (owners[v] != NO_OWNER)
+					return {};
+
+				owners[v] = s;
+			}
+		}
+
+		if (std::ranges::find(owners, NO_OWNER) != owners.end())
+			return {};
+
+		return owners;
+	}
+
+	template <typename T>
+	void release(std::vector<T>& attribute)
+	{
+		std::vector<T>().swap(attribute);
+	}
+}
+
+bool MeshQuantizer::Pack(Mesh& mesh)
+{
+	using namespace DirectX::PackedVector;
+
+	const size_t vertexCount = mesh.vertices.size();
+
+	if (vertexCount == 0 || !mesh.packedVertices.empty())
+		return false;
+
+	const std::vector<uint32_t> owners = findOwners(mesh, vertexCount);
+
+	if (owners.empty())
+		return false;
+
+	const bool hasNormals = mesh.normals.size() == vertexCount;
+	const bool hasTangents = mesh.tangents.size() == vertexCount;
+	const bool hasBitangents = mesh.bitangents.size() == vertexCount;
+	const bool hasUV = mesh.uv.size() == vertexCount;
+	const bool hasUV2 = mesh.uv2.size() == vertexCount;
+	const bool hasSkin = mesh.boneWeights.size() == vertexCount;
+	const bool hasColors = mesh.colors.size() == vertexCount;
+
+	std::vector<PackedSkin> packedSkin(hasSkin ? vertexCount : 0);
+
+	for (size_t v = 0; v < packedSkin.size(); ++v)
+	{
+		//  ε 16 Ʈ   
+		if (!packSkin(mesh.boneWeights[v], packedSkin[v]))
+			return false;
+	}
+
+	// ޽ ġ ٿ
+	for (auto& subMesh : mesh.subMeshDescriptors)
+	{
+		Vector3 minimum(FLT_MAX, FLT_MAX, FLT_MAX);
+		Vector3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+		for (uint32_t v = subMesh.vertexOffset; v < subMesh.vertexOffset + subMesh.vertexCount; ++v)
+		{
+			minimum = Vector3::Min(minimum, mesh.vertices[v]);
+			maximum = Vector3::Max(maximum, mesh.vertices[v]);
+		}
+
+		subMesh.positionMin = subMesh.vertexCount > 0 ? minimum : Vector3::Zero;
+		subMesh.positionExtent = subMesh.vertexCount > 0 ? maximum - minimum : Vector3::Zero;
+	}
+
+	mesh.packedVertices.resize(vertexCount);
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const auto& subMesh = mesh.subMeshDescriptors[owners[v]];
+		const Vector3& position = mesh.vertices[v];
+
+		PackedVertex& packed = mesh.packedVertices[v];
+		packed = {};
+		packed.position[0] = quantizeUnorm16(position.x, subMesh.positionMin.x, subMesh.positionExtent.x);
+		packed.position[1] = quantizeUnorm16(position.y, subMesh.positionMin.y, subMesh.positionExtent.y);
+		packed.position[2] = quantizeUnorm16(position.z, subMesh.positionMin.z, subMesh.positionExtent.z);
+
+		if (hasNormals)
+			encodeOctahedral(mesh.normals[v], packed.normal);
+
+		if (hasTangents)
+			encodeOctahedral(mesh.tangents[v], packed.tangent);
+
+		packed.bitangentSign = 1;
+		if (hasNormals && hasTangents && hasBitangents)
+			packed.bitangentSign = mesh.normals[v].Cross(mesh.tangents[v]).Dot(mesh.bitangents[v]) >= 0.0f ? 1 : 0;
+
+		if (hasUV)
+		{
+			packed.uv[0] = XMConvertFloatToHalf(mesh.uv[v].x);
+			packed.uv[1] = XMConvertFloatToHalf(mesh.uv[v].y);
+		}
+
+		if (hasUV2)
+		{
+			packed.uv2[0] = XMConvertFloatToHalf(mesh.uv2[v].x);
+			packed.uv2[1] = XMConvertFloatToHalf(mesh.uv2[v].y);
+		}
+	}
+
+	mesh.packedSkin = std::move(packedSkin);
+
+	mesh.packedColors.clear();
+	if (hasColors)
+	{
+		mesh.packedColors.reserve(vertexCount);
+		for (const auto& color : mesh.colors)
+			mesh.packedColors.push_back(packColor(color));
+	}
+
+	mesh.packedAttributes =
+		(hasNormals ? Normal : 0) |
+		(hasTangents ? Tangent : 0) |
+		(hasBitangents ? Bitangent : 0) |
+		(hasUV ? UV : 0) |
+		(hasUV2 ? UV2 : 0);
+
+	ReleaseUnpacked(mesh);
+
+	return true;
+}
+
+bool MeshQuantizer::Unpack(Mesh& mesh)
+{
+	using namespace DirectX::PackedVector;
+
+	const size_t vertexCount = mesh.packedVertices.size();
+
+	if (vertexCount == 0 || !mesh.vertices.empty())
+		return false;
+
+	const std::vector<uint32_t> owners = findOwners(mesh, vertexCount);
+
+	if (owners.empty())
+		return false;
+
+	const uint32_t attributes = mesh.packedAttributes;
+
+	mesh.vertices.resize(vertexCount);
+	mesh.normals.resize(attributes & Normal ? vertexCount : 0);
+	mesh.tangents.resize(attributes & Tangent ? vertexCount : 0);
+	mesh.bitangents.resize(attributes & Bitangent ? vertexCount : 0);
+	mesh.uv.resize(attributes & UV ? vertexCount : 0);
+	mesh.uv2.resize(attributes & UV2 ? vertexCount : 0);
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const auto& subMesh = mesh.subMeshDescriptors[owners[v]];
+		const PackedVertex& packed = mesh.packedVertices[v];
+
+		mesh.vertices[v] = {
+			dequantizeUnorm16(packed.position[0], subMesh.positionMin.x, subMesh.positionExtent.x),
+			dequantizeUnorm16(packed.position[1], subMesh.positionMin.y, subMesh.positionExtent.y),
+			dequantizeUnorm16(packed.position[2], subMesh.positionMin.z, subMesh.positionExtent.z)
+		};
+
+		const Vector3 normal = decodeOctahedral(packed.normal);
+		const Vector3 tangent = decodeOctahedral(packed.tangent);
+
+		if (attributes & Normal)
+			mesh.normals[v] = normal;
+
+		if (attributes & Tangent)
+			mesh.tangents[v] = tangent;
+
+		if (attributes & Bitangent)
+			mesh.bitangents[v] = normal.Cross(tangent) * (packed.bitangentSign ? 1.0f : -1.0f);
+
+		if (attributes & UV)
+			mesh.uv[v] = { XMConvertHalfToFloat(packed.uv[0]), XMConvertHalfToFloat(packed.uv[1]) };
+
+		if (attributes & UV2)
+			mesh.uv2[v] = { XMConvertHalfToFloat(packed.uv2[0]), XMConvertHalfToFloat(packed.uv2[1]) };
+	}
+
+	mesh.boneWeights.clear();
+	mesh.boneWeights.reserve(mesh.packedSkin.size());
+	for (const auto& skin : mesh.packedSkin)
+		mesh.boneWeights.push_back(unpackSkin(skin));
+
+	mesh.colors.clear();
+	mesh.colors.reserve(mesh.packedColors.size());
+	for (auto color : mesh.packedColors)
+		mesh.colors.push_back(unpackColor(color));
+
+	return true;
+}
+
+void MeshQuantizer::ReleaseUnpacked(Mesh& mesh)
+{
+	if (mesh.packedVertices.empty())
+		return;
+
+	release(mesh.vertices);
+	release(mesh.normals);
+	release(mesh.tangents);
+	release(mesh.bitangents);
+	release(mesh.uv);
+	release(mesh.uv2);
+	release(mesh.boneWeights);
+	release(mesh.colors);
+}
+
+void MeshQuantizer::DecodePositions(const Mesh& mesh, std::vector<Vector3>& positions)
+{
+	if (!mesh.vertices.empty())
+	{
+		positions.assign(mesh.vertices.begin(), mesh.vertices.end());
+		return;
+	}
+
+	positions.clear();
+
+	const size_t vertexCount = mesh.packedVertices.size();
+	const std::vector<uint32_t> owners = findOwners(mesh, vertexCount);
+
+	if (owners.empty())
+		return;
+
+	positions.resize(vertexCount);
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const auto& subMesh = mesh.subMeshDescriptors[owners[v]];
+		const PackedVertex& packed = mesh.packedVertices[v];
+
+		positions[v] = {
+			dequantizeUnorm16(packed.position[0], subMesh.positionMin.x, subMesh.positionExtent.x),
+			dequantizeUnorm16(packed.position[1], subMesh.positionMin.y, subMesh.positionExtent.y),
+			dequantizeUnorm16(packed.position[2], subMesh.positionMin.z, subMesh.positionExtent.z)
+		};
+	}
+}
+
+size_t MeshQuantizer::GetVertexMemory(const Mesh& mesh)
+{
+	return
+		mesh.vertices.capacity() * sizeof(Vector3) +
+		mesh.normals.capacity() * sizeof(Vector3) +
+		mesh.tangents.capacity() * sizeof(Vector3) +
+		mesh.bitangents.capacity() * sizeof(Vector3) +
+		mesh.uv.capacity() * sizeof(Vector2) +
+		mesh.uv2.capacity() * sizeof(Vector2) +
+		mesh.boneWeights.capacity() * sizeof(BoneWeight) +
+		mesh.colors.capacity() * sizeof(Vector4) +
+		mesh.packedVertices.capacity() * sizeof(PackedVertex) +
+		mesh.packedSkin.capacity() * sizeof(PackedSkin) +
+		mesh.packedColors.capacity() * sizeof(uint32_t);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+class Mesh;
+
+///  Ӽ  (PackedVertex / PackedSkin / packedColors)
+/// ġ ޽ ٿ  unorm16, /źƮ ȸü snorm16 + źƮ ȣ, UV  half,  unorm8,  ġ unorm8
+/// Ʈ   .mcm  ϰ, GPU ε  float 迭 Ǯٰ  (̴ Է ̾ƿ ״)
+class ANIMAVISION_DLL MeshQuantizer
+{
+public:
+	//   ִ float 迭 (Mesh::packedAttributes)
+	enum Attribute : uint32_t
+	{
+		Normal = 1 << 0,
+		Tangent = 1 << 1,
+		Bitangent = 1 << 2,
+		UV = 1 << 3,
+		UV2 = 1 << 4,
+	};
+
+	// float 迭 ϰ , ޽          
+	static bool Pack(Mesh& mesh);
+
+	//  ͷ float 迭 ä (̹  false)
+	static bool Unpack(Mesh& mesh);
+
+	//  Ͱ  float 迭 
+	static void ReleaseUnpacked(Mesh& mesh);
+
+	//  ŷ, ŷ ġ (float 迭  ,   Ϳ )
+	static void DecodePositions(const Mesh& mesh, std::vector<Vector3>& positions);
+
+	// CPU  ϴ   ũ (float 迭 +  迭)
+	static size_t GetVertexMemory(const Mesh& mesh);
+};
@@ -0,0 +1,560 @@
+#include "pch.h"
+#include "MeshSimplifier.h"
+
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+	struct Point
+	{
+		double x = 0.0;
+		double y = 0.0;
+		double z = 0.0;
+	};
+
+	Point subtract(const Point& a, const Point& b)
+	{
+		return { a.x - b.x, a.y - b.y, a.z - b.z };
+	}
+
+	Point cross(const Point& a, const Point& b)
+	{
+		return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	}
+
+	double dot(const Point& a, const Point& b)
+	{
+		return a.x * b.x + a.y * b.y + a.z * b.z;
+	}
+
+	//  Ÿ   (Ī 4x4   ﰢ), weight   
+	struct Quadric
+	{
+		double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+		double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+		double a22 = 0.0, a23 = 0.0;
+		double a33 = 0.0;
+		double weight = 0.0;
+
+		static Quadric FromPlane(const Point& normal, double distance, double weight)
+		{
+			Quadric q;
+			q.a00 = normal.x * normal.x * weight;
+			q.a01 = normal.x * normal.y * weight;
+			q.a02 = normal.x * normal.z * weight;
+			q.a03 = normal.x * distance * weight;
+			q.a11 = normal.y * normal.y * weight;
+			q.a12 = normal.y * normal.z * weight;
+			q.a13 = normal.y * distance * weight;
+			q.a22 = normal.z * normal.z * weight;
+			q.a23 = normal.z * distance * weight;
+			q.a33 = distance * distance * weight;
+			q.weight = weight;
+			return q;
+		}
+
+		Quadric& operator+=(const Quadric& other)
+		{
+			a00 += other.a00; a01 += other.a01; a02 += other.a02; a03 += other.a03;
+			a11 += other.a11; a12 += other.a12; a13 += other.a13;
+			a22 += other.a22; a23 += other.a23;
+			a33 += other.a33;
+			weight += other.weight;
+			return *this;
+		}
+
+		//    Ÿ 
+		double Evaluate(const Point& p) const
+		{
+			if (weight <= 0.0)
+				return 0.0;
+
+			const double value =
+				a00 * p.x * p.x + 2.0 * a01 * p.x * p.y + 2.0 * a02 * p.x * p.z + 2.0 * a03 * p.x +
+				a11 * p.y * p.y + 2.0 * a12 * p.y * p.z + 2.0 * a13 * p.y +
+				a22 * p.z * p.z + 2.0 * a23 * p.z +
+				a33;
+
+			return std::abs(value) / weight;
+		}
+	};
+
+	// from  to  ġ ĺ (  ٲ )
+	struct Collapse
+	{
+		double cost = 0.0;
+		double error = 0.0;		//   (ȭ Ÿ )
+		uint32_t from = 0;
+		uint32_t to = 0;
+		uint32_t fromVersion = 0;
+		uint32_t toVersion = 0;
+
+		bool operator>(const Collapse& other) const { return cost > other.cost; }
+	};
+
+	//   ̻ ư ġ   (cos 75)
+	constexpr double MIN_NORMAL_COSINE = 0.25;
+
+	class SubMeshSimplifier
+	{
+	public:
+		SubMeshSimplifier(const Mesh& mesh, const SubMeshDescriptor& subMesh);
+
+		//  ﰢ target ϰ   ħ (  Ѵ ĺ  ߴ)
+		void Simplify(size_t targetTriangles);
+
+		size_t GetTriangleCount() const { return _liveTriangles; }
+		float GetError() const { return static_cast<float>(std::sqrt(_maxError)); }
+		void GetIndices(std::vector<uint32_t>& indices) const;
+
+	private:
+		void pushCollapse(uint32_t from, uint32_t to);
+		bool isValid(uint32_t from, uint32_t to) const;
+		void apply(uint32_t from, uint32_t to);
+
+		bool canBlendSkin(uint32_t from, uint32_t to) const;
+		double attributeDistance(uint32_t from, uint32_t to) const;
+
+		const Mesh& _mesh;
+		uint32_t _vertexOffset = 0;
+
+		std::vector<Point> _positions;			// ٿ   ȭ (    )
+		std::vector<uint32_t> _triangles;
+		std::vector<uint8_t> _removed;
+		std::vector<std::vector<uint32_t>> _vertexTriangles;
+
+		std::vector<Quadric> _quadrics;
+		std::vector<uint8_t> _locked;
+		std::vector<uint8_t> _collapsed;
+		std::vector<uint32_t> _versions;
+
+		std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> _queue;
+
+		size_t _liveTriangles = 0;
+		double _maxError = 0.0;
+	};
+
+	SubMeshSimplifier::SubMeshSimplifier(const Mesh& mesh, const SubMeshDescriptor& subMesh)
+		: _mesh(mesh)
+		, _vertexOffset(subMesh.vertexOffset)
+	{
+		const uint32_t vertexCount = subMesh.vertexCount;
+
+		const Vector3 center = mesh.boundingSphere.Center;
+		double radius = mesh.boundingSphere.Radius;
+
+		if (radius <= 0.0)
+		{
+			for (uint32_t v = 0; v < vertexCount; ++v)
+				radius = (std::max)(radius, static_cast<double>(Vector3::Distance(mesh.vertices[_vertexOffset + v], center)));
+		}
+
+		const double invRadius = radius > 0.0 ? 1.0 / radius : 1.0;
+
+		_positions.resize(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v)
+		{
+			const Vector3& position = mesh.vertices[_vertexOffset + v];
+			_positions[v] = { (position.x - center.x) * invRadius, (position.y - center.y) * invRadius, (position.z - center.z) * invRadius };
+		}
+
+		_triangles.assign(mesh.indices.begin() + subMesh.indexOffset, mesh.indices.begin() + subMesh.indexOffset + subMesh.indexCount);
+
+		const size_t triangleCount = _triangles.size() / 3;
+		_removed.assign(triangleCount, 0);
+		_vertexTriangles.resize(vertexCount);
+		_quadrics.resize(vertexCount);
+		_locked.assign(vertexCount, 0);
+		_collapsed.assign(vertexCount, 0);
+		_versions.assign(vertexCount, 0);
+
+		//   -> ϴ ﰢ  (1 ̸ , UV /   ε  谡 )
+		std::unordered_map<uint64_t, uint32_t> edges;
+		edges.reserve(_triangles.size());
+
+		for (size_t t = 0; t < triangleCount; ++t)
+		{
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0])
+			{
+				_removed[t] = 1;
+				continue;
+			}
+
+			++_liveTriangles;
+
+			const Point& p0 = _positions[triangle[0]];
+			const Point normal = cross(subtract(_positions[triangle[1]], p0), subtract(_positions[triangle[2]], p0));
+			const double length = std::sqrt(dot(normal, normal));
+
+			for (int i = 0; i < 3; ++i)
+			{
+				_vertexTriangles[triangle[i]].push_back(static_cast<uint32_t>(t));
+
+				const uint32_t a = (std::min)(triangle[i], triangle[(i + 1) % 3]);
+				const uint32_t b = (std::max)(triangle[i], triangle[(i + 1) % 3]);
+				++edges[(static_cast<uint64_t>(a) << 32) | b];
+			}
+
+			if (length <= 0.0)
+				continue;
+
+			const Point unit = { normal.x / length, normal.y / length, normal.z / length };
+			const Quadric plane = Quadric::FromPlane(unit, -dot(unit, p0), length * 0.5);
+
+			for (int i = 0; i < 3; ++i)
+				_quadrics[triangle[i]] += plane;
+		}
+
+		// , پü     (,   )
+		for (const auto& [key, count] : edges)
+		{
+			if (count == 2)
+				continue;
+
+			_locked[static_cast<uint32_t>(key >> 32)] = 1;
+			_locked[static_cast<uint32_t>(key & 0xFFFFFFFF)] = 1;
+		}
+
+		for (size_t t = 0; t < triangleCount; ++t)
+		{
+			if (_removed[t])
+				continue;
+
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			for (int i = 0; i < 3; ++i)
+			{
+				pushCollapse(triangle[i], triangle[(i + 1) % 3]);
+				pushCollapse(triangle[(i + 1) % 3], triangle[i]);
+			}
+		}
+	}
+
+	void SubMeshSimplifier::Simplify(size_t targetTriangles)
+	{
+		constexpr double MAX_ERROR_SQUARED = static_cast<double>(MeshSimplifier::MAX_ERROR) * MeshSimplifier::MAX_ERROR;
+
+		while (_liveTriangles > targetTriangles && !_queue.empty())
+		{
+			const Collapse collapse = _queue.top();
+
+			if (_collapsed[collapse.from] || _collapsed[collapse.to] ||
+				_versions[collapse.from] != collapse.fromVersion || _versions[collapse.to] != collapse.toVersion)
+			{
+				_queue.pop();
+				continue;
+			}
+
+			//  ̹Ƿ  ĺ    ɼ ,  ܰ迡 ״ ߴ
+			if (collapse.error > MAX_ERROR_SQUARED)
+				break;
+
+			_queue.pop();
+
+			if (!isValid(collapse.from, collapse.to))
+				continue;
+
+			apply(collapse.from, collapse.to);
+			_maxError = (std::max)(_maxError, collapse.error);
+		}
+	}
+
+	void SubMeshSimplifier::GetIndices(std::vector<uint32_t>& indices) const
+	{
+		indices.clear();
+		indices.reserve(_liveTriangles * 3);
+
+		for (size_t t = 0; t < _removed.size(); ++t)
+		{
+			if (!_removed[t])
+				indices.insert(indices.end(), _triangles.begin() + t * 3, _triangles.begin() + t * 3 + 3);
+		}
+	}
+
+	void SubMeshSimplifier::pushCollapse(uint32_t from, uint32_t to)
+	{
+		if (from == to || _locked[from] || !canBlendSkin(from, to))
+			return;
+
+		Quadric quadric = _quadrics[from];
+		quadric += _quadrics[to];
+
+		Collapse collapse;
+		collapse.error = quadric.Evaluate(_positions[to]);
+		collapse.cost = collapse.error + MeshSimplifier::ATTRIBUTE_WEIGHT * attributeDistance(from, to);
+		collapse.from = from;
+		collapse.to = to;
+		collapse.fromVersion = _versions[from];
+		collapse.toVersion = _versions[to];
+
+		_queue.push(collapse);
+	}
+
+	bool SubMeshSimplifier::isValid(uint32_t from, uint32_t to) const
+	{
+		// ũ  :    ̿  ϴ ﰢ  ƾ پü 
+		std::vector<uint32_t> fromNeighbors;
+		std::vector<uint32_t> toNeighbors;
+		uint32_t sharedTriangles = 0;
+
+		for (auto t : _vertexTriangles[from])
+		{
+			if (_removed[t])
+				continue;
+
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+				++sharedTriangles;
+
+			for (int i = 0; i < 3; ++i)
+			{
+				if (triangle[i] != from && triangle[i] != to)
+					fromNeighbors.push_back(triangle[i]);
+			}
+		}
+
+		if (sharedTriangles == 0)
+			return false;
+
+		for (auto t : _vertexTriangles[to])
+		{
+			if (_removed[t])
+				continue;
+
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			for (int i = 0; i < 3; ++i)
+			{
+				if (triangle[i] != from && triangle[i] != to)
+					toNeighbors.push_back(triangle[i]);
+			}
+		}
+
+		std::ranges::sort(fromNeighbors);
+		std::ranges::sort(toNeighbors);
+		fromNeighbors.erase(std::unique(fromNeighbors.begin(), fromNeighbors.end()), fromNeighbors.end());
+		toNeighbors.erase(std::unique(toNeighbors.begin(), toNeighbors.end()), toNeighbors.end());
+
+		std::vector<uint32_t> common;
+		std::ranges::set_intersection(fromNeighbors, toNeighbors, std::back_inserter(common));
+
+		if (common.size() > sharedTriangles)
+			return false;
+
+		//  ﰢ ų ũ ̸  
+		for (auto t : _vertexTriangles[from])
+		{
+			if (_removed[t])
+				continue;
+
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+				continue;
+
+			Point before[3];
+			Point after[3];
+
+			for (int i = 0; i < 3; ++i)
+			{
+				before[i] = _positions[triangle[i]];
+				after[i] = triangle[i] == from ? _positions[to] : before[i];
+			}
+
+			const Point oldNormal = cross(subtract(before[1], before[0]), subtract(before[2], before[0]));
+			const Point newNormal = cross(subtract(after[1], after[0]), subtract(after[2], after[0]));
+
+			const double oldLength = std::sqrt(dot(oldNormal, oldNormal));
+			const double newLength = std::sqrt(dot(newNormal, newNormal));
+
+			if (newLength <= 0.0 || dot(oldNormal, newNormal) < MIN_NORMAL_COSINE * oldLength * newLength)
+				return false;
+		}
+
+		return true;
+	}
+
+	void SubMeshSimplifier::apply(uint32_t from, uint32_t to)
+	{
+		for (auto t : _vertexTriangles[from])
+		{
+			if (_removed[t])
+				continue;
+
+			uint32_t* triangle = &_triangles[t * 3];
+
+			if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+			{
+				_removed[t] = 1;
+				--_liveTriangles;
+				continue;
+			}
+
+			for (int i = 0; i < 3; ++i)
+			{
+				if (triangle[i] == from)
+					triangle[i] = to;
+			}
+
+			_vertexTriangles[to].push_back(t);
+		}
+
+		_quadrics[to] += _quadrics[from];
+		_collapsed[from] = 1;
+		_vertexTriangles[from].clear();
+		++_versions[to];
+
+		auto& toTriangles = _vertexTriangles[to];
+		std::erase_if(toTriangles, [this](uint32_t t) { return _removed[t] != 0; });
+
+		// to   ٲǷ ֺ  ĺ ٽ 
+		for (auto t : toTriangles)
+		{
+			const uint32_t* triangle = &_triangles[t * 3];
+
+			for (int i = 0; i < 3; ++i)
+			{
+				if (triangle[i] == to)
+					continue;
+
+				pushCollapse(to, triangle[i]);
+				pushCollapse(triangle[i], to);
+			}
+		}
+	}
+
+	bool SubMeshSimplifier::canBlendSkin(uint32_t from, uint32_t to) const
+	{
+		if (_mesh.boneWeights.size() != _mesh.vertices.size())
+			return true;
+
+		const BoneWeight& a = _mesh.boneWeights[_vertexOffset + from];
+		const BoneWeight& b = _mesh.boneWeights[_vertexOffset + to];
+
+		//  ε ġ   ( ޽ö  ε  )
+		float difference = 0.0f;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			float weight = 0.0f;
+			for (int j = 0; j < 4; ++j)
+			{
+				if (b.boneIndex[j] == a.boneIndex[i])
+					weight += b.weight[j];
+			}
+
+			difference += std::abs(a.weight[i] - weight);
+		}
+
+		for (int j = 0; j < 4; ++j)
+		{
+			bool isShared = false;
+			for (int i = 0; i < 4; ++i)
+				isShared |= a.boneIndex[i] == b.boneIndex[j];
+
+			if (!isShared)
+				difference += b.weight[j];
+		}
+
+		return difference <= MeshSimplifier::SKIN_WEIGHT_TOLERANCE;
+	}
+
+	double SubMeshSimplifier::attributeDistance(uint32_t from, uint32_t to) const
+	{
+		const uint32_t a = _vertexOffset + from;
+		const uint32_t b = _vertexOffset + to;
+
+		double distance = 0.0;
+
+		if (_mesh.uv.size() == _mesh.vertices.size())
+			distance += Vector2::DistanceSquared(_mesh.uv[a], _mesh.uv[b]);
+
+		if (_mesh.normals.size() == _mesh.vertices.size())
+			distance += (std::max)(0.0, 1.0 - static_cast<double>(_mesh.normals[a].Dot(_mesh.normals[b])));
+
+		return distance;
+	}
+}
+
+void MeshSimplifier::GenerateLods(Mesh& mesh)
+{
+	mesh.lodErrors.clear();
+
+	if (mesh.indices.empty() || mesh.vertices.empty())
+		return;
+
+	// ٽ    LOD ε 
+	mesh.indices.resize(mesh.GetBaseIndexCount());
+
+	uint32_t lodCount = 1;
+	std::vector<uint32_t> lodIndices;
+
+	for (auto& subMesh : mesh.subMeshDescriptors)
+	{
+		subMesh.lods.clear();
+
+		const bool isValidRange =
+			subMesh.vertexOffset + subMesh.vertexCount <= mesh.vertices.size() &&
+			subMesh.indexOffset + subMesh.indexCount <= mesh.indices.size() &&
+			subMesh.indexCount % 3 == 0;
+
+		if (!isValidRange || subMesh.indexCount / 3 < MIN_TRIANGLES)
+			continue;
+
+		const uint32_t* indexData = mesh.indices.data() + subMesh.indexOffset;
+		const uint32_t vertexCount = subMesh.vertexCount;
+
+		if (std::any_of(indexData, indexData + subMesh.indexCount, [vertexCount](uint32_t index) { return index >= vertexCount; }))
+			continue;
+
+		SubMeshSimplifier simplifier(mesh, subMesh);
+		size_t previous = simplifier.GetTriangleCount();
+
+		//  ܰ迡 ̾ ٿ Ƿ ܰ踶 ó ٽ  
+		while (subMesh.lods.size() + 1 < MAX_LOD_COUNT)
+		{
+			simplifier.Simplify(static_cast<size_t>(previous * LOD_REDUCTION));
+
+			const size_t current = simplifier.GetTriangleCount();
+
+			if (current == 0 || current > previous * MIN_REDUCTION)
+				break;
+
+			simplifier.GetIndices(lodIndices);
+			MeshOptimizer::OptimizeVertexCache(lodIndices, vertexCount);
+
+			SubMeshLod lod;
+			lod.indexCount = static_cast<uint32_t>(lodIndices.size());
+			lod.indexOffset = static_cast<uint32_t>(mesh.indices.size());
+			lod.error = simplifier.GetError();
+
+			mesh.indices.insert(mesh.indices.end(), lodIndices.begin(), lodIndices.end());
+			subMesh.lods.push_back(lod);
+
+			previous = current;
+		}
+
+		lodCount = (std::max)(lodCount, static_cast<uint32_t>(subMesh.lods.size()) + 1);
+	}
+
+	if (lodCount == 1)
+		return;
+
+	// ܰ谡 ڶ ޽ô  ģ ܰ踦 ״ Ƿ   ä
+	mesh.lodErrors.assign(lodCount, 0.0f);
+
+	for (const auto& subMesh : mesh.subMeshDescriptors)
+	{
+		for (uint32_t level = 1; level < lodCount; ++level)
+			mesh.lodErrors[level] = (std::max)(mesh.lodErrors[level], subMesh.GetLod(level).error);
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+class Mesh;
+
+/// Ʈ  ޽ú LOD ü  (quadric error metric, half-edge collapse)
+///  θ ġǷ LOD  LOD 0    ϰ, ε  mesh.indices ڿ ߰
+///  Ӽ (UV,   ε 谡 Ǵ )  ,  ġ ٸ  ġ 
+class ANIMAVISION_DLL MeshSimplifier
+{
+public:
+	static constexpr uint32_t MAX_LOD_COUNT = 4;			// LOD 0 
+	static constexpr uint32_t MIN_TRIANGLES = 64;			// ̺  ޽ô LOD   
+	static constexpr float LOD_REDUCTION = 0.5f;			// ܰ踶 ǥ ﰢ 
+	static constexpr float MIN_REDUCTION = 0.85f;			//  ܰ躸   Ѱ  ܰ踦  
+	static constexpr float MAX_ERROR = 0.05f;				// ٿ     (Ѵ ġ  )
+	static constexpr float ATTRIBUTE_WEIGHT = 0.01f;		// UV /  ̸ Ÿ   ٲٴ ġ
+	static constexpr float SKIN_WEIGHT_TOLERANCE = 0.2f;	// ĥ  ִ  ġ  (L1)
+
+	// ޽ø lods  ä mesh.lodErrors  (MeshOptimizer::Optimize , ε ޽ )
+	static void GenerateLods(Mesh& mesh);
+};
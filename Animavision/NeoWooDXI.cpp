@@ -5,6 +5,7 @@
 #include "DX11Sampler.h"
 #include "DX11Buffer.h"
 #include "ResourceFontLoader.h"
+#include "VirtualFileSystem.h"
 
 #include <functional>
 #include <DirectXTex.h>
@@ -68,7 +69,7 @@ void NeoWooDXI::Submit(Mesh& mesh, Material& material, PrimitiveTopology primiti
 	unbindShaderResources(material);
 }
 
-void NeoWooDXI::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode /*= PrimitiveTopology::TRIANGLELIST*/, uint32_t instances /*= 1*/)
+void NeoWooDXI::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode /*= PrimitiveTopology::TRIANGLELIST*/, uint32_t instances /*= 1*/, uint32_t lod /*= 0*/)
 {
 	if (subMeshIndex >= mesh.subMeshDescriptors.size())
 	{
@@ -99,11 +100,12 @@ void NeoWooDXI::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, Pr
 	bindShaderResources(material);
 
 	const auto& subMesh = mesh.subMeshDescriptors[subMeshIndex];
+	const SubMeshLod range = subMesh.GetLod(lod);
 
 	m_Context->SetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(primitiveMode));
 	mesh.vertexBuffer->Bind(m_Context.get());
 	mesh.indexBuffer->Bind(m_Context.get());
-	m_Context->DrawIndexedInstanced(subMesh.indexCount, instances, subMesh.indexOffset, subMesh.vertexOffset, 0);
+	m_Context->DrawIndexedInstanced(range.indexCount, instances, range.indexOffset, subMesh.vertexOffset, 0);
 
 #ifdef _DEBUG
 	ID3D11Debug* debugDevice = nullptr;
@@ -185,6 +187,9 @@ void NeoWooDXI::SubmitInstancedIndirect(Material& material, Texture* argsBuffer,
 
 void NeoWooDXI::BeginRender()
 {
+	//   û  ø 
+	m_TextureStreamer->Update();
+
 	m_Context->BeginRender();
 }
 
@@ -245,8 +250,12 @@ NeoWooDXI::NeoWooDXI(HWND hwnd, uint32_t width, uint32_t height)
 {
 	m_Context = std::make_unique<NeoDX11Context>(hwnd, width, height);
 	m_ResourceManager = std::make_unique<DX11ResourceManager>(m_Context.get());
+	m_TextureStreamer = std::make_unique<TextureStreamer>(m_Context.get());
 	m_MaterialLibrary = std::make_unique<MaterialLibrary>();
 	m_ShaderLibrary = std::make_unique<ShaderLibrary>();
+	m_ShaderCache = std::make_unique<ShaderCache>(std::make_unique<D3DShaderCompiler>());
+	m_ShaderCache->Load();
+	DX11Shader::s_Cache = m_ShaderCache.get();
 	m_MeshLibrary = std::make_unique<MeshLibrary>(this);
 	m_AnimationLibrary = std::make_unique<AnimationLibrary>();
 
@@ -279,14 +288,21 @@ NeoWooDXI::~NeoWooDXI()
 
 	m_Fonts.clear();
 	m_UITextures.clear();
+	m_UITextureRegistry.Clear();
 	m_ParticleTextures.clear();
 	m_PipelineStates.clear();
+	m_TextureStreamer.reset();
 	m_ResourceManager.reset();
 	m_AnimationLibrary.reset();
 	m_MaterialLibrary.reset();
 	m_ShaderLibrary.reset();
 	m_MeshLibrary.reset();
 	m_Context.reset();
+
+	// Ÿӿ ٽ  ̴ 
+	DX11Shader::s_Cache = nullptr;
+	m_ShaderCache->Save();
+	m_ShaderCache.reset();
 }
 
 RendererContext* NeoWooDXI::GetContext()
@@ -416,99 +432,108 @@ void NeoWooDXI::LoadMaterialsFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 	{
-		return;
+		m_MaterialLibrary->LoadFromFile(path);
 	}
-
-	if (std::filesystem::is_directory(directory))
+	else
 	{
 		m_MaterialLibrary->LoadFromDirectory(path);
 	}
-	else
+
+	// ̹  Ƽ ǳʶ ( ε  ϳ    ٽ  ʵ)
+	for (auto& [name, material] : m_MaterialLibrary->GetMaterials())
 	{
-		m_MaterialLibrary->LoadFromFile(path);
+		if (material->m_Shader == nullptr)
+			bindMaterial(*material);
 	}
+}
 
-	for (auto& material : m_MaterialLibrary->GetMaterials())
+void NeoWooDXI::bindMaterial(Material& material)
+{
+	if (material.m_ShaderString.empty())
 	{
-		if (material.second->m_ShaderString.empty())
-		{
-			OutputDebugStringA("Material does not have a shader\n");
-			continue;
-		}
-		material.second->m_Shader = LoadShader(material.second->m_ShaderString.c_str());
+		OutputDebugStringA("Material does not have a shader\n");
+		return;
+	}
+	material.m_Shader = LoadShader(material.m_ShaderString.c_str());
+
+	if (material.m_Shader == nullptr)
+	{
+		OutputDebugStringA("Shader can't find.\n");
+		assert(false);
+		return;
+	}
 
-		if (material.second->m_Shader == nullptr)
+	for (auto& texture : material.m_Textures)
+	{
+		// â : ̺κ ťؽĿ ؼ ؾѴ..Ƹ..
+		if (texture.second.Path.empty())
 		{
-			OutputDebugStringA("Shader can't find.\n");
-			assert(false);
-			continue;
+			OutputDebugStringA("Texture does not have a path\n");
+			switch (texture.second.Type)
+			{
+			case Texture::Type::Texture2D:
+				texture.second.Path = DEFAULT_TEXTURE2D_PATH;
+				texture.second.Texture = m_ResourceManager->CreateTexture2D(DEFAULT_TEXTURE2D_PATH);
+				break;
+			case Texture::Type::TextureCube:
+				texture.second.Path = DEFAULT_TEXTURECUBE_PATH;
+				texture.second.Texture = m_ResourceManager->CreateTextureCube(DEFAULT_TEXTURECUBE_PATH);
+				break;
+			default:
+				break;
+			}
 		}
-
-		for (auto& texture : material.second->m_Textures)
+		else
 		{
-			// â : ̺κ ťؽĿ ؼ ؾѴ..Ƹ..
-			if (texture.second.Path.empty())
+			std::filesystem::path texturePath = texture.second.Path;
+			if (texturePath.extension().string().empty())
 			{
-				OutputDebugStringA("Texture does not have a path\n");
-				switch (texture.second.Type)
-				{
-				case Texture::Type::Texture2D:
-					texture.second.Path = DEFAULT_TEXTURE2D_PATH;
-					texture.second.Texture = m_ResourceManager->CreateTexture2D(DEFAULT_TEXTURE2D_PATH);
-					break;
-				case Texture::Type::TextureCube:
-					texture.second.Path = DEFAULT_TEXTURECUBE_PATH;
-					texture.second.Texture = m_ResourceManager->CreateTextureCube(DEFAULT_TEXTURECUBE_PATH);
-					break;
-				default:
-					break;
-				}
+
 			}
-			else
+			else if (texture.second.Type == Texture::Type::Texture2D)
 			{
-				std::filesystem::path texturePath = texture.second.Path;
-				if (texturePath.extension().string().empty())
-				{
-
-				}
-				else
-				{
-					texture.second.Path = texturePath.string();
-					texture.second.Texture = Texture::Create(this, texture.second.Path.c_str(), texture.second.Type);
-				}
+				// Ƽ 2D ؽó  Ӹ ø RequestTextureResidency  ʿ ŭ Ʈ
+				texture.second.Path = texturePath.string();
+				texture.second.Texture = m_ResourceManager->CreateStreamingTexture2D(texture.second.Path, *m_TextureStreamer);
 			}
-
-			if (texture.second.Texture == nullptr)
+			else
 			{
-				OutputDebugStringA("Texture does not have a path\n");
-				switch (texture.second.Type)
-				{
-				case Texture::Type::Texture2D:
-					texture.second.Path = DEFAULT_TEXTURE2D_PATH;
-					texture.second.Texture = m_ResourceManager->CreateTexture2D(DEFAULT_TEXTURE2D_PATH);
-					break;
-				case Texture::Type::TextureCube:
-					texture.second.Path = DEFAULT_TEXTURECUBE_PATH;
-					texture.second.Texture = m_ResourceManager->CreateTextureCube(DEFAULT_TEXTURECUBE_PATH);
-					break;
-				default:
-					break;
-				}
+				texture.second.Path = texturePath.string();
+				texture.second.Texture = Texture::Create(this, texture.second.Path.c_str(), texture.second.Type);
 			}
 		}
 
-		// uav ø  ϴϱ ̷Զ 
-		auto&& dx11shader = std::static_pointer_cast<DX11Shader>(material.second->m_Shader);
-		for (auto& uav : dx11shader->m_UAVBindings)
+		if (texture.second.Texture == nullptr)
 		{
-			if (material.second->m_UAVTextures.find(uav.Name) == material.second->m_UAVTextures.end())
+			OutputDebugStringA("Texture does not have a path\n");
+			switch (texture.second.Type)
 			{
-				material.second->m_UAVTextures.emplace(uav.Name, nullptr);
+			case Texture::Type::Texture2D:
+				texture.second.Path = DEFAULT_TEXTURE2D_PATH;
+				texture.second.Texture = m_ResourceManager->CreateTexture2D(DEFAULT_TEXTURE2D_PATH);
+				break;
+			case Texture::Type::TextureCube:
+				texture.second.Path = DEFAULT_TEXTURECUBE_PATH;
+				texture.second.Texture = m_ResourceManager->CreateTextureCube(DEFAULT_TEXTURECUBE_PATH);
+				break;
+			default:
+				break;
 			}
 		}
 	}
+
+	// uav ø  ϴϱ ̷Զ 
+	auto&& dx11shader = std::static_pointer_cast<DX11Shader>(material.m_Shader);
+	for (auto& uav : dx11shader->m_UAVBindings)
+	{
+		if (material.m_UAVTextures.find(uav.Name) == material.m_UAVTextures.end())
+		{
+			material.m_UAVTextures.emplace(uav.Name, nullptr);
+		}
+	}
 }
 
 void NeoWooDXI::SaveMaterial(const std::string& name)
@@ -578,6 +603,7 @@ void NeoWooDXI::LoadShadersFromDrive(const std::string& path)
 		return;
 	}
 
+	std::vector<std::string> shaderPaths;
 	for (const auto& entry : std::filesystem::recursive_directory_iterator(shaderPath))
 	{
 		if (entry.is_regular_file())
@@ -588,11 +614,23 @@ void NeoWooDXI::LoadShadersFromDrive(const std::string& path)
 			{
 				auto pathStirng = path.string();
 				std::replace(pathStirng.begin(), pathStirng.end(), '\\', '/');
-				LoadShader(pathStirng.c_str());
+				shaderPaths.push_back(std::move(pathStirng));
 			}
 		}
 	}
 
+	// ĳÿ ų ٲ ̴  忡  , Ʒ LoadShader  ĳÿ blob  
+	std::vector<ShaderCompileRequest> requests;
+	for (const auto& shaderPathString : shaderPaths)
+		std::ranges::move(DX11Shader::GetCompileRequests(shaderPathString), std::back_inserter(requests));
+
+	m_ShaderCache->CompileAll(requests);
+
+	for (const auto& shaderPathString : shaderPaths)
+		LoadShader(shaderPathString.c_str());
+
+	m_ShaderCache->Save();
+
 	auto end = std::chrono::high_resolution_clock::now();
 
 	auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
@@ -600,24 +638,21 @@ void NeoWooDXI::LoadShadersFromDrive(const std::string& path)
 	OutputDebugStringA("LoadShadersFromDrive: ");
 	OutputDebugStringA(std::to_string(duration).c_str());
 	OutputDebugStringA("ms\n");
+	OutputDebugStringA(m_ShaderCache->GetSummary().c_str());
 }
 
 void NeoWooDXI::LoadMeshesFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
-	{
-		return;
-	}
-
-	if (std::filesystem::is_directory(directory))
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 	{
-		m_MeshLibrary->LoadMeshesFromDirectory(path);
+		m_MeshLibrary->LoadMeshesFromFile(path);
 	}
 	else
 	{
-		m_MeshLibrary->LoadMeshesFromFile(path);
+		m_MeshLibrary->LoadMeshesFromDirectory(path);
 	}
 }
 
@@ -625,13 +660,11 @@ void NeoWooDXI::LoadAnimationClipsFromDrive(const std::string& path)
 {
 	std::filesystem::path directory = path;
 
-	if (!std::filesystem::exists(directory))
-		return;
-
-	if (std::filesystem::is_directory(directory))
-		m_AnimationLibrary->LoadAnimationClipsFromDirectory(path);
-	else
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
 		m_AnimationLibrary->LoadAnimationClipsFromFile(path);
+	else
+		m_AnimationLibrary->LoadAnimationClipsFromDirectory(path);
 }
 
 void NeoWooDXI::LoadUITexturesFromDrive(const std::string& path)
@@ -657,6 +690,15 @@ std::shared_ptr<Texture> NeoWooDXI::GetUITexture(const std::string& name)
 	return nullptr;
 }
 
+void NeoWooDXI::RequestTextureResidency(Material& material, float screenPixels)
+{
+	for (auto& [name, slot] : material.m_Textures)
+	{
+		if (slot.Type == Texture::Type::Texture2D && slot.Texture != nullptr)
+			TextureStreamer::Request(static_cast<DX11Texture&>(*slot.Texture), screenPixels);
+	}
+}
+
 void NeoWooDXI::SetDebugViewProj(const DirectX::SimpleMath::Matrix& view, const DirectX::SimpleMath::Matrix& proj)
 {
 	m_effect->SetView(view);
@@ -961,14 +1003,16 @@ void NeoWooDXI::bindShaderResources(Material& material)
 		}
 	}
 
-	auto& textures = material.m_Textures;
+	// ε  ̸ ã   (̸ ã )
+	const auto& textures = material.GetBoundTextures();
 
-	for (auto& binding : dx11Shader->m_TextureBindings)
+	for (size_t i = 0; i < textures.size(); ++i)
 	{
-		auto it = textures.find(binding.Name);
-		if (it != textures.end())
+		const auto& binding = dx11Shader->m_TextureBindings[i];
+
+		if (const Material::TextureSlot* slot = textures[i])
 		{
-			auto dx11Texture = std::static_pointer_cast<DX11Texture>(it->second.Texture);
+			auto dx11Texture = static_cast<DX11Texture*>(slot->Texture.get());
 
 			if (dx11Texture)
 				dx11Texture->Bind(m_Context.get(), binding);
@@ -1001,17 +1045,13 @@ void NeoWooDXI::unbindShaderResources(Material& material)
 
 	DX11Shader* dx11Shader = static_cast<DX11Shader*>(shader);
 
-	auto& textures = material.m_Textures;
-
-	for (auto& binding : dx11Shader->m_TextureBindings)
+	for (const Material::TextureSlot* slot : material.GetBoundTextures())
 	{
-		auto it = textures.find(binding.Name);
-		if (it != textures.end())
-		{
-			if (auto dx11Texture = std::static_pointer_cast<DX11Texture>(it->second.Texture))
-				dx11Texture->Unbind(m_Context.get());
-		}
+		if (slot == nullptr)
+			continue;
 
+		if (auto dx11Texture = static_cast<DX11Texture*>(slot->Texture.get()))
+			dx11Texture->Unbind(m_Context.get());
 	}
 
 
@@ -1059,6 +1099,7 @@ void NeoWooDXI::loadUITexturesFromFile(const std::string& path)
 	static_pointer_cast<DX11Texture>(texture)->SetName(name);
 
 	m_UITextures[name] = texture;
+	m_UITextureRegistry.Set(name, texture);
 }
 
 void NeoWooDXI::loadParticleTexturesFromDirectory(const std::string& path)
@@ -1094,6 +1135,86 @@ void NeoWooDXI::loadParticleTexturesFromFile(const std::string& path)
 	m_ParticleTextures[name] = texture;
 }
 
+void NeoWooDXI::IndexAssetsFromDrive(AssetType type, const std::string& path)
+{
+	switch (type)
+	{
+	case AssetType::Mesh:
+		m_MeshLibrary->IndexDirectory(path);
+		break;
+	case AssetType::Material:
+		// Ƽ ̸  ζ  ʿ 
+		break;
+	case AssetType::AnimationClip:
+		m_AnimationLibrary->IndexDirectory(path);
+		break;
+	case AssetType::UITexture:
+		indexFileNames(path, m_UITexturePaths);
+		break;
+	case AssetType::ParticleTexture:
+		indexFileNames(path, m_ParticleTexturePaths);
+		break;
+	}
+}
+
+bool NeoWooDXI::LoadAsset(AssetType type, const std::string& name)
+{
+	if (name.empty())
+		return false;
+
+	switch (type)
+	{
+	case AssetType::Mesh:
+		return m_MeshLibrary->LoadMesh(name);
+	case AssetType::Material:
+	{
+		if (m_MaterialLibrary->GetMaterial(name) != nullptr)
+			return true;
+
+		if (!VirtualFileSystem::Exists(name))
+			return false;
+
+		LoadMaterialsFromDrive(name);
+		return m_MaterialLibrary->GetMaterial(name) != nullptr;
+	}
+	case AssetType::AnimationClip:
+		return m_AnimationLibrary->LoadAnimationClip(name);
+	case AssetType::UITexture:
+	{
+		if (m_UITextures.contains(name))
+			return true;
+
+		auto it = m_UITexturePaths.find(name);
+		if (it == m_UITexturePaths.end())
+			return false;
+
+		loadUITexturesFromFile(it->second);
+		return m_UITextures.contains(name);
+	}
+	case AssetType::ParticleTexture:
+	{
+		if (m_ParticleTextures.contains(name))
+			return true;
+
+		auto it = m_ParticleTexturePaths.find(name);
+		if (it == m_ParticleTexturePaths.end())
+			return false;
+
+		loadParticleTexturesFromFile(it->second);
+		return m_ParticleTextures.contains(name);
+	}
+	}
+
+	return false;
+}
+
+void NeoWooDXI::indexFileNames(const std::string& path, robin_hood::unordered_map<std::string, std::string>& paths)
+{
+	// load*TexturesFromDirectory    (  ),   + ũ
+	for (const auto& file : VirtualFileSystem::List(path, false))
+		paths[std::filesystem::path(file).filename().string()] = file;
+}
+
 void NeoWooDXI::loadFontsFromDirectory(const std::string& path)
 {
 	std::filesystem::path directory(path);
@@ -7,6 +7,7 @@
 #include "Material.h"
 #include "AnimationLibrary.h"
 #include "DX11ResourceManager.h"
+#include "TextureStreamer.h"
 
 #include "DebugDraw.h"
 #include <./directxtk/CommonStates.h>
@@ -30,7 +31,7 @@ public:
 	virtual void SetFullScreen(bool fullscreen) override;
 	virtual void SetVSync(bool vsync) override;
 	virtual void Submit(Mesh& mesh, Material& material, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) override;
-	virtual void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) override;
+	virtual void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1, uint32_t lod = 0) override;
 	virtual void DispatchCompute(Material& material, uint32_t threadGroupCountX, uint32_t threadGroupCountY, uint32_t threadGroupCountZ) override;
 	virtual void CopyStructureCount(Buffer* dest, uint32_t distAlignedByteOffset, Texture* src) override;
 	virtual void SubmitInstancedIndirect(Material& material, Texture* argsBuffer, uint32_t allignedByteOffsetForArgs, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST) override;
@@ -67,6 +68,7 @@ public:
 	virtual void AddMaterial(const std::shared_ptr<Material>& material) override { m_MaterialLibrary->AddMaterial(material); }
 	virtual std::shared_ptr<Material> GetMaterial(const std::string& name) override { return m_MaterialLibrary->GetMaterial(name); }
 	virtual std::map<std::string, std::shared_ptr<Material>>* GetMaterials() override { return &m_MaterialLibrary->GetMaterials(); }
+	virtual AssetRegistry<Material>* GetMaterialRegistry() override { return &m_MaterialLibrary->GetRegistry(); }
 
 	virtual void LoadShadersFromDrive(const std::string& path) override;
 	virtual std::map<std::string, std::shared_ptr<Shader>>* GetShaders() override { return &m_ShaderLibrary->GetShaders(); }
@@ -74,16 +76,23 @@ public:
 	virtual void LoadMeshesFromDrive(const std::string& path) override;
 	virtual std::shared_ptr<Mesh> GetMesh(const std::string& name) override { return m_MeshLibrary->GetMesh(name); }
 	virtual std::map<std::string, std::shared_ptr<Mesh>>* GetMeshes() override { return &m_MeshLibrary->GetMeshes(); }
+	virtual AssetRegistry<Mesh>* GetMeshRegistry() override { return &m_MeshLibrary->GetRegistry(); }
 	virtual void AddMesh(const std::shared_ptr<Mesh>& mesh) override { m_MeshLibrary->AddMesh(mesh); }
 
 	virtual void LoadAnimationClipsFromDrive(const std::string& path);
 	virtual std::shared_ptr<AnimationClip> GetAnimationClip(const std::string& name) { return m_AnimationLibrary->GetAnimationClip(name); }
 	virtual std::map<std::string, std::shared_ptr<AnimationClip>>* GetAnimationClips() { return &m_AnimationLibrary->GetAnimationClips(); }
 
+	// TextureStreaming
+	virtual void RequestTextureResidency(Material& material, float screenPixels) override;
+	virtual void SetTextureStreamingBudget(uint64_t bytes) override { m_TextureStreamer->SetBudget(bytes); }
+	virtual TextureStreamingStats GetTextureStreamingStats() const override { return m_TextureStreamer->GetStats(); }
+
 	// UI
 	virtual void LoadUITexturesFromDrive(const std::string& path) override;
 	virtual std::shared_ptr<Texture> GetUITexture(const std::string& name) override;
 	virtual robin_hood::unordered_map<std::string, std::shared_ptr<Texture>>* GetUITextures() override { return &m_UITextures; }
+	virtual AssetRegistry<Texture>* GetUITextureRegistry() override { return &m_UITextureRegistry; }
 
 	// DebugDraw
 	virtual void SetDebugViewProj(const DirectX::SimpleMath::Matrix& view, const DirectX::SimpleMath::Matrix& proj) override;
@@ -109,8 +118,18 @@ public:
 	virtual std::shared_ptr<Font> GetFont(const std::string& name) override;
 	virtual robin_hood::unordered_map<std::string, std::shared_ptr<Font>>* GetFonts() override { return &m_Fonts; }
 
+	//  ε
+	virtual void IndexAssetsFromDrive(AssetType type, const std::string& path) override;
+	virtual bool LoadAsset(AssetType type, const std::string& name) override;
+
 private:
 	void bindShaderResources(Material& material);
+
+	// ̴, ؽó 
+	void bindMaterial(Material& material);
+
+	//  ̸ ->  (ؽó  ̸ ãǷ  ʰ ϸ )
+	void indexFileNames(const std::string& path, robin_hood::unordered_map<std::string, std::string>& paths);
 	void unbindShaderResources(Material& material);
 
 	// UI
@@ -130,9 +149,11 @@ private:
 	API m_API = API::DirectX11;
 	std::unique_ptr<NeoDX11Context> m_Context = nullptr;
 	std::unique_ptr<DX11ResourceManager> m_ResourceManager = nullptr;
+	std::unique_ptr<TextureStreamer> m_TextureStreamer = nullptr;
 
 	// Library
 	std::unique_ptr<ShaderLibrary> m_ShaderLibrary = nullptr;
+	std::unique_ptr<ShaderCache> m_ShaderCache = nullptr;
 	std::unique_ptr<MeshLibrary> m_MeshLibrary = nullptr;
 	std::unique_ptr<MaterialLibrary> m_MaterialLibrary = nullptr;
 	std::unique_ptr<AnimationLibrary> m_AnimationLibrary = nullptr;
@@ -147,9 +168,12 @@ private:
 
 	// UI
 	robin_hood::unordered_map<std::string, std::shared_ptr<Texture>> m_UITextures;
+	AssetRegistry<Texture> m_UITextureRegistry;
+	robin_hood::unordered_map<std::string, std::string> m_UITexturePaths;			//  ε 
 
 	// Particle
 	std::map<std::string, std::shared_ptr<Texture>> m_ParticleTextures;
+	robin_hood::unordered_map<std::string, std::string> m_ParticleTexturePaths;	//  ε 
 
 	// DWrite
 	robin_hood::unordered_map<std::string, std::shared_ptr<Font>> m_Fonts;
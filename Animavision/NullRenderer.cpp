@@ -0,0 +1,422 @@
+#include "pch.h"
+#include "NullRenderer.h"
+
+#include "Mesh.h"
+#include "Material.h"
+#include "MeshLibrary.h"
+#include "AnimationLibrary.h"
+
+NullTexture::NullTexture(const std::string& path, Type type, uint32_t width, uint32_t height)
+{
+	m_Path = path;
+	m_Type = type;
+	m_Width = width;
+	m_Height = height;
+}
+
+NullShader::NullShader(NullRenderer* renderer, const std::string& srcPath)
+	: m_Renderer(renderer)
+{
+	Name = srcPath;
+	ID = s_ShaderCount++;
+	IsValid = true;
+}
+
+void NullShader::MapConstantBuffer(RendererContext* context)
+{
+	m_Renderer->RecordConstantBuffer(ID, true);
+}
+
+void NullShader::UnmapConstantBuffer(RendererContext* context)
+{
+	m_Renderer->RecordConstantBuffer(ID, false);
+}
+
+void NullShader::record(uint32_t size)
+{
+	m_Renderer->RecordConstant(ID, size);
+}
+
+NullRenderer::NullRenderer(uint32_t width, uint32_t height)
+	: m_Width(width), m_Height(height)
+{
+	m_MaterialLibrary = std::make_unique<MaterialLibrary>();
+	m_ShaderLibrary = std::make_unique<ShaderLibrary>();
+	m_MeshLibrary = std::make_unique<MeshLibrary>(this);
+	m_AnimationLibrary = std::make_unique<AnimationLibrary>();
+}
+
+NullRenderer::~NullRenderer() = default;
+
+void NullRenderer::Resize(uint32_t width, uint32_t height)
+{
+	m_Width = width;
+	m_Height = height;
+}
+
+void NullRenderer::Clear(const float* RGBA)
+{
+	record(RenderCommand::Type::Clear);
+}
+
+void NullRenderer::ClearTexture(Texture* texture, const float* clearColor)
+{
+	record(RenderCommand::Type::ClearTexture);
+}
+
+void NullRenderer::SetRenderTargets(uint32_t numRenderTargets, Texture* renderTargets[], Texture* depthStencil, bool useDefaultDSV)
+{
+	++m_Stats.renderTargetChanges;
+	record(RenderCommand::Type::SetRenderTargets, 0, numRenderTargets, depthStencil || useDefaultDSV);
+}
+
+void NullRenderer::SetViewport(uint32_t width, uint32_t height)
+{
+	record(RenderCommand::Type::SetViewport, 0, width, height);
+}
+
+void NullRenderer::ApplyRenderState(BlendState blendstate, RasterizerState rasterizerstate, DepthStencilState depthstencilstate)
+{
+	const uint32_t state = static_cast<uint32_t>(blendstate)
+		| static_cast<uint32_t>(rasterizerstate) << 8
+		| static_cast<uint32_t>(depthstencilstate) << 16;
+
+	if (state == m_LastRenderState)
+	{
+		++m_Stats.redundantStateChanges;
+		return;
+	}
+
+	m_LastRenderState = state;
+	++m_Stats.stateChanges;
+	record(RenderCommand::Type::ApplyRenderState, 0, static_cast<uint32_t>(blendstate), static_cast<uint32_t>(rasterizerstate), static_cast<uint32_t>(depthstencilstate));
+}
+
+void NullRenderer::Submit(Mesh& mesh, Material& material, PrimitiveTopology primitiveMode, uint32_t instances)
+{
+	recordDraw(material, mesh.GetIndexCount(), instances, primitiveMode);
+}
+
+void NullRenderer::Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode, uint32_t instances, uint32_t lod)
+{
+	const uint32_t indexCount = subMeshIndex < mesh.subMeshDescriptors.size() ? mesh.subMeshDescriptors[subMeshIndex].GetLod(lod).indexCount : 0;
+	recordDraw(material, indexCount, instances, primitiveMode);
+}
+
+void NullRenderer::DispatchCompute(Material& material, uint32_t threadGroupCountX, uint32_t threadGroupCountY, uint32_t threadGroupCountZ)
+{
+	recordShader(material);
+	++m_Stats.dispatches;
+	record(RenderCommand::Type::Dispatch, m_LastShaderID, threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+void NullRenderer::SubmitInstancedIndirect(Material& material, Texture* argsBuffer, uint32_t allignedByteOffsetForArgs, PrimitiveTopology primitiveMode)
+{
+	// ε, νϽ  GPU  ϹǷ ο Ƚ 
+	recordShader(material);
+	++m_Stats.draws;
+	record(RenderCommand::Type::DrawIndirect, m_LastShaderID, 0, 0, static_cast<uint32_t>(primitiveMode));
+}
+
+std::shared_ptr<Texture> NullRenderer::GetTexture(const char* path)
+{
+	auto it = m_Textures.find(path);
+	if (it != m_Textures.end())
+		return it->second;
+
+	return nullptr;
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateTexture(const char* path)
+{
+	return getOrCreateTexture(path, Texture::Type::Texture2D);
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateTexture2DArray(const char* path)
+{
+	return getOrCreateTexture(path, Texture::Type::Texture2DArray);
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateTextureCube(const char* path)
+{
+	return getOrCreateTexture(path, Texture::Type::TextureCube);
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateEmptyTexture(std::string name, Texture::Type type, uint32_t width, uint32_t height, uint32_t mipLevels, Texture::Format format, Texture::Usage usage, float* clearColor, Texture::UAVType uavType, uint32_t arraySize)
+{
+	auto texture = std::make_shared<NullTexture>(name, type, width, height);
+	m_Textures[name] = texture;
+
+	return texture;
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateEmptyTexture(const TextureDesc& desc)
+{
+	return CreateEmptyTexture(desc.name, desc.type, desc.width, desc.height, desc.mipLevels, desc.format, desc.usage, desc.clearColor, desc.uavType, desc.arraySize);
+}
+
+void NullRenderer::ReleaseTexture(const std::string& name)
+{
+	m_Textures.erase(name);
+}
+
+std::shared_ptr<Shader> NullRenderer::LoadShader(const char* srcPath)
+{
+	return m_ShaderLibrary->LoadShader(this, srcPath);
+}
+
+void NullRenderer::LoadShadersFromDrive(const std::string& path)
+{
+	std::filesystem::path shaderPath = path;
+	if (!std::filesystem::exists(shaderPath))
+		return;
+
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(shaderPath))
+	{
+		if (entry.is_regular_file() && entry.path().extension() == ".hlsl")
+		{
+			auto pathString = entry.path().string();
+			std::replace(pathString.begin(), pathString.end(), '\\', '/');
+			LoadShader(pathString.c_str());
+		}
+	}
+}
+
+std::map<std::string, std::shared_ptr<Shader>>* NullRenderer::GetShaders()
+{
+	return &m_ShaderLibrary->GetShaders();
+}
+
+void NullRenderer::AddMesh(const std::shared_ptr<Mesh>& mesh)
+{
+	m_MeshLibrary->AddMesh(mesh);
+}
+
+void NullRenderer::LoadMeshesFromDrive(const std::string& path)
+{
+	std::filesystem::path directory = path;
+
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	//  ۴  ʰ(Buffer::Create  nullptr) CPU Ϳ ٿ 
+	if (directory.has_extension())
+		m_MeshLibrary->LoadMeshesFromFile(path);
+	else
+		m_MeshLibrary->LoadMeshesFromDirectory(path);
+}
+
+std::shared_ptr<Mesh> NullRenderer::GetMesh(const std::string& name)
+{
+	return m_MeshLibrary->GetMesh(name);
+}
+
+std::map<std::string, std::shared_ptr<Mesh>>* NullRenderer::GetMeshes()
+{
+	return &m_MeshLibrary->GetMeshes();
+}
+
+AssetRegistry<Mesh>* NullRenderer::GetMeshRegistry()
+{
+	return &m_MeshLibrary->GetRegistry();
+}
+
+void NullRenderer::AddMaterial(const std::shared_ptr<Material>& material)
+{
+	m_MaterialLibrary->AddMaterial(material);
+}
+
+void NullRenderer::LoadMaterialsFromDrive(const std::string& path)
+{
+	std::filesystem::path directory = path;
+
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
+		m_MaterialLibrary->LoadFromFile(path);
+	else
+		m_MaterialLibrary->LoadFromDirectory(path);
+
+	// DX   Ģ ̴, ؽó  (ΰ  ⺻ ؽó)
+	for (auto& [name, material] : m_MaterialLibrary->GetMaterials())
+	{
+		if (!material->m_ShaderString.empty())
+			material->m_Shader = LoadShader(material->m_ShaderString.c_str());
+
+		for (auto& [slotName, slot] : material->m_Textures)
+		{
+			if (slot.Path.empty())
+			{
+				if (slot.Type == Texture::Type::Texture2D)
+					slot.Path = DEFAULT_TEXTURE2D_PATH;
+				else if (slot.Type == Texture::Type::TextureCube)
+					slot.Path = DEFAULT_TEXTURECUBE_PATH;
+			}
+
+			slot.Texture = getOrCreateTexture(slot.Path, slot.Type);
+		}
+	}
+}
+
+std::shared_ptr<Material> NullRenderer::GetMaterial(const std::string& name)
+{
+	return m_MaterialLibrary->GetMaterial(name);
+}
+
+std::map<std::string, std::shared_ptr<Material>>* NullRenderer::GetMaterials()
+{
+	return &m_MaterialLibrary->GetMaterials();
+}
+
+AssetRegistry<Material>* NullRenderer::GetMaterialRegistry()
+{
+	return &m_MaterialLibrary->GetRegistry();
+}
+
+void NullRenderer::LoadAnimationClipsFromDrive(const std::string& path)
+{
+	std::filesystem::path directory = path;
+
+	// Ѹ ϸ ũ ͸ Ƿ Ȯڷ  
+	if (directory.has_extension())
+		m_AnimationLibrary->LoadAnimationClipsFromFile(path);
+	else
+		m_AnimationLibrary->LoadAnimationClipsFromDirectory(path);
+}
+
+std::shared_ptr<AnimationClip> NullRenderer::GetAnimationClip(const std::string& name)
+{
+	return m_AnimationLibrary->GetAnimationClip(name);
+}
+
+std::map<std::string, std::shared_ptr<AnimationClip>>* NullRenderer::GetAnimationClips()
+{
+	return &m_AnimationLibrary->GetAnimationClips();
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateRandomTexture()
+{
+	return std::make_shared<NullTexture>("RandomTexture", Texture::Type::Texture1D);
+}
+
+std::shared_ptr<Texture> NullRenderer::CreateIndirectDrawTexture()
+{
+	return std::make_shared<NullTexture>("IndirectDrawTexture", Texture::Type::Buffer);
+}
+
+Renderer::ParticleBuffers NullRenderer::CreateParticleBufferTextures(uint32_t maxCount, uint32_t entity)
+{
+	return ParticleBuffers(
+		std::make_shared<NullTexture>("ParticleBuffer", Texture::Type::Buffer, maxCount),
+		std::make_shared<NullTexture>("ParticleAppendBuffer", Texture::Type::Buffer, maxCount),
+		std::make_shared<NullTexture>("ParticleConsumeBuffer", Texture::Type::Buffer, maxCount));
+}
+
+void NullRenderer::LoadParticleTexturesFromDrive(const std::string& path)
+{
+	std::filesystem::path directory(path);
+	if (!std::filesystem::exists(directory))
+		return;
+
+	for (const auto& entry : std::filesystem::directory_iterator(directory))
+	{
+		if (entry.is_regular_file())
+		{
+			auto name = entry.path().filename().string();
+			m_ParticleTextures[name] = std::make_shared<NullTexture>(name, Texture::Type::Texture2D);
+		}
+	}
+}
+
+std::shared_ptr<Texture> NullRenderer::GetParticleTexture(std::string name)
+{
+	auto it = m_ParticleTextures.find(name);
+	if (it != m_ParticleTextures.end())
+		return it->second;
+
+	return nullptr;
+}
+
+void NullRenderer::LoadUITexturesFromDrive(const std::string& path)
+{
+	std::filesystem::path directory(path);
+	if (!std::filesystem::exists(directory))
+		return;
+
+	for (const auto& entry : std::filesystem::directory_iterator(directory))
+	{
+		if (entry.is_regular_file())
+		{
+			auto name = entry.path().filename().string();
+			auto texture = std::make_shared<NullTexture>(name, Texture::Type::Texture2D);
+			m_UITextures[name] = texture;
+			m_UITextureRegistry.Set(name, texture);
+		}
+	}
+}
+
+std::shared_ptr<Texture> NullRenderer::GetUITexture(const std::string& name)
+{
+	auto it = m_UITextures.find(name);
+	if (it != m_UITextures.end())
+		return it->second;
+
+	return nullptr;
+}
+
+void NullRenderer::ResetRecording()
+{
+	m_Commands.clear();
+	m_Stats = {};
+	m_LastRenderState = UINT32_MAX;
+	m_LastShaderID = UINT32_MAX;
+}
+
+void NullRenderer::RecordConstant(uint32_t shaderID, uint32_t size)
+{
+	++m_Stats.constantWrites;
+	m_Stats.constantBytes += size;
+	record(RenderCommand::Type::SetConstant, shaderID, size);
+}
+
+void NullRenderer::RecordConstantBuffer(uint32_t shaderID, bool isMap)
+{
+	if (isMap)
+		++m_Stats.constantBufferMaps;
+
+	record(isMap ? RenderCommand::Type::MapConstantBuffer : RenderCommand::Type::UnmapConstantBuffer, shaderID);
+}
+
+std::shared_ptr<Texture> NullRenderer::getOrCreateTexture(const std::string& path, Texture::Type type)
+{
+	auto& texture = m_Textures[path];
+	if (!texture)
+		texture = std::make_shared<NullTexture>(path, type);
+
+	return texture;
+}
+
+void NullRenderer::record(RenderCommand::Type type, uint32_t shaderID, uint32_t arg0, uint32_t arg1, uint32_t arg2)
+{
+	if (m_IsCommandLogEnabled)
+		m_Commands.push_back({ type, shaderID, arg0, arg1, arg2 });
+}
+
+void NullRenderer::recordDraw(Material& material, uint32_t indexCount, uint32_t instances, PrimitiveTopology primitiveMode)
+{
+	recordShader(material);
+
+	++m_Stats.draws;
+	m_Stats.instances += instances;
+	m_Stats.indices += static_cast<uint64_t>(indexCount) * instances;
+
+	record(RenderCommand::Type::Draw, m_LastShaderID, indexCount, instances, static_cast<uint32_t>(primitiveMode));
+}
+
+void NullRenderer::recordShader(Material& material)
+{
+	const uint32_t shaderID = material.m_Shader ? material.m_Shader->ID : UINT32_MAX;
+
+	if (shaderID != m_LastShaderID)
+	{
+		m_LastShaderID = shaderID;
+		++m_Stats.shaderChanges;
+	}
+}
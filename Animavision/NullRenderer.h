@@ -0,0 +1,208 @@
+#pragma once
+
+#include "Renderer.h"
+#include "Shader.h"
+
+class MeshLibrary;
+class ShaderLibrary;
+class MaterialLibrary;
+class AnimationLibrary;
+class NullRenderer;
+
+// NullRenderer  ϴ  ( ũ, ҽ ID  θ )
+struct RenderCommand
+{
+	enum class Type : uint8_t
+	{
+		Clear,
+		ClearTexture,
+		SetRenderTargets,		// arg0 :  Ÿ , arg1 :    
+		SetViewport,			// arg0 : ʺ, arg1 : 
+		ApplyRenderState,		// arg0 : Blend, arg1 : Rasterizer, arg2 : DepthStencil
+		Draw,					// shaderID, arg0 : ε , arg1 : νϽ , arg2 : 
+		DrawIndirect,			// shaderID, arg2 : 
+		Dispatch,				// shaderID, arg0 ~ arg2 :  ׷ 
+		SetConstant,			// shaderID, arg0 : Ʈ 
+		MapConstantBuffer,		// shaderID
+		UnmapConstantBuffer,	// shaderID
+	};
+
+	Type type = Type::Clear;
+	uint32_t shaderID = 0;
+	uint32_t arg0 = 0;
+	uint32_t arg1 = 0;
+	uint32_t arg2 = 0;
+};
+
+//  (ResetRecording )  
+struct RenderStats
+{
+	uint32_t draws = 0;
+	uint32_t instances = 0;
+	uint64_t indices = 0;
+	uint32_t dispatches = 0;
+
+	uint32_t stateChanges = 0;				//  ٸ ApplyRenderState
+	uint32_t redundantStateChanges = 0;		//   ApplyRenderState
+	uint32_t renderTargetChanges = 0;
+	uint32_t shaderChanges = 0;				//   ̴ ٸ ο, ġ
+
+	uint32_t constantWrites = 0;
+	uint64_t constantBytes = 0;				// ũ⸦ ƴ Set* ȣ⸸ (SetIntArray, SetStruct  ÷  0)
+	uint32_t constantBufferMaps = 0;
+};
+
+// ̸, , ũ⸸  ؽó (GPU ҽ )
+class NullTexture : public Texture
+{
+public:
+	NullTexture(const std::string& path, Type type, uint32_t width = 0, uint32_t height = 0);
+
+	virtual void* GetShaderResourceView() override { return nullptr; }
+};
+
+//     ȣ Ʈ   ϴ ̴
+class NullShader : public Shader
+{
+public:
+	NullShader(NullRenderer* renderer, const std::string& srcPath);
+
+	virtual void Bind(Renderer* renderer) override {}
+
+	virtual void SetInt(const std::string& name, int value) override { record(sizeof(int)); }
+	virtual void SetIntArray(const std::string& name, int* value) override { record(0); }
+	virtual void SetFloat(const std::string& name, float value) override { record(sizeof(float)); }
+	virtual void SetFloat2(const std::string& name, const Vector2& value) override { record(sizeof(Vector2)); }
+	virtual void SetFloat3(const std::string& name, const Vector3& value) override { record(sizeof(Vector3)); }
+	virtual void SetFloat4(const std::string& name, const Vector4& value) override { record(sizeof(Vector4)); }
+	virtual void SetMatrix(const std::string& name, const Matrix& value) override { record(sizeof(Matrix)); }
+	virtual void SetStruct(const std::string& name, const void* value) override { record(0); }
+	virtual void SetConstant(const std::string& name, const void* value, uint32_t size) override { record(size); }
+	virtual void MapConstantBuffer(RendererContext* context) override;
+	virtual void UnmapConstantBuffer(RendererContext* context) override;
+	virtual void MapConstantBuffer(RendererContext* context, std::string bufName) override { MapConstantBuffer(context); }
+	virtual void UnmapConstantBuffer(RendererContext* context, std::string bufName) override { UnmapConstantBuffer(context); }
+
+private:
+	void record(uint32_t size);
+
+	NullRenderer* m_Renderer = nullptr;
+};
+
+/// GPU, â  ϴ  (API::NONE)
+/// ޽, ִϸ̼ Ŭ, Ƽ CPU ͸ ״ а ؽó ̴  ü 
+/// ,  ,    α׿ ϰ 踦 Ƿ  ý CPU  GPU    
+///  ܰ Renderer   ķ ǹǷ  ȭ 
+class ANIMAVISION_DLL NullRenderer : public Renderer
+{
+public:
+	NullRenderer(uint32_t width, uint32_t height);
+	virtual ~NullRenderer();
+
+	virtual void Resize(uint32_t width, uint32_t height) override;
+	virtual void Clear(const float* RGBA) override;
+	virtual void ClearTexture(Texture* texture, const float* clearColor) override;
+
+	virtual void SetRenderTargets(uint32_t numRenderTargets, Texture* renderTargets[], Texture* depthStencil = nullptr, bool useDefaultDSV = true) override;
+	virtual void SetViewport(uint32_t width, uint32_t height) override;
+	virtual void ApplyRenderState(BlendState blendstate, RasterizerState rasterizerstate, DepthStencilState depthstencilstate) override;
+
+	virtual void Submit(Mesh& mesh, Material& material, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) override;
+	virtual void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1, uint32_t lod = 0) override;
+	virtual void DispatchCompute(Material& material, uint32_t threadGroupCountX, uint32_t threadGroupCountY, uint32_t threadGroupCountZ) override;
+	virtual void SubmitInstancedIndirect(Material& material, Texture* argsBuffer, uint32_t allignedByteOffsetForArgs, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST) override;
+
+	virtual void BeginRender() override {}
+	virtual void EndRender() override {}
+
+	virtual std::shared_ptr<Texture> GetTexture(const char* path) override;
+	virtual std::shared_ptr<Texture> CreateTexture(const char* path) override;
+	virtual std::shared_ptr<Texture> CreateTexture2DArray(const char* path) override;
+	virtual std::shared_ptr<Texture> CreateTextureCube(const char* path) override;
+	virtual std::shared_ptr<Texture> CreateEmptyTexture(std::string name, Texture::Type type, uint32_t width, uint32_t height, uint32_t mipLevels, Texture::Format format, Texture::Usage usage = Texture::Usage::NONE, float* clearColor = nullptr, Texture::UAVType uavType = Texture::UAVType::NONE, uint32_t arraySize = 1) override;
+	virtual std::shared_ptr<Texture> CreateEmptyTexture(const TextureDesc& desc) override;
+	virtual void ReleaseTexture(const std::string& name) override;
+
+	virtual std::shared_ptr<Shader> LoadShader(const char* srcPath) override;
+	virtual void LoadShadersFromDrive(const std::string& path) override;
+	virtual std::map<std::string, std::shared_ptr<Shader>>* GetShaders() override;
+
+	virtual RendererContext* GetContext() override { return nullptr; }
+	virtual void* GetShaderResourceView() override { return nullptr; }
+
+	virtual uint32_t GetWidth() const override { return m_Width; }
+	virtual uint32_t GetHeight() const override { return m_Height; }
+
+	virtual void AddMesh(const std::shared_ptr<Mesh>& mesh) override;
+	virtual void LoadMeshesFromDrive(const std::string& path) override;
+	virtual std::shared_ptr<Mesh> GetMesh(const std::string& name) override;
+	virtual std::map<std::string, std::shared_ptr<Mesh>>* GetMeshes() override;
+	virtual AssetRegistry<Mesh>* GetMeshRegistry() override;
+
+	virtual void AddMaterial(const std::shared_ptr<Material>& material) override;
+	virtual void LoadMaterialsFromDrive(const std::string& path) override;
+	virtual std::shared_ptr<Material> GetMaterial(const std::string& name) override;
+	virtual void SaveMaterial(const std::string& name) override {}
+	virtual std::map<std::string, std::shared_ptr<Material>>* GetMaterials() override;
+	virtual AssetRegistry<Material>* GetMaterialRegistry() override;
+
+	virtual void LoadAnimationClipsFromDrive(const std::string& path) override;
+	virtual std::shared_ptr<AnimationClip> GetAnimationClip(const std::string& name) override;
+	virtual std::map<std::string, std::shared_ptr<AnimationClip>>* GetAnimationClips() override;
+
+	// Particle
+	virtual std::shared_ptr<Texture> CreateRandomTexture() override;
+	virtual std::shared_ptr<Texture> CreateIndirectDrawTexture() override;
+	virtual ParticleBuffers CreateParticleBufferTextures(uint32_t maxCount, uint32_t entity) override;
+	virtual void LoadParticleTexturesFromDrive(const std::string& path) override;
+	virtual std::shared_ptr<Texture> GetParticleTexture(std::string name) override;
+	virtual std::map<std::string, std::shared_ptr<Texture>>* GetParticleTextures() override { return &m_ParticleTextures; }
+
+	// UI
+	virtual void LoadUITexturesFromDrive(const std::string& path) override;
+	virtual std::shared_ptr<Texture> GetUITexture(const std::string& name) override;
+	virtual robin_hood::unordered_map<std::string, std::shared_ptr<Texture>>* GetUITextures() override { return &m_UITextures; }
+	virtual AssetRegistry<Texture>* GetUITextureRegistry() override { return &m_UITextureRegistry; }
+
+	// Recording
+	// α׸  踸  (  αװ  Ŀ ʵ)
+	void SetCommandLogEnabled(bool enabled) { m_IsCommandLogEnabled = enabled; }
+	// α, ,   ʱȭ (α 뷮 )
+	void ResetRecording();
+	const std::vector<RenderCommand>& GetCommands() const { return m_Commands; }
+	const RenderStats& GetStats() const { return m_Stats; }
+
+	void RecordConstant(uint32_t shaderID, uint32_t size);
+	void RecordConstantBuffer(uint32_t shaderID, bool isMap);
+
+private:
+	std::shared_ptr<Texture> getOrCreateTexture(const std::string& path, Texture::Type type);
+
+	void record(RenderCommand::Type type, uint32_t shaderID = 0, uint32_t arg0 = 0, uint32_t arg1 = 0, uint32_t arg2 = 0);
+	void recordDraw(Material& material, uint32_t indexCount, uint32_t instances, PrimitiveTopology primitiveMode);
+	void recordShader(Material& material);
+
+	uint32_t m_Width = 0;
+	uint32_t m_Height = 0;
+
+	// Library
+	std::unique_ptr<ShaderLibrary> m_ShaderLibrary = nullptr;
+	std::unique_ptr<MeshLibrary> m_MeshLibrary = nullptr;
+	std::unique_ptr<MaterialLibrary> m_MaterialLibrary = nullptr;
+	std::unique_ptr<AnimationLibrary> m_AnimationLibrary = nullptr;
+
+	// (Ǵ ̸) ؽó
+	std::map<std::string, std::shared_ptr<Texture>> m_Textures;
+	std::map<std::string, std::shared_ptr<Texture>> m_ParticleTextures;
+	robin_hood::unordered_map<std::string, std::shared_ptr<Texture>> m_UITextures;
+	AssetRegistry<Texture> m_UITextureRegistry;
+
+	// Recording
+	bool m_IsCommandLogEnabled = true;
+	std::vector<RenderCommand> m_Commands;
+	RenderStats m_Stats;
+
+	// ߺ  Ǵܿ   (UINT32_MAX :    )
+	uint32_t m_LastRenderState = UINT32_MAX;
+	uint32_t m_LastShaderID = UINT32_MAX;
+};
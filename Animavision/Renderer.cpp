@@ -2,6 +2,7 @@
 #include "Renderer.h"
 #include "ChangDXII.h"
 #include "NeoWooDXI.h"
+#include "NullRenderer.h"
 
 
 std::unique_ptr<Renderer> Renderer::Create(HWND hwnd, uint32_t width, uint32_t height, API api, bool isRaytracing /*= false*/)
@@ -25,8 +26,53 @@ std::unique_ptr<Renderer> Renderer::Create(HWND hwnd, uint32_t width, uint32_t h
 		return std::make_unique<ChangDXII>(hwnd, width, height, isRaytracing);
 		break;
 	}
+	case API::NONE:
+	{
+		return std::make_unique<NullRenderer>(width, height);
+	}
 	}
 
 	assert(false && "Invalid API");
 	return nullptr;
 }
+
+void Renderer::IndexAssetsFromDrive(AssetType type, const std::string& path)
+{
+	switch (type)
+	{
+	case AssetType::Mesh:
+		LoadMeshesFromDrive(path);
+		break;
+	case AssetType::Material:
+		LoadMaterialsFromDrive(path);
+		break;
+	case AssetType::AnimationClip:
+		LoadAnimationClipsFromDrive(path);
+		break;
+	case AssetType::UITexture:
+		LoadUITexturesFromDrive(path);
+		break;
+	case AssetType::ParticleTexture:
+		LoadParticleTexturesFromDrive(path);
+		break;
+	}
+}
+
+bool Renderer::LoadAsset(AssetType type, const std::string& name)
+{
+	switch (type)
+	{
+	case AssetType::Mesh:
+		return GetMesh(name) != nullptr;
+	case AssetType::Material:
+		return GetMaterial(name) != nullptr;
+	case AssetType::AnimationClip:
+		return GetAnimationClip(name) != nullptr;
+	case AssetType::UITexture:
+		return GetUITexture(name) != nullptr;
+	case AssetType::ParticleTexture:
+		return GetParticleTexture(name) != nullptr;
+	}
+
+	return false;
+}
@@ -7,6 +7,7 @@
 #include <map>
 #include <tuple>
 #include "ShaderResource.h"
+#include "AssetHandle.h"
 
 #include <directxtk/SimpleMath.h>
 
@@ -140,6 +141,22 @@ enum class TextBoxAlign
 	CenterCenter,
 };
 
+// ؽó Ʈ  ( Ʃ׿, Ʈ   0)
+struct TextureStreamingStats
+{
+	uint64_t budgetBytes = 0;
+	uint64_t residentBytes = 0;			// Ʈ ؽó  GPU  ø ũ
+	uint64_t pendingBytes = 0;			// д   ũ (꿡 ̸ )
+	uint64_t wantedBytes = 0;			// û   ÷  ũ
+	uint32_t textures = 0;
+	uint32_t pendingLoads = 0;
+	uint32_t starvedTextures = 0;		//  ڶ ϴ Ӻ ĥ  ؽó
+	uint32_t loads = 0;					// ̹  ø ؽó
+	uint32_t evictions = 0;				// ̹   ؽó
+	uint64_t totalLoadedBytes = 0;
+	uint64_t totalEvictedBytes = 0;
+};
+
 class ANIMAVISION_DLL Renderer
 {
 public:
@@ -164,7 +181,7 @@ public:
 	virtual void ApplyRenderState(BlendState blendstate, RasterizerState rasterizerstate, DepthStencilState depthstencilstate) = 0;
 
 	virtual void Submit(Mesh& mesh, Material& material, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) = 0;
-	virtual void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1) = 0;
+	virtual void Submit(Mesh& mesh, Material& material, uint32_t subMeshIndex, PrimitiveTopology primitiveMode = PrimitiveTopology::TRIANGLELIST, uint32_t instances = 1, uint32_t lod = 0) = 0;
 	virtual void DispatchCompute(Material& material, uint32_t threadGroupCountX, uint32_t threadGroupCountY, uint32_t threadGroupCountZ) {}
 	virtual void DispatchRays(Material& material, uint32_t width, uint32_t height, uint32_t depth) {}
 	virtual void CopyStructureCount(Buffer* dest, uint32_t distAlignedByteOffset, Texture* src) {}
@@ -203,12 +220,15 @@ public:
 	virtual void LoadMeshesFromDrive(const std::string& path) = 0;
 	virtual std::shared_ptr<Mesh> GetMesh(const std::string& name) = 0;
 	virtual std::map<std::string, std::shared_ptr<Mesh>>* GetMeshes() = 0;
+	// ̸  Get*  /ȭ,    ڵ Ʈ ڵ ȸ
+	virtual AssetRegistry<Mesh>* GetMeshRegistry() { return nullptr; }
 
 	virtual void AddMaterial(const std::shared_ptr<Material>& material) = 0;
 	virtual void LoadMaterialsFromDrive(const std::string& path) = 0;
 	virtual std::shared_ptr<Material> GetMaterial(const std::string& name) = 0;
 	virtual void SaveMaterial(const std::string& name) = 0;
 	virtual std::map<std::string, std::shared_ptr<Material>>* GetMaterials() = 0;
+	virtual AssetRegistry<Material>* GetMaterialRegistry() { return nullptr; }
 
 	virtual void LoadAnimationClipsFromDrive(const std::string& path) = 0;
 	virtual std::shared_ptr<AnimationClip> GetAnimationClip(const std::string& name) = 0;
@@ -268,11 +288,17 @@ public:
 	virtual void FlushRaytracingData() {}
 	virtual void ResetAS() {}
 
+	// ؽó Ʈ : screenPixels  Ƽ  ü ȭ鿡 ϴ  (ȼ)
+	virtual void RequestTextureResidency(Material& material, float screenPixels) {}
+	virtual void SetTextureStreamingBudget(uint64_t bytes) {}
+	virtual TextureStreamingStats GetTextureStreamingStats() const { return {}; }
+
 	// ui
 	virtual void LoadUITexturesFromDrive(const std::string& path) {}
 	virtual std::shared_ptr<Texture> GetUITexture(const std::string& name) { return nullptr; }
 	virtual std::shared_ptr<Texture> CreateTexture(const char* path, bool isUI) { return nullptr; }
 	virtual robin_hood::unordered_map<std::string, std::shared_ptr<Texture>>* GetUITextures() { return nullptr; }
+	virtual AssetRegistry<Texture>* GetUITextureRegistry() { return nullptr; }
 
 	// DWrite
 	virtual void SubmitText(Texture* rt, Font* font, const std::string& text, Vector2 posH, Vector2 size, Vector2 scale, DirectX::SimpleMath::Color color, float fontSize, TextAlign textAlign = TextAlign::LeftTop, TextBoxAlign boxAlign = TextBoxAlign::CenterCenter, bool useUnderline = false, bool useStrikeThrough = false) {}
@@ -281,6 +307,13 @@ public:
 	virtual std::shared_ptr<Font> GetFont(const std::string& name) { return nullptr; }
 	virtual robin_hood::unordered_map<std::string, std::shared_ptr<Font>>* GetFonts() { return nullptr; }
 
+	//  ε : path Ʒ  ̸ -> Ϸ θ ϰ, LoadAsset  ʿ ͸ 
+	//  ʴ  Load*FromDrive   
+	virtual void IndexAssetsFromDrive(AssetType type, const std::string& path);
+	// ̹ ְų о true (̺귯 Ƿ  忡,  尡  ȸ)
+	virtual bool LoadAsset(AssetType type, const std::string& name);
+
+	// API::NONE  â GPU  ϴ NullRenderer (hwnd )
 	static std::unique_ptr<Renderer> Create(HWND hwnd, uint32_t width, uint32_t height, API api, bool isRaytracing = false);
 
 	inline static API s_Api = API::NONE;
@@ -3,6 +3,7 @@
 #include "Renderer.h"
 #include "DX11Shader.h"
 #include "DX12Shader.h"
+#include "NullRenderer.h"
 
 std::shared_ptr<Shader> Shader::Create(Renderer* renderer, const std::string& srcPath)
 {
@@ -14,6 +15,8 @@ std::shared_ptr<Shader> Shader::Create(Renderer* renderer, const std::string& sr
 	case Renderer::API::DirectX12:
 		return std::make_shared<DX12Shader>(renderer, srcPath.data());
 		break;
+	case Renderer::API::NONE:
+		return std::make_shared<NullShader>(static_cast<NullRenderer*>(renderer), srcPath);
 	}
 
 	assert(false && "Invalid API");
@@ -0,0 +1,372 @@
+#include "pch.h"
+#include "ShaderCache.h"
+
+#include "DX11Shader.h"
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <unordered_set>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	float elapsedMilliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	bool readFile(const std::filesystem::path& path, std::string& text)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		std::stringstream stream;
+		stream << file.rdbuf();
+		text = stream.str();
+
+		return true;
+	}
+}
+
+bool D3DShaderCompiler::ReadSource(const std::string& path, std::string& text)
+{
+	return readFile(path, text);
+}
+
+bool D3DShaderCompiler::ReadInclude(const std::string& name, std::string& text)
+{
+	// ShaderIncludeHandler   ġ
+	return readFile(std::filesystem::current_path() / "Shaders" / name, text);
+}
+
+bool D3DShaderCompiler::Compile(const ShaderCompileRequest& request, const std::string& source, ShaderCompileOutput& output)
+{
+	std::vector<D3D_SHADER_MACRO> macros;
+	macros.reserve(request.defines.size() + 1);
+	for (const auto& [name, definition] : request.defines)
+		macros.push_back({ name.c_str(), definition.c_str() });
+	macros.push_back({ nullptr, nullptr });
+
+	ShaderIncludeHandler includeHandler;
+
+	Microsoft::WRL::ComPtr<ID3DBlob> blob;
+	Microsoft::WRL::ComPtr<ID3DBlob> errorBlob;
+
+	const HRESULT hr = D3DCompile(source.c_str(), source.size(), request.path.c_str(), macros.data(), &includeHandler,
+		request.entryPoint.c_str(), request.profile.c_str(), request.flags, 0, blob.GetAddressOf(), errorBlob.GetAddressOf());
+
+	output.includes = std::move(includeHandler.Includes);
+
+	if (errorBlob)
+		output.error.assign(static_cast<const char*>(errorBlob->GetBufferPointer()), errorBlob->GetBufferSize());
+
+	if (FAILED(hr) || !blob)
+		return false;
+
+	const char* data = static_cast<const char*>(blob->GetBufferPointer());
+	output.blob.assign(data, data + blob->GetBufferSize());
+
+	return true;
+}
+
+ShaderCache::ShaderCache(std::unique_ptr<IShaderCompiler> compiler)
+	: _compiler(std::move(compiler))
+{
+}
+
+bool ShaderCache::Load(const std::filesystem::path& path)
+{
+	const auto start = Clock::now();
+
+	std::lock_guard lock(_mutex);
+
+	_entries.clear();
+
+	//  blob    
+	std::string data;
+	if (!readFile(path, data))
+		return false;
+
+	std::istringstream is(std::move(data));
+
+	try
+	{
+		cereal::BinaryInputArchive archive(is);
+
+		uint32_t magic = 0;
+		uint32_t version = 0;
+		archive(magic, version);
+
+		if (magic != MAGIC || version != VERSION)
+			return false;
+
+		std::vector<ShaderCacheEntry> entries;
+		archive(entries);
+
+		for (auto& entry : entries)
+		{
+			std::string key = makeKey(entry.request);
+			_entries.emplace(std::move(key), std::make_shared<const ShaderCacheEntry>(std::move(entry)));
+		}
+	}
+	catch (const std::exception&)
+	{
+		_entries.clear();
+		return false;
+	}
+
+	_stats.loadMilliseconds = elapsedMilliseconds(start);
+
+	return true;
+}
+
+bool ShaderCache::Save(const std::filesystem::path& path)
+{
+	if (!_isDirty)
+		return true;
+
+	const auto start = Clock::now();
+
+	std::vector<std::pair<std::string, std::shared_ptr<const ShaderCacheEntry>>> entries;
+	{
+		std::lock_guard lock(_mutex);
+
+		entries.assign(_entries.begin(), _entries.end());
+	}
+
+	//   Ź  
+	std::ranges::sort(entries, {}, &std::pair<std::string, std::shared_ptr<const ShaderCacheEntry>>::first);
+
+	std::filesystem::create_directories(path.parent_path());
+
+	std::ofstream os(path, std::ios::binary);
+	if (!os.is_open())
+		return false;
+
+	{
+		cereal::BinaryOutputArchive archive(os);
+		archive(MAGIC, VERSION, cereal::make_size_tag(static_cast<cereal::size_type>(entries.size())));
+		for (const auto& [key, entry] : entries)
+			archive(*entry);
+	}
+
+	if (!os.good())
+		return false;
+
+	_isDirty = false;
+	_stats.saveMilliseconds += elapsedMilliseconds(start);
+
+	return true;
+}
+
+std::shared_ptr<const ShaderCacheEntry> ShaderCache::Compile(const ShaderCompileRequest& request)
+{
+	const std::string key = makeKey(request);
+
+	const FileState source = readSource(request.path);
+	if (!source.isFound)
+		return nullptr;
+
+	std::shared_ptr<const ShaderCacheEntry> cached;
+	{
+		std::lock_guard lock(_mutex);
+
+		if (auto it = _entries.find(key); it != _entries.end())
+			cached = it->second;
+	}
+
+	// ҽ include   Ȯ (include   include  ߰ص  include  ؽð ٲǷ ٽ )
+	if (cached && cached->sourceHash == source.hash
+		&& std::ranges::all_of(cached->includes, [this](const auto& include) { return readInclude(include.first).hash == include.second; }))
+	{
+		++_stats.hits;
+		return cached;
+	}
+
+	const auto start = Clock::now();
+
+	ShaderCompileOutput output;
+	const bool isCompiled = _compiler->Compile(request, *source.text, output);
+
+	_stats.compileMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+	++_stats.misses;
+
+	auto entry = std::make_shared<ShaderCacheEntry>();
+	entry->request = request;
+	entry->sourceHash = source.hash;
+	entry->isCompiled = isCompiled;
+	entry->blob = std::move(output.blob);
+	entry->error = std::move(output.error);
+
+	//       
+	std::ranges::sort(output.includes);
+	const auto [first, last] = std::ranges::unique(output.includes);
+	output.includes.erase(first, last);
+
+	for (auto& include : output.includes)
+	{
+		const uint64_t hash = readInclude(include).hash;
+		entry->includes.emplace_back(std::move(include), hash);
+	}
+
+	if (!isCompiled)
+		++_stats.failures;
+
+	{
+		std::lock_guard lock(_mutex);
+		_entries[key] = entry;
+	}
+
+	_isDirty = true;
+
+	return entry;
+}
+
+void ShaderCache::CompileAll(const std::vector<ShaderCompileRequest>& requests, uint32_t workerCount)
+{
+	if (requests.empty())
+		return;
+
+	const auto start = Clock::now();
+
+	//  û     尡  ̽ ÿ ϹǷ  
+	std::vector<const ShaderCompileRequest*> uniqueRequests;
+	uniqueRequests.reserve(requests.size());
+	{
+		std::unordered_set<std::string> keys;
+		for (const auto& request : requests)
+		{
+			if (keys.insert(makeKey(request)).second)
+				uniqueRequests.push_back(&request);
+		}
+	}
+
+	if (workerCount == 0)
+		workerCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+	workerCount = static_cast<uint32_t>((std::min)(static_cast<size_t>(workerCount), uniqueRequests.size()));
+
+	std::atomic<size_t> next = 0;
+	auto work = [&]()
+		{
+			for (size_t i = next++; i < uniqueRequests.size(); i = next++)
+				Compile(*uniqueRequests[i]);
+		};
+
+	// ȣ 嵵 Բ ó
+	std::vector<std::future<void>> workers;
+	for (uint32_t i = 1; i < workerCount; ++i)
+		workers.push_back(std::async(std::launch::async, work));
+
+	work();
+
+	for (auto& worker : workers)
+		worker.get();
+
+	_stats.workers = workerCount;
+	_stats.compileAllMilliseconds += elapsedMilliseconds(start);
+}
+
+void ShaderCache::Invalidate()
+{
+	std::lock_guard lock(_mutex);
+
+	_sources.clear();
+	_includes.clear();
+}
+
+std::string ShaderCache::GetSummary() const
+{
+	return std::format("ShaderCache : hits {}, misses {} (failed {}), compile {:.1f} ms on {} workers, compile all {:.1f} ms, load {:.1f} ms, save {:.1f} ms\n",
+		_stats.hits.load(), _stats.misses.load(), _stats.failures.load(), _stats.compileMicroseconds.load() / 1000.0, _stats.workers.load(),
+		_stats.compileAllMilliseconds, _stats.loadMilliseconds, _stats.saveMilliseconds);
+}
+
+uint64_t ShaderCache::Hash(const void* data, size_t size, uint64_t seed)
+{
+	// FNV-1a 64
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	uint64_t hash = seed;
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+ShaderCache::FileState ShaderCache::readSource(const std::string& path)
+{
+	{
+		std::lock_guard lock(_mutex);
+
+		if (auto it = _sources.find(path); it != _sources.end())
+			return it->second;
+	}
+
+	// д    (   尡 о  )
+	FileState state;
+	std::string text;
+	state.isFound = _compiler->ReadSource(path, text);
+	state.hash = Hash(text.data(), text.size());
+	state.text = std::make_shared<const std::string>(std::move(text));
+
+	std::lock_guard lock(_mutex);
+
+	return _sources.try_emplace(path, std::move(state)).first->second;
+}
+
+ShaderCache::FileState ShaderCache::readInclude(const std::string& name)
+{
+	{
+		std::lock_guard lock(_mutex);
+
+		if (auto it = _includes.find(name); it != _includes.end())
+			return it->second;
+	}
+
+	// include  ؽø ʿ (  0, ϵ ؽÿ ޶ ٽ )
+	FileState state;
+	std::string text;
+	state.isFound = _compiler->ReadInclude(name, text);
+	state.hash = state.isFound ? Hash(text.data(), text.size()) : 0;
+
+	std::lock_guard lock(_mutex);
+
+	return _includes.try_emplace(name, std::move(state)).first->second;
+}
+
+std::string ShaderCache::makeKey(const ShaderCompileRequest& request)
+{
+	std::filesystem::path path = request.path;
+	if (path.is_absolute())
+		path = path.lexically_proximate(std::filesystem::current_path());
+
+	std::string key = path.lexically_normal().generic_string();
+	std::ranges::transform(key, key.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+	key += '|';
+	key += request.entryPoint;
+	key += '|';
+	key += request.profile;
+	key += '|';
+	key += std::to_string(request.flags);
+
+	for (const auto& [name, definition] : request.defines)
+	{
+		key += '|';
+		key += name;
+		key += '=';
+		key += definition;
+	}
+
+	return key;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
+///    Է (θ  ο ҽ, include  ĳ Ű)
+struct ShaderCompileRequest
+{
+	std::string path;											// hlsl ( ͸ )
+	std::string entryPoint;
+	std::string profile;										// vs_5_0 ...
+	std::vector<std::pair<std::string, std::string>> defines;
+	uint32_t flags = 0;											// D3DCOMPILE_*
+};
+
+struct ShaderCompileOutput
+{
+	std::vector<char> blob;
+	std::vector<std::string> includes;		//  ߿  include (ø )
+	std::string error;
+};
+
+///  Ϸ (׽Ʈ ,  䳻  뿪 ü)
+/// Compile   忡 ÿ ȣ
+class IShaderCompiler
+{
+public:
+	virtual ~IShaderCompiler() = default;
+
+	//  false
+	virtual bool ReadSource(const std::string& path, std::string& text) = 0;
+	virtual bool ReadInclude(const std::string& name, std::string& text) = 0;
+
+	// (   ) false, output.error  ޽
+	virtual bool Compile(const ShaderCompileRequest& request, const std::string& source, ShaderCompileOutput& output) = 0;
+};
+
+/// D3DCompile + ShaderIncludeHandler (Shaders ͸ include  ã)
+class D3DShaderCompiler : public IShaderCompiler
+{
+public:
+	bool ReadSource(const std::string& path, std::string& text) override;
+	bool ReadInclude(const std::string& name, std::string& text) override;
+	bool Compile(const ShaderCompileRequest& request, const std::string& source, ShaderCompileOutput& output) override;
+};
+
+/// ĳ ׸ ϳ ( ϵ ؼ   Ź ٽ  )
+struct ShaderCacheEntry
+{
+	ShaderCompileRequest request;
+	uint64_t sourceHash = 0;
+	std::vector<std::pair<std::string, uint64_t>> includes;		// include ̸,  ؽ
+	bool isCompiled = false;
+	std::vector<char> blob;
+	std::string error;
+
+	template <class Archive>
+	void serialize(Archive& ar)
+	{
+		ar(request.path, request.entryPoint, request.profile, request.defines, request.flags,
+			sourceHash, includes, isCompiled, blob, error);
+	}
+};
+
+struct ShaderCacheStats
+{
+	std::atomic<uint32_t> hits = 0;
+	std::atomic<uint32_t> misses = 0;
+	std::atomic<uint32_t> failures = 0;					// ̽    (  )
+	std::atomic<uint64_t> compileMicroseconds = 0;		// Ϸ ȿ  ð 
+	std::atomic<uint32_t> workers = 0;					//  CompileAll   
+	float loadMilliseconds = 0.f;
+	float compileAllMilliseconds = 0.f;					// CompileAll  ð 
+	float saveMilliseconds = 0.f;
+};
+
+/// ̴   ĳ (DX11)
+/// ҽ, include  󰡸   (ShaderIncludeHandler), , , define, ÷װ   ϹǷ
+///   ġ    ̴ ٽ ϵ
+///    ϳ      а, ̽ CompileAll   忡 
+class ShaderCache
+{
+public:
+	static constexpr uint32_t MAGIC = 0x43534D41;	// "AMSC"
+	static constexpr uint32_t VERSION = 1;
+#ifdef _DEBUG
+	static constexpr const char* DEFAULT_PATH = "./Shaders/Cache/dx11d.shadercache";
+#else
+	static constexpr const char* DEFAULT_PATH = "./Shaders/Cache/dx11.shadercache";
+#endif
+
+	explicit ShaderCache(std::unique_ptr<IShaderCompiler> compiler);
+
+	//  ų  ٸ  false
+	bool Load(const std::filesystem::path& path = DEFAULT_PATH);
+	// ٲ    
+	bool Save(const std::filesystem::path& path = DEFAULT_PATH);
+
+	// ĳð ȿϸ ״, ƴϸ ȣ 忡  (и isCompiled  false)
+	std::shared_ptr<const ShaderCacheEntry> Compile(const ShaderCompileRequest& request);
+
+	// requests  workerCount    Compile (0 ̸ ھ ),  ĳÿ 
+	//  û   ־    (ShaderCacheCheck  Ȯ)
+	void CompileAll(const std::vector<ShaderCompileRequest>& requests, uint32_t workerCount = 0);
+
+	//   ؽø ٽ е (̴  ε )
+	void Invalidate();
+
+	bool IsDirty() const { return _isDirty; }
+	const ShaderCacheStats& GetStats() const { return _stats; }
+	std::string GetSummary() const;
+
+	static uint64_t Hash(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull);
+
+private:
+	struct FileState
+	{
+		bool isFound = false;
+		uint64_t hash = 0;
+		std::shared_ptr<const std::string> text;
+	};
+
+	FileState readSource(const std::string& path);
+	FileState readInclude(const std::string& name);
+
+	static std::string makeKey(const ShaderCompileRequest& request);
+
+	std::unique_ptr<IShaderCompiler> _compiler;
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, std::shared_ptr<const ShaderCacheEntry>> _entries;
+	std::unordered_map<std::string, FileState> _sources;
+	std::unordered_map<std::string, FileState> _includes;
+	std::atomic<bool> _isDirty = false;
+
+	ShaderCacheStats _stats;
+};
@@ -0,0 +1,341 @@
+#include "pch.h"
+#include "ShaderCacheCheck.h"
+
+#include "ShaderCache.h"
+#include "DX11Shader.h"
+
+#include <chrono>
+#include <thread>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+	struct CheckReport
+	{
+		std::string name;
+		bool isPassed = false;
+		std::string detail;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(name), CEREAL_NVP(isPassed), CEREAL_NVP(detail));
+		}
+	};
+
+	/// ޸  + û  Ƚ (ShaderCache   忡 ȣ)
+	class FakeShaderCompiler : public IShaderCompiler
+	{
+	public:
+		void SetFile(const std::string& name, std::string text)
+		{
+			std::lock_guard lock(_mutex);
+			_files[name] = std::move(text);
+		}
+
+		uint32_t GetCompileCount(const ShaderCompileRequest& request) const
+		{
+			std::lock_guard lock(_mutex);
+
+			auto it = _counts.find(makeName(request));
+			return it != _counts.end() ? it->second : 0;
+		}
+
+		uint32_t GetTotalCompileCount() const
+		{
+			std::lock_guard lock(_mutex);
+
+			uint32_t total = 0;
+			for (const auto& [name, count] : _counts)
+				total += count;
+
+			return total;
+		}
+
+		// û ϳ   ϵ Ƚ
+		uint32_t GetMaxCompileCount() const
+		{
+			std::lock_guard lock(_mutex);
+
+			uint32_t max = 0;
+			for (const auto& [name, count] : _counts)
+				max = (std::max)(max, count);
+
+			return max;
+		}
+
+		bool ReadSource(const std::string& path, std::string& text) override
+		{
+			return read(path, text);
+		}
+
+		bool ReadInclude(const std::string& name, std::string& text) override
+		{
+			return read(name, text);
+		}
+
+		bool Compile(const ShaderCompileRequest& request, const std::string& source, ShaderCompileOutput& output) override
+		{
+			{
+				std::lock_guard lock(_mutex);
+				++_counts[makeName(request)];
+			}
+
+			//  ̽  尡 ÿ ϸ 巯  ó  ɸ
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+			collectIncludes(source, output.includes);
+
+			// D3DCompile ó   
+			if (source.find(request.entryPoint) == std::string::npos)
+			{
+				output.error = request.path + " : entrypoint not found : " + request.entryPoint;
+				return false;
+			}
+
+			const std::string blob = std::format("{}|{}|{}", request.path, request.entryPoint, ShaderCache::Hash(source.data(), source.size()));
+			output.blob.assign(blob.begin(), blob.end());
+
+			return true;
+		}
+
+	private:
+		static std::string makeName(const ShaderCompileRequest& request)
+		{
+			return request.path + '|' + request.entryPoint + '|' + request.profile;
+		}
+
+		bool read(const std::string& name, std::string& text) const
+		{
+			std::lock_guard lock(_mutex);
+
+			auto it = _files.find(name);
+			if (it == _files.end())
+				return false;
+
+			text = it->second;
+
+			return true;
+		}
+
+		// ShaderIncludeHandler ó include  include   
+		void collectIncludes(const std::string& text, std::vector<std::string>& includes) const
+		{
+			constexpr std::string_view DIRECTIVE = "#include \"";
+
+			std::istringstream stream(text);
+			std::string line;
+			while (std::getline(stream, line))
+			{
+				if (!line.starts_with(DIRECTIVE))
+					continue;
+
+				const size_t end = line.find('"', DIRECTIVE.size());
+				if (end == std::string::npos)
+					continue;
+
+				std::string name = line.substr(DIRECTIVE.size(), end - DIRECTIVE.size());
+				if (std::ranges::find(includes, name) != includes.end())
+					continue;
+
+				includes.push_back(name);
+
+				std::string included;
+				if (read(name, included))
+					collectIncludes(included, includes);
+			}
+		}
+
+		mutable std::mutex _mutex;
+		std::unordered_map<std::string, std::string> _files;
+		std::unordered_map<std::string, uint32_t> _counts;
+	};
+
+	//     ġ    ׸ ٽ 
+	CheckReport checkTransitiveInclude()
+	{
+		CheckReport report;
+		report.name = "transitive include invalidates entry";
+
+		auto fakeCompiler = std::make_unique<FakeShaderCompiler>();
+		FakeShaderCompiler& compiler = *fakeCompiler;
+		ShaderCache cache(std::move(fakeCompiler));
+
+		compiler.SetFile("Lighting.hlsli", "float3 Light() { return 1; }\n");
+		compiler.SetFile("Common.hlsli", "#include \"Lighting.hlsli\"\n");
+		compiler.SetFile("Unlit.hlsli", "float4 Color() { return 1; }\n");
+		compiler.SetFile("./Shaders/Lit.hlsl", "#include \"Common.hlsli\"\nfloat4 PSMain() : SV_Target { return Light().xyzz; }\n");
+		compiler.SetFile("./Shaders/Unlit.hlsl", "#include \"Unlit.hlsli\"\nfloat4 PSMain() : SV_Target { return Color(); }\n");
+
+		const ShaderCompileRequest lit = { "./Shaders/Lit.hlsl", "PSMain", "ps_5_0", {}, 0 };
+		const ShaderCompileRequest unlit = { "./Shaders/Unlit.hlsl", "PSMain", "ps_5_0", {}, 0 };
+
+		cache.Compile(lit);
+		cache.Compile(unlit);
+		auto entry = cache.Compile(lit);
+		cache.Compile(unlit);
+
+		const bool isCachedBefore = compiler.GetCompileCount(lit) == 1 && compiler.GetCompileCount(unlit) == 1;
+		const bool hasNestedInclude = entry != nullptr
+			&& std::ranges::any_of(entry->includes, [](const auto& include) { return include.first == "Lighting.hlsli"; });
+
+		//  εó ģ   ؽø ٽ а 
+		compiler.SetFile("Lighting.hlsli", "float3 Light() { return 0.5; }\n");
+		cache.Invalidate();
+
+		cache.Compile(lit);
+		cache.Compile(unlit);
+
+		report.isPassed = isCachedBefore && hasNestedInclude && compiler.GetCompileCount(lit) == 2 && compiler.GetCompileCount(unlit) == 1;
+		report.detail = std::format("lit compiled {} (expected 2), unlit compiled {} (expected 1), nested include recorded {}",
+			compiler.GetCompileCount(lit), compiler.GetCompileCount(unlit), hasNestedInclude);
+
+		return report;
+	}
+
+	//   з ϵǾ ٽ   (  ٽ о)
+	CheckReport checkCachedFailure(const std::filesystem::path& cachePath)
+	{
+		CheckReport report;
+		report.name = "cached failure is reused";
+
+		const std::string source = "float4 PSMain() : SV_Target { return 1; }\n";
+		const ShaderCompileRequest hull = { "./Shaders/PixelOnly.hlsl", "HSMain", "hs_5_0", {}, 0 };
+
+		bool isReused = false;
+		{
+			auto fakeCompiler = std::make_unique<FakeShaderCompiler>();
+			FakeShaderCompiler& compiler = *fakeCompiler;
+			ShaderCache cache(std::move(fakeCompiler));
+
+			compiler.SetFile(hull.path, source);
+
+			auto first = cache.Compile(hull);
+			auto second = cache.Compile(hull);
+
+			isReused = first != nullptr && !first->isCompiled && !first->error.empty() && second == first
+				&& compiler.GetCompileCount(hull) == 1 && cache.GetStats().failures == 1;
+
+			isReused = cache.Save(cachePath) && isReused;
+		}
+
+		auto fakeCompiler = std::make_unique<FakeShaderCompiler>();
+		FakeShaderCompiler& compiler = *fakeCompiler;
+		ShaderCache reloaded(std::move(fakeCompiler));
+
+		compiler.SetFile(hull.path, source);
+
+		const bool isLoaded = reloaded.Load(cachePath);
+		auto third = reloaded.Compile(hull);
+
+		const bool isReusedAfterLoad = isLoaded && third != nullptr && !third->isCompiled && compiler.GetCompileCount(hull) == 0;
+
+		std::error_code ec;
+		std::filesystem::remove(cachePath, ec);
+
+		report.isPassed = isReused && isReusedAfterLoad;
+		report.detail = std::format("reused in memory {}, reused after save and load {}", isReused, isReusedAfterLoad);
+
+		return report;
+	}
+
+	//  û     ص ̽  ,  ° CompileAll   
+	CheckReport checkCompileAll(uint32_t workerCount)
+	{
+		CheckReport report;
+		report.name = "CompileAll compiles each miss once";
+
+		auto fakeCompiler = std::make_unique<FakeShaderCompiler>();
+		FakeShaderCompiler& compiler = *fakeCompiler;
+		ShaderCache cache(std::move(fakeCompiler));
+
+		// VS, PS  ִ ̴ (  з ĳ)
+		constexpr uint32_t SHADER_COUNT = 6;
+
+		std::vector<ShaderCompileRequest> requests;
+		for (uint32_t i = 0; i < SHADER_COUNT; ++i)
+		{
+			const std::string path = std::format("./Shaders/Check{}.hlsl", i);
+			compiler.SetFile(path, std::format("float4 VSMain() : SV_Position {{ return {}; }}\nfloat4 PSMain() : SV_Target {{ return 1; }}\n", i));
+
+			std::ranges::move(DX11Shader::GetCompileRequests(path), std::back_inserter(requests));
+		}
+
+		const uint32_t uniqueCount = static_cast<uint32_t>(requests.size());
+
+		//    ó  û   
+		const std::vector<ShaderCompileRequest> duplicated = requests;
+		requests.insert(requests.end(), duplicated.begin(), duplicated.end());
+
+		cache.CompileAll(requests, workerCount);
+
+		const uint32_t firstCompiles = compiler.GetTotalCompileCount();
+		const uint32_t maxCompiles = compiler.GetMaxCompileCount();
+
+		cache.CompileAll(requests, workerCount);
+
+		const uint32_t secondCompiles = compiler.GetTotalCompileCount() - firstCompiles;
+
+		report.isPassed = firstCompiles == uniqueCount && maxCompiles == 1 && secondCompiles == 0;
+		report.detail = std::format("{} requests ({} unique) on {} workers : compiled {}, max per request {}, second pass compiled {}",
+			requests.size(), uniqueCount, workerCount, firstCompiles, maxCompiles, secondCompiles);
+
+		return report;
+	}
+}
+
+ShaderCacheCheck::ShaderCacheCheck(ShaderCacheCheckSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+bool ShaderCacheCheck::Run()
+{
+	std::vector<CheckReport> reports;
+	reports.push_back(checkTransitiveInclude());
+	reports.push_back(checkCachedFailure(_settings.cachePath));
+	reports.push_back(checkCompileAll(_settings.workerCount));
+
+	bool isPassed = true;
+	for (const auto& report : reports)
+	{
+		OutputDebugStringA(std::format("ShaderCacheCheck : {} - {} ({})\n", report.name, report.isPassed ? "passed" : "FAILED", report.detail).c_str());
+		isPassed = isPassed && report.isPassed;
+	}
+
+	std::ofstream file(_settings.reportPath);
+	if (file.is_open())
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(
+			cereal::make_nvp("passed", isPassed),
+			cereal::make_nvp("checks", reports)
+		);
+	}
+
+	return isPassed && file.good();
+}
+
+bool ShaderCacheCheck::ParseArguments(const std::vector<std::string>& args, ShaderCacheCheckSettings& settings)
+{
+	bool isCheck = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size() && !args[i + 1].starts_with("--");
+
+		if (arg == "--check-shader-cache")
+			isCheck = true;
+		else if (arg == "--report" && hasValue)
+			settings.reportPath = args[++i];
+		else if (arg == "--workers" && hasValue)
+			settings.workerCount = static_cast<uint32_t>(std::stoul(args[++i]));
+	}
+
+	return isCheck;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+struct ShaderCacheCheckSettings
+{
+	std::filesystem::path cachePath = "./Shaders/Cache/check.shadercache";		// , ٽ б Ȯο ( )
+	std::filesystem::path reportPath = "./shader_cache_check.json";
+	uint32_t workerCount = 8;
+};
+
+/// ShaderCache  ޸ ϰ  Ƚ  ¥ IShaderCompiler  Ȯϴ 帮  (D3DCompile, GPU )
+/// - ø include  ġ  include   ׸ ٽ 
+/// -  ( ) , ٽ  ڿ 
+/// - CompileAll   û  ־ ̽ Ȯ   
+/// ׸  JSON  
+class ANIMAVISION_DLL ShaderCacheCheck
+{
+public:
+	explicit ShaderCacheCheck(ShaderCacheCheckSettings settings);
+
+	// ϳ ϸ false
+	bool Run();
+
+	// "--check-shader-cache [--report path] [--workers N]"
+	// --check-shader-cache   false
+	static bool ParseArguments(const std::vector<std::string>& args, ShaderCacheCheckSettings& settings);
+
+private:
+	ShaderCacheCheckSettings _settings;
+};
@@ -5,6 +5,7 @@
 #include "DX11Buffer.h"
 #include "DX12Buffer.h"
 #include "DX12Texture.h"
+#include "NullRenderer.h"
 
 std::shared_ptr<Texture> Texture::Create(Renderer* renderer, const std::string& path, const Type& type/* = Type::Texture2D*/)
 {
@@ -33,6 +34,8 @@ std::shared_ptr<Texture> Texture::Create(Renderer* renderer, const std::string&
 	}
 		return DX12Texture::Create(renderer, path);
 		break;
+	case Renderer::API::NONE:
+		return std::make_shared<NullTexture>(path, type);
 	}
 
 	assert(false && "Invalid API");
@@ -50,6 +53,8 @@ std::shared_ptr<Texture> Texture::Create(RendererContext* context, const std::st
 		OutputDebugStringA("DX12Texture::Create(RendererContext*, const std::string&, const Type&) not implemented\n");
 		return nullptr;
 		break;
+	case Renderer::API::NONE:
+		return std::make_shared<NullTexture>(path, type);
 	}
 
 	assert(false && "Invalid API");
@@ -66,6 +71,8 @@ std::shared_ptr<Buffer> Buffer::Create(Renderer* renderer, Mesh* mesh, Usage usa
 	case Renderer::API::DirectX12:
 		return DX12Buffer::Create(renderer, mesh, usage);
 		break;
+	case Renderer::API::NONE:
+		return nullptr;
 	}
 
 	assert(false && "Invalid API");
@@ -0,0 +1,409 @@
+#include "pch.h"
+#include "TextureBaker.h"
+
+#include "TextureManifest.h"
+
+#include <DirectXTex.h>
+#include <DirectXTexEXR.h>
+
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+	struct TextureReport
+	{
+		std::string source;
+		std::string baked;
+		uint32_t sourceFormat = 0;		// DXGI_FORMAT
+		uint32_t bakedFormat = 0;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t mipLevels = 0;
+		bool compressed = false;		//     Ӹʸ    
+		bool upToDate = false;			//  ٲ ʾ ̹ ȯ 
+		uint64_t sourceFileBytes = 0;
+		uint64_t bakedFileBytes = 0;
+		uint64_t runtimeVramBytes = 0;	// Ÿ ΰ ø ũ (  +  Ӹ)
+		uint64_t bakedVramBytes = 0;
+		float runtimeLoadMilliseconds = 0.f;	//  ε + Ӹ 
+		float bakedLoadMilliseconds = 0.f;		// ũ dds ε
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(source), CEREAL_NVP(baked), CEREAL_NVP(sourceFormat), CEREAL_NVP(bakedFormat),
+				CEREAL_NVP(width), CEREAL_NVP(height), CEREAL_NVP(mipLevels), CEREAL_NVP(compressed), CEREAL_NVP(upToDate),
+				CEREAL_NVP(sourceFileBytes), CEREAL_NVP(bakedFileBytes), CEREAL_NVP(runtimeVramBytes), CEREAL_NVP(bakedVramBytes),
+				CEREAL_NVP(runtimeLoadMilliseconds), CEREAL_NVP(bakedLoadMilliseconds));
+		}
+	};
+
+	struct TotalReport
+	{
+		uint32_t textures = 0;
+		uint32_t baked = 0;
+		uint32_t upToDate = 0;
+		uint32_t failed = 0;
+		uint64_t sourceFileBytes = 0;
+		uint64_t bakedFileBytes = 0;
+		uint64_t runtimeVramBytes = 0;
+		uint64_t bakedVramBytes = 0;
+		float runtimeLoadMilliseconds = 0.f;
+		float bakedLoadMilliseconds = 0.f;
+
+		template <class Archive>
+		void serialize(Archive& archive)
+		{
+			archive(CEREAL_NVP(textures), CEREAL_NVP(baked), CEREAL_NVP(upToDate), CEREAL_NVP(failed),
+				CEREAL_NVP(sourceFileBytes), CEREAL_NVP(bakedFileBytes), CEREAL_NVP(runtimeVramBytes), CEREAL_NVP(bakedVramBytes),
+				CEREAL_NVP(runtimeLoadMilliseconds), CEREAL_NVP(bakedLoadMilliseconds));
+		}
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	float elapsedMilliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	std::wstring lowerExtension(const std::filesystem::path& path)
+	{
+		std::wstring extension = path.extension().wstring();
+		std::ranges::transform(extension, extension.begin(), ::towlower);
+
+		return extension;
+	}
+
+	bool isTextureFile(const std::filesystem::path& path)
+	{
+		const std::wstring extension = lowerExtension(path);
+
+		return extension == L".png" || extension == L".jpg" || extension == L".jpeg" || extension == L".tiff" || extension == L".tif"
+			|| extension == L".bmp" || extension == L".dds" || extension == L".tga" || extension == L".hdr" || extension == L".exr";
+	}
+
+	// DX11Texture   δ 
+	HRESULT loadSource(const std::filesystem::path& path, DirectX::ScratchImage& image)
+	{
+		const std::wstring extension = lowerExtension(path);
+
+		if (extension == L".dds")
+			return DirectX::LoadFromDDSFile(path.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, image);
+		if (extension == L".tga")
+			return DirectX::LoadFromTGAFile(path.c_str(), nullptr, image);
+		if (extension == L".hdr")
+			return DirectX::LoadFromHDRFile(path.c_str(), nullptr, image);
+		if (extension == L".exr")
+			return DirectX::LoadFromEXRFile(path.c_str(), nullptr, image);
+
+		return DirectX::LoadFromWICFile(path.c_str(), DirectX::WIC_FLAGS_NONE, nullptr, image);
+	}
+
+	// ø (ä ,  , )    BC 
+	DXGI_FORMAT selectFormat(DXGI_FORMAT format)
+	{
+		if (DirectX::FormatDataType(format) == DirectX::FORMAT_TYPE_FLOAT)
+			return DXGI_FORMAT_BC6H_UF16;
+
+		switch (format)
+		{
+			case DXGI_FORMAT_R8_UNORM:
+			case DXGI_FORMAT_R16_UNORM:
+				return DXGI_FORMAT_BC4_UNORM;
+			case DXGI_FORMAT_R8G8_UNORM:
+			case DXGI_FORMAT_R16G16_UNORM:
+				return DXGI_FORMAT_BC5_UNORM;
+			// ĸ ִ  BC4  ٲٸ r äη ŰǷ 
+			case DXGI_FORMAT_A8_UNORM:
+				return DXGI_FORMAT_UNKNOWN;
+			default:
+				break;
+		}
+
+		return DirectX::IsSRGB(format) ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+	}
+
+	uint32_t fullMipCount(size_t width, size_t height)
+	{
+		uint32_t count = 1;
+		while (width > 1 || height > 1)
+		{
+			width = (std::max)(width / 2, size_t{ 1 });
+			height = (std::max)(height / 2, size_t{ 1 });
+			++count;
+		}
+
+		return count;
+	}
+
+	int64_t lastWriteTime(const std::filesystem::path& path)
+	{
+		return static_cast<int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+	}
+}
+
+TextureBaker::TextureBaker(TextureBakeSettings settings)
+	: _settings(std::move(settings))
+{
+}
+
+bool TextureBaker::Run()
+{
+	// WIC δ
+	const HRESULT comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	TextureManifest::Load(_settings.manifestPath);
+
+	std::vector<std::filesystem::path> sources;
+	if (std::filesystem::exists(_settings.sourcePath))
+	{
+		const std::filesystem::path outputPath = std::filesystem::weakly_canonical(_settings.outputPath);
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(_settings.sourcePath))
+		{
+			if (!entry.is_regular_file() || !isTextureFile(entry.path()))
+				continue;
+
+			//  ũ 
+			const std::filesystem::path relative = std::filesystem::weakly_canonical(entry.path()).lexically_relative(outputPath);
+			if (!relative.empty() && *relative.begin() != "..")
+				continue;
+
+			// Ÿ ȯ   ̸ dds    Ǵ 
+			if (lowerExtension(entry.path()) != L".dds")
+			{
+				std::filesystem::path dds = entry.path();
+				if (std::filesystem::exists(dds.replace_extension(".dds")))
+					continue;
+			}
+
+			sources.push_back(entry.path());
+		}
+	}
+
+	std::ranges::sort(sources);
+
+	std::vector<TextureReport> textures;
+	std::vector<std::string> errors;
+	TotalReport total;
+
+	for (const auto& source : sources)
+	{
+		const std::string sourceString = source.generic_string();
+
+		std::filesystem::path baked = _settings.outputPath / source.lexically_relative(_settings.sourcePath);
+		baked.replace_extension(".dds");
+
+		TextureReport report;
+		report.source = TextureManifest::MakeKey(source);
+		report.baked = TextureManifest::MakeKey(baked);
+		report.sourceFileBytes = std::filesystem::file_size(source);
+
+		// Ÿ  (DX11Texture :  ε, Ӹ  )
+		const auto runtimeStart = Clock::now();
+
+		DirectX::ScratchImage image;
+		if (FAILED(loadSource(source, image)))
+		{
+			errors.push_back("load failed : " + sourceString);
+			++total.failed;
+			continue;
+		}
+
+		DirectX::TexMetadata metadata = image.GetMetadata();
+		if (metadata.mipLevels == 1 && !DirectX::IsCompressed(metadata.format))
+		{
+			DirectX::ScratchImage mipChain;
+			if (SUCCEEDED(DirectX::GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata, DirectX::TEX_FILTER_DEFAULT, 0, mipChain)))
+			{
+				image = std::move(mipChain);
+				metadata = image.GetMetadata();
+			}
+		}
+
+		report.runtimeLoadMilliseconds = elapsedMilliseconds(runtimeStart);
+		report.runtimeVramBytes = image.GetPixelsSize();
+		report.sourceFormat = static_cast<uint32_t>(metadata.format);
+		report.width = static_cast<uint32_t>(metadata.width);
+		report.height = static_cast<uint32_t>(metadata.height);
+
+		if (metadata.dimension != DirectX::TEX_DIMENSION_TEXTURE2D)
+		{
+			//  ؽó Ÿ δ ״ 
+			errors.push_back("skipped, not a 2D texture : " + sourceString);
+			continue;
+		}
+
+		const std::optional<TextureManifestEntry> previous = TextureManifest::Find(sourceString);
+		report.upToDate = !_settings.force
+			&& previous.has_value()
+			&& previous->sourceSize == report.sourceFileBytes
+			&& previous->sourceTime == lastWriteTime(source)
+			&& std::filesystem::exists(baked);
+
+		if (!report.upToDate)
+		{
+			// ̹   Ǯ Ӹ ä  ٽ 
+			if (DirectX::IsCompressed(metadata.format) && metadata.mipLevels != fullMipCount(metadata.width, metadata.height))
+			{
+				DirectX::ScratchImage decompressed;
+				DirectX::ScratchImage mipChain;
+				if (FAILED(DirectX::Decompress(image.GetImages(), image.GetImageCount(), metadata, DXGI_FORMAT_UNKNOWN, decompressed))
+					|| FAILED(DirectX::GenerateMipMaps(decompressed.GetImages(), decompressed.GetImageCount(), decompressed.GetMetadata(), DirectX::TEX_FILTER_DEFAULT, 0, mipChain)))
+				{
+					errors.push_back("mip generation failed : " + sourceString);
+					++total.failed;
+					continue;
+				}
+
+				image = std::move(mipChain);
+				metadata = image.GetMetadata();
+			}
+			// Ӹ Ϻθ  ֻ ٽ 
+			else if (!DirectX::IsCompressed(metadata.format) && metadata.mipLevels != fullMipCount(metadata.width, metadata.height))
+			{
+				DirectX::ScratchImage mipChain;
+				if (FAILED(DirectX::GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata, DirectX::TEX_FILTER_DEFAULT, 0, mipChain)))
+				{
+					errors.push_back("mip generation failed : " + sourceString);
+					++total.failed;
+					continue;
+				}
+
+				image = std::move(mipChain);
+				metadata = image.GetMetadata();
+			}
+
+			// D3D11  BC ؽó ֻ ũⰡ 4   
+			const DXGI_FORMAT target = DirectX::IsCompressed(metadata.format) ? DXGI_FORMAT_UNKNOWN : selectFormat(metadata.format);
+			const bool isBlockAligned = metadata.width % 4 == 0 && metadata.height % 4 == 0;
+
+			if (target != DXGI_FORMAT_UNKNOWN && isBlockAligned)
+			{
+				DirectX::ScratchImage compressed;
+				if (FAILED(DirectX::Compress(image.GetImages(), image.GetImageCount(), metadata, target, DirectX::TEX_COMPRESS_PARALLEL, DirectX::TEX_THRESHOLD_DEFAULT, compressed)))
+				{
+					errors.push_back("compression failed : " + sourceString);
+					++total.failed;
+					continue;
+				}
+
+				image = std::move(compressed);
+				metadata = image.GetMetadata();
+			}
+
+			std::filesystem::create_directories(baked.parent_path());
+
+			if (FAILED(DirectX::SaveToDDSFile(image.GetImages(), image.GetImageCount(), metadata, DirectX::DDS_FLAGS_NONE, baked.c_str())))
+			{
+				errors.push_back("save failed : " + baked.generic_string());
+				++total.failed;
+				continue;
+			}
+
+			TextureManifestEntry entry;
+			entry.source = sourceString;
+			entry.baked = baked.generic_string();
+			entry.format = static_cast<uint32_t>(metadata.format);
+			entry.width = static_cast<uint32_t>(metadata.width);
+			entry.height = static_cast<uint32_t>(metadata.height);
+			entry.mipLevels = static_cast<uint32_t>(metadata.mipLevels);
+			entry.sourceSize = report.sourceFileBytes;
+			entry.sourceTime = lastWriteTime(source);
+			TextureManifest::Set(std::move(entry));
+
+			++total.baked;
+		}
+		else
+		{
+			++total.upToDate;
+		}
+
+		// ũ   (Ÿ Resolve  ϴ )
+		const auto bakedStart = Clock::now();
+
+		DirectX::ScratchImage bakedImage;
+		if (FAILED(DirectX::LoadFromDDSFile(baked.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, bakedImage)))
+		{
+			errors.push_back("baked load failed : " + baked.generic_string());
+			++total.failed;
+			continue;
+		}
+
+		report.bakedLoadMilliseconds = elapsedMilliseconds(bakedStart);
+
+		const DirectX::TexMetadata& bakedMetadata = bakedImage.GetMetadata();
+		report.bakedFormat = static_cast<uint32_t>(bakedMetadata.format);
+		report.mipLevels = static_cast<uint32_t>(bakedMetadata.mipLevels);
+		report.compressed = DirectX::IsCompressed(bakedMetadata.format);
+		report.bakedFileBytes = std::filesystem::file_size(baked);
+		report.bakedVramBytes = bakedImage.GetPixelsSize();
+
+		++total.textures;
+		total.sourceFileBytes += report.sourceFileBytes;
+		total.bakedFileBytes += report.bakedFileBytes;
+		total.runtimeVramBytes += report.runtimeVramBytes;
+		total.bakedVramBytes += report.bakedVramBytes;
+		total.runtimeLoadMilliseconds += report.runtimeLoadMilliseconds;
+		total.bakedLoadMilliseconds += report.bakedLoadMilliseconds;
+
+		textures.push_back(std::move(report));
+	}
+
+	const bool isSaved = TextureManifest::Save(_settings.manifestPath);
+	if (!isSaved)
+		errors.push_back("manifest save failed : " + _settings.manifestPath.generic_string());
+
+	// VRAM    
+	std::ranges::sort(textures, std::greater{}, [](const TextureReport& report) { return report.runtimeVramBytes - (std::min)(report.runtimeVramBytes, report.bakedVramBytes); });
+
+	std::ofstream file(_settings.reportPath);
+	if (file.is_open())
+	{
+		cereal::JSONOutputArchive archive(file);
+		archive(
+			cereal::make_nvp("source", _settings.sourcePath.generic_string()),
+			cereal::make_nvp("output", _settings.outputPath.generic_string()),
+			cereal::make_nvp("manifest", _settings.manifestPath.generic_string()),
+			cereal::make_nvp("total", total),
+			cereal::make_nvp("textures", textures),
+			cereal::make_nvp("errors", errors)
+		);
+	}
+
+	if (SUCCEEDED(comResult))
+		CoUninitialize();
+
+	return isSaved && file.good() && total.failed == 0;
+}
+
+bool TextureBaker::ParseArguments(const std::vector<std::string>& args, TextureBakeSettings& settings)
+{
+	bool isBake = false;
+
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string& arg = args[i];
+		const bool hasValue = i + 1 < args.size() && !args[i + 1].starts_with("--");
+
+		if (arg == "--bake-textures")
+		{
+			if (hasValue)
+				settings.sourcePath = args[++i];
+			isBake = true;
+		}
+		else if (arg == "--bake-out" && hasValue)
+			settings.outputPath = args[++i];
+		else if (arg == "--manifest" && hasValue)
+			settings.manifestPath = args[++i];
+		else if (arg == "--report" && hasValue)
+			settings.reportPath = args[++i];
+		else if (arg == "--force")
+			settings.force = true;
+	}
+
+	return isBake;
+}
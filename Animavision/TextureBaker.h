@@ -0,0 +1,31 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+struct TextureBakeSettings
+{
+	std::filesystem::path sourcePath = "./Resources";
+	std::filesystem::path outputPath = "./Resources/Baked";			// sourcePath   η dds 
+	std::filesystem::path manifestPath = "./Resources/Baked/textures.manifest";
+	std::filesystem::path reportPath = "./texture_bake.json";
+	bool force = false;												//  ٲ ʾҾ ٽ ũ
+};
+
+/// GPU   ؽó ü Ӹ + BCn dds  ȯϰ TextureManifest  ϴ  
+///   ä,   ϴ   (HDR -> BC6H, 1 ä -> BC4, 2 ä -> BC5,  -> BC7)
+/// Ÿ ( ε + Ӹ ) ũ  ε ð, VRAM    JSON  
+class ANIMAVISION_DLL TextureBaker
+{
+public:
+	explicit TextureBaker(TextureBakeSettings settings);
+
+	// ȯ, Ŵ佺Ʈ,   (ϳ ϸ false,   )
+	bool Run();
+
+	// "--bake-textures [dir] [--bake-out dir] [--manifest path] [--report path] [--force]"
+	// --bake-textures   false
+	static bool ParseArguments(const std::vector<std::string>& args, TextureBakeSettings& settings);
+
+private:
+	TextureBakeSettings _settings;
+};
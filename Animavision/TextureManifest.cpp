@@ -0,0 +1,141 @@
+#include "pch.h"
+#include "TextureManifest.h"
+#include "VirtualFileSystem.h"
+
+#include <fstream>
+#include <algorithm>
+#include <unordered_set>
+
+bool TextureManifest::Load(const std::filesystem::path& path)
+{
+	std::lock_guard lock(s_Mutex);
+
+	s_IsLoaded = true;
+	s_Entries.clear();
+
+	std::vector<char> data;
+	if (!VirtualFileSystem::Read(path, data))
+		return false;
+
+	MemoryStream is(data);
+	cereal::BinaryInputArchive archive(is);
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	archive(magic, version);
+
+	if (magic != MAGIC || version != VERSION)
+		return false;
+
+	std::vector<TextureManifestEntry> entries;
+	archive(entries);
+
+	// ũ    
+	// ׸񸶴 Ȯ ʰ ũ ͸    ( Ʈϸ )
+	std::unordered_set<std::string> directories;
+	for (const auto& entry : entries)
+		directories.insert(std::filesystem::path(entry.baked).parent_path().string());
+
+	std::unordered_set<std::string> bakedFiles;
+	for (const auto& directory : directories)
+	{
+		for (const auto& file : VirtualFileSystem::List(directory, false))
+			bakedFiles.insert(MakeKey(file));
+	}
+
+	for (auto& entry : entries)
+	{
+		if (!bakedFiles.contains(MakeKey(entry.baked)))
+			continue;
+
+		std::string key = entry.source;
+		s_Entries.emplace(std::move(key), std::move(entry));
+	}
+
+	return true;
+}
+
+bool TextureManifest::Save(const std::filesystem::path& path)
+{
+	std::lock_guard lock(s_Mutex);
+
+	std::vector<TextureManifestEntry> entries;
+	entries.reserve(s_Entries.size());
+	for (const auto& [key, entry] : s_Entries)
+		entries.push_back(entry);
+
+	//   ϱ    
+	std::ranges::sort(entries, {}, &TextureManifestEntry::source);
+
+	std::filesystem::create_directories(path.parent_path());
+
+	std::ofstream os(path, std::ios::binary);
+	if (!os.is_open())
+		return false;
+
+	{
+		cereal::BinaryOutputArchive archive(os);
+		archive(MAGIC, VERSION, entries);
+	}
+
+	return os.good();
+}
+
+std::string TextureManifest::Resolve(const std::string& path)
+{
+	loadOnce();
+
+	std::lock_guard lock(s_Mutex);
+
+	if (s_Entries.empty())
+		return path;
+
+	auto it = s_Entries.find(MakeKey(path));
+	if (it == s_Entries.end())
+		return path;
+
+	return it->second.baked;
+}
+
+std::optional<TextureManifestEntry> TextureManifest::Find(const std::string& path)
+{
+	loadOnce();
+
+	std::lock_guard lock(s_Mutex);
+
+	auto it = s_Entries.find(MakeKey(path));
+	if (it == s_Entries.end())
+		return std::nullopt;
+
+	return it->second;
+}
+
+void TextureManifest::Set(TextureManifestEntry entry)
+{
+	loadOnce();
+
+	std::lock_guard lock(s_Mutex);
+
+	entry.source = MakeKey(entry.source);
+	std::string key = entry.source;
+	s_Entries[std::move(key)] = std::move(entry);
+}
+
+std::string TextureManifest::MakeKey(const std::filesystem::path& path)
+{
+	std::string key = path.lexically_normal().generic_string();
+	std::ranges::transform(key, key.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+	return key;
+}
+
+void TextureManifest::loadOnce()
+{
+	{
+		std::lock_guard lock(s_Mutex);
+		if (s_IsLoaded)
+			return;
+	}
+
+	Load();
+}
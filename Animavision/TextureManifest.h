@@ -0,0 +1,57 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+/// ũ ؽó   (  -> BCn + ü Ӹ dds)
+struct TextureManifestEntry
+{
+	std::string source;			//   (TextureManifest::MakeKey)
+	std::string baked;			// ũ dds 
+	uint32_t format = 0;		// DXGI_FORMAT
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t mipLevels = 0;
+	uint64_t sourceSize = 0;	//  ٲ Ȯ (ũ,  ð)
+	int64_t sourceTime = 0;
+
+	template <class Archive>
+	void serialize(Archive& ar)
+	{
+		ar(source, baked, format, width, height, mipLevels, sourceSize, sourceTime);
+	}
+};
+
+///  ؽó ũ  (TextureBaker  )
+/// Ÿ δ Resolve    ũ dds  о Ӹ ,  ȯ  
+/// ؽó ̸,  Ű  θ ״ 
+class ANIMAVISION_DLL TextureManifest
+{
+public:
+	static constexpr uint32_t MAGIC = 0x4D544D41;	// "AMTM"
+	static constexpr uint32_t VERSION = 1;
+	static constexpr const char* DEFAULT_PATH = "./Resources/Baked/textures.manifest";
+
+	//  ų  ٸ  false
+	static bool Load(const std::filesystem::path& path = DEFAULT_PATH);
+	static bool Save(const std::filesystem::path& path = DEFAULT_PATH);
+
+	// ũ    ,  path ״ (ó ȣ  DEFAULT_PATH ε)
+	static std::string Resolve(const std::string& path);
+
+	static std::optional<TextureManifestEntry> Find(const std::string& path);
+	static void Set(TextureManifestEntry entry);
+
+	// ҹ, , "./" ̸  Ű
+	static std::string MakeKey(const std::filesystem::path& path);
+
+private:
+	static void loadOnce();
+
+	inline static std::mutex s_Mutex;
+	inline static bool s_IsLoaded = false;
+	inline static std::unordered_map<std::string, TextureManifestEntry> s_Entries;
+};
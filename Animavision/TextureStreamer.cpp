@@ -0,0 +1,501 @@
+#include "pch.h"
+#include "TextureStreamer.h"
+
+#include "DX11Texture.h"
+#include "NeoDX11Context.h"
+#include "TextureManifest.h"
+#include "VirtualFileSystem.h"
+#include "AssetPack.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+	// ׶ 忡 
+	std::vector<uint8_t> readRange(const std::filesystem::path& path, uint64_t offset, uint64_t size)
+	{
+		std::vector<uint8_t> data;
+
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+			return data;
+
+		data.resize(size);
+		file.seekg(static_cast<std::streamoff>(offset));
+		if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size)))
+			data.clear();
+
+		return data;
+	}
+
+	// ׶ 忡 
+	// ε  ׸  ̸ о  (εϴ  尡  Ʈ  ʵ),  
+	std::vector<uint8_t> touchRange(const uint8_t* data, uint64_t size)
+	{
+		volatile uint8_t sink = 0;
+		for (uint64_t i = 0; i < size; i += AssetPack::ALIGNMENT)
+			sink = sink + data[i];
+
+		if (size > 0)
+			sink = sink + data[size - 1];
+
+		return {};
+	}
+
+	size_t mipExtent(size_t size, uint32_t mip)
+	{
+		return (std::max)(size >> mip, size_t{ 1 });
+	}
+
+	// magic + DDS_HEADER (+ DDS_HEADER_DXT10)
+	constexpr uint64_t DDS_HEADER_SIZE = 4 + 124;
+	constexpr uint64_t DDS_HEADER_DXT10_SIZE = 20;
+	constexpr uint64_t DDS_FOURCC_OFFSET = 84;
+}
+
+uint64_t StreamedTexture::GetBytes(uint32_t topMip) const
+{
+	uint64_t bytes = 0;
+	for (size_t i = topMip; i < mipBytes.size(); ++i)
+		bytes += mipBytes[i];
+
+	return bytes;
+}
+
+TextureStreamer::TextureStreamer(NeoDX11Context* context, uint64_t budget)
+	: _context(context)
+{
+	_stats.budgetBytes = budget;
+}
+
+TextureStreamer::~TextureStreamer()
+{
+	std::lock_guard lock(_mutex);
+
+	for (auto& entry : _entries)
+	{
+		if (entry->isPending)
+			entry->pending.wait();
+
+		if (auto texture = entry->texture.lock())
+			texture->m_Streaming = nullptr;
+	}
+}
+
+std::shared_ptr<DX11Texture> TextureStreamer::Register(const std::string& path)
+{
+	const std::string loadPath = TextureManifest::Resolve(path);
+
+	std::filesystem::path filePath = loadPath;
+	std::wstring extension = filePath.extension().wstring();
+	std::ranges::transform(extension, extension.begin(), ::towlower);
+
+	if (extension != L".dds")
+		return nullptr;
+
+	auto entry = std::make_unique<StreamedTexture>();
+	entry->path = filePath;
+
+	// ѿ       ε ׸   
+	std::span<const uint8_t> mapped;
+	if (VirtualFileSystem::Map(filePath, mapped))
+		entry->mapped = mapped.data();
+
+	auto& metadata = entry->metadata;
+	const HRESULT hr = entry->mapped != nullptr
+		? DirectX::GetMetadataFromDDSMemory(mapped.data(), mapped.size(), DirectX::DDS_FLAGS_NONE, metadata)
+		: DirectX::GetMetadataFromDDSFile(filePath.c_str(), DirectX::DDS_FLAGS_NONE, metadata);
+
+	if (FAILED(hr))
+		return nullptr;
+
+	if (metadata.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || metadata.arraySize != 1 || metadata.IsCubemap() || metadata.mipLevels <= 1)
+		return nullptr;
+
+	//  ġ (DXT10 Ȯ   20 Ʈ )
+	uint64_t offset = DDS_HEADER_SIZE;
+	{
+		char fourCC[4] = {};
+		if (entry->mapped != nullptr)
+		{
+			// Ÿ͸ оǷ  ü  
+			std::memcpy(fourCC, entry->mapped + DDS_FOURCC_OFFSET, sizeof(fourCC));
+		}
+		else
+		{
+			std::ifstream file(filePath, std::ios::binary);
+			file.seekg(DDS_FOURCC_OFFSET);
+			if (!file.read(fourCC, sizeof(fourCC)))
+				return nullptr;
+		}
+
+		if (std::memcmp(fourCC, "DX10", sizeof(fourCC)) == 0)
+			offset += DDS_HEADER_DXT10_SIZE;
+	}
+
+	for (uint32_t mip = 0; mip < metadata.mipLevels; ++mip)
+	{
+		size_t rowPitch = 0;
+		size_t slicePitch = 0;
+		if (FAILED(DirectX::ComputePitch(metadata.format, mipExtent(metadata.width, mip), mipExtent(metadata.height, mip), rowPitch, slicePitch)))
+			return nullptr;
+
+		entry->mipOffsets.push_back(offset);
+		entry->mipBytes.push_back(slicePitch);
+		offset += slicePitch;
+	}
+
+	// ε  ȯǴ Ž  ϰ ޸ ġ ޶ κ б Ұ
+	const uint64_t fileSize = entry->mapped != nullptr ? mapped.size() : std::filesystem::file_size(filePath);
+	if (offset != fileSize)
+		return nullptr;
+
+	uint32_t minMip = 0;
+	while (minMip + 1 < metadata.mipLevels && (std::max)(mipExtent(metadata.width, minMip), mipExtent(metadata.height, minMip)) > MIN_RESIDENT_SIZE)
+		++minMip;
+	while (minMip > 0 && !isValidTopMip(*entry, minMip))
+		--minMip;
+
+	// ̹  
+	if (minMip == 0)
+		return nullptr;
+
+	std::vector<uint8_t> data;
+	const uint8_t* minMipData = nullptr;
+
+	if (entry->mapped != nullptr)
+	{
+		minMipData = entry->mapped + entry->mipOffsets[minMip];
+	}
+	else
+	{
+		data = readRange(filePath, entry->mipOffsets[minMip], entry->GetBytes(minMip));
+		if (data.empty())
+			return nullptr;
+
+		minMipData = data.data();
+	}
+
+	auto texture = std::make_shared<DX11Texture>();
+	texture->m_Path = path;
+	texture->m_Name = path.substr(path.find_last_of('/') + 1);
+	texture->m_Type = Texture::Type::Texture2D;
+	texture->m_Width = static_cast<uint32_t>(metadata.width);
+	texture->m_Height = static_cast<uint32_t>(metadata.height);
+	texture->m_MipLevels = static_cast<uint32_t>(metadata.mipLevels);
+	texture->m_Format = static_cast<Texture::Format>(metadata.format);
+
+	entry->residentMip = static_cast<uint32_t>(metadata.mipLevels);
+	if (!rebuild(*entry, *texture, minMip, minMipData))
+		return nullptr;
+
+	entry->minMip = minMip;
+	entry->wantedMip = minMip;
+	entry->texture = texture;
+	texture->m_Streaming = entry.get();
+
+	std::lock_guard lock(_mutex);
+	_stats.residentBytes += entry->GetBytes(minMip);
+	_entries.push_back(std::move(entry));
+
+	return texture;
+}
+
+void TextureStreamer::Request(DX11Texture& texture, float screenPixels)
+{
+	StreamedTexture* entry = texture.m_Streaming;
+	if (entry == nullptr)
+		return;
+
+	const auto& metadata = entry->metadata;
+	const uint32_t lastMip = static_cast<uint32_t>(metadata.mipLevels) - 1;
+
+	// ü ŭ ȼ ؽó   ٰ  ؼ : ȼ  1 : 1  Ǵ 
+	uint32_t mip = lastMip;
+	if (screenPixels > 0.f)
+	{
+		const float size = static_cast<float>((std::max)(metadata.width, metadata.height));
+		const float level = std::log2(size / screenPixels) + MIP_BIAS;
+		mip = level <= 0.f ? 0 : static_cast<uint32_t>((std::min)(level, static_cast<float>(lastMip)));
+	}
+
+	uint32_t current = entry->requestedMip.load(std::memory_order_relaxed);
+	while (mip < current && !entry->requestedMip.compare_exchange_weak(current, mip, std::memory_order_relaxed))
+	{
+	}
+}
+
+void TextureStreamer::Update()
+{
+	std::lock_guard lock(_mutex);
+
+	++_frame;
+	_stats.loads = 0;
+	_stats.evictions = 0;
+
+	// бⰡ   ε
+	uint32_t uploads = 0;
+	for (auto& entry : _entries)
+	{
+		if (!entry->isPending || uploads >= MAX_UPLOADS_PER_FRAME)
+			continue;
+
+		if (entry->pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			continue;
+
+		std::vector<uint8_t> data = entry->pending.get();
+		entry->isPending = false;
+
+		const uint64_t bytes = entry->GetBytes(entry->pendingMip) - entry->GetBytes(entry->residentMip);
+		_stats.pendingBytes -= bytes;
+
+		auto texture = entry->texture.lock();
+		if (texture == nullptr || (entry->mapped == nullptr && data.empty()))
+			continue;
+
+		// ε ̸  ʰ ׸   ״ ε
+		const uint8_t* source = entry->mapped != nullptr ? entry->mapped + entry->mipOffsets[entry->pendingMip] : data.data();
+
+		if (rebuild(*entry, *texture, entry->pendingMip, source))
+		{
+			_stats.residentBytes += bytes;
+			_stats.totalLoadedBytes += bytes;
+			++_stats.loads;
+			++uploads;
+		}
+	}
+
+	//  ؽó (д ̸   )
+	std::erase_if(_entries, [this](const std::unique_ptr<StreamedTexture>& entry)
+		{
+			if (!entry->texture.expired() || entry->isPending)
+				return false;
+
+			_stats.residentBytes -= entry->GetBytes(entry->residentMip);
+			return true;
+		});
+
+	// ̹  û 
+	for (auto& entry : _entries)
+	{
+		const uint32_t requested = entry->requestedMip.exchange(StreamedTexture::NO_REQUEST, std::memory_order_relaxed);
+
+		if (requested != StreamedTexture::NO_REQUEST)
+		{
+			uint32_t wanted = (std::min)(requested, entry->minMip);
+			while (wanted > 0 && !isValidTopMip(*entry, wanted))
+				--wanted;
+
+			entry->wantedMip = wanted;
+			entry->lastRequestedFrame = _frame;
+		}
+		else if (_frame - entry->lastRequestedFrame > IDLE_FRAMES)
+		{
+			entry->wantedMip = entry->minMip;
+		}
+	}
+
+	// ֱٿ û , ̰ ū ͺ б 
+	std::vector<StreamedTexture*> candidates;
+	uint32_t pendingLoads = 0;
+
+	for (auto& entry : _entries)
+	{
+		if (entry->isPending)
+			++pendingLoads;
+		else if (entry->wantedMip < entry->residentMip)
+			candidates.push_back(entry.get());
+	}
+
+	std::ranges::sort(candidates, [](const StreamedTexture* lhs, const StreamedTexture* rhs)
+		{
+			if (lhs->lastRequestedFrame != rhs->lastRequestedFrame)
+				return lhs->lastRequestedFrame > rhs->lastRequestedFrame;
+
+			return lhs->residentMip - lhs->wantedMip > rhs->residentMip - rhs->wantedMip;
+		});
+
+	for (StreamedTexture* entry : candidates)
+	{
+		if (pendingLoads >= MAX_PENDING_LOADS)
+			break;
+
+		//  ȿ    
+		uint32_t target = entry->wantedMip;
+		for (; target < entry->residentMip; ++target)
+		{
+			if (isValidTopMip(*entry, target) && evict(entry->GetBytes(target) - entry->GetBytes(entry->residentMip)))
+				break;
+		}
+
+		if (target >= entry->residentMip)
+			continue;
+
+		const uint64_t offset = entry->mipOffsets[target];
+		const uint64_t size = entry->mipOffsets[entry->residentMip] - offset;
+
+		if (entry->mapped != nullptr)
+			entry->pending = std::async(std::launch::async, touchRange, entry->mapped + offset, size);
+		else
+			entry->pending = std::async(std::launch::async, readRange, entry->path, offset, size);
+		entry->pendingMip = target;
+		entry->isPending = true;
+
+		_stats.pendingBytes += entry->GetBytes(target) - entry->GetBytes(entry->residentMip);
+		++pendingLoads;
+	}
+
+	// 
+	_stats.textures = static_cast<uint32_t>(_entries.size());
+	_stats.pendingLoads = pendingLoads;
+	_stats.wantedBytes = 0;
+	_stats.starvedTextures = 0;
+
+	for (const auto& entry : _entries)
+	{
+		_stats.wantedBytes += entry->GetBytes(entry->wantedMip);
+
+		if (!entry->isPending && entry->wantedMip < entry->residentMip)
+			++_stats.starvedTextures;
+	}
+}
+
+bool TextureStreamer::isValidTopMip(const StreamedTexture& entry, uint32_t mip) const
+{
+	// D3D11  BC ؽó ֻ ũⰡ 4   
+	if (!DirectX::IsCompressed(entry.metadata.format))
+		return true;
+
+	return mipExtent(entry.metadata.width, mip) % 4 == 0 && mipExtent(entry.metadata.height, mip) % 4 == 0;
+}
+
+bool TextureStreamer::rebuild(StreamedTexture& entry, DX11Texture& texture, uint32_t topMip, const uint8_t* data)
+{
+	const auto& metadata = entry.metadata;
+	const uint32_t mipLevels = static_cast<uint32_t>(metadata.mipLevels);
+	const uint32_t loadedEnd = (std::min)(entry.residentMip, mipLevels);
+
+	assert((data != nullptr || topMip >= entry.residentMip) && "Missing mip data");
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.Width = static_cast<uint32_t>(mipExtent(metadata.width, topMip));
+	desc.Height = static_cast<uint32_t>(mipExtent(metadata.height, topMip));
+	desc.MipLevels = mipLevels - topMip;
+	desc.ArraySize = 1;
+	desc.Format = metadata.format;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	// о   (topMip ~ loadedEnd - 1)  data  ̾ 
+	std::vector<D3D11_SUBRESOURCE_DATA> loaded;
+	for (uint32_t mip = topMip; mip < loadedEnd; ++mip)
+	{
+		size_t rowPitch = 0;
+		size_t slicePitch = 0;
+		DirectX::ComputePitch(metadata.format, mipExtent(metadata.width, mip), mipExtent(metadata.height, mip), rowPitch, slicePitch);
+
+		D3D11_SUBRESOURCE_DATA subresource = {};
+		subresource.pSysMem = data;
+		subresource.SysMemPitch = static_cast<uint32_t>(rowPitch);
+		subresource.SysMemSlicePitch = static_cast<uint32_t>(slicePitch);
+		loaded.push_back(subresource);
+
+		data += slicePitch;
+	}
+
+	Microsoft::WRL::ComPtr<ID3D11Texture2D> newTexture;
+	HRESULT hr = S_OK;
+
+	if (texture.m_Texture2D == nullptr)
+	{
+		// ó  : ̽ ϹǷ ε 忡 
+		hr = _context->GetDevice()->CreateTexture2D(&desc, loaded.data(), newTexture.GetAddressOf());
+	}
+	else
+	{
+		hr = _context->GetDevice()->CreateTexture2D(&desc, nullptr, newTexture.GetAddressOf());
+		if (FAILED(hr))
+			return false;
+
+		ID3D11DeviceContext* deviceContext = _context->GetDeviceContext();
+
+		for (uint32_t mip = topMip; mip < loadedEnd; ++mip)
+		{
+			const D3D11_SUBRESOURCE_DATA& subresource = loaded[mip - topMip];
+			deviceContext->UpdateSubresource(newTexture.Get(), mip - topMip, nullptr, subresource.pSysMem, subresource.SysMemPitch, subresource.SysMemSlicePitch);
+		}
+
+		// ̹ ö ִ  GPU ȿ 
+		for (uint32_t mip = (std::max)(topMip, entry.residentMip); mip < mipLevels; ++mip)
+			deviceContext->CopySubresourceRegion(newTexture.Get(), mip - topMip, 0, 0, 0, texture.m_Texture2D.Get(), mip - entry.residentMip, nullptr);
+	}
+
+	if (FAILED(hr))
+		return false;
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Format = metadata.format;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Texture2D.MipLevels = desc.MipLevels;
+	srvDesc.Texture2D.MostDetailedMip = 0;
+
+	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> srv;
+	hr = _context->GetDevice()->CreateShaderResourceView(newTexture.Get(), &srvDesc, srv.GetAddressOf());
+	if (FAILED(hr))
+		return false;
+
+	texture.m_Texture2D = newTexture;
+	texture.m_SRV = srv;
+	entry.residentMip = topMip;
+
+	return true;
+}
+
+bool TextureStreamer::evict(uint64_t bytes)
+{
+	auto fits = [this, bytes]() { return _stats.residentBytes + _stats.pendingBytes + bytes <= _stats.budgetBytes; };
+
+	if (fits())
+		return true;
+
+	// ʿ ̻ ö ִ ؽó  û  
+	std::vector<StreamedTexture*> victims;
+	for (auto& entry : _entries)
+	{
+		if (!entry->isPending && entry->residentMip < entry->wantedMip)
+			victims.push_back(entry.get());
+	}
+
+	std::ranges::sort(victims, {}, &StreamedTexture::lastRequestedFrame);
+
+	for (StreamedTexture* victim : victims)
+	{
+		auto texture = victim->texture.lock();
+		if (texture == nullptr)
+			continue;
+
+		uint32_t topMip = victim->wantedMip;
+		while (topMip > victim->residentMip && !isValidTopMip(*victim, topMip))
+			--topMip;
+
+		if (topMip <= victim->residentMip)
+			continue;
+
+		const uint64_t freed = victim->GetBytes(victim->residentMip) - victim->GetBytes(topMip);
+		if (!rebuild(*victim, *texture, topMip, nullptr))
+			continue;
+
+		_stats.residentBytes -= freed;
+		_stats.totalEvictedBytes += freed;
+		++_stats.evictions;
+
+		if (fits())
+			return true;
+	}
+
+	return fits();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Renderer.h"
+
+#include <mutex>
+#include <future>
+#include <DirectXTex.h>
+
+class DX11Texture;
+class NeoDX11Context;
+
+/// Ʈ ؽó     (DX11Texture::m_Streaming  Ŵ)
+///  ȣ  ػ󵵰 , residentMip ~  ӱ GPU  ö 
+struct StreamedTexture
+{
+	static constexpr uint32_t NO_REQUEST = ~0u;
+
+	std::weak_ptr<DX11Texture> texture;
+	std::filesystem::path path;				// ũ(Ǵ ) dds
+	const uint8_t* mapped = nullptr;		// ѿ   ε dds  (VirtualFileSystem::Map), ƴϸ Ͽ 
+	DirectX::TexMetadata metadata;			// ü  ü 
+	std::vector<uint64_t> mipOffsets;		// dds   ġ
+	std::vector<uint64_t> mipBytes;
+
+	uint32_t minMip = 0;					// ׻ ϴ  ģ ֻ  (  )
+	uint32_t residentMip = 0;
+	uint32_t wantedMip = 0;
+	uint64_t lastRequestedFrame = 0;
+
+	//  尡 ƴϾ  (̹  û    )
+	std::atomic<uint32_t> requestedMip = NO_REQUEST;
+
+	bool isPending = false;
+	uint32_t pendingMip = 0;
+	std::future<std::vector<uint8_t>> pending;	// pendingMip ~ residentMip - 1   (mapped   о ΰ  )
+
+	uint64_t GetBytes(uint32_t topMip) const;
+};
+
+/// Ƽ ؽó Ʈ (DX11)
+///    (MIN_RESIDENT_SIZE )  а, ȭ鿡 ̴ MeshRenderer   ũ ʿ  û޾
+///  ȿ    ׶ (ѿ  ε ׸) о ø
+///  ڶ ֱٿ û  ؽó(LRU) ʿ ̻ ö ִ  
+/// ؽó  ũ ٽ  SRV  üϹǷ εϴ  ٲ 
+class TextureStreamer
+{
+public:
+	static constexpr uint32_t MIN_RESIDENT_SIZE = 64;			// ׻ ϴ  ִ  
+	static constexpr uint64_t DEFAULT_BUDGET = 256ull << 20;
+	static constexpr uint32_t MAX_PENDING_LOADS = 4;			// ÿ д ؽó 
+	static constexpr uint32_t MAX_UPLOADS_PER_FRAME = 2;		// Ӵ GPU  ø ؽó  (ġ )
+	static constexpr uint64_t IDLE_FRAMES = 120;				// ̸ŭ û  ϴ  minMip  
+	static constexpr float MIP_BIAS = 0.f;						// ȭ ȼ  ؼ   (  )
+
+	explicit TextureStreamer(NeoDX11Context* context, uint64_t budget = DEFAULT_BUDGET);
+	~TextureStreamer();
+
+	// Ʈ  dds(2D, 迭 ƴ, Ӹ )   Ӹ ø ؽó, ƴϸ nullptr
+	std::shared_ptr<DX11Texture> Register(const std::string& path);
+
+	// screenPixels : ؽó  ü ȭ鿡 ϴ  (ȼ), ƹ 忡 ȣ 
+	static void Request(DX11Texture& texture, float screenPixels);
+
+	//  忡 Ӹ ȣ : б Ϸ ε, û ,  ȿ б , LRU 
+	void Update();
+
+	void SetBudget(uint64_t bytes) { _stats.budgetBytes = bytes; }
+	const TextureStreamingStats& GetStats() const { return _stats; }
+
+private:
+	bool isValidTopMip(const StreamedTexture& entry, uint32_t mip) const;
+
+	// ֻ topMip  ϴ ؽó ٽ  (data  topMip ~ residentMip - 1 ,   ؽó )
+	bool rebuild(StreamedTexture& entry, DX11Texture& texture, uint32_t topMip, const uint8_t* data);
+
+	// residentBytes + pendingBytes + bytes   ȿ  LRU   (ϸ true)
+	bool evict(uint64_t bytes);
+
+	NeoDX11Context* _context = nullptr;
+
+	std::mutex _mutex;
+	std::vector<std::unique_ptr<StreamedTexture>> _entries;
+	uint64_t _frame = 0;
+
+	TextureStreamingStats _stats;
+};
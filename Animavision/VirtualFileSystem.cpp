@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "VirtualFileSystem.h"
+
+#include "AssetPack.h"
+
+#include <fstream>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace
+{
+	// Ʈ /   , б ε 忡 Ͼ
+	std::shared_mutex s_mutex;
+	AssetPack s_pack;
+}
+
+bool VirtualFileSystem::Mount(const std::filesystem::path& path)
+{
+	std::unique_lock lock(s_mutex);
+
+	return s_pack.Open(path);
+}
+
+void VirtualFileSystem::Unmount()
+{
+	std::unique_lock lock(s_mutex);
+
+	s_pack.Close();
+}
+
+bool VirtualFileSystem::IsMounted()
+{
+	std::shared_lock lock(s_mutex);
+
+	return s_pack.IsOpen();
+}
+
+bool VirtualFileSystem::Exists(const std::filesystem::path& path)
+{
+	if (IsInPack(path))
+		return true;
+
+	std::error_code ec;
+	return std::filesystem::is_regular_file(path, ec);
+}
+
+bool VirtualFileSystem::IsInPack(const std::filesystem::path& path)
+{
+	std::shared_lock lock(s_mutex);
+
+	return s_pack.IsOpen() && s_pack.Find(AssetPack::MakeKey(path)) != nullptr;
+}
+
+bool VirtualFileSystem::GetSize(const std::filesystem::path& path, uint64_t& size)
+{
+	{
+		std::shared_lock lock(s_mutex);
+
+		if (const AssetPackEntry* entry = s_pack.IsOpen() ? s_pack.Find(AssetPack::MakeKey(path)) : nullptr)
+		{
+			size = entry->size;
+			return true;
+		}
+	}
+
+	std::error_code ec;
+	size = std::filesystem::file_size(path, ec);
+
+	return !ec;
+}
+
+bool VirtualFileSystem::Read(const std::filesystem::path& path, std::vector<char>& data)
+{
+	{
+		std::shared_lock lock(s_mutex);
+
+		if (const AssetPackEntry* entry = s_pack.IsOpen() ? s_pack.Find(AssetPack::MakeKey(path)) : nullptr)
+		{
+			data.resize(entry->size);
+			if (!s_pack.Read(*entry, data.data()))
+			{
+				data.clear();
+				return false;
+			}
+
+			++s_Stats.packReads;
+			s_Stats.packBytes += entry->size;
+			return true;
+		}
+	}
+
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+		return false;
+
+	data.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+	if (!file)
+	{
+		data.clear();
+		return false;
+	}
+
+	++s_Stats.looseReads;
+	s_Stats.looseBytes += data.size();
+	return true;
+}
+
+bool VirtualFileSystem::Map(const std::filesystem::path& path, std::span<const uint8_t>& data)
+{
+	std::shared_lock lock(s_mutex);
+
+	const AssetPackEntry* entry = s_pack.IsOpen() ? s_pack.Find(AssetPack::MakeKey(path)) : nullptr;
+	const uint8_t* mapped = entry != nullptr ? s_pack.GetData(*entry) : nullptr;
+	if (mapped == nullptr)
+		return false;
+
+	data = { mapped, static_cast<size_t>(entry->size) };
+
+	++s_Stats.packReads;
+	s_Stats.packBytes += entry->size;
+	return true;
+}
+
+std::vector<std::string> VirtualFileSystem::List(const std::filesystem::path& directory, bool isRecursive)
+{
+	std::vector<std::string> files = ListPack(directory, isRecursive);
+
+	//  Ʈϸ Ÿ д   ѿ Ƿ ũ  
+	if (IsMounted() && !s_IsLooseListing)
+		return files;
+
+	// Ѹ ϸ ͸   
+	std::error_code ec;
+	if (!std::filesystem::is_directory(directory, ec))
+		return files;
+
+	std::unordered_set<std::string> keys;
+	for (const auto& file : files)
+		keys.insert(AssetPack::MakeKey(file));
+
+	auto addLoose = [&](const std::filesystem::directory_entry& entry)
+		{
+			if (!entry.is_regular_file())
+				return;
+
+			if (keys.insert(AssetPack::MakeKey(entry.path())).second)
+				files.push_back(entry.path().string());
+		};
+
+	if (isRecursive)
+	{
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+			addLoose(entry);
+	}
+	else
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(directory))
+			addLoose(entry);
+	}
+
+	return files;
+}
+
+std::vector<std::string> VirtualFileSystem::ListPack(const std::filesystem::path& directory, bool isRecursive)
+{
+	std::vector<std::string> files;
+
+	std::string prefix = AssetPack::MakeKey(directory);
+	if (!prefix.empty() && prefix != "." && !prefix.ends_with('/'))
+		prefix += '/';
+	if (prefix == ".")
+		prefix.clear();
+
+	// directory   ״ տ  (ũ ȸ   )
+	std::string base = directory.string();
+	while (!base.empty() && (base.back() == '/' || base.back() == '\\'))
+		base.pop_back();
+
+	{
+		std::shared_lock lock(s_mutex);
+
+		if (s_pack.IsOpen())
+		{
+			for (const AssetPackEntry& entry : s_pack.GetEntries())
+			{
+				const std::string_view path = s_pack.GetPath(entry);
+				if (path.size() <= prefix.size())
+					continue;
+
+				//   δ ̹ ȭǾ 
+				std::string key(path);
+				std::ranges::transform(key, key.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+				if (!key.starts_with(prefix))
+					continue;
+
+				const std::string_view remainder = path.substr(prefix.size());
+				if (!isRecursive && remainder.find('/') != std::string_view::npos)
+					continue;
+
+				files.push_back(base.empty() ? std::string(remainder) : base + "/" + std::string(remainder));
+			}
+		}
+	}
+
+	return files;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "RendererDLL.h"
+
+#include <span>
+#include <atomic>
+#include <istream>
+#include <streambuf>
+
+///    cereal ī̺꿡 ѱ  Ʈ ( , data   ִ ȸ )
+class MemoryStream : public std::istream
+{
+public:
+	explicit MemoryStream(const std::vector<char>& data)
+		: std::istream(nullptr)
+		, _buffer(data)
+	{
+		rdbuf(&_buffer);
+	}
+
+private:
+	class Buffer : public std::streambuf
+	{
+	public:
+		explicit Buffer(const std::vector<char>& data)
+		{
+			char* begin = const_cast<char*>(data.data());
+			setg(begin, begin, begin + data.size());
+		}
+
+	protected:
+		pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override
+		{
+			char* position = direction == std::ios_base::beg ? eback() : direction == std::ios_base::cur ? gptr() : egptr();
+			if (offset < eback() - position || offset > egptr() - position)
+				return pos_type(off_type(-1));
+
+			setg(eback(), position + offset, egptr());
+			return pos_type(gptr() - eback());
+		}
+
+		pos_type seekpos(pos_type position, std::ios_base::openmode mode) override
+		{
+			return seekoff(off_type(position), std::ios_base::beg, mode);
+		}
+	};
+
+	Buffer _buffer;
+};
+
+struct VirtualFileSystemStats
+{
+	std::atomic<uint32_t> packReads = 0;
+	std::atomic<uint32_t> looseReads = 0;
+	std::atomic<uint64_t> packBytes = 0;		//   
+	std::atomic<uint64_t> looseBytes = 0;
+};
+
+///  б  (Ʈ AssetPack  ,  ũ)
+/// ̺귯,  δ    ʰ  о  ϳ ص   ̸ ״ 
+///  Ʈ  ó ũ 
+class ANIMAVISION_DLL VirtualFileSystem
+{
+public:
+	static constexpr const char* DEFAULT_PACK_PATH = "./Resources.pack";
+
+	//   ,  ϸ false (ũ )
+	static bool Mount(const std::filesystem::path& path = DEFAULT_PACK_PATH);
+	static void Unmount();
+	static bool IsMounted();
+
+	static bool Exists(const std::filesystem::path& path);
+	static bool IsInPack(const std::filesystem::path& path);
+	//    ũ,  false
+	static bool GetSize(const std::filesystem::path& path, uint64_t& size);
+
+	//  ü data  ( false)
+	static bool Read(const std::filesystem::path& path, std::vector<char>& data);
+	// ѿ     ε Ʈ   data  (Unmount  ȿ), ƴϸ false
+	static bool Map(const std::filesystem::path& path, std::span<const uint8_t>& data);
+
+	// ͸ Ʒ 
+	//  Ʈϸ   (ũ  ), ƴϸ ũ
+	//  ׸ directory ڿ '/'  ̾  ζ ũ  Ͱ  ̸ 
+	static std::vector<std::string> List(const std::filesystem::path& directory, bool isRecursive = true);
+	//   (ũ  , Ʈ ʾ  )
+	static std::vector<std::string> ListPack(const std::filesystem::path& directory, bool isRecursive = true);
+
+	// ߿ (--loose-assets) :  Ʈص List  ũ Ⱦ ѿ     (ߺ )
+	static void SetLooseListing(bool isEnabled) { s_IsLooseListing = isEnabled; }
+
+	static const VirtualFileSystemStats& GetStats() { return s_Stats; }
+
+private:
+	inline static VirtualFileSystemStats s_Stats;
+	inline static std::atomic<bool> s_IsLooseListing = false;
+};
@@ -0,0 +1,48 @@
+﻿#include "pch.h"
+
+#include <Animacore/BenchmarkRunner.h>
+
+#include <new>
+#include <cstdlib>
+
+// 벤치마크 할당 집계를 위한 전역 operator new 교체
+// 정적 라이브러리(Animacore, midnight_cleanup)의 할당까지 포함되며 DLL(Animavision) 내부 할당은 제외
+namespace
+{
+	const bool isHooked = (core::AllocationCounter::isHooked = true);
+}
+
+void* operator new(size_t size)
+{
+	core::AllocationCounter::Record(size);
+
+	if (void* ptr = std::malloc(size == 0 ? 1 : size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
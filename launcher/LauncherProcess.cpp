@@ -3,30 +3,59 @@
 
 #include <Animacore/Timer.h>
 #include <Animacore/AnimatorSystem.h>
+#include <Animacore/InputSystem.h>
 
 #include "Animacore/CoreSystemEvents.h"
 #include "Animacore/Scene.h"
 
 #include "Animacore/CoreComponents.h"
+#include "Animacore/FramePipeline.h"
+#include "Animacore/SceneLoader.h"
+#include "Animacore/Profiler.h"
+#include "Animacore/AssetLoader.h"
+#include "Animacore/SceneManifest.h"
+#include "Animavision/VirtualFileSystem.h"
+
+namespace
+{
+	// 프로세스 시작부터 지난 시간 (창, 렌더러 생성 포함)
+	double getProcessElapsedMs()
+	{
+		FILETIME creation, exit, kernel, user, now;
+		if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+			return 0.0;
+
+		GetSystemTimeAsFileTime(&now);
+
+		auto toTicks = [](const FILETIME& time) { return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+
+		// 100ns 단위
+		return static_cast<double>(toTicks(now) - toTicks(creation)) / 10000.0;
+	}
+}
 
 launcher::LauncherProcess::LauncherProcess(const core::ProcessInfo& info)
 	: McProcess(info)
 {
+	PROFILE_THREAD("Main");
+
 	if (_renderer->IsRayTracing())
 		_renderer->InitializeTopLevelAS();
 
-	_renderer->LoadMeshesFromDrive("./Resources/Models");
-	_renderer->LoadMaterialsFromDrive("./Resources");
-	_renderer->LoadShadersFromDrive("./Shaders");
-	_renderer->LoadAnimationClipsFromDrive("./Resources/Animations");
-	_renderer->LoadUITexturesFromDrive("./Resources/UI");
-	_renderer->LoadParticleTexturesFromDrive("./Resources/Particles");
-	_renderer->LoadFontsFromDrive("./Resources/Fonts");
-
-	core::AnimatorSystem::controllerManager.LoadControllersFromDrive("./Resources", _renderer.get());
+	// 첫 씬의 의존성 목록이 있으면 그 씬이 참조하는 에셋만 읽고, 나머지는 AssetLoader 가 필요할 때 읽음
+	if (core::SceneManifest manifest; manifest.Load(core::SceneManifest::GetPath(FIRST_SCENE_PATH)))
+		loadSceneAssets(manifest);
+	else
+		loadAllAssets();
 
 	_currentScene = std::make_shared<core::Scene>();
-	_currentScene->LoadScene("./Resources/Scenes/title.scene");
+	_sceneLoader = std::make_unique<core::SceneLoader>();
+
+	_currentScene->LoadScene(FIRST_SCENE_PATH);
+
+	// 입력 기록, 재생 중에는 씬마다 같은 시드 사용
+	if (core::InputSystem::recorder.GetMode() != core::InputRecorder::Mode::None)
+		_currentScene->GetGenerator()->seed(core::InputSystem::recorder.GetSeed());
 
 	// configuration을 가져온다
 	auto& config = _currentScene->GetRegistry()->ctx().get<core::Configuration>();
@@ -34,6 +63,10 @@ launcher::LauncherProcess::LauncherProcess(const core::ProcessInfo& info)
 	config.height = _processInfo.height;
 
 	_currentScene->Start(_renderer.get());
+
+	if (_processInfo.pipelineFrames && !_currentScene->CanPipelineRender())
+		LOG_INFO(*_currentScene, "Frame pipelining requested, but this scene has render systems without frame packets; rendering serially");
+
 	_currentScene->GetDispatcher()->sink<core::OnChangeScene>().connect<&LauncherProcess::changeScene>(this);
 	_currentScene->GetDispatcher()->sink<core::OnChangeResolution>().connect<&LauncherProcess::changeResolution>(this);
 
@@ -48,6 +81,66 @@ launcher::LauncherProcess::LauncherProcess(const core::ProcessInfo& info)
 	changeResolution(event);
 }
 
+void launcher::LauncherProcess::loadAllAssets()
+{
+	{
+		PROFILE_SCOPE("LoadMeshesFromDrive");
+		_renderer->LoadMeshesFromDrive("./Resources/Models");
+	}
+	{
+		PROFILE_SCOPE("LoadMaterialsFromDrive");
+		_renderer->LoadMaterialsFromDrive("./Resources");
+	}
+	{
+		PROFILE_SCOPE("LoadShadersFromDrive");
+		_renderer->LoadShadersFromDrive("./Shaders");
+	}
+	{
+		PROFILE_SCOPE("LoadAnimationClipsFromDrive");
+		_renderer->LoadAnimationClipsFromDrive("./Resources/Animations");
+	}
+	{
+		PROFILE_SCOPE("LoadUITexturesFromDrive");
+		_renderer->LoadUITexturesFromDrive("./Resources/UI");
+	}
+	{
+		PROFILE_SCOPE("LoadParticleTexturesFromDrive");
+		_renderer->LoadParticleTexturesFromDrive("./Resources/Particles");
+	}
+	{
+		PROFILE_SCOPE("LoadFontsFromDrive");
+		_renderer->LoadFontsFromDrive("./Resources/Fonts");
+	}
+
+	{
+		PROFILE_SCOPE("LoadControllersFromDrive");
+		core::AnimatorSystem::controllerManager.LoadControllersFromDrive("./Resources", _renderer.get());
+	}
+}
+
+void launcher::LauncherProcess::loadSceneAssets(const core::SceneManifest& manifest)
+{
+	// 셰이더는 머티리얼, 렌더 시스템이 LoadShader 로 필요할 때 컴파일, 폰트는 작아서 전부 읽음
+	{
+		PROFILE_SCOPE("IndexAssetsFromDrive");
+		_renderer->IndexAssetsFromDrive(AssetType::Mesh, "./Resources/Models");
+		_renderer->IndexAssetsFromDrive(AssetType::Material, "./Resources");
+		_renderer->IndexAssetsFromDrive(AssetType::AnimationClip, "./Resources/Animations");
+		_renderer->IndexAssetsFromDrive(AssetType::UITexture, "./Resources/UI");
+		_renderer->IndexAssetsFromDrive(AssetType::ParticleTexture, "./Resources/Particles");
+	}
+	{
+		PROFILE_SCOPE("LoadFontsFromDrive");
+		_renderer->LoadFontsFromDrive("./Resources/Fonts");
+	}
+	{
+		PROFILE_SCOPE("LoadSceneAssets");
+		auto& loader = core::AssetLoader::Get();
+		loader.LoadEngineAssets(*_renderer);
+		loader.Load(manifest, *_renderer);
+	}
+}
+
 void launcher::LauncherProcess::Loop()
 {
 	// todo
@@ -69,14 +162,39 @@ void launcher::LauncherProcess::Loop()
 		}
 		else
 		{
+			PROFILE_FRAME();
+
 			timer.Update();
-			const auto tick = timer.GetTick();
+			const float frameTick = _processInfo.fixedTick > 0.f ? _processInfo.fixedTick : timer.GetTick();
+
+			// 입력 재생 중에는 기록된 tick
+			const auto tick = core::InputSystem::recorder.GetNextTick(frameTick);
 
-			// 씬 재생
+			// 씬 재생 (파이프라인이면 렌더 스레드의 이전 프레임 제출과 겹쳐 실행)
 			_currentScene->Update(tick);
 
+			if (_framePipeline)
+				_framePipeline->Flush();
+
+			// 렌더 스레드가 쉬는 동안 요청된 에셋을 읽음 (씬 로더 워커가 라이브러리를 읽는 중이면 보류)
+			if (_sceneLoader->GetState() != core::SceneLoader::State::Loading)
+				core::AssetLoader::Get().Pump(*_renderer, ASSET_BUDGET_MS);
+
+			// 렌더 스레드는 파이프라인 가능한 씬을 처음 만났을 때 만들고, 패킷만 읽으므로 씬이 바뀌어도 그대로 사용
+			if (_processInfo.pipelineFrames && !_framePipeline && _currentScene->CanPipelineRender())
+			{
+				_framePipeline = std::make_unique<core::FramePipeline>([this](const core::FramePacket& packet)
+					{
+						_renderer->BeginRender();
+						core::Scene::SubmitFramePacket(packet, _renderer.get());
+						_renderer->EndRender();
+					});
+			}
+
+			const bool isPipelined = _framePipeline && _currentScene->CanPipelineRender();
+
 			// 렌더링
-			if (!LauncherProcess::isMinimized)
+			if (!LauncherProcess::isMinimized && !isPipelined)
 			{
 				_renderer->BeginRender();
 
@@ -90,6 +208,23 @@ void launcher::LauncherProcess::Loop()
 			mouseWheel = 0;
 
 			changeExecution();
+
+			// 이벤트 처리 후의 상태를 패킷으로 복사하여 렌더 스레드로 넘김 (1 프레임 지연)
+			if (!LauncherProcess::isMinimized && isPipelined && _currentScene->CanPipelineRender())
+			{
+				auto& packet = _framePipeline->GetExtractPacket();
+				_currentScene->ExtractFramePacket(packet, tick, _renderer.get());
+				_framePipeline->Kick();
+			}
+
+			if (!_isFirstFrameReported)
+			{
+				const auto& loader = core::AssetLoader::Get();
+				const auto& files = VirtualFileSystem::GetStats();
+				LOG_INFO(*_currentScene, "Time to first frame : {:.1f} ms (assets loaded {}, missing {}, pack reads {}, loose reads {})",
+					getProcessElapsedMs(), loader.GetLoadedCount(), loader.GetMissingCount(), files.packReads.load(), files.looseReads.load());
+				_isFirstFrameReported = true;
+			}
 		}
 	}
 }
@@ -102,21 +237,113 @@ void launcher::LauncherProcess::changeScene(const core::OnChangeScene& event)
 
 void launcher::LauncherProcess::changeExecution()
 {
+	// 입력 재생 중에는 기록에서 교체된 프레임에 맞춰 교체 (로딩이 늦으면 대기, 빠르면 보류)
+	const auto& recorder = core::InputSystem::recorder;
+	const bool isReplaying = recorder.IsReplaying();
+
+	auto& assetLoader = core::AssetLoader::Get();
+
+	// 다음 씬이 참조하는 에셋을 먼저 프레임마다 나눠 읽고 (Loop 의 Pump), 다 읽으면 워커 스레드에서 씬을 읽음
+	// 그동안 현재 씬(타이틀 등)은 계속 갱신
 	if (_receiveChangeEvent)
 	{
-		_currentScene->Finish(_renderer.get());
-		_currentScene->LoadScene(_scenePath);
-		_currentScene->Start(_renderer.get());
-		//_titleBarHeight = GetSystemMetrics(SM_CYCAPTION);
-		//_currentScene->GetDispatcher()->enqueue<core::OnGetTitleBarHeight>({ _titleBarHeight });
+		if (!_prefetchScenePath.empty() || _sceneLoader->GetState() != core::SceneLoader::State::Idle)
+		{
+			LOG_WARN(*_currentScene, "Scene is already loading : {}", _scenePath.string());
+		}
+		else
+		{
+			if (core::SceneManifest manifest; manifest.Load(core::SceneManifest::GetPath(_scenePath)))
+			{
+				// 재생 중에는 교체 프레임이 늦어지지 않도록 바로 읽음
+				if (isReplaying)
+					assetLoader.Load(manifest, *_renderer);
+				else
+					assetLoader.Prefetch(manifest);
+			}
+
+			_prefetchScenePath = _scenePath;
+		}
 
 		_receiveChangeEvent = false;
 		_scenePath.clear();
 	}
+
+	if (!_prefetchScenePath.empty())
+	{
+		if (isReplaying || assetLoader.IsIdle())
+		{
+			if (!_sceneLoader->LoadAsync(_prefetchScenePath, _renderer.get()))
+				LOG_WARN(*_currentScene, "Scene is already loading : {}", _sceneLoader->GetPath().string());
+
+			_prefetchScenePath.clear();
+		}
+		else
+		{
+			_currentScene->GetRegistry()->ctx().insert_or_assign(
+				core::SceneLoadProgress{ _prefetchScenePath.string(), PREFETCH_PROGRESS * assetLoader.GetProgress(), true });
+		}
+	}
+
+	if (isReplaying && recorder.IsSceneSwitchFrame())
+		_sceneLoader->Wait();
+
+	switch (_sceneLoader->GetState())
+	{
+	case core::SceneLoader::State::Loading:
+		_currentScene->GetRegistry()->ctx().insert_or_assign(
+			core::SceneLoadProgress{ _sceneLoader->GetPath().string(), PREFETCH_PROGRESS + (1.0f - PREFETCH_PROGRESS) * _sceneLoader->GetProgress(), true });
+		break;
+	case core::SceneLoader::State::Ready:
+		// 프레임 경계에서 교체
+		if (!isReplaying || recorder.IsSceneSwitchFrame())
+			switchScene(_sceneLoader->TakeScene());
+		break;
+	case core::SceneLoader::State::Failed:
+		LOG_ERROR(*_currentScene, "Failed to load scene : {}", _sceneLoader->GetPath().string());
+		_currentScene->GetRegistry()->ctx().erase<core::SceneLoadProgress>();
+		_sceneLoader->TakeScene();
+		break;
+	default:
+		break;
+	}
+}
+
+void launcher::LauncherProcess::switchScene(std::shared_ptr<core::Scene> scene)
+{
+	if (!scene)
+		return;
+
+	if (_framePipeline)
+		_framePipeline->Flush();
+
+	// 해상도 등 실행 설정은 이어서 사용
+	const auto config = _currentScene->GetRegistry()->ctx().get<core::Configuration>();
+
+	_currentScene->Finish(_renderer.get());
+	_currentScene = std::move(scene);
+
+	auto& recorder = core::InputSystem::recorder;
+	if (recorder.GetMode() != core::InputRecorder::Mode::None)
+		_currentScene->GetGenerator()->seed(recorder.GetSeed());
+
+	recorder.MarkSceneSwitch();
+
+	_currentScene->GetRegistry()->ctx().get<core::Configuration>() = config;
+	_currentScene->GetDispatcher()->sink<core::OnChangeScene>().connect<&LauncherProcess::changeScene>(this);
+	_currentScene->GetDispatcher()->sink<core::OnChangeResolution>().connect<&LauncherProcess::changeResolution>(this);
+
+	_currentScene->Start(_renderer.get());
+	//_titleBarHeight = GetSystemMetrics(SM_CYCAPTION);
+	//_currentScene->GetDispatcher()->enqueue<core::OnGetTitleBarHeight>({ _titleBarHeight });
 }
 
 void launcher::LauncherProcess::changeResolution(const core::OnChangeResolution& event)
 {
+	// 업데이트 중에 trigger 될 수 있으므로 렌더 스레드가 Renderer 를 놓을 때까지 대기
+	if (_framePipeline)
+		_framePipeline->Flush();
+
 	if (event.isFullScreen)
 	{
 		_renderer->SetFullScreen(true);
@@ -4,7 +4,10 @@
 namespace core
 {
 	class Scene;
+	class FramePipeline;
+	class SceneLoader;
 	struct OnChangeScene;
+	struct SceneManifest;
 }
 
 namespace launcher
@@ -18,16 +21,37 @@ namespace launcher
 		inline static bool isMinimized = false;
 
 	private:
+		static constexpr const char* FIRST_SCENE_PATH = "./Resources/Scenes/title.scene";
+		static constexpr float ASSET_BUDGET_MS = 4.0f;			// 프레임마다 AssetLoader 가 에셋을 읽는 시간
+		static constexpr float PREFETCH_PROGRESS = 0.5f;		// 로딩 진행률 중 다음 씬 에셋을 미리 읽는 비율
+
+		// 의존성 목록(.deps)이 없는 씬이면 예전처럼 모든 에셋 디렉터리를 읽음
+		void loadAllAssets();
+		// 디렉터리는 색인만 하고 첫 씬이 참조하는 에셋만 읽음
+		void loadSceneAssets(const core::SceneManifest& manifest);
+
 		void changeScene(const core::OnChangeScene& event);
 
 		void changeExecution();
+		void switchScene(std::shared_ptr<core::Scene> scene);
 		void changeResolution(const core::OnChangeResolution& event);
 
 		std::shared_ptr<core::Scene> _currentScene;
 
+		// 업데이트/렌더 파이프라인 (ProcessInfo::pipelineFrames)
+		std::unique_ptr<core::FramePipeline> _framePipeline;
+
+		// 다음 씬 비동기 로딩 (현재 씬은 로딩 중에도 계속 실행)
+		std::unique_ptr<core::SceneLoader> _sceneLoader;
+
 		bool _receiveChangeEvent = false;
 		std::filesystem::path _scenePath;
 
+		// 에셋을 미리 읽는 중인 다음 씬 (다 읽으면 _sceneLoader 로 넘김)
+		std::filesystem::path _prefetchScenePath;
+
+		bool _isFirstFrameReported = false;
+
 		//int _titleBarHeight = 0;
 	};
 }
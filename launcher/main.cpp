@@ -3,6 +3,21 @@
 #include "pch.h"
 #include "LauncherProcess.h"
 
+#include <random>
+#include <optional>
+#include <shellapi.h>
+
+#include <Animacore/MetaFuncs.h>
+#include <Animacore/InputSystem.h>
+#include <Animacore/BenchmarkRunner.h>
+#include <Animacore/SceneManifestWriter.h>
+#include <Animavision/TextureBaker.h>
+#include <Animavision/AssetPacker.h>
+#include <Animavision/MaterialCompiler.h>
+#include <Animavision/ShaderCacheCheck.h>
+#include <Animavision/VirtualFileSystem.h>
+#include <midnight_cleanup/McMetaFuncs.h>
+
 LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
@@ -10,6 +25,100 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_ LPWSTR    lpCmdLine,
                      _In_ int       nCmdShow)
 {
+	std::vector<std::string> args;
+
+	if (int argc = 0; LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc))
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const int length = WideCharToMultiByte(CP_UTF8, 0, argv[i], -1, nullptr, 0, nullptr, nullptr);
+			std::string arg(length > 0 ? length - 1 : 0, '\0');
+			WideCharToMultiByte(CP_UTF8, 0, argv[i], -1, arg.data(), length, nullptr, nullptr);
+			args.push_back(std::move(arg));
+		}
+
+		LocalFree(argv);
+	}
+
+	// 헤드리스 텍스처 베이크 (launcher.exe --bake-textures [dir] ...), 창과 GPU 없이 변환만 하고 종료
+	if (TextureBakeSettings settings; TextureBaker::ParseArguments(args, settings))
+	{
+		TextureBaker baker(std::move(settings));
+		return baker.Run() ? 0 : 1;
+	}
+
+	// 헤드리스 머티리얼 컴파일 (launcher.exe --compile-materials [dir] ...), .material 을 바이너리 라이브러리 하나로 묶고 종료
+	if (MaterialCompileSettings settings; MaterialCompiler::ParseArguments(args, settings))
+	{
+		MaterialCompiler compiler(std::move(settings));
+		return compiler.Run() ? 0 : 1;
+	}
+
+	// 셰이더 캐시 확인 (launcher.exe --check-shader-cache), 가짜 컴파일러로 무효화, 실패 재사용, CompileAll 횟수를 확인하고 종료
+	if (ShaderCacheCheckSettings settings; ShaderCacheCheck::ParseArguments(args, settings))
+	{
+		ShaderCacheCheck check(std::move(settings));
+		return check.Run() ? 0 : 1;
+	}
+
+	// 헤드리스 의존성 목록 생성 (launcher.exe --write-deps [dir]), 씬, 프리팹마다 <scene>.deps 를 다시 쓰고 종료
+	if (core::SceneManifestWriterSettings settings; core::SceneManifestWriter::ParseArguments(args, settings))
+	{
+		core::RegisterCoreMetaData();
+		mc::RegisterMcMetaData();
+
+		core::SceneManifestWriter writer(std::move(settings));
+		return writer.Run() ? 0 : 1;
+	}
+
+	// 헤드리스 에셋 팩 생성 (launcher.exe --pack-assets [dir] ...), 디스크의 에셋을 팩 하나로 묶고 종료
+	if (AssetPackSettings settings; AssetPacker::ParseArguments(args, settings))
+	{
+		AssetPacker packer(std::move(settings));
+		return packer.Run() ? 0 : 1;
+	}
+
+	// 팩이 있으면 에셋을 팩에서 읽음 (팩에 없는 파일은 디스크에서)
+	// 팩을 마운트하면 디렉터리 목록도 팩 목차만 봄, 개발 중 팩을 다시 만들지 않은 새 파일까지 보려면 --loose-assets
+	VirtualFileSystem::Mount();
+	VirtualFileSystem::SetLooseListing(std::ranges::find(args, "--loose-assets") != args.end());
+
+	// 헤드리스 벤치마크 (launcher.exe --benchmark <scene> ...)
+	if (core::BenchmarkSettings settings; core::BenchmarkRunner::ParseArguments(args, settings))
+	{
+		core::RegisterCoreMetaData();
+		mc::RegisterMcMetaData();
+
+		core::BenchmarkRunner runner(std::move(settings));
+		return runner.Run() ? 0 : 1;
+	}
+
+	// 업데이트/렌더 파이프라인 (--pipeline-frames), 렌더 단계 시스템이 모두 패킷으로 제출 가능한 씬에서만 켜짐
+	const bool hasPipelineFrames = std::ranges::find(args, "--pipeline-frames") != args.end();
+
+	// 입력 기록, 재생 (--record-input <path> [--seed N] | --replay-input <path>) [--fixed-tick S]
+	float fixedTick = 0.f;
+	std::optional<uint32_t> seed;
+	std::filesystem::path recordPath;
+	std::filesystem::path replayPath;
+
+	for (size_t i = 0; i + 1 < args.size(); ++i)
+	{
+		if (args[i] == "--record-input")
+			recordPath = args[++i];
+		else if (args[i] == "--replay-input")
+			replayPath = args[++i];
+		else if (args[i] == "--fixed-tick")
+			fixedTick = std::stof(args[++i]);
+		else if (args[i] == "--seed")
+			seed = static_cast<uint32_t>(std::stoul(args[++i]));
+	}
+
+	if (!replayPath.empty())
+		core::InputSystem::recorder.StartReplay(replayPath);
+	else if (!recordPath.empty())
+		core::InputSystem::recorder.StartRecording(recordPath, seed.value_or(std::random_device{}()));
+
 	core::ProcessInfo info;
 	info.hInstance = hInstance;
 	info.title = L"Midnight Clean-up";
@@ -19,6 +128,8 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 	info.enableImGui = false;
 	info.proc = WndProc;
 	info.windowStyle = WS_OVERLAPPEDWINDOW ^ WS_THICKFRAME ^ WS_MAXIMIZEBOX;
+	info.pipelineFrames = hasPipelineFrames;
+	info.fixedTick = fixedTick;
 	
 	//info.startScene = "";
 
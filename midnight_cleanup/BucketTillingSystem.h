@@ -6,6 +6,16 @@ namespace core
 {
 	struct OnStartSystem;
 	struct OnFinishSystem;
+	struct Sound;
+	struct Relationship;
+	struct MeshRenderer;
+	struct ParticleSystem;
+	struct LocalTransform;
+}
+
+namespace mc
+{
+	struct WaterBucket;
 }
 
 
@@ -28,4 +38,6 @@ private:
 	entt::entity _waterParticle = entt::null;
 };
 DEFINE_SYSTEM_TRAITS(BucketTillingSystem)
+DEFINE_SYSTEM_READS(BucketTillingSystem, core::LocalTransform, core::Relationship)
+DEFINE_SYSTEM_WRITES(BucketTillingSystem, mc::WaterBucket, core::Sound, core::MeshRenderer, core::ParticleSystem, core::access::Dispatcher)
 
@@ -9,6 +9,7 @@
 #include <Animacore/RaycastHit.h>
 #include <Animacore/PhysicsScene.h>
 #include <Animacore/CoreSystemEvents.h>
+#include <Animacore/FrameAllocator.h>
 
 #include "McTagsAndLayers.h"
 #include <Animacore/InputSystem.h>
@@ -629,7 +630,7 @@ void mc::CharacterActionSystem::cleanStain(core::Scene& scene, mc::Inventory& in
 
 	if (stainDurability->currentDurability <= 0)
 	{
-		_dispatcher->trigger<mc::OnDecreaseStain>({ scene, hitEntity });
+		scene.GetEventBus()->Push<mc::OnDecreaseStain>(scene, hitEntity);
 		scene.DestroyEntity(hitEntity);
 	}
 }
@@ -723,7 +724,7 @@ void mc::CharacterActionSystem::continueInteraction(core::Scene& scene, const co
 	if (!_rayCastingTransform || !_rayCastingInfo)
 		return;
 
-	std::vector<physics::RaycastHit> hits;
+	core::FrameVector<physics::RaycastHit> hits;
 
 	_interactingOffsetX += input.mouseDeltaRotation.x;
 	_interactingOffsetY += input.mouseDeltaRotation.y;
@@ -804,7 +805,7 @@ void mc::CharacterActionSystem::continueInteraction(core::Scene& scene, const co
 
 					if (stainDurability->currentDurability <= 10)
 					{
-						_dispatcher->trigger<mc::OnDecreaseStain>({ scene, hit.entity });
+						scene.GetEventBus()->Push<mc::OnDecreaseStain>(scene, hit.entity);
 						scene.DestroyEntity(hit.entity);
 						_accumulator = 0;
 					}
@@ -841,7 +842,7 @@ void mc::CharacterActionSystem::createNewStain(core::Scene& scene)
 
 	entt::entity roomTrigger = entt::null;
 	// 켱 ѹ Ƽ  ִָ roomtrigger  ã´.
-	std::vector<physics::RaycastHit> roomHits;
+	core::FrameVector<physics::RaycastHit> roomHits;
 	Vector3 rayOrigin = _rayCastingTransform->position;
 	Vector3 rayDirection = _rayCastingTransform->matrix.Backward();
 	rayDirection.Normalize();
@@ -907,7 +908,7 @@ void mc::CharacterActionSystem::createNewStain(core::Scene& scene)
 			auto& room = scene.GetRegistry()->get<mc::Room>(newEntity);
 			room.type = hitRoom->type;
 
-			_dispatcher->trigger<mc::OnIncreaseStain>({ scene, newEntity });
+			scene.GetEventBus()->Push<mc::OnIncreaseStain>(scene, newEntity);
 
 			auto& log = scene.GetRegistry()->ctx().get<CaptionLog>();
 			if (!log.isShown[CaptionLog::Caption_MopDirty])
@@ -10,6 +10,7 @@
 #include <Animacore/RenderComponents.h>
 #include <Animacore/CorePhysicsComponents.h>
 #include <Animacore/InputSystem.h>
+#include <Animacore/FrameAllocator.h>
 
 #include "McTagsAndLayers.h"
 
@@ -426,7 +427,7 @@ void mc::CharacterMovementSystem::playFootStepSound(core::Scene& scene)
 
 	Vector3 direction = Vector3::Down;
 
-	std::vector<physics::RaycastHit> hits;
+	core::FrameVector<physics::RaycastHit> hits;
 
 	if (!_physicsScene->Raycast(origin, direction, hits, 5, 3.f))
 	{
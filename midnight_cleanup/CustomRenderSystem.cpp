@@ -4,6 +4,7 @@
 #include <Animacore/Scene.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
+#include <Animacore/AssetResolver.h>
 #include "McComponents.h"
 
 #include "../Animavision/Renderer.h"
@@ -66,22 +67,59 @@ mc::CustomRenderSystem::~CustomRenderSystem()
 
 void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer, float tick)
 {
-	auto& registry = *scene.GetRegistry();
 	auto& renderRes = scene.GetRegistry()->ctx().get<core::RenderResources>();
-	const Matrix& view = renderRes.viewMatrix;
-	const Matrix& proj = renderRes.projectionMatrix;
-	const Matrix& viewProj = renderRes.viewProjectionMatrix;
-	auto& cameraTransform = *renderRes.cameraTransform;
 
-	DirectX::BoundingFrustum frustum;
-	DirectX::BoundingFrustum::CreateFromMatrix(frustum, proj);
-	frustum.Transform(frustum, view.Invert());
+	core::FramePacket::Camera camera;
+	camera.view = renderRes.viewMatrix;
+	camera.proj = renderRes.projectionMatrix;
+	camera.viewProj = renderRes.viewProjectionMatrix;
+	if (renderRes.cameraTransform)
+		camera.position = renderRes.cameraTransform->position;
 
+	updateVideos(scene, tick);
+	collectDraws(scene, renderer, camera);
+	submitDraws(renderer, camera);
+}
 
-	PerObject perObject;
-	cbDissolveFactor dissolveFactor;
+void mc::CustomRenderSystem::Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet)
+{
+	updateVideos(scene, packet.tick);
+	collectDraws(scene, renderer, packet.camera);
+}
 
-	renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+void mc::CustomRenderSystem::Submit(const core::FramePacket& packet, Renderer& renderer)
+{
+	submitDraws(renderer, packet.camera);
+}
+
+void mc::CustomRenderSystem::updateVideos(core::Scene& scene, float tick)
+{
+	// ù  Ʈ  ϹǷ ǳʶ
+	if (!_skip1Frame)
+		return;
+
+	auto& registry = *scene.GetRegistry();
+
+	for (auto&& [entity, videoRenderer, meshRenderer] : registry.view<mc::VideoRenderer, core::MeshRenderer>().each())
+	{
+		if (_videoTextures[entity].update(tick))
+		{
+			_dispatcher->enqueue<core::OnChangeScene>("./Resources/Scenes/InGame.scene");
+		}
+	}
+}
+
+void mc::CustomRenderSystem::collectDraws(core::Scene& scene, Renderer& renderer, const core::FramePacket::Camera& camera)
+{
+	auto& registry = *scene.GetRegistry();
+
+	_dissolveDraws.clear();
+	_videoDraws.clear();
+	_bonePalettes.clear();
+
+	DirectX::BoundingFrustum frustum;
+	DirectX::BoundingFrustum::CreateFromMatrix(frustum, camera.proj);
+	frustum.Transform(frustum, camera.view.Invert());
 
 	{
 		auto&& dissolveViewIter = registry.view<mc::DissolveRenderer, core::WorldTransform, core::MeshRenderer>().each();
@@ -90,11 +128,8 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 			if (!meshRenderer.isOn || meshRenderer.isForward)
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(renderer, meshRenderer))
 				continue;
-			}
 
 			DirectX::BoundingSphere boundingSphere = meshRenderer.mesh->boundingSphere;
 			boundingSphere.Transform(boundingSphere, transform.matrix);
@@ -102,19 +137,8 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 			if (frustum.Intersects(boundingSphere) == DirectX::DISJOINT && !meshRenderer.isSkinned)
 				continue;
 
-			if (!meshRenderer.isCulling)
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
-			else
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
-
-			if (meshRenderer.materials.size() <= 0)
-			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-				}
+			if (!core::AssetResolver::ResolveMaterials(renderer, meshRenderer))
 				continue;
-			}
 
 			auto world = transform.matrix;
 
@@ -122,7 +146,7 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 
 			for (uint32_t i = 0; i < static_cast<uint32_t>(meshRenderer.materials.size()); ++i)
 			{
-				auto material = meshRenderer.materials[i];
+				auto& material = meshRenderer.materials[i];
 				if (material == nullptr)
 				{
 					continue;
@@ -134,51 +158,44 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 					continue;
 				}
 
-				perObject.gWorld = world;
-				perObject.gWorldInvTranspose = worldInvTranspose;
-				perObject.gTexTransform = Matrix::Identity;
-				perObject.gView = view;
-				perObject.gProj = proj;
-				perObject.gViewProj = viewProj;
-
-				dissolveFactor.gDissolveColor = dissolveRenderer.dissolveColor;
-				dissolveFactor.gDissolveFactor = dissolveRenderer.dissolveFactor;
-				dissolveFactor.gEdgeWidth = dissolveRenderer.edgeWidth;
-
-				material->m_Shader->MapConstantBuffer(renderer.GetContext());
-				material->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
-				material->m_Shader->SetFloat3(G_EYE_POS_W, cameraTransform.position);
-				material->m_Shader->SetInt(G_RECIEVE_DECAL, meshRenderer.canReceivingDecal);
-				material->m_Shader->SetFloat(G_EMISSIVE_FACTOR, meshRenderer.emissiveFactor);
-				material->m_Shader->SetConstant("cbDissolveFactor", &dissolveFactor, sizeof(cbDissolveFactor));
-
+				DissolveDraw draw;
+				draw.mesh = meshRenderer.mesh.get();
+				draw.material = material.get();
+				draw.subMeshIndex = i;
+				draw.world = world;
+				draw.worldInvTranspose = worldInvTranspose;
+				draw.dissolveColor = dissolveRenderer.dissolveColor;
+				draw.dissolveFactor = dissolveRenderer.dissolveFactor;
+				draw.edgeWidth = dissolveRenderer.edgeWidth;
+				draw.emissiveFactor = meshRenderer.emissiveFactor;
+				draw.canReceivingDecal = meshRenderer.canReceivingDecal;
+				draw.isCulling = meshRenderer.isCulling;
+				draw.isSkinned = meshRenderer.isSkinned;
+
+				//   Ʈ Ʈ ŰǷ ⼭ 
 				if (meshRenderer.isSkinned)
 				{
 					SubMeshDescriptor& subMesh = meshRenderer.mesh->subMeshDescriptors[i];
+					draw.paletteOffset = static_cast<uint32_t>(_bonePalettes.size());
+
 					if (meshRenderer.animator)
 					{
-						std::vector<Matrix> boneTransforms;
-						boneTransforms.reserve(subMesh.boneIndexMap.size());
-
+						draw.isAnimated = true;
 						for (int j = 0; j < meshRenderer.bones[i].size(); j++)
 						{
 							auto boneMatrix = meshRenderer.boneOffsets[i][j] * (meshRenderer.bones[i][j] ? meshRenderer.bones[i][j]->matrix : Matrix::Identity);
-							boneTransforms.push_back(boneMatrix);
+							_bonePalettes.push_back(boneMatrix);
 						}
-						material->m_Shader->SetConstant("BoneMatrixBuffer", boneTransforms.data(), static_cast<uint32_t>(sizeof(Matrix) * boneTransforms.size()));
-						material->m_Shader->SetMatrix("gWorld", Matrix::Identity);
 					}
 					else
 					{
-						std::vector<Matrix> boneTransforms;
-						boneTransforms.resize(subMesh.boneIndexMap.size(), Matrix::Identity);
-						material->m_Shader->SetConstant("BoneMatrixBuffer", boneTransforms.data(), static_cast<uint32_t>(sizeof(Matrix) * boneTransforms.size()));
+						_bonePalettes.resize(_bonePalettes.size() + subMesh.boneIndexMap.size(), Matrix::Identity);
 					}
-				}
 
-				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+					draw.paletteCount = static_cast<uint32_t>(_bonePalettes.size()) - draw.paletteOffset;
+				}
 
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
+				_dissolveDraws.push_back(draw);
 			}
 		}
 	}
@@ -190,11 +207,8 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 			if (!meshRenderer.isOn || meshRenderer.isForward)
 				continue;
 
-			if (meshRenderer.mesh == nullptr)
-			{
-				meshRenderer.mesh = renderer.GetMesh(meshRenderer.meshString);
+			if (!core::AssetResolver::ResolveMesh(renderer, meshRenderer))
 				continue;
-			}
 
 			DirectX::BoundingSphere boundingSphere = meshRenderer.mesh->boundingSphere;
 			boundingSphere.Transform(boundingSphere, registry.get<core::WorldTransform>(entity).matrix);
@@ -202,30 +216,12 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 			if (frustum.Intersects(boundingSphere) == DirectX::DISJOINT && !meshRenderer.isSkinned)
 				continue;
 
-			if (!meshRenderer.isCulling)
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
-			else
-				renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
-
-			if (meshRenderer.materials.size() <= 0)
-			{
-				for (auto&& materialString : meshRenderer.materialStrings)
-				{
-					meshRenderer.materials.push_back(renderer.GetMaterial(materialString));
-				}
+			if (!core::AssetResolver::ResolveMaterials(renderer, meshRenderer))
 				continue;
-			}
-
-			perObject.gWorld = Matrix::Identity;
-			perObject.gWorldInvTranspose = Matrix::Identity;
-			perObject.gTexTransform = Matrix::Identity;
-			perObject.gView = Matrix::Identity;
-			perObject.gProj = Matrix::Identity;
-			perObject.gViewProj = Matrix::Identity;
 
 			for (uint32_t i = 0; i < static_cast<uint32_t>(meshRenderer.materials.size()); ++i)
 			{
-				auto material = meshRenderer.materials[i];
+				auto& material = meshRenderer.materials[i];
 				if (material == nullptr)
 				{
 					continue;
@@ -236,15 +232,87 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, Renderer& renderer,
 					OutputDebugStringA("Submesh index out of range\n");
 					continue;
 				}
-				material->SetTexture("txYUV", _videoTextures[entity].getTexture());
-				material->m_Shader->MapConstantBuffer(renderer.GetContext());
-				material->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
-				material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
 
-				renderer.Submit(*meshRenderer.mesh, *material, i, PrimitiveTopology::TRIANGLELIST, 1);
+				VideoDraw draw;
+				draw.mesh = meshRenderer.mesh.get();
+				draw.material = material.get();
+				draw.subMeshIndex = i;
+				draw.texture = _videoTextures[entity].getTexture();
+				draw.isCulling = meshRenderer.isCulling;
+				_videoDraws.push_back(draw);
 			}
+		}
+	}
+}
+
+void mc::CustomRenderSystem::submitDraws(Renderer& renderer, const core::FramePacket::Camera& camera)
+{
+	PerObject perObject;
+	cbDissolveFactor dissolveFactor;
 
+	renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+	for (const auto& draw : _dissolveDraws)
+	{
+		if (!draw.isCulling)
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
+		else
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+		auto material = draw.material;
+
+		perObject.gWorld = draw.world;
+		perObject.gWorldInvTranspose = draw.worldInvTranspose;
+		perObject.gTexTransform = Matrix::Identity;
+		perObject.gView = camera.view;
+		perObject.gProj = camera.proj;
+		perObject.gViewProj = camera.viewProj;
+
+		dissolveFactor.gDissolveColor = draw.dissolveColor;
+		dissolveFactor.gDissolveFactor = draw.dissolveFactor;
+		dissolveFactor.gEdgeWidth = draw.edgeWidth;
+
+		material->m_Shader->MapConstantBuffer(renderer.GetContext());
+		material->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
+		material->m_Shader->SetFloat3(G_EYE_POS_W, camera.position);
+		material->m_Shader->SetInt(G_RECIEVE_DECAL, draw.canReceivingDecal);
+		material->m_Shader->SetFloat(G_EMISSIVE_FACTOR, draw.emissiveFactor);
+		material->m_Shader->SetConstant("cbDissolveFactor", &dissolveFactor, sizeof(cbDissolveFactor));
+
+		if (draw.isSkinned)
+		{
+			material->m_Shader->SetConstant("BoneMatrixBuffer", _bonePalettes.data() + draw.paletteOffset, static_cast<uint32_t>(sizeof(Matrix) * draw.paletteCount));
+			if (draw.isAnimated)
+				material->m_Shader->SetMatrix("gWorld", Matrix::Identity);
 		}
+
+		material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+
+		renderer.Submit(*draw.mesh, *material, draw.subMeshIndex, PrimitiveTopology::TRIANGLELIST, 1);
+	}
+
+	perObject.gWorld = Matrix::Identity;
+	perObject.gWorldInvTranspose = Matrix::Identity;
+	perObject.gTexTransform = Matrix::Identity;
+	perObject.gView = Matrix::Identity;
+	perObject.gProj = Matrix::Identity;
+	perObject.gViewProj = Matrix::Identity;
+
+	for (const auto& draw : _videoDraws)
+	{
+		if (!draw.isCulling)
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_NONE, DepthStencilState::DEPTH_ENABLED);
+		else
+			renderer.ApplyRenderState(BlendState::COUNT, RasterizerState::CULL_BACK, DepthStencilState::DEPTH_ENABLED);
+
+		auto material = draw.material;
+
+		material->SetTexture("txYUV", draw.texture);
+		material->m_Shader->MapConstantBuffer(renderer.GetContext());
+		material->m_Shader->SetConstant(CB_PER_OBJECT, &perObject, sizeof(PerObject));
+		material->m_Shader->UnmapConstantBuffer(renderer.GetContext());
+
+		renderer.Submit(*draw.mesh, *material, draw.subMeshIndex, PrimitiveTopology::TRIANGLELIST, 1);
 	}
 }
 
@@ -273,11 +341,6 @@ void mc::CustomRenderSystem::operator()(core::Scene& scene, float tick)
 		{
 			_dispatcher->enqueue<core::OnChangeScene>("./Resources/Scenes/InGame.scene");
 		}
-
-		if (_videoTextures[entity].update(tick))
-		{
-			_dispatcher->enqueue<core::OnChangeScene>("./Resources/Scenes/InGame.scene");
-		}
 	}
 }
 
@@ -310,6 +373,10 @@ void mc::CustomRenderSystem::finishSystem(const core::OnFinishSystem& event)
 	_skip1Frame = false;
 	_videoTextures.clear();
 
+	_dissolveDraws.clear();
+	_videoDraws.clear();
+	_bonePalettes.clear();
+
 	//   is playing .
 
 	for (auto&& [entity, sound] : event.scene->GetRegistry()->view<core::Sound>().each())
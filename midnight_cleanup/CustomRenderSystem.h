@@ -2,11 +2,12 @@
 #include "Animacore/SystemInterface.h"
 #include "Animacore/SystemTraits.h"
 
+#include "Animacore/FramePacket.h"
 #include "Animavision/VideoTexture.h"
 
 namespace mc
 {
-	class CustomRenderSystem : public core::ISystem, public core::IRenderSystem, public core::IUpdateSystem, public core::IFixedSystem
+	class CustomRenderSystem : public core::ISystem, public core::IRenderSystem, public core::IUpdateSystem, public core::IFixedSystem, public core::IFramePacketSystem
 	{
 	public:
 		CustomRenderSystem(core::Scene& scene);
@@ -16,10 +17,47 @@ namespace mc
 		void operator()(core::Scene& scene) override;
 		void operator()(core::Scene& scene, Renderer& renderer, float tick) override;
 
+		void Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet) override;
+		void Submit(const core::FramePacket& packet, Renderer& renderer) override;
+
 	private:
+		//  ޽ ޽ ϳ (Ű̸   _bonePalettes[paletteOffset, paletteOffset + paletteCount))
+		struct DissolveDraw
+		{
+			Mesh* mesh = nullptr;
+			Material* material = nullptr;
+			uint32_t subMeshIndex = 0;
+			Matrix world;
+			Matrix worldInvTranspose;
+			Vector3 dissolveColor;
+			float dissolveFactor = 0.0f;
+			float edgeWidth = 0.0f;
+			float emissiveFactor = 1.0f;
+			uint32_t paletteOffset = 0;
+			uint32_t paletteCount = 0;
+			bool canReceivingDecal = true;
+			bool isCulling = true;
+			bool isSkinned = false;
+			bool isAnimated = false;
+		};
+
+		struct VideoDraw
+		{
+			Mesh* mesh = nullptr;
+			Material* material = nullptr;
+			uint32_t subMeshIndex = 0;
+			std::shared_ptr<Texture> texture;
+			bool isCulling = true;
+		};
+
 		void preStartSystem(const core::OnPreStartSystem& event);
 		void finishSystem(const core::OnFinishSystem& event);
 
+		//  ؽó ε Renderer ؽƮ ϹǷ  ܰ( , Extract) ȣ
+		void updateVideos(core::Scene& scene, float tick);
+		void collectDraws(core::Scene& scene, Renderer& renderer, const core::FramePacket::Camera& camera);
+		void submitDraws(Renderer& renderer, const core::FramePacket::Camera& camera);
+
 	private:
 		const static inline std::string CB_PER_OBJECT = "cbPerObject";
 		const static inline std::string G_EYE_POS_W = "gEyePosW";
@@ -31,6 +69,11 @@ namespace mc
 		bool _skip1Frame = false;
 
 		robin_hood::unordered_map<entt::entity, VideoTexture> _videoTextures;
+
+		// Extract   尡  Ŷ  ģ ڿ ǹǷ   
+		std::vector<DissolveDraw> _dissolveDraws;
+		std::vector<VideoDraw> _videoDraws;
+		std::vector<Matrix> _bonePalettes;
 	};
 }
 DEFINE_SYSTEM_TRAITS(mc::CustomRenderSystem)
@@ -5,6 +5,7 @@
 #include "McTagsAndLayers.h"
 
 #include <Animacore/Scene.h>
+#include <Animacore/FramePacket.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
 #include <Animacore/PhysicsScene.h>
@@ -26,6 +27,11 @@ mc::FurnitureDiscardingSystem::~FurnitureDiscardingSystem()
 	_dispatcher->disconnect(this);
 }
 
+void mc::FurnitureDiscardingSystem::Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet)
+{
+	(*this)(scene, renderer, packet.tick);
+}
+
 void mc::FurnitureDiscardingSystem::operator()(core::Scene& scene, Renderer& renderer, float tick)
 {
 	if (!scene.IsPlaying())
@@ -17,7 +17,7 @@ namespace mc
 	struct RayCastingInfo;
 	struct OnProcessFurniture;
 	
-	class FurnitureDiscardingSystem : public core::ISystem, public core::IRenderSystem
+	class FurnitureDiscardingSystem : public core::ISystem, public core::IRenderSystem, public core::IFramePacketSystem
 	{
 	public:
 		FurnitureDiscardingSystem(core::Scene& scene);
@@ -25,6 +25,10 @@ namespace mc
 
 		void operator()(core::Scene& scene, Renderer& renderer, float tick) override;
 
+		//  ó, ī޶ 鸲 Ʈ ٲٹǷ Extract  ״ ϰ   
+		void Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet) override;
+		void Submit(const core::FramePacket& packet, Renderer& renderer) override {}
+
 	private:
 		void startSystem(const core::OnStartSystem& event);
 		void finishSystem(const core::OnFinishSystem& event);
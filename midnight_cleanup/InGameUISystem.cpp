@@ -16,6 +16,7 @@
 mc::InGameUiSystem::InGameUiSystem(core::Scene& scene)
 	: ISystem(scene)
 	, _dispatcher(scene.GetDispatcher())
+	, _events(scene.GetEventBus())
 {
 	_dispatcher->sink<core::OnPreStartSystem>()
 		.connect<&InGameUiSystem::preStartSystem>(this);
@@ -26,10 +27,11 @@ mc::InGameUiSystem::InGameUiSystem(core::Scene& scene)
 	_dispatcher->sink<core::OnFinishSystem>()
 		.connect<&InGameUiSystem::finishSystem>(this);
 
-	_dispatcher->sink<OnDecreaseStain>()
-		.connect<&InGameUiSystem::decreaseStain>(this);
-	_dispatcher->sink<OnIncreaseStain>()
-		.connect<&InGameUiSystem::increaseStain>(this);
+	// 얼룩 이벤트는 같은 프레임에 여러 개 발생하므로 모아서 전달 받음
+	_events->Sink<OnDecreaseStain>()
+		.connect<&InGameUiSystem::decreaseStains>(this);
+	_events->Sink<OnIncreaseStain>()
+		.connect<&InGameUiSystem::increaseStains>(this);
 
 
 	// 자막 ui 이벤트
@@ -40,7 +42,7 @@ mc::InGameUiSystem::InGameUiSystem(core::Scene& scene)
 mc::InGameUiSystem::~InGameUiSystem()
 {
 	_dispatcher->disconnect(this);
-
+	_events->Disconnect(this);
 }
 
 void mc::InGameUiSystem::operator()(core::Scene& scene, float tick)
@@ -690,35 +692,40 @@ void mc::InGameUiSystem::finishSystem(const core::OnFinishSystem& event)
 	_tooltipUI = entt::null;
 }
 
-void mc::InGameUiSystem::decreaseStain(const OnDecreaseStain& event)
+void mc::InGameUiSystem::decreaseStains(std::span<const OnDecreaseStain> events)
 {
-	auto entity = event.entity;
-	auto& registry = *event.scene->GetRegistry();
-	auto& room = registry.get<mc::Room>(entity).type;
-	auto& stain = registry.get<mc::Stain>(entity);
-
-	if (stain.isMopStain)
-		_questUI->cleanedMopStainsInRoom[room] += 1;
-	else if (stain.isSpongeStain)
-		_questUI->cleanedSpongeStainInRoom[room] += 1;
-	else
-		LOG_ERROR(registry.ctx().get<core::Scene>(), "{} : Setup mc::Stain", entity);
+	for (const auto& event : events)
+	{
+		auto entity = event.entity;
+		auto& registry = *event.scene->GetRegistry();
+		auto& room = registry.get<mc::Room>(entity).type;
+		auto& stain = registry.get<mc::Stain>(entity);
+
+		if (stain.isMopStain)
+			_questUI->cleanedMopStainsInRoom[room] += 1;
+		else if (stain.isSpongeStain)
+			_questUI->cleanedSpongeStainInRoom[room] += 1;
+		else
+			LOG_ERROR(registry.ctx().get<core::Scene>(), "{} : Setup mc::Stain", entity);
+	}
 }
 
-void mc::InGameUiSystem::increaseStain(const OnIncreaseStain& event)
+void mc::InGameUiSystem::increaseStains(std::span<const OnIncreaseStain> events)
 {
-	auto entity = event.entity;
-	auto& registry = *event.scene->GetRegistry();
-	auto& room = registry.get<mc::Room>(entity).type;
-	auto& stain = registry.get<mc::Stain>(entity);
-
-	if (stain.isMopStain)
-		_questUI->totalMopStainsInRoom[room] += 1;
-	else if (stain.isSpongeStain)
-		_questUI->totalSpongeStainInRoom[room] += 1;
-	else
-		LOG_ERROR(registry.ctx().get<core::Scene>(), "{} : Setup mc::Stain", entity);
-
+	for (const auto& event : events)
+	{
+		auto entity = event.entity;
+		auto& registry = *event.scene->GetRegistry();
+		auto& room = registry.get<mc::Room>(entity).type;
+		auto& stain = registry.get<mc::Stain>(entity);
+
+		if (stain.isMopStain)
+			_questUI->totalMopStainsInRoom[room] += 1;
+		else if (stain.isSpongeStain)
+			_questUI->totalSpongeStainInRoom[room] += 1;
+		else
+			LOG_ERROR(registry.ctx().get<core::Scene>(), "{} : Setup mc::Stain", entity);
+	}
 }
 void mc::InGameUiSystem::showCaption(const mc::OnShowCaption& event)
 {
@@ -2,6 +2,11 @@
 #include "Animacore/SystemInterface.h"
 #include "Animacore/SystemTraits.h"
 
+namespace core
+{
+	class EventBus;
+}
+
 namespace mc
 {
 	struct OnDecreaseStain;
@@ -23,14 +28,15 @@ namespace mc
 		void startSystem(const core::OnStartSystem& event);
 		void postStartSystem(const core::OnPostStartSystem& event);
 		void finishSystem(const core::OnFinishSystem& event);
-		void decreaseStain(const OnDecreaseStain& event);
-		void increaseStain(const OnIncreaseStain& event);
+		void decreaseStains(std::span<const OnDecreaseStain> events);
+		void increaseStains(std::span<const OnIncreaseStain> events);
 
 		void showCaption(const mc::OnShowCaption& event);
 		void blinking(entt::registry& registry);
 
 	private:
 		entt::dispatcher* _dispatcher = nullptr;
+		core::EventBus* _events = nullptr;
 		mc::Quest* _questUI = nullptr;
 		mc::CaptionLog* _captionLog = nullptr;
 
@@ -5,6 +5,7 @@
 #include "McTagsAndLayers.h"
 
 #include <Animacore/Scene.h>
+#include <Animacore/FramePacket.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
 
@@ -22,6 +23,11 @@ mc::IngameLightSystem::~IngameLightSystem()
 	_dispatcher->disconnect(this);
 }
 
+void mc::IngameLightSystem::Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet)
+{
+	(*this)(scene, renderer, packet.tick);
+}
+
 void mc::IngameLightSystem::operator()(core::Scene& scene, Renderer& renderer, float tick)
 {
 	if (!scene.IsPlaying())
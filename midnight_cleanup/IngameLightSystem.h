@@ -7,7 +7,7 @@ namespace  mc
 	struct OnSwitchPushed;
 	struct OnHandleFlashLight;
 
-	class IngameLightSystem : public core::ISystem, public core::IRenderSystem
+	class IngameLightSystem : public core::ISystem, public core::IRenderSystem, public core::IFramePacketSystem
 	{
 	public:
 		IngameLightSystem(core::Scene& scene);
@@ -15,6 +15,10 @@ namespace  mc
 
 		void operator()(core::Scene& scene, Renderer& renderer, float tick) override;
 
+		// , ߱  ٲٴ  ̶ Extract  ״ ϰ   
+		void Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet) override;
+		void Submit(const core::FramePacket& packet, Renderer& renderer) override {}
+
 	private:
 		void switchPushed(const mc::OnSwitchPushed& event);
 		void handleFlashlight(const mc::OnHandleFlashLight& event);
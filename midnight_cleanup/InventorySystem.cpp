@@ -5,8 +5,10 @@
 #include "McTagsAndLayers.h"
 
 #include <Animacore/Scene.h>
+#include <Animacore/FramePacket.h>
 #include <Animacore/CoreComponents.h>
 #include <Animacore/RenderComponents.h>
+#include <Animacore/AssetResolver.h>
 #include <Animacore/CoreSystemEvents.h>
 
 #include "../Animavision/Renderer.h"
@@ -28,6 +30,11 @@ mc::InventorySystem::~InventorySystem()
 	_dispatcher->disconnect(this);
 }
 
+void mc::InventorySystem::Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet)
+{
+	(*this)(scene, renderer, packet.tick);
+}
+
 void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, float tick)
 {
 	if(!scene.IsPlaying())
@@ -96,7 +103,7 @@ void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, flo
 						else if (_mainInventory->toolType[3] == Tool::Type::FLASHLIGHT)
 							common.textureString = "T_RadialIcon_Flashlight.dds";
 					}
-					common.texture = renderer.GetUITexture(common.textureString);
+					core::AssetResolver::ResolveUITexture(renderer, common);
 				}
 				if (radialUI.type & RadialUI::Type::RIGHT)
 				{
@@ -115,7 +122,7 @@ void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, flo
 						else if (_mainInventory->toolType[1] == Tool::Type::FLASHLIGHT)
 							common.textureString = "T_RadialIcon_Flashlight.dds";
 					}
-					common.texture = renderer.GetUITexture(common.textureString);
+					core::AssetResolver::ResolveUITexture(renderer, common);
 				}
 				if (radialUI.type & RadialUI::Type::TOP)
 				{
@@ -134,7 +141,7 @@ void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, flo
 						else if (_mainInventory->toolType[0] == Tool::Type::FLASHLIGHT)
 							common.textureString = "T_RadialIcon_Flashlight.dds";
 					}
-					common.texture = renderer.GetUITexture(common.textureString);
+					core::AssetResolver::ResolveUITexture(renderer, common);
 				}
 				if (radialUI.type & RadialUI::Type::BOTTOM)
 				{
@@ -153,7 +160,7 @@ void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, flo
 						else if (_mainInventory->toolType[2] == Tool::Type::FLASHLIGHT)
 							common.textureString = "T_RadialIcon_Flashlight.dds";
 					}
-					common.texture = renderer.GetUITexture(common.textureString);
+					core::AssetResolver::ResolveUITexture(renderer, common);
 				}
 			}
 
@@ -238,7 +245,7 @@ void mc::InventorySystem::operator()(core::Scene& scene, Renderer& renderer, flo
 					common.textureString = "T_RadialText_Flashlight.dds";
 				else if (type == Tool::Type::DEFAULT)
 					common.textureString = "T_RadialText_Hand.dds";
-				common.texture = renderer.GetUITexture(common.textureString);
+				core::AssetResolver::ResolveUITexture(renderer, common);
 			}
 
 			// 콺  ư  شϴ  õǾ Ѵ.
@@ -13,7 +13,7 @@ namespace mc
 {
 	struct Inventory;
 
-	class InventorySystem : public core::ISystem, public core::IRenderSystem
+	class InventorySystem : public core::ISystem, public core::IRenderSystem, public core::IFramePacketSystem
 	{
 	public:
 		InventorySystem(core::Scene& scene);
@@ -21,6 +21,10 @@ namespace mc
 
 		void operator()(core::Scene& scene, Renderer& renderer, float tick) override;
 
+		// κ丮 UI Ʈ ϰ ׸ PostRenderSystem  Ŷ ϹǷ   
+		void Extract(core::Scene& scene, Renderer& renderer, core::FramePacket& packet) override;
+		void Submit(const core::FramePacket& packet, Renderer& renderer) override {}
+
 	private:
 		void startSystem(const core::OnStartSystem& event);
 		void finishSystem(const core::OnFinishSystem& event);
@@ -5,6 +5,7 @@
 namespace mc
 {
 	struct Quest;
+	struct DestroyableTrash;
 
 	class TrashSystem : public core::ISystem, public core::IUpdateSystem, public core::ICollisionHandler
 	{
@@ -28,4 +29,5 @@ namespace mc
 }
 
 DEFINE_SYSTEM_TRAITS(mc::TrashSystem)
+DEFINE_SYSTEM_WRITES(mc::TrashSystem, mc::DestroyableTrash, core::access::Context<mc::Quest>, core::access::Structure)
 